@@ -89,9 +89,10 @@ typedef enum ctx_config_key {
   CTX_CONFIG_KEY_ARRAY_SOLVER,
   CTX_CONFIG_KEY_BV_SOLVER,
   CTX_CONFIG_KEY_ARITH_SOLVER,
+  CTX_CONFIG_KEY_THREADS,
 } ctx_config_key_t;
 
-#define NUM_CONFIG_KEYS (CTX_CONFIG_KEY_ARITH_SOLVER+1)
+#define NUM_CONFIG_KEYS (CTX_CONFIG_KEY_THREADS+1)
 
 
 static const char *const config_key_names[NUM_CONFIG_KEYS] = {
@@ -101,6 +102,7 @@ static const char *const config_key_names[NUM_CONFIG_KEYS] = {
   "bv-solver",
   "mode",
   "solver-type",
+  "threads",
   "trace",
   "uf-solver",
 };
@@ -112,6 +114,7 @@ static const int32_t config_key[NUM_CONFIG_KEYS] = {
   CTX_CONFIG_KEY_BV_SOLVER,
   CTX_CONFIG_KEY_MODE,
   CTX_CONFIG_KEY_SOLVER_TYPE,
+  CTX_CONFIG_KEY_THREADS,
   CTX_CONFIG_KEY_TRACE_TAGS,
   CTX_CONFIG_KEY_UF_SOLVER,
 };
@@ -246,6 +249,7 @@ static const ctx_config_t default_config = {
   CTX_CONFIG_DEFAULT,     // arith
   ARITH_LIRA,             // fragment
   NULL,                   // trace tags
+  0,                      // threads
 };
 
 
@@ -400,6 +404,12 @@ int32_t config_set_field(ctx_config_t *config, const char *key, const char *valu
     }
     break;
 
+  case CTX_CONFIG_KEY_THREADS:
+    if (parse_as_uint(value, &config->num_threads) != valid_integer) {
+      r = -2;
+    }
+    break;
+
   default:
     assert(k == -1);
     r = -1;
@@ -106,6 +106,7 @@ struct ctx_config_s {
   solver_code_t         arith_config;
   arith_fragment_t      arith_fragment;
   char*                 trace_tags;
+  uint32_t              num_threads;
 };
 
 
@@ -120,6 +121,7 @@ struct ctx_config_s {
  * - bv_config    = NONE
  * - arith_config = NONE
  * - trace_tags = NULL
+ * - num_threads = 0
  *
  * In this configuration, a context supports propositional logic only.
  */
@@ -145,7 +147,7 @@ extern int32_t config_set_logic(ctx_config_t *config, const char *logic);
  *
  * This can't be used to set config->logic: key must be one of "mode",
  * "arith-fragment", "uf-solver", "array-solver", "bv-solver",
- * "arith-solver" or "trace".
+ * "arith-solver", "trace", or "threads".
  *
  * Return code:
  *   -1 if the key is not recognized
@@ -73,6 +73,7 @@
 #define DEFAULT_CLAUSE_DECAY   CLAUSE_DECAY_FACTOR
 #define DEFAULT_CACHE_TCLAUSES false
 #define DEFAULT_TCLAUSE_SIZE   0
+#define DEFAULT_MEMORY_LIMIT   0
 
 
 /*
@@ -144,6 +145,7 @@ static const param_t default_settings = {
   DEFAULT_CLAUSE_DECAY,
   DEFAULT_CACHE_TCLAUSES,
   DEFAULT_TCLAUSE_SIZE,
+  DEFAULT_MEMORY_LIMIT,
 
   DEFAULT_USE_DYN_ACK,
   DEFAULT_USE_BOOL_DYN_ACK,
@@ -200,6 +202,7 @@ typedef enum param_key {
   PARAM_CLAUSE_DECAY,
   PARAM_CACHE_TCLAUSES,
   PARAM_TCLAUSE_SIZE,
+  PARAM_MEMORY_LIMIT,
   // egraph parameters
   PARAM_DYN_ACK,
   PARAM_DYN_BOOL_ACK,
@@ -249,6 +252,7 @@ static const char *const param_key_names[NUM_PARAM_KEYS] = {
   "max-extensionality",
   "max-interface-eqs",
   "max-update-conflicts",
+  "memory-limit",
   "optimistic-final-check",
   "prop-threshold",
   "r-factor",
@@ -286,6 +290,7 @@ static const int32_t param_code[NUM_PARAM_KEYS] = {
   PARAM_MAX_EXTENSIONALITY,
   PARAM_MAX_INTERFACE_EQS,
   PARAM_MAX_UPDATE_CONFLICTS,
+  PARAM_MEMORY_LIMIT,
   PARAM_OPTIMISTIC_FCHECK,
   PARAM_PROP_THRESHOLD,
   PARAM_R_FACTOR,
@@ -575,6 +580,13 @@ int32_t params_set_field(param_t *parameters, const char *key, const char *value
     }
     break;
 
+  case PARAM_MEMORY_LIMIT:
+    r = set_int32_param(value, &z, 0, INT32_MAX);
+    if (r == 0) {
+      parameters->memory_limit = (uint32_t) z;
+    }
+    break;
+
   case PARAM_DYN_ACK:
     r = set_bool_param(value, &parameters->use_dyn_ack);
     break;
@@ -95,6 +95,14 @@ struct param_s {
    *   in a conflict resolution
    * - parameter tclause_size controls the lemma size: only theory lemmas
    *   of size <= tclause_size are turned into learned clauses
+   *
+   * Memory budget:
+   * - memory_limit is a bound on the memory used by the core (in MB)
+   * - when it's exceeded, the core deletes learned clauses and, if that's
+   *   not enough, the search is interrupted. 0 means no limit.
+   * - only the CDCL(T) core and its theory solvers are covered: memory
+   *   allocated by the bit-blaster's sat solver (bvsolver, new_sat_solver)
+   *   and by MCSAT is not counted.
    */
   double   var_decay;       // decay factor for variable activity
   float    randomness;      // probability of a random pick in select_unassigned_literal
@@ -103,6 +111,7 @@ struct param_s {
   float    clause_decay;    // decay factor for learned-clause activity
   bool     cache_tclauses;
   uint32_t tclause_size;
+  uint32_t memory_limit;
 
   /*
    * EGRAPH PARAMETERS
@@ -74,6 +74,7 @@
 #include "frontend/yices/yices_parser.h"
 
 #include "io/model_printer.h"
+#include "io/term_archive.h"
 #include "io/term_printer.h"
 #include "io/type_printer.h"
 #include "io/yices_pp.h"
@@ -989,6 +990,37 @@ static void delete_fvars(void) {
 
 
 
+/*****************
+ *  LEMMA CACHE  *
+ ****************/
+
+/*
+ * Return the lemma cache
+ * - allocate and initialize it if necessary
+ */
+static lemma_cache_t *get_lemma_cache(void) {
+  if (__yices_globals.lemmas == NULL) {
+    __yices_globals.lemmas = (lemma_cache_t *) safe_malloc(sizeof(lemma_cache_t));
+    init_lemma_cache(__yices_globals.lemmas);
+  }
+
+  return __yices_globals.lemmas;
+}
+
+
+/*
+ * Delete the lemma cache if it exists
+ */
+static void delete_lemmas(void) {
+  if (__yices_globals.lemmas != NULL) {
+    delete_lemma_cache(__yices_globals.lemmas);
+    safe_free(__yices_globals.lemmas);
+    __yices_globals.lemmas = NULL;
+  }
+}
+
+
+
 /***************************************
  *  GLOBAL INITIALIZATION AND CLEANUP  *
  **************************************/
@@ -1016,6 +1048,7 @@ static void init_globals(yices_globals_t *glob) {
   glob->lexer = NULL;
   glob->tstack = NULL;
   glob->fvars = NULL;
+  glob->lemmas = NULL;
 
 #ifdef THREAD_SAFE
   create_yices_lock(&(glob->lock));
@@ -1108,6 +1141,7 @@ EXPORTED void yices_exit(void) {
 
   delete_parsing_objects();
   delete_fvars();
+  delete_lemmas();
 
   delete_term_manager(__yices_globals.manager);
   delete_term_table(__yices_globals.terms);
@@ -6194,6 +6228,338 @@ term_t _o_yices_bvslt_atom(term_t t1, term_t t2) {
 
 
 
+/*****************************
+ *  BATCH TERM CONSTRUCTION  *
+ ****************************/
+
+#define NUM_BATCH_OPS (YICES_BATCH_BVSLT+1)
+
+/*
+ * Number of operands for each opcode (-1 means any number)
+ */
+static const int32_t batch_arity[NUM_BATCH_OPS] = {
+  1,   // YICES_BATCH_TERM
+  1,   // YICES_BATCH_INT32
+  2,   // YICES_BATCH_BVCONST32
+  1,   // YICES_BATCH_NOT
+  -1,  // YICES_BATCH_AND
+  -1,  // YICES_BATCH_OR
+  -1,  // YICES_BATCH_XOR
+  2,   // YICES_BATCH_IFF
+  2,   // YICES_BATCH_IMPLIES
+  3,   // YICES_BATCH_ITE
+  2,   // YICES_BATCH_EQ
+  2,   // YICES_BATCH_NEQ
+  -1,  // YICES_BATCH_DISTINCT
+  -1,  // YICES_BATCH_APP
+  -1,  // YICES_BATCH_ADD
+  2,   // YICES_BATCH_SUB
+  1,   // YICES_BATCH_NEG
+  -1,  // YICES_BATCH_MUL
+  2,   // YICES_BATCH_ARITH_EQ
+  2,   // YICES_BATCH_ARITH_NEQ
+  2,   // YICES_BATCH_ARITH_GEQ
+  2,   // YICES_BATCH_ARITH_GT
+  2,   // YICES_BATCH_ARITH_LEQ
+  2,   // YICES_BATCH_ARITH_LT
+  -1,  // YICES_BATCH_BVADD
+  2,   // YICES_BATCH_BVSUB
+  1,   // YICES_BATCH_BVNEG
+  -1,  // YICES_BATCH_BVMUL
+  2,   // YICES_BATCH_BVDIV
+  2,   // YICES_BATCH_BVREM
+  1,   // YICES_BATCH_BVNOT
+  -1,  // YICES_BATCH_BVAND
+  -1,  // YICES_BATCH_BVOR
+  -1,  // YICES_BATCH_BVXOR
+  2,   // YICES_BATCH_BVSHL
+  2,   // YICES_BATCH_BVLSHR
+  2,   // YICES_BATCH_BVASHR
+  -1,  // YICES_BATCH_BVCONCAT
+  3,   // YICES_BATCH_BVEXTRACT
+  2,   // YICES_BATCH_BVEQ
+  2,   // YICES_BATCH_BVNEQ
+  2,   // YICES_BATCH_BVGE
+  2,   // YICES_BATCH_BVGT
+  2,   // YICES_BATCH_BVLE
+  2,   // YICES_BATCH_BVLT
+  2,   // YICES_BATCH_BVSGE
+  2,   // YICES_BATCH_BVSGT
+  2,   // YICES_BATCH_BVSLE
+  2,   // YICES_BATCH_BVSLT
+};
+
+
+/*
+ * Number of operands of instruction [op, n, ...] that are node indices
+ */
+static uint32_t batch_node_operands(int32_t op, uint32_t n) {
+  switch (op) {
+  case YICES_BATCH_TERM:
+  case YICES_BATCH_INT32:
+  case YICES_BATCH_BVCONST32:
+    return 0;
+
+  case YICES_BATCH_BVEXTRACT:
+    return 1;
+
+  default:
+    return n;
+  }
+}
+
+
+/*
+ * Report an error in instruction that starts at code[i]
+ */
+static void batch_error(uint32_t i) {
+  error_report_t *error;
+
+  error = get_yices_error();
+  error->code = INVALID_BATCH_CODE;
+  error->badval = i;
+}
+
+
+/*
+ * Structural check of code[0 ... size-1]:
+ * - every instruction must have a valid opcode and arity and fit in the array
+ * - node operands must refer to earlier instructions
+ * - there must be at least one instruction
+ * This doesn't check types or the leaves: that's done when the nodes are built.
+ *
+ * Return the number of nodes if the code is well formed, or -1 otherwise.
+ */
+static int32_t check_batch_code(const int32_t *code, uint32_t size) {
+  uint32_t i, j, n, k, nodes;
+  int32_t op;
+
+  nodes = 0;
+  i = 0;
+  while (i < size) {
+    if (size - i < 2 || code[i] < 0 || code[i] >= NUM_BATCH_OPS || code[i+1] < 0) {
+      goto error;
+    }
+    op = code[i];
+    n = (uint32_t) code[i+1];
+    if (n > size - i - 2 || (batch_arity[op] >= 0 && n != (uint32_t) batch_arity[op]) ||
+        (op == YICES_BATCH_APP && n == 0)) {
+      goto error;
+    }
+    k = batch_node_operands(op, n);
+    for (j=0; j<k; j++) {
+      if (code[i+2+j] < 0 || code[i+2+j] >= nodes) {
+        goto error;
+      }
+    }
+    if (nodes == (uint32_t) INT32_MAX) {
+      goto error;
+    }
+    nodes ++;
+    i += n + 2;
+  }
+
+  if (nodes == 0) {
+    goto error;
+  }
+
+  return nodes;
+
+ error:
+  batch_error(i);
+  return -1;
+}
+
+
+/*
+ * Build the node for instruction [op, n, a[0], ..., a[n-1]]
+ * - v = vector of nodes built so far
+ * - args = auxiliary vector
+ * - return NULL_TERM if the node can't be built (the error
+ *   is set by the constructor)
+ */
+static term_t build_batch_node(int32_t op, uint32_t n, const int32_t *a, ivector_t *v, ivector_t *args) {
+  term_t *t;
+  uint32_t i;
+
+  ivector_reset(args);
+  n = batch_node_operands(op, n);
+  for (i=0; i<n; i++) {
+    ivector_push(args, v->data[a[i]]);
+  }
+  t = args->data;
+
+  switch (op) {
+  case YICES_BATCH_TERM:
+    return check_good_term(__yices_globals.manager, a[0]) ? a[0] : NULL_TERM;
+  case YICES_BATCH_INT32:
+    return _o_yices_int32(a[0]);
+  case YICES_BATCH_BVCONST32:
+    return _o_yices_bvconst_uint32((uint32_t) a[0], (uint32_t) a[1]);
+
+  case YICES_BATCH_NOT:
+    return _o_yices_not(t[0]);
+  case YICES_BATCH_AND:
+    return _o_yices_and(n, t);
+  case YICES_BATCH_OR:
+    return _o_yices_or(n, t);
+  case YICES_BATCH_XOR:
+    return _o_yices_xor(n, t);
+  case YICES_BATCH_IFF:
+    return _o_yices_iff(t[0], t[1]);
+  case YICES_BATCH_IMPLIES:
+    return _o_yices_implies(t[0], t[1]);
+  case YICES_BATCH_ITE:
+    return _o_yices_ite(t[0], t[1], t[2]);
+  case YICES_BATCH_EQ:
+    return _o_yices_eq(t[0], t[1]);
+  case YICES_BATCH_NEQ:
+    return _o_yices_neq(t[0], t[1]);
+  case YICES_BATCH_DISTINCT:
+    return _o_yices_distinct(n, t);
+  case YICES_BATCH_APP:
+    return _o_yices_application(t[0], n-1, t+1);
+
+  case YICES_BATCH_ADD:
+    return _o_yices_sum(n, t);
+  case YICES_BATCH_SUB:
+    return _o_yices_sub(t[0], t[1]);
+  case YICES_BATCH_NEG:
+    return _o_yices_neg(t[0]);
+  case YICES_BATCH_MUL:
+    return _o_yices_product(n, t);
+  case YICES_BATCH_ARITH_EQ:
+    return _o_yices_arith_eq_atom(t[0], t[1]);
+  case YICES_BATCH_ARITH_NEQ:
+    return _o_yices_arith_neq_atom(t[0], t[1]);
+  case YICES_BATCH_ARITH_GEQ:
+    return _o_yices_arith_geq_atom(t[0], t[1]);
+  case YICES_BATCH_ARITH_GT:
+    return _o_yices_arith_gt_atom(t[0], t[1]);
+  case YICES_BATCH_ARITH_LEQ:
+    return _o_yices_arith_leq_atom(t[0], t[1]);
+  case YICES_BATCH_ARITH_LT:
+    return _o_yices_arith_lt_atom(t[0], t[1]);
+
+  case YICES_BATCH_BVADD:
+    return _o_yices_bvsum(n, t);
+  case YICES_BATCH_BVSUB:
+    return _o_yices_bvsub(t[0], t[1]);
+  case YICES_BATCH_BVNEG:
+    return _o_yices_bvneg(t[0]);
+  case YICES_BATCH_BVMUL:
+    return _o_yices_bvproduct(n, t);
+  case YICES_BATCH_BVDIV:
+    return _o_yices_bvdiv(t[0], t[1]);
+  case YICES_BATCH_BVREM:
+    return _o_yices_bvrem(t[0], t[1]);
+  case YICES_BATCH_BVNOT:
+    return _o_yices_bvnot(t[0]);
+  case YICES_BATCH_BVAND:
+    return _o_yices_bvand(n, t);
+  case YICES_BATCH_BVOR:
+    return _o_yices_bvor(n, t);
+  case YICES_BATCH_BVXOR:
+    return _o_yices_bvxor(n, t);
+  case YICES_BATCH_BVSHL:
+    return _o_yices_bvshl(t[0], t[1]);
+  case YICES_BATCH_BVLSHR:
+    return _o_yices_bvlshr(t[0], t[1]);
+  case YICES_BATCH_BVASHR:
+    return _o_yices_bvashr(t[0], t[1]);
+  case YICES_BATCH_BVCONCAT:
+    return _o_yices_bvconcat(n, t);
+  case YICES_BATCH_BVEXTRACT:
+    return _o_yices_bvextract(t[0], (uint32_t) a[1], (uint32_t) a[2]);
+  case YICES_BATCH_BVEQ:
+    return _o_yices_bveq_atom(t[0], t[1]);
+  case YICES_BATCH_BVNEQ:
+    return _o_yices_bvneq_atom(t[0], t[1]);
+  case YICES_BATCH_BVGE:
+    return _o_yices_bvge_atom(t[0], t[1]);
+  case YICES_BATCH_BVGT:
+    return _o_yices_bvgt_atom(t[0], t[1]);
+  case YICES_BATCH_BVLE:
+    return _o_yices_bvle_atom(t[0], t[1]);
+  case YICES_BATCH_BVLT:
+    return _o_yices_bvlt_atom(t[0], t[1]);
+  case YICES_BATCH_BVSGE:
+    return _o_yices_bvsge_atom(t[0], t[1]);
+  case YICES_BATCH_BVSGT:
+    return _o_yices_bvsgt_atom(t[0], t[1]);
+  case YICES_BATCH_BVSLE:
+    return _o_yices_bvsle_atom(t[0], t[1]);
+  case YICES_BATCH_BVSLT:
+    return _o_yices_bvslt_atom(t[0], t[1]);
+
+  default:
+    assert(false);
+    return NULL_TERM;
+  }
+}
+
+
+/*
+ * Build all the terms encoded in code[0 ... size-1]
+ * - return the last node or NULL_TERM if there's an error
+ * - if nodes is non-NULL, all the nodes are stored in it
+ *   (nodes->data[i] = term for the i-th instruction)
+ *
+ * Everything is done with a single lock acquisition.
+ */
+EXPORTED term_t yices_build_terms(uint32_t size, const int32_t code[], term_vector_t *nodes) {
+  MT_PROTECT(term_t, __yices_globals.lock, _o_yices_build_terms(size, code, nodes));
+}
+
+term_t _o_yices_build_terms(uint32_t size, const int32_t code[], term_vector_t *nodes) {
+  ivector_t aux, args;
+  ivector_t *v;
+  term_t t;
+  int32_t n;
+  uint32_t i;
+
+  if (nodes != NULL) {
+    yices_reset_term_vector(nodes);
+  }
+
+  n = check_batch_code(code, size);
+  if (n < 0) {
+    return NULL_TERM;
+  }
+
+  v = (ivector_t *) nodes;
+  if (v == NULL) {
+    init_ivector(&aux, n);
+    v = &aux;
+  } else {
+    resize_ivector(v, n);
+  }
+  init_ivector(&args, 10);
+
+  t = NULL_TERM;
+  i = 0;
+  while (i < size) {
+    t = build_batch_node(code[i], code[i+1], code + i + 2, v, &args);
+    if (t == NULL_TERM) {
+      // the constructor has set the error code: add the node index
+      get_yices_error()->badval = v->size;
+      ivector_reset(v);
+      break;
+    }
+    ivector_push(v, t);
+    i += code[i+1] + 2;
+  }
+
+  delete_ivector(&args);
+  if (v == &aux) {
+    delete_ivector(&aux);
+  }
+
+  return t;
+}
+
+
+
 /*********************
  *  PRETTY PRINTING  *
  ********************/
@@ -7999,9 +8365,11 @@ typedef enum ctx_option {
   CTX_OPTION_KEEP_ITE,
   CTX_OPTION_EAGER_ARITH_LEMMAS,
   CTX_OPTION_ASSERT_ITE_BOUNDS,
+  CTX_OPTION_LEMMA_CACHE,
+  CTX_OPTION_LOG_ASSERTIONS,
 } ctx_option_t;
 
-#define NUM_CTX_OPTIONS (CTX_OPTION_ASSERT_ITE_BOUNDS+1)
+#define NUM_CTX_OPTIONS (CTX_OPTION_LOG_ASSERTIONS+1)
 
 
 /*
@@ -8016,6 +8384,8 @@ static const char * const ctx_option_names[NUM_CTX_OPTIONS] = {
   "flatten",
   "keep-ite",
   "learn-eq",
+  "lemma-cache",
+  "log-assertions",
   "var-elim",
 };
 
@@ -8032,6 +8402,8 @@ static const int32_t ctx_option_key[NUM_CTX_OPTIONS] = {
   CTX_OPTION_FLATTEN,
   CTX_OPTION_KEEP_ITE,
   CTX_OPTION_LEARN_EQ,
+  CTX_OPTION_LEMMA_CACHE,
+  CTX_OPTION_LOG_ASSERTIONS,
   CTX_OPTION_VAR_ELIM,
 };
 
@@ -8081,6 +8453,19 @@ EXPORTED int32_t yices_context_enable_option(context_t *ctx, const char *option)
     enable_assert_ite_bounds(ctx);
     break;
 
+  case CTX_OPTION_LEMMA_CACHE:
+    if (ctx->mcsat != NULL) {
+      set_error_code(CTX_OPERATION_NOT_SUPPORTED);
+      r = -1;
+    } else {
+      (void) context_get_lemma_exchange(ctx);
+    }
+    break;
+
+  case CTX_OPTION_LOG_ASSERTIONS:
+    enable_assertion_log(ctx);
+    break;
+
   default:
     assert(k == -1);
     // not recognized
@@ -8138,6 +8523,14 @@ EXPORTED int32_t yices_context_disable_option(context_t *ctx, const char *option
     disable_assert_ite_bounds(ctx);
     break;
 
+  case CTX_OPTION_LEMMA_CACHE:
+    context_free_lemma_exchange(ctx);
+    break;
+
+  case CTX_OPTION_LOG_ASSERTIONS:
+    disable_assertion_log(ctx);
+    break;
+
   default:
     set_error_code(CTX_UNKNOWN_PARAMETER);
     r = -1;
@@ -8346,6 +8739,10 @@ context_t *_o_yices_new_context(const ctx_config_t *config) {
     context_set_trace(ctx, trace);
   }
 
+  if (config != NULL) {
+    context_set_num_threads(ctx, config->num_threads);
+  }
+
   return ctx;
 }
 
@@ -8368,6 +8765,15 @@ EXPORTED smt_status_t yices_context_status(context_t *ctx) {
 }
 
 
+/*
+ * Check whether the last search was interrupted because ctx
+ * exceeded its memory budget: return 1 if so, 0 otherwise.
+ */
+EXPORTED int32_t yices_context_memout(context_t *ctx) {
+  return context_memout(ctx);
+}
+
+
 /*
  * Reset: remove all assertions and restore ctx's status to IDLE
  */
@@ -8529,6 +8935,51 @@ void yices_internalization_error(int32_t code) {
 }
 
 
+
+/*
+ * Clone ctx
+ * - the new context is allocated and configured with the lock held,
+ *   then the assertions are replayed (assert_formulas takes the lock)
+ */
+static context_t *yices_clone_context_config(context_t *ctx) {
+  MT_PROTECT(context_t *, __yices_globals.lock, _o_yices_clone_context_config(ctx));
+}
+
+context_t *_o_yices_clone_context_config(context_t *ctx) {
+  context_t *clone;
+
+  clone = alloc_context();
+  init_context_copy(clone, ctx);
+
+  return clone;
+}
+
+EXPORTED context_t *yices_clone_context(context_t *ctx) {
+  context_t *clone;
+  int32_t code;
+
+  if (context_status(ctx) == STATUS_SEARCHING) {
+    set_error_code(CTX_INVALID_OPERATION);
+    return NULL;
+  }
+  if (! context_can_be_cloned(ctx)) {
+    set_error_code(CTX_OPERATION_NOT_SUPPORTED);
+    return NULL;
+  }
+
+  clone = yices_clone_context_config(ctx);
+  code = context_replay_assertions(clone, ctx);
+  if (code < 0) {
+    convert_internalization_error(code);
+    yices_free_context(clone);
+    return NULL;
+  }
+  assert(code == TRIVIALLY_UNSAT || code == CTX_NO_ERROR);
+
+  return clone;
+}
+
+
 /*
  * Assert formula t in ctx
  * - ctx status must be IDLE or UNSAT or SAT or UNKNOWN
@@ -8868,6 +9319,240 @@ EXPORTED void yices_default_params_for_context(const context_t *ctx, param_t *pa
 
 
 
+/*
+ * LEMMA CACHE SUPPORT
+ */
+
+/*
+ * Add the cached lemmas to ctx before a search
+ */
+static void import_cached_lemmas(context_t *ctx) {
+  yices_obtain_mutex();
+  (void) context_import_lemmas(ctx, get_lemma_cache());
+  yices_release_mutex();
+}
+
+
+/*
+ * Initialize a context to check the validity of candidate lemmas
+ * - it uses the same solvers as ctx but the difference-logic solvers
+ *   are replaced by simplex since they don't support push/pop
+ * - each check is bounded by MAX_LEMMA_VALIDATION_CONFLICTS
+ */
+static void init_lemma_checker(context_t *checker, param_t *params, context_t *ctx) {
+  context_arch_t arch;
+
+  arch = ctx->arch;
+  if (arch == CTX_ARCH_AUTO_IDL || arch == CTX_ARCH_AUTO_RDL ||
+      arch == CTX_ARCH_IFW || arch == CTX_ARCH_RFW) {
+    arch = CTX_ARCH_SPLX;
+  }
+  yices_obtain_mutex();
+  init_context(checker, __yices_globals.terms, ctx->logic, CTX_MODE_PUSHPOP, arch, false);
+  context_set_default_options(checker, ctx->logic, arch, true, false);
+  yices_release_mutex();
+  yices_set_default_params(params, ctx->logic, arch, CTX_MODE_PUSHPOP);
+  if (checker->core != NULL) {
+    set_conflict_limit(checker->core, MAX_LEMMA_VALIDATION_CONFLICTS);
+  }
+}
+
+
+/*
+ * Result of a validity check
+ * - LEMMA_UNSUPPORTED means that the checker can't process the clause
+ *   (e.g., the clause contains atoms of a theory the checker doesn't support)
+ * - LEMMA_INVALID means that the clause is not valid or that the check
+ *   was stopped by the conflict budget
+ */
+typedef enum lemma_check {
+  LEMMA_VALID,
+  LEMMA_INVALID,
+  LEMMA_UNSUPPORTED,
+} lemma_check_t;
+
+
+/*
+ * Check whether clause a[0 ... n-1] is valid: assert the negation
+ * of all the literals in a new scope of checker and check for UNSAT.
+ */
+static lemma_check_t check_lemma(context_t *checker, const param_t *params, uint32_t n, const term_t *a) {
+  term_t neg[MAX_CACHED_LEMMA_LENGTH];
+  int32_t code;
+  uint32_t i;
+  lemma_check_t result;
+
+  assert(n <= MAX_CACHED_LEMMA_LENGTH);
+
+  for (i=0; i<n; i++) {
+    neg[i] = opposite_term(a[i]);
+  }
+
+  context_push(checker);
+  code = assert_formulas(checker, n, neg);
+  if (code == TRIVIALLY_UNSAT) {
+    result = LEMMA_VALID;
+  } else if (code < 0) {
+    result = LEMMA_UNSUPPORTED;
+  } else if (check_context(checker, params) == STATUS_UNSAT) {
+    result = LEMMA_VALID;
+  } else {
+    result = LEMMA_INVALID;
+  }
+
+  // restore the checker to its initial state (as in yices_pop)
+  switch (context_status(checker)) {
+  case STATUS_UNKNOWN:
+  case STATUS_SAT:
+  case STATUS_INTERRUPTED:
+    context_clear(checker);
+    break;
+
+  case STATUS_UNSAT:
+    context_clear_unsat(checker);
+    break;
+
+  default:
+    break;
+  }
+  context_pop(checker);
+
+  return result;
+}
+
+
+/*
+ * Check the clauses stored in v (each clause is terminated by NULL_TERM)
+ * then move them to the cache or to the rejected set.
+ * - epoch = epoch of the cache when the clauses were collected: if the
+ *   cache is reset in the meantime, the results are dropped
+ * - the checks are done without holding the global lock: the checker
+ *   takes it when needed (e.g., in the egraph's final check)
+ */
+static void validate_lemmas(context_t *ctx, ivector_t *v, uint32_t epoch) {
+  lemma_cache_t *cache;
+  context_t checker;
+  param_t params;
+  ivector_t results;
+  uint32_t i, j, k;
+
+  if (v->size == 0) return;
+
+  init_ivector(&results, 0);
+  init_lemma_checker(&checker, &params, ctx);
+  j = 0;
+  for (i=0; i<v->size; i++) {
+    if (v->data[i] == NULL_TERM) {
+      ivector_push(&results, check_lemma(&checker, &params, i - j, v->data + j));
+      j = i+1;
+    }
+  }
+  delete_context(&checker);
+
+  yices_obtain_mutex();
+  cache = get_lemma_cache();
+  if (cache->epoch == epoch) {
+    j = 0;
+    k = 0;
+    for (i=0; i<v->size; i++) {
+      if (v->data[i] == NULL_TERM) {
+        switch (results.data[k]) {
+        case LEMMA_VALID:
+          lemma_cache_remove_pending(cache, i - j, v->data + j);
+          lemma_cache_add(cache, i - j, v->data + j);
+          break;
+
+        case LEMMA_INVALID:
+          lemma_cache_remove_pending(cache, i - j, v->data + j);
+          lemma_cache_reject(cache, i - j, v->data + j);
+          break;
+
+        default:
+          // keep it pending if it was
+          break;
+        }
+        k ++;
+        j = i+1;
+      }
+    }
+  }
+  yices_release_mutex();
+
+  delete_ivector(&results);
+}
+
+
+/*
+ * Check the pending clauses of the cache before they can be imported
+ * - at most MAX_LEMMA_VALIDATIONS of them
+ * - the pending clauses stay in the cache while they are checked
+ *   so that the garbage collector keeps their terms
+ */
+static void validate_pending_lemmas(context_t *ctx) {
+  lemma_cache_t *cache;
+  ivector_t v;
+  uint32_t epoch;
+
+  init_ivector(&v, 0);
+
+  yices_obtain_mutex();
+  cache = get_lemma_cache();
+  epoch = cache->epoch;
+  lemma_cache_collect_pending(cache, &v, MAX_LEMMA_VALIDATIONS);
+  yices_release_mutex();
+
+  validate_lemmas(ctx, &v, epoch);
+  delete_ivector(&v);
+}
+
+
+/*
+ * Export the lemmas of ctx to the cache after a search
+ * - the candidates that are neither cached nor rejected yet are checked
+ *   (at most MAX_LEMMA_VALIDATIONS of them)
+ */
+static void export_lemmas(context_t *ctx) {
+  lemma_cache_t *cache;
+  ivector_t v;
+  term_t *a;
+  uint32_t i, j, k, m, n, epoch, count;
+
+  init_ivector(&v, 0);
+
+  // collect the new candidates: keep them in v[0 ... k-1]
+  yices_obtain_mutex();
+  cache = get_lemma_cache();
+  epoch = cache->epoch;
+  context_collect_lemmas(ctx, &v);
+  count = 0;
+  j = 0;
+  k = 0;
+  for (i=0; i<v.size && count < MAX_LEMMA_VALIDATIONS; i++) {
+    if (v.data[i] == NULL_TERM) {
+      a = v.data + j;
+      n = i - j;
+      j = i+1;
+      if (! lemma_cache_member(cache, n, a) && ! lemma_cache_rejected(cache, n, a)) {
+        // k <= a - v.data so this is safe
+        for (m=0; m<n; m++) {
+          v.data[k] = a[m];
+          k ++;
+        }
+        v.data[k] = NULL_TERM;
+        k ++;
+        count ++;
+      }
+    }
+  }
+  ivector_shrink(&v, k);
+  yices_release_mutex();
+
+  validate_lemmas(ctx, &v, epoch);
+  delete_ivector(&v);
+}
+
+
+
 /*
  * Check satisfiability: check whether the assertions stored in ctx
  * are satisfiable.
@@ -8923,10 +9608,17 @@ EXPORTED smt_status_t yices_check_context(context_t *ctx, const param_t *params)
       yices_default_params_for_context(ctx, &default_params);
       params = &default_params;
     }
+    if (context_lemma_cache_enabled(ctx)) {
+      validate_pending_lemmas(ctx);
+      import_cached_lemmas(ctx);
+    }
     stat = check_context(ctx, params);
     if (stat == STATUS_INTERRUPTED && context_supports_cleaninterrupt(ctx)) {
       context_cleanup(ctx);
     }
+    if (context_lemma_cache_enabled(ctx) && stat != STATUS_INTERRUPTED) {
+      export_lemmas(ctx);
+    }
     break;
 
   case STATUS_SEARCHING:
@@ -10055,6 +10747,200 @@ EXPORTED int32_t yices_export_formulas_to_dimacs(const term_t f[], uint32_t n, c
 
 
 
+/*******************
+ *  TERM ARCHIVES  *
+ ******************/
+
+/*
+ * Save terms t[0 ... n-1] and their dependencies in file filename
+ * - return 0 if the archive was written, -1 otherwise
+ */
+EXPORTED int32_t yices_save_terms(const char *filename, uint32_t n, const term_t t[]) {
+  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_save_terms(filename, n, t));
+}
+
+int32_t _o_yices_save_terms(const char *filename, uint32_t n, const term_t t[]) {
+  error_report_t *error;
+  term_t bad;
+  int32_t code;
+
+  if (! check_good_terms(__yices_globals.manager, n, t)) {
+    return -1;
+  }
+
+  code = save_term_archive(__yices_globals.manager, filename, n, t, &bad);
+  switch (code) {
+  case TERM_ARCHIVE_OK:
+    return 0;
+
+  case TERM_ARCHIVE_UNSUPPORTED:
+    error = get_yices_error();
+    error->code = ARCHIVE_UNSUPPORTED_TERM;
+    error->term1 = bad;
+    break;
+
+  default:
+    file_output_error();
+    break;
+  }
+
+  return -1;
+}
+
+
+/*
+ * Load archive filename and store its terms in v
+ * - return 0 if the archive was loaded, -1 otherwise
+ */
+EXPORTED int32_t yices_load_terms(const char *filename, term_vector_t *v) {
+  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_load_terms(filename, v));
+}
+
+int32_t _o_yices_load_terms(const char *filename, term_vector_t *v) {
+  int32_t code;
+
+  yices_reset_term_vector(v);
+  code = load_term_archive(__yices_globals.manager, filename, (ivector_t *) v);
+  switch (code) {
+  case TERM_ARCHIVE_OK:
+    return 0;
+
+  case TERM_ARCHIVE_OPEN_ERROR:
+  case TERM_ARCHIVE_IO_ERROR:
+    set_error_code(INPUT_ERROR);
+    break;
+
+  default:
+    set_error_code(ARCHIVE_FORMAT_ERROR);
+    break;
+  }
+
+  return -1;
+}
+
+
+
+/*****************
+ *  LEMMA CACHE  *
+ ****************/
+
+/*
+ * Set the memory limit (in MB)
+ */
+EXPORTED void yices_set_lemma_cache_limit(uint32_t mb) {
+  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_set_lemma_cache_limit(mb));
+}
+
+void _o_yices_set_lemma_cache_limit(uint32_t mb) {
+  lemma_cache_set_limit(get_lemma_cache(), mb);
+}
+
+
+/*
+ * Number of clauses
+ */
+EXPORTED uint32_t yices_lemma_cache_size(void) {
+  MT_PROTECT(uint32_t, __yices_globals.lock, _o_yices_lemma_cache_size());
+}
+
+uint32_t _o_yices_lemma_cache_size(void) {
+  if (__yices_globals.lemmas == NULL) {
+    return 0;
+  }
+  return lemma_cache_num_clauses(__yices_globals.lemmas);
+}
+
+
+/*
+ * Remove all clauses
+ */
+EXPORTED void yices_reset_lemma_cache(void) {
+  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_reset_lemma_cache());
+}
+
+void _o_yices_reset_lemma_cache(void) {
+  if (__yices_globals.lemmas != NULL) {
+    reset_lemma_cache(__yices_globals.lemmas);
+  }
+}
+
+
+/*
+ * Save the cache in a term archive: each clause is followed by true_term
+ */
+EXPORTED int32_t yices_save_lemma_cache(const char *filename) {
+  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_save_lemma_cache(filename));
+}
+
+int32_t _o_yices_save_lemma_cache(const char *filename) {
+  ivector_t v;
+  term_t bad;
+  int32_t code;
+
+  init_ivector(&v, 0);
+  if (__yices_globals.lemmas != NULL) {
+    lemma_cache_flatten(__yices_globals.lemmas, &v);
+  }
+  code = save_term_archive(__yices_globals.manager, filename, v.size, v.data, &bad);
+  delete_ivector(&v);
+
+  // the cache contains only Boolean atoms so TERM_ARCHIVE_UNSUPPORTED is unlikely
+  if (code != TERM_ARCHIVE_OK) {
+    file_output_error();
+    return -1;
+  }
+
+  return 0;
+}
+
+
+/*
+ * Load clauses saved by yices_save_lemma_cache
+ */
+EXPORTED int32_t yices_load_lemma_cache(const char *filename) {
+  MT_PROTECT(int32_t, __yices_globals.lock, _o_yices_load_lemma_cache(filename));
+}
+
+int32_t _o_yices_load_lemma_cache(const char *filename) {
+  ivector_t v;
+  int32_t code;
+  uint32_t i;
+
+  init_ivector(&v, 0);
+  code = load_term_archive(__yices_globals.manager, filename, &v);
+  switch (code) {
+  case TERM_ARCHIVE_OK:
+    // all terms must be Boolean
+    for (i=0; i<v.size; i++) {
+      if (! is_boolean_term(__yices_globals.terms, v.data[i])) {
+        set_error_code(ARCHIVE_FORMAT_ERROR);
+        code = -1;
+        goto done;
+      }
+    }
+    code = lemma_cache_add_flattened(get_lemma_cache(), v.size, v.data);
+    break;
+
+  case TERM_ARCHIVE_OPEN_ERROR:
+  case TERM_ARCHIVE_IO_ERROR:
+    set_error_code(INPUT_ERROR);
+    code = -1;
+    break;
+
+  default:
+    set_error_code(ARCHIVE_FORMAT_ERROR);
+    code = -1;
+    break;
+  }
+
+ done:
+  delete_ivector(&v);
+
+  return code;
+}
+
+
+
 /************************
  *  VALUES IN A MODEL   *
  ***********************/
@@ -10551,6 +11437,47 @@ int32_t _o_yices_get_value(model_t *mdl, term_t t, yval_t *val) {
 }
 
 
+/*
+ * Values of a[0 ... n-1] as node descriptors
+ * - the terms are evaluated by evaluate_term_array: they share the
+ *   model's evaluation cache.
+ */
+EXPORTED int32_t yices_get_values(model_t *mdl, uint32_t n, const term_t a[], yval_t val[]) {
+  MT_PROTECT(int32_t,  __yices_globals.lock, _o_yices_get_values(mdl, n, a, val));
+}
+
+int32_t _o_yices_get_values(model_t *mdl, uint32_t n, const term_t a[], yval_t val[]) {
+  value_table_t *vtbl;
+  value_t *b;
+  int32_t eval_code;
+  uint32_t i;
+
+  if (! check_good_terms(__yices_globals.manager, n, a)) {
+    return -1;
+  }
+
+  if (n == 0) {
+    return 0;
+  }
+
+  b = (value_t *) safe_malloc(n * sizeof(value_t));
+  eval_code = evaluate_term_array(mdl, n, a, b);
+  if (eval_code < 0) {
+    safe_free(b);
+    set_error_code(yices_eval_error(eval_code));
+    return -1;
+  }
+
+  vtbl = model_get_vtbl(mdl);
+  for (i=0; i<n; i++) {
+    get_yval(vtbl, b[i], val + i);
+  }
+  safe_free(b);
+
+  return 0;
+}
+
+
 /*
  * Queries on the value of a rational node
  */
@@ -11765,14 +12692,14 @@ EXPORTED void yices_garbage_collect(const term_t t[], uint32_t nt,
   MT_PROTECT_VOID(__yices_globals.lock, _o_yices_garbage_collect(t, nt, tau, ntau, keep_named));
 }
 
-void _o_yices_garbage_collect(const term_t t[], uint32_t nt,
-                              const type_t tau[], uint32_t ntau,
-                              int32_t keep_named) {
-  bool keep;
-
-
-  get_list_locks();
-
+/*
+ * Mark the roots for the garbage collectors:
+ * - all terms and types in all live models and contexts
+ * - terms in t[0 ... nt-1] and types in tau[0 ... ntau-1]
+ * - all terms and types with a positive reference count
+ * - all terms in the lemma cache
+ */
+static void mark_gc_roots(const term_t t[], uint32_t nt, const type_t tau[], uint32_t ntau) {
   /*
    * Default roots: all terms and types in all live models and context
    */
@@ -11795,6 +12722,24 @@ void _o_yices_garbage_collect(const term_t t[], uint32_t nt,
     sparse_array_iterate(root_types, __yices_globals.types, type_marker);
   }
 
+  /*
+   * Terms in the lemma cache
+   */
+  if (__yices_globals.lemmas != NULL) {
+    lemma_cache_gc_mark(__yices_globals.lemmas, __yices_globals.terms);
+  }
+}
+
+void _o_yices_garbage_collect(const term_t t[], uint32_t nt,
+                              const type_t tau[], uint32_t ntau,
+                              int32_t keep_named) {
+  bool keep;
+
+
+  get_list_locks();
+
+  mark_gc_roots(t, nt, tau, ntau);
+
   /*
    * Call the garbage collector
    */
@@ -11811,3 +12756,63 @@ void _o_yices_garbage_collect(const term_t t[], uint32_t nt,
   release_list_locks();
 
 }
+
+
+/*
+ * Young-generation collection: only the terms created since the
+ * last garbage collection can be deleted.
+ * - t = optional array of terms
+ * - nt = size of t
+ * - keep_named specifies whether the named terms should be preserved
+ */
+EXPORTED void yices_garbage_collect_young(const term_t t[], uint32_t nt, int32_t keep_named) {
+  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_garbage_collect_young(t, nt, keep_named));
+}
+
+void _o_yices_garbage_collect_young(const term_t t[], uint32_t nt, int32_t keep_named) {
+  bool keep;
+
+  get_list_locks();
+
+  mark_gc_roots(t, nt, NULL, 0);
+
+  keep = (keep_named != 0);
+  term_table_young_gc(__yices_globals.terms, keep);
+
+  if (__yices_globals.fvars != NULL) {
+    cleanup_fvar_collector(__yices_globals.fvars);
+  }
+
+  release_list_locks();
+}
+
+
+/*
+ * Number of terms created since the last garbage collection
+ */
+EXPORTED uint32_t yices_num_young_terms(void) {
+  MT_PROTECT(uint32_t, __yices_globals.lock, _o_yices_num_young_terms());
+}
+
+uint32_t _o_yices_num_young_terms(void) {
+  return __yices_globals.terms->young_terms;
+}
+
+
+/*
+ * Garbage-collection statistics
+ */
+EXPORTED void yices_get_gc_stats(yices_gc_stats_t *stats) {
+  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_get_gc_stats(stats));
+}
+
+void _o_yices_get_gc_stats(yices_gc_stats_t *stats) {
+  term_gc_stats_t *s;
+
+  s = &__yices_globals.terms->gc_stats;
+  stats->full_collections = s->full_collections;
+  stats->young_collections = s->young_collections;
+  stats->terms_reclaimed = s->terms_reclaimed;
+  stats->types_reclaimed = s->types_reclaimed;
+  stats->bytes_reclaimed = s->bytes_reclaimed;
+}
@@ -393,6 +393,13 @@ extern term_t _o_yices_bvsle_atom(term_t t1, term_t t2);
 extern term_t _o_yices_bvslt_atom(term_t t1, term_t t2);
 
 
+/*****************************
+ *  BATCH TERM CONSTRUCTION  *
+ ****************************/
+
+extern term_t _o_yices_build_terms(uint32_t size, const int32_t code[], term_vector_t *nodes);
+
+
 /*********************
  *  PRETTY PRINTING  *
  ********************/
@@ -573,6 +580,8 @@ extern int32_t _o_yices_clear_term_name(term_t t);
 
 extern context_t *_o_yices_new_context(const ctx_config_t *config);
 
+extern context_t *_o_yices_clone_context_config(context_t *ctx);
+
 //iam: this one is defined in context.c
 extern int32_t _o_assert_formulas(context_t *ctx, uint32_t n, const term_t *f);
 
@@ -633,6 +642,7 @@ extern int32_t _o_yices_get_scalar_value(model_t *mdl, term_t t, int32_t *val);
  */
 
 extern int32_t _o_yices_get_value(model_t *mdl, term_t t, yval_t *val);
+extern int32_t _o_yices_get_values(model_t *mdl, uint32_t n, const term_t a[], yval_t val[]);
 
 extern int32_t _o_yices_val_is_int32(model_t *mdl, const yval_t *v);
 
@@ -734,6 +744,30 @@ extern term_t _o_yices_generalize_model_array(model_t *mdl, uint32_t n, const te
 				       yices_gen_mode_t mode, term_vector_t *v);
 
 
+/*******************
+ *  TERM ARCHIVES  *
+ ******************/
+
+extern int32_t _o_yices_save_terms(const char *filename, uint32_t n, const term_t t[]);
+
+extern int32_t _o_yices_load_terms(const char *filename, term_vector_t *v);
+
+
+/*****************
+ *  LEMMA CACHE  *
+ ****************/
+
+extern void _o_yices_set_lemma_cache_limit(uint32_t mb);
+
+extern uint32_t _o_yices_lemma_cache_size(void);
+
+extern void _o_yices_reset_lemma_cache(void);
+
+extern int32_t _o_yices_save_lemma_cache(const char *filename);
+
+extern int32_t _o_yices_load_lemma_cache(const char *filename);
+
+
 /*************************
  *  GARBAGE COLLECTION   *
  ************************/
@@ -758,6 +792,12 @@ extern void _o_yices_garbage_collect(const term_t t[], uint32_t nt,
                                      const type_t tau[], uint32_t ntau,
                                      int32_t keep_named);
 
+extern void _o_yices_garbage_collect_young(const term_t t[], uint32_t nt, int32_t keep_named);
+
+extern uint32_t _o_yices_num_young_terms(void);
+
+extern void _o_yices_get_gc_stats(yices_gc_stats_t *stats);
+
 
 
 #endif /* ___O_YICES_API_H */
@@ -216,6 +216,10 @@ int32_t print_error(FILE *f) {
     code = fprintf(f, "Invalid term-exploration query\n");
     break;
 
+  case INVALID_BATCH_CODE:
+    code = fprintf(f, "invalid instruction in term batch at index %"PRId64"\n", error->badval);
+    break;
+
     /*
      * Parser errors
      */
@@ -490,6 +494,18 @@ int32_t print_error(FILE *f) {
     code = fprintf(f, "output error\n");
     break;
 
+  case INPUT_ERROR:
+    code = fprintf(f, "input error\n");
+    break;
+
+  case ARCHIVE_FORMAT_ERROR:
+    code = fprintf(f, "invalid term archive\n");
+    break;
+
+  case ARCHIVE_UNSUPPORTED_TERM:
+    code = fprintf(f, "term can't be stored in an archive\n");
+    break;
+
   case MCSAT_ERROR_UNSUPPORTED_THEORY:
     code = fprintf(f, "mcsat: unsupported theory\n");
     break;
@@ -705,6 +721,10 @@ char *error_string(void) {
     nchar = snprintf(buffer, BUFFER_SIZE, "Invalid term-exploration query");
     break;
 
+  case INVALID_BATCH_CODE:
+    nchar = snprintf(buffer, BUFFER_SIZE, "invalid instruction in term batch at index %"PRId64, error->badval);
+    break;
+
     /*
      * Parser errors
      */
@@ -979,6 +999,18 @@ char *error_string(void) {
     nchar = snprintf(buffer, BUFFER_SIZE, "output error");
     break;
 
+  case INPUT_ERROR:
+    nchar = snprintf(buffer, BUFFER_SIZE, "input error");
+    break;
+
+  case ARCHIVE_FORMAT_ERROR:
+    nchar = snprintf(buffer, BUFFER_SIZE, "invalid term archive");
+    break;
+
+  case ARCHIVE_UNSUPPORTED_TERM:
+    nchar = snprintf(buffer, BUFFER_SIZE, "term can't be stored in an archive");
+    break;
+
   case MCSAT_ERROR_UNSUPPORTED_THEORY:
     nchar = snprintf(buffer, BUFFER_SIZE, "mcsat: unsupported theory");
     break;
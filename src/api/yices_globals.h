@@ -31,6 +31,7 @@
 #ifndef __YICES_GLOBALS_H
 #define __YICES_GLOBALS_H
 
+#include "context/lemma_cache.h"
 #include "mt/yices_locks.h"
 #include "frontend/yices/yices_parser.h"
 #include "parser_utils/term_stack2.h"
@@ -53,6 +54,8 @@ typedef struct yices_globals_s {
 
   fvar_collector_t *fvars; // to collect free variables of terms
 
+  lemma_cache_t *lemmas;   // lemma cache (or NULL)
+
 } yices_globals_t;
 
 extern yices_globals_t __yices_globals;
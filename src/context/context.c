@@ -5603,6 +5603,9 @@ void init_context(context_t *ctx, term_table_t *terms, smt_logic_t logic,
   init_sharing_map(&ctx->sharing, &ctx->intern);
   init_objstore(&ctx->cstore, sizeof(conditional_t), 32);
   init_assumption_stack(&ctx->assumptions);
+  init_ivector(&ctx->assertions, CTX_DEFAULT_VECTOR_SIZE);
+  init_ivector(&ctx->assertion_marks, 0);
+  ctx->log_incomplete = false;
 
   ctx->subst = NULL;
   ctx->marks = NULL;
@@ -5611,7 +5614,9 @@ void init_context(context_t *ctx, term_table_t *terms, smt_logic_t logic,
   ctx->edge_map = NULL;
   ctx->eq_cache = NULL;
   ctx->divmod_table = NULL;
+  ctx->sym_guards = NULL;
   ctx->explorer = NULL;
+  ctx->lemmas = NULL;
 
   ctx->dl_profile = NULL;
   ctx->arith_buffer = NULL;
@@ -5636,6 +5641,7 @@ void init_context(context_t *ctx, term_table_t *terms, smt_logic_t logic,
   init_solvers(ctx);
 
   ctx->en_quant = false;
+  ctx->num_threads = 0;
 }
 
 
@@ -5704,6 +5710,8 @@ void delete_context(context_t *ctx) {
   delete_sharing_map(&ctx->sharing);
   delete_objstore(&ctx->cstore);
   delete_assumption_stack(&ctx->assumptions);
+  delete_ivector(&ctx->assertions);
+  delete_ivector(&ctx->assertion_marks);
 
   context_free_subst(ctx);
   context_free_marks(ctx);
@@ -5711,7 +5719,9 @@ void delete_context(context_t *ctx) {
   context_free_small_cache(ctx);
   context_free_eq_cache(ctx);
   context_free_divmod_table(ctx);
+  context_free_sym_guards(ctx);
   context_free_explorer(ctx);
+  context_free_lemma_exchange(ctx);
 
   context_free_dl_profile(ctx);
   context_free_edge_map(ctx);
@@ -5760,13 +5770,18 @@ void reset_context(context_t *ctx) {
   reset_sharing_map(&ctx->sharing);
   reset_objstore(&ctx->cstore);
   reset_assumption_stack(&ctx->assumptions);
+  ivector_reset(&ctx->assertions);
+  ivector_reset(&ctx->assertion_marks);
+  ctx->log_incomplete = false;
 
   context_free_subst(ctx);
   context_free_marks(ctx);
   context_reset_small_cache(ctx);
   context_reset_eq_cache(ctx);
   context_reset_divmod_table(ctx);
+  context_reset_sym_guards(ctx);
   context_reset_explorer(ctx);
+  context_reset_lemma_exchange(ctx);
 
   context_free_arith_buffer(ctx);
   context_reset_poly_buffer(ctx);
@@ -5779,6 +5794,84 @@ void reset_context(context_t *ctx) {
 }
 
 
+/*
+ * Initialize ctx with the same configuration as src
+ */
+void init_context_copy(context_t *ctx, context_t *src) {
+  init_context(ctx, src->terms, src->logic, src->mode, src->arch, context_quant_enabled(src));
+
+  ctx->options = src->options;
+  if (splx_eager_lemmas_enabled(src)) {
+    enable_splx_eager_lemmas(ctx);
+  } else {
+    disable_splx_eager_lemmas(ctx);
+  }
+  if (splx_periodic_icheck_enabled(src)) {
+    enable_splx_periodic_icheck(ctx);
+  } else {
+    disable_splx_periodic_icheck(ctx);
+  }
+  if (splx_eqprop_enabled(src)) {
+    enable_splx_eqprop(ctx);
+  } else {
+    disable_splx_eqprop(ctx);
+  }
+
+  ctx->mcsat_options = src->mcsat_options;
+  ctx->en_quant = src->en_quant;
+  ctx->num_threads = src->num_threads;
+}
+
+
+/*
+ * Assert formulas src->assertions[k ... n-1] in ctx
+ */
+static int32_t context_replay_segment(context_t *ctx, context_t *src, uint32_t k, uint32_t n) {
+  assert(k <= n && n <= src->assertions.size);
+
+  if (k == n) {
+    return CTX_NO_ERROR;
+  }
+  return assert_formulas(ctx, n - k, src->assertions.data + k);
+}
+
+
+/*
+ * Replay the assertions of src in ctx
+ * - src must have a complete assertion log (cf. context_can_be_cloned)
+ */
+int32_t context_replay_assertions(context_t *ctx, context_t *src) {
+  uint32_t i, k, n;
+  int32_t code;
+
+  assert(ctx->base_level == 0 && ctx->assertions.size == 0 &&
+         src->assertion_marks.size == src->base_level && context_can_be_cloned(src));
+
+  code = CTX_NO_ERROR;
+  k = 0;
+  for (i=0; i<src->base_level; i++) {
+    n = src->assertion_marks.data[i];
+    code = context_replay_segment(ctx, src, k, n);
+    if (code != CTX_NO_ERROR) goto done;
+    context_push(ctx);
+    k = n;
+  }
+  code = context_replay_segment(ctx, src, k, src->assertions.size);
+
+ done:
+  if (code < 0 && smt_status(src->core) == STATUS_UNSAT && src->arch == CTX_ARCH_NOSOLVERS) {
+    /*
+     * src was an AUTO_IDL or AUTO_RDL context whose assertions simplified
+     * to false. Its architecture was reset so the replay can fail, but
+     * the clone must just be unsat.
+     */
+    code = assert_formula(ctx, false_term);
+  }
+
+  return code;
+}
+
+
 /*
  * Add tracer to ctx and ctx->core
  */
@@ -5803,8 +5896,11 @@ void context_push(context_t *ctx) {
   }
   intern_tbl_push(&ctx->intern);
   assumption_stack_push(&ctx->assumptions);
+  ivector_push(&ctx->assertion_marks, ctx->assertions.size);
   context_eq_cache_push(ctx);
   context_divmod_table_push(ctx);
+  context_sym_guards_push(ctx);
+  context_lemma_exchange_push(ctx);
 
   ctx->base_level ++;
 }
@@ -5817,8 +5913,11 @@ void context_pop(context_t *ctx) {
   }
   intern_tbl_pop(&ctx->intern);
   assumption_stack_pop(&ctx->assumptions);
+  ivector_shrink(&ctx->assertions, ivector_pop2(&ctx->assertion_marks));
   context_eq_cache_pop(ctx);
   context_divmod_table_pop(ctx);
+  context_sym_guards_pop(ctx);
+  context_lemma_exchange_pop(ctx);
 
   ctx->base_level --;
 }
@@ -5838,12 +5937,24 @@ void context_pop(context_t *ctx) {
  */
 static void context_build_sharing_data(context_t *ctx) {
   sharing_map_t *map;
+  ivector_t *v;
 
   map = &ctx->sharing;
   reset_sharing_map(map);
-  sharing_map_add_terms(map, ctx->top_eqs.data, ctx->top_eqs.size);
-  sharing_map_add_terms(map, ctx->top_atoms.data, ctx->top_atoms.size);
-  sharing_map_add_terms(map, ctx->top_formulas.data, ctx->top_formulas.size);
+  if (ctx->num_threads <= 1) {
+    sharing_map_add_terms(map, ctx->top_eqs.data, ctx->top_eqs.size);
+    sharing_map_add_terms(map, ctx->top_atoms.data, ctx->top_atoms.size);
+    sharing_map_add_terms(map, ctx->top_formulas.data, ctx->top_formulas.size);
+  } else {
+    // explore all assertions in parallel
+    v = &ctx->aux_vector;
+    assert(v->size == 0);
+    ivector_add(v, ctx->top_eqs.data, ctx->top_eqs.size);
+    ivector_add(v, ctx->top_atoms.data, ctx->top_atoms.size);
+    ivector_add(v, ctx->top_formulas.data, ctx->top_formulas.size);
+    sharing_map_add_terms_mt(map, v->data, v->size, ctx->num_threads);
+    ivector_reset(v);
+  }
 }
 
 
@@ -5924,6 +6035,11 @@ static int32_t context_process_assertions(context_t *ctx, uint32_t n, const term
      *   substitutions.
      */
 
+    // symmetry-breaking guards created earlier may no longer be valid
+    if (ctx->sym_guards != NULL) {
+      retire_symmetry_guards(ctx);
+    }
+
     switch (ctx->arch) {
     // TBD: make sure following preprocessings work with quant enabled
     case CTX_ARCH_EG:
@@ -5951,6 +6067,9 @@ static int32_t context_process_assertions(context_t *ctx, uint32_t n, const term
        * For difference logic, we must process the subst_eqs first
        * (otherwise analyze_diff_logic may give wrong results).
        */
+      if (context_breaksym_enabled(ctx)) {
+        break_var_symmetries(ctx);
+      }
       if (ctx->subst_eqs.size > 0) {
         context_process_candidate_subst(ctx);
       }
@@ -5962,6 +6081,9 @@ static int32_t context_process_assertions(context_t *ctx, uint32_t n, const term
       /*
        * Difference logic, we must process the subst_eqs first
        */
+      if (context_breaksym_enabled(ctx)) {
+        break_var_symmetries(ctx);
+      }
       trace_printf(ctx->trace, 6, "(auto-idl solver)\n");
       if (ctx->subst_eqs.size > 0) {
         context_process_candidate_subst(ctx);
@@ -5975,6 +6097,9 @@ static int32_t context_process_assertions(context_t *ctx, uint32_t n, const term
        * Simplex, like EG, may add aux_atoms so we must process
        * subst_eqs last here.
        */
+      if (context_breaksym_enabled(ctx)) {
+        break_var_symmetries(ctx);
+      }
       trace_printf(ctx->trace, 6, "(Simplex solver)\n");
       // more optional processing
       if (context_cond_def_preprocessing_enabled(ctx)) {
@@ -5995,6 +6120,9 @@ static int32_t context_process_assertions(context_t *ctx, uint32_t n, const term
       /*
        * Process the candidate variable substitutions if any
        */
+      if (context_breaksym_enabled(ctx)) {
+        break_var_symmetries(ctx);
+      }
       if (ctx->subst_eqs.size > 0) {
         context_process_candidate_subst(ctx);
       }
@@ -6127,6 +6255,13 @@ int32_t _o_assert_formulas(context_t *ctx, uint32_t n, const term_t *f) {
   assert(!context_quant_enabled(ctx));
 
   code = context_process_assertions(ctx, n, f);
+  if (code >= 0 && n > 0) {
+    if (context_assertion_log_enabled(ctx)) {
+      ivector_add(&ctx->assertions, f, n);
+    } else {
+      ctx->log_incomplete = true;
+    }
+  }
   if (code == TRIVIALLY_UNSAT) {
     if (ctx->arch == CTX_ARCH_AUTO_IDL || ctx->arch == CTX_ARCH_AUTO_RDL) {
       // cleanup: reset arch/config to 'no theory'
@@ -6322,6 +6457,11 @@ int32_t context_process_formulas(context_t *ctx, uint32_t n, term_t *f) {
      *   substitutions.
      */
 
+    // symmetry-breaking guards created earlier may no longer be valid
+    if (ctx->sym_guards != NULL) {
+      retire_symmetry_guards(ctx);
+    }
+
     switch (ctx->arch) {
     case CTX_ARCH_EG:
       /*
@@ -6348,6 +6488,9 @@ int32_t context_process_formulas(context_t *ctx, uint32_t n, term_t *f) {
        * For difference logic, we must process the subst_eqs first
        * (otherwise analyze_diff_logic may give wrong results).
        */
+      if (context_breaksym_enabled(ctx)) {
+	break_var_symmetries(ctx);
+      }
       if (ctx->subst_eqs.size > 0) {
 	context_process_candidate_subst(ctx);
       }
@@ -6359,6 +6502,9 @@ int32_t context_process_formulas(context_t *ctx, uint32_t n, term_t *f) {
       /*
        * Difference logic, we must process the subst_eqs first
        */
+      if (context_breaksym_enabled(ctx)) {
+	break_var_symmetries(ctx);
+      }
       if (ctx->subst_eqs.size > 0) {
 	context_process_candidate_subst(ctx);
       }
@@ -6371,6 +6517,9 @@ int32_t context_process_formulas(context_t *ctx, uint32_t n, term_t *f) {
        * Simplex, like EG, may add aux_atoms so we must process
        * subst_eqs last here.
        */
+      if (context_breaksym_enabled(ctx)) {
+	break_var_symmetries(ctx);
+      }
       // more optional processing
       if (context_cond_def_preprocessing_enabled(ctx)) {
 	process_conditional_definitions(ctx);
@@ -6390,6 +6539,9 @@ int32_t context_process_formulas(context_t *ctx, uint32_t n, term_t *f) {
       /*
        * Process the candidate variable substitutions if any
        */
+      if (context_breaksym_enabled(ctx)) {
+	break_var_symmetries(ctx);
+      }
       if (ctx->subst_eqs.size > 0) {
 	context_process_candidate_subst(ctx);
       }
@@ -6437,6 +6589,9 @@ void context_stop_search(context_t *ctx) {
     if (context_has_simplex_solver(ctx)) {
       simplex_stop_search(ctx->arith_solver);
     }
+    if (ctx->quant_solver != NULL) {
+      quant_solver_stop_search(ctx->quant_solver);
+    }
   } else {
     mcsat_stop_search(ctx->mcsat);
   }
@@ -6552,6 +6707,150 @@ int32_t assert_blocking_clause(context_t *ctx) {
 
 
 
+/*****************
+ *  LEMMA CACHE  *
+ ****************/
+
+/*
+ * Literal mapped to Boolean term t
+ * - return null_literal if t is not internalized yet
+ */
+static literal_t lemma_term_to_literal(context_t *ctx, term_t t) {
+  uint32_t polarity;
+  term_t r;
+
+  r = intern_tbl_get_root(&ctx->intern, t);
+  polarity = polarity_of(r);
+  r = unsigned_term(r);
+  if (! intern_tbl_root_is_mapped(&ctx->intern, r)) {
+    return null_literal;
+  }
+
+  return translate_code_to_literal(ctx, intern_tbl_map_of_root(&ctx->intern, r)) ^ polarity;
+}
+
+
+/*
+ * Add the clauses of cache whose terms are all internalized in ctx
+ * - skip the clauses that were already added
+ * - empty the lemma log: it may contain lemmas from a search that was
+ *   interrupted, or from a check that did not export its lemmas
+ */
+uint32_t context_import_lemmas(context_t *ctx, lemma_cache_t *cache) {
+  lemma_exchange_t *exchange;
+  ivector_t *v;
+  harray_t *c;
+  literal_t l;
+  uint32_t i, j, n, count;
+
+  assert(ctx->lemmas != NULL && smt_status(ctx->core) == STATUS_IDLE);
+
+  exchange = ctx->lemmas;
+  ivector_reset(&exchange->log);
+  lemma_exchange_set_epoch(exchange, cache->epoch);
+  v = &ctx->aux_vector;
+  assert(v->size == 0);
+
+  count = 0;
+  n = lemma_cache_num_clauses(cache);
+  for (i=0; i<n; i++) {
+    if (lemma_exchange_has_clause(exchange, i)) continue;
+
+    c = cache->clause[i];
+    for (j=0; j<c->nelems; j++) {
+      l = lemma_term_to_literal(ctx, c->data[j]);
+      if (l == null_literal) break;
+      ivector_push(v, l);
+    }
+    if (j == c->nelems) {
+      add_clause(ctx->core, v->size, v->data);
+      lemma_exchange_add_clause(exchange, i);
+      count ++;
+    }
+    ivector_reset(v);
+  }
+
+  return count;
+}
+
+
+/*
+ * Convert clause a[0 ... n-1] of the core to a normalized clause of terms
+ * - the terms are added to v, followed by NULL_TERM
+ * - v is unchanged if the conversion fails: this happens if a literal
+ *   is not mapped to a term, if the clause is true, or if it's
+ *   empty after removing false literals.
+ */
+static void lemma_to_terms(context_t *ctx, uint32_t n, literal_t *a, ivector_t *v) {
+  uint32_t i, k;
+  int32_t m;
+  literal_t l;
+  term_t r;
+
+  k = v->size;
+  for (i=0; i<n; i++) {
+    l = a[i];
+    if (var_of(l) == const_bvar) {
+      if (l == true_literal) goto failed;
+      continue;
+    }
+    r = intern_tbl_term_of_literal(&ctx->intern, l);
+    if (r == NULL_TERM) {
+      r = intern_tbl_term_of_literal(&ctx->intern, not(l));
+      if (r == NULL_TERM) goto failed;
+      r = opposite_term(r);
+    }
+    ivector_push(v, r);
+  }
+
+  m = normalize_lemma(v->size - k, v->data + k);
+  if (m <= 0) goto failed;
+  ivector_shrink(v, k + m);
+  ivector_push(v, NULL_TERM);
+  return;
+
+ failed:
+  ivector_shrink(v, k);
+}
+
+
+/*
+ * Convert all clauses stored in vector a (as sequences of literals terminated by null_literal)
+ */
+static void lemma_vector_to_terms(context_t *ctx, ivector_t *a, ivector_t *v) {
+  uint32_t i, j;
+
+  j = 0;
+  for (i=0; i<a->size; i++) {
+    if (a->data[i] == null_literal) {
+      lemma_to_terms(ctx, i - j, a->data + j, v);
+      j = i+1;
+    }
+  }
+}
+
+
+/*
+ * Collect the lemmas to export: theory lemmas in the log then short learned clauses
+ */
+void context_collect_lemmas(context_t *ctx, ivector_t *v) {
+  ivector_t *aux;
+
+  assert(ctx->lemmas != NULL);
+
+  lemma_vector_to_terms(ctx, &ctx->lemmas->log, v);
+  ivector_reset(&ctx->lemmas->log);
+
+  aux = &ctx->aux_vector;
+  assert(aux->size == 0);
+  smt_core_collect_learned_clauses(ctx->core, MAX_CACHED_LEARNED_LENGTH, aux);
+  lemma_vector_to_terms(ctx, aux, v);
+  ivector_reset(aux);
+}
+
+
+
+
 /********************************
  *  GARBAGE COLLECTION SUPPORT  *
  *******************************/
@@ -6573,6 +6872,8 @@ static void ctx_mark_eq(void *aux, const pmap2_rec_t *p) {
  * that they use.
  */
 void context_gc_mark(context_t *ctx) {
+  uint32_t i, n;
+
   if (ctx->egraph != NULL) {
     egraph_gc_mark(ctx->egraph);
   }
@@ -6582,6 +6883,12 @@ void context_gc_mark(context_t *ctx) {
 
   intern_tbl_gc_mark(&ctx->intern);
 
+  // asserted formulas are needed for cloning
+  n = ctx->assertions.size;
+  for (i=0; i<n; i++) {
+    term_table_set_gc_mark(ctx->terms, index_of(ctx->assertions.data[i]));
+  }
+
   // empty all the term vectors to be safe
   ivector_reset(&ctx->top_eqs);
   ivector_reset(&ctx->top_atoms);
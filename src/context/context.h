@@ -54,6 +54,31 @@ extern void delete_context(context_t *ctx);
 extern void reset_context(context_t *ctx);
 
 
+/*
+ * Cloning: a context is copied by creating a new context with the
+ * same configuration, then asserting the same formulas in it. This
+ * requires the assertion log: src can be cloned only if option
+ * LOG_ASSERTIONS was enabled before any formula was asserted in src
+ * (since it was created or reset).
+ *
+ * init_context_copy: initialize ctx with the same term table, logic,
+ * mode, architecture, options, and mcsat options as src. No formula
+ * is asserted in ctx.
+ *
+ * context_replay_assertions: assert in ctx all the formulas asserted
+ * in src since it was created or reset, with the same push/pop
+ * structure (ctx must be freshly initialized). Learned clauses,
+ * blocking clauses, and models are not copied.
+ * - return code: same as assert_formulas.
+ */
+extern void init_context_copy(context_t *ctx, context_t *src);
+extern int32_t context_replay_assertions(context_t *ctx, context_t *src);
+
+static inline bool context_can_be_cloned(context_t *ctx) {
+  return context_assertion_log_enabled(ctx) && !ctx->log_incomplete;
+}
+
+
 /*
  * Set the trace:
  * - the current tracer must be NULL.
@@ -244,6 +269,15 @@ extern void context_build_model(model_t *model, context_t *ctx);
  */
 extern void build_model(model_t *model, context_t *ctx);
 
+/*
+ * Build a model from the current assignment, during the search
+ * - this must be called from a final check, once all the satellite
+ *   solvers have accepted the current assignment
+ * - the model is built as in build_model
+ * - cleanup of satellite models needed using clean_solver_models()
+ */
+extern void build_search_model(model_t *model, context_t *ctx);
+
 /*
  * Cleanup solver models
  */
@@ -428,6 +462,16 @@ static inline smt_status_t context_status(context_t *ctx) {
 }
 
 
+/*
+ * Check whether the last call to check_context was interrupted
+ * because the core exceeded its memory budget.
+ * - always false for MCSAT contexts (there's no memory budget)
+ */
+static inline bool context_memout(context_t *ctx) {
+  return ctx->arch != CTX_ARCH_MCSAT && smt_memout(ctx->core);
+}
+
+
 /*
  * Read the base_level (= number of calls to push)
  */
@@ -448,6 +492,36 @@ static inline uint32_t context_base_level(context_t *ctx) {
 extern bval_t context_bool_term_value(context_t *ctx, term_t t);
 
 
+/*
+ * LEMMA CACHE
+ */
+
+/*
+ * Add the clauses of cache whose terms are all internalized in ctx
+ * - ctx->lemmas must be non-NULL and ctx's status must be IDLE
+ * - the clauses already added to ctx (and not removed by pop) are skipped
+ * - the lemma log is emptied
+ * - return the number of clauses added
+ */
+extern uint32_t context_import_lemmas(context_t *ctx, lemma_cache_t *cache);
+
+/*
+ * Collect candidate clauses for the cache
+ * - ctx->lemmas must be non-NULL
+ * - this must be called after check and before the next pop
+ * - the candidates are the theory lemmas recorded during the search, and
+ *   the learned clauses of length at most MAX_CACHED_LEARNED_LENGTH
+ * - they are converted to normalized clauses of terms and added to v
+ *   (each clause is followed by NULL_TERM). Clauses that contain literals
+ *   not mapped to terms are skipped.
+ * - the lemma log is emptied
+ *
+ * The candidates are not necessarily valid: they must be checked
+ * before they're added to the cache.
+ */
+extern void context_collect_lemmas(context_t *ctx, ivector_t *v);
+
+
 /*
  * GARBAGE-COLLECTION SUPPORT
  */
@@ -3636,6 +3636,74 @@ static void print_candidates(sym_breaker_t *breaker, sym_breaker_sets_t *sets) {
 #endif
 
 
+/*
+ * GUARDED SYMMETRY BREAKING
+ */
+
+/*
+ * If the context supports multiple checks, more assertions may be
+ * added after the symmetries are broken. To keep things sound, the
+ * symmetry-breaking clauses are guarded (cf. symmetry_guards.h):
+ * - a set of constants is used only if none of them occurs in
+ *   formulas asserted earlier (i.e., none of them is internalized)
+ * - the symmetry-breaking clauses for this set are guarded by a fresh
+ *   literal, which is assumed by check_context.
+ * - a guard created earlier is retired as soon as the assertions are
+ *   not invariant under permutations of its constants.
+ */
+static bool fresh_constant_set(context_t *ctx, rng_record_t *r) {
+  uint32_t i, n;
+
+  n = r->num_constants;
+  for (i=0; i<n; i++) {
+    assert(intern_tbl_is_root(&ctx->intern, r->cst[i]));
+    if (intern_tbl_root_is_mapped(&ctx->intern, r->cst[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*
+ * Create a guard for the constants c[0 ... n-1]:
+ * - the guard is a fresh Boolean term mapped to a fresh literal
+ */
+static term_t make_symmetry_guard(context_t *ctx, term_t *c, uint32_t n) {
+  term_t g;
+  literal_t l;
+
+  g = new_uninterpreted_term(ctx->terms, bool_id);
+  l = pos_lit(create_boolean_variable(ctx->core));
+  intern_tbl_map_root(&ctx->intern, g, literal2code(l));
+  sym_guard_stack_add(context_get_sym_guards(ctx), l, c, n);
+
+  return g;
+}
+
+/*
+ * Retire the active guards if the assertions are not invariant for their constants.
+ */
+void retire_symmetry_guards(context_t *ctx) {
+  sym_guard_stack_t *stack;
+  sym_guard_t *g;
+  uint32_t i, n;
+
+  stack = ctx->sym_guards;
+  assert(stack != NULL);
+  n = stack->top;
+  for (i=0; i<n; i++) {
+    if (sym_guard_is_active(stack, i)) {
+      g = stack->data + i;
+      if (! check_constants_invariance(ctx, g->cst, g->num_constants)) {
+        trace_printf(ctx->trace, 5, "(retiring symmetry-breaking guard)\n");
+        add_unit_clause(ctx->core, not(g->lit));
+        sym_guard_stack_retire(stack, i);
+      }
+    }
+  }
+}
+
+
 /*
  * Break symmetries
  */
@@ -3644,6 +3712,11 @@ void break_uf_symmetries(context_t *ctx) {
   sym_breaker_sets_t *sets;
   rng_record_t **v;
   uint32_t i, j, n;
+  bool guarded;
+
+  // quantifier instances are not checked for invariance
+  guarded = context_supports_multichecks(ctx);
+  if (guarded && context_quant_enabled(ctx)) return;
 
   breaker = objstack_alloc(&ctx->ostack, sizeof(sym_breaker_t), (cleaner_t) delete_sym_breaker);
   init_sym_breaker(breaker, ctx);
@@ -3659,6 +3732,7 @@ void break_uf_symmetries(context_t *ctx) {
     // test of symmetry breaking
     sets = &breaker->sets;
     for (i=0; i<n; i++) {
+      if (guarded && !fresh_constant_set(ctx, v[i])) continue;
       if (check_assertion_invariance(breaker, v[i])) {
 #if TRACE_SYM_BREAKING
 	printf("Breaking symmetries using set[%"PRIu32"]:", i);
@@ -3680,6 +3754,9 @@ void break_uf_symmetries(context_t *ctx) {
 	print_candidates(breaker, sets);
 	printf("\n");
 #endif
+	if (guarded) {
+	  breaker->guard = make_symmetry_guard(ctx, v[i]->cst, v[i]->num_constants);
+	}
 	break_symmetries(breaker, sets);
       } else {
 #if TRACE_SYM_BREAKING
@@ -3701,6 +3778,41 @@ void break_uf_symmetries(context_t *ctx) {
 }
 
 
+/*
+ * Break symmetries between arithmetic or bitvector variables
+ */
+void break_var_symmetries(context_t *ctx) {
+  sym_breaker_t *breaker;
+  var_class_t *c;
+  uint32_t i, n;
+  bool guarded;
+
+  guarded = context_supports_multichecks(ctx);
+  if (guarded && context_quant_enabled(ctx)) return;
+
+  breaker = objstack_alloc(&ctx->ostack, sizeof(sym_breaker_t), (cleaner_t) delete_sym_breaker);
+  init_sym_breaker(breaker, ctx);
+  collect_variable_classes(breaker);
+
+  n = breaker->var_classes.nelems;
+  if (n > MAX_VAR_CLASS_CHECKS) {
+    n = MAX_VAR_CLASS_CHECKS;
+  }
+  for (i=0; i<n; i++) {
+    c = breaker->var_classes.data + i;
+    if (check_variable_class_invariance(breaker, c)) {
+      trace_printf(ctx->trace, 5, "(breaking variable symmetries)\n");
+      if (guarded) {
+        breaker->guard = make_symmetry_guard(ctx, c->var, c->num_vars);
+      }
+      break_variable_symmetries(breaker, c);
+    }
+  }
+
+  objstack_pop(&ctx->ostack);
+}
+
+
 
 
 /******************************
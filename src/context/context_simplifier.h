@@ -386,6 +386,27 @@ extern void analyze_diff_logic(context_t *ctx, bool idl);
 extern void break_uf_symmetries(context_t *ctx);
 
 
+/*
+ * Break symmetries between arithmetic or bitvector variables:
+ * - search for sets of variables {x_1, ..., x_n} of the same type such
+ *   that the assertions are invariant by all permutations of x_1 ... x_n
+ * - for each such set, add the constraints x_1 <= x_2 <= ... <= x_n
+ *   (the unsigned ordering is used for bitvectors)
+ */
+extern void break_var_symmetries(context_t *ctx);
+
+
+/*
+ * Retire the symmetry-breaking guards that are no longer valid:
+ * - a guard is retired if the current assertions are not invariant
+ *   under permutations of its constants or variables
+ * - ctx->sym_guards must not be NULL
+ * - this must be called on every batch of assertions, whether or
+ *   not symmetry breaking is still enabled
+ */
+extern void retire_symmetry_guards(context_t *ctx);
+
+
 /*
  * Preprocessing of conditional definitions
  */
@@ -165,6 +165,14 @@ static void search(smt_core_t *core, uint32_t conflict_bound, uint32_t *reduce_t
       trace_reduce(core, core->stats.learned_clauses_deleted - deletions);
     }
 
+    // memory budget
+    smt_check_memory_limit(core);
+    if (smt_memout(core)) break;
+
+    // conflict budget
+    smt_check_conflict_limit(core);
+    if (smt_status(core) != STATUS_SEARCHING) break;
+
     // assumption
     if (core->has_assumptions) {
       l = get_next_assumption(core);
@@ -219,6 +227,14 @@ static void luby_search(smt_core_t *core, uint32_t conflict_bound, uint32_t *red
       trace_reduce(core, core->stats.learned_clauses_deleted - deletions);
     }
 
+    // memory budget
+    smt_check_memory_limit(core);
+    if (smt_memout(core)) break;
+
+    // conflict budget
+    smt_check_conflict_limit(core);
+    if (smt_status(core) != STATUS_SEARCHING) break;
+
     // assumption
     if (core->has_assumptions) {
       l = get_next_assumption(core);
@@ -278,6 +294,14 @@ static void special_search(smt_core_t *core, uint32_t conflict_bound, uint32_t *
       trace_reduce(core, core->stats.learned_clauses_deleted - deletions);
     }
 
+    // memory budget
+    smt_check_memory_limit(core);
+    if (smt_memout(core)) break;
+
+    // conflict budget
+    smt_check_conflict_limit(core);
+    if (smt_status(core) != STATUS_SEARCHING) break;
+
     // assumption
     if (core->has_assumptions) {
       l = get_next_assumption(core);
@@ -488,6 +512,7 @@ static void context_set_search_parameters(context_t *ctx, const param_t *params)
   } else {
     disable_theory_cache(core);
   }
+  set_memory_limit_mb(core, params->memory_limit);
 
   /*
    * Set egraph parameters
@@ -561,10 +586,13 @@ static smt_status_t call_mcsat_solver(context_t *ctx, const param_t *params) {
  * Initialize search parameters then call solve
  * - if ctx->status is not IDLE, return the status.
  * - if params is NULL, we use default values.
+ * - the active symmetry-breaking guards are passed as assumptions
+ *   (so the result may be UNSAT with assumptions).
  */
 smt_status_t check_context(context_t *ctx, const param_t *params) {
   smt_core_t *core;
   smt_status_t stat;
+  ivector_t guards;
 
   if (params == NULL) {
     params = get_default_params();
@@ -579,7 +607,15 @@ smt_status_t check_context(context_t *ctx, const param_t *params) {
   if (stat == STATUS_IDLE) {
     // clean state: the search can proceed
     context_set_search_parameters(ctx, params);
-    solve(core, params, 0, NULL);
+    if (ctx->sym_guards != NULL) {
+      // assume the active symmetry-breaking guards
+      init_ivector(&guards, 0);
+      sym_guard_stack_collect_active(ctx->sym_guards, &guards);
+      solve(core, params, guards.size, guards.data);
+      delete_ivector(&guards);
+    } else {
+      solve(core, params, 0, NULL);
+    }
     stat = smt_status(core);
   }
 
@@ -1043,18 +1079,14 @@ static void build_term_value(context_t *ctx, model_t *model, term_t t) {
 
 /*
  * Build a model for the current context (including all satellite solvers)
- * - the context status must be SAT (or UNKNOWN)
  * - if model->has_alias is true, we store the term substitution
  *   defined by ctx->intern_tbl into the model
- * - cleanup of satellite models needed using clean_solver_models()
  */
-void build_model(model_t *model, context_t *ctx) {
+static void build_solver_models(model_t *model, context_t *ctx) {
   term_table_t *terms;
   uint32_t i, n;
   term_t t;
 
-  assert(smt_status(ctx->core) == STATUS_SAT || smt_status(ctx->core) == STATUS_UNKNOWN || mcsat_status(ctx->mcsat) == STATUS_SAT);
-
   /*
    * First build assignments in the satellite solvers
    * and get the val_in_model functions for the egraph
@@ -1094,6 +1126,29 @@ void build_model(model_t *model, context_t *ctx) {
 }
 
 
+/*
+ * Build a model for the current context
+ * - the context status must be SAT (or UNKNOWN)
+ * - cleanup of satellite models needed using clean_solver_models()
+ */
+void build_model(model_t *model, context_t *ctx) {
+  assert(smt_status(ctx->core) == STATUS_SAT || smt_status(ctx->core) == STATUS_UNKNOWN || mcsat_status(ctx->mcsat) == STATUS_SAT);
+  build_solver_models(model, ctx);
+}
+
+
+/*
+ * Build a model from the current assignment during the search
+ * - this is used in final check (by the quantifier solver) when all
+ *   the other solvers have accepted the current assignment
+ * - cleanup of satellite models needed using clean_solver_models()
+ */
+void build_search_model(model_t *model, context_t *ctx) {
+  assert(smt_status(ctx->core) == STATUS_SEARCHING && ctx->mcsat == NULL);
+  build_solver_models(model, ctx);
+}
+
+
 /*
  * Cleanup solver models
  */
@@ -1180,7 +1235,7 @@ bval_t context_bool_term_value(context_t *ctx, term_t t) {
  */
 void context_build_unsat_core(context_t *ctx, ivector_t *v) {
   smt_core_t *core;
-  uint32_t i, n;
+  uint32_t i, j, n;
   term_t t;
 
   core = ctx->core;
@@ -1188,12 +1243,18 @@ void context_build_unsat_core(context_t *ctx, ivector_t *v) {
   build_unsat_core(core, v);
 
   // convert from literals to terms
+  // skip the symmetry-breaking guards (they're not assumption literals)
   n = v->size;
+  j = 0;
   for (i=0; i<n; i++) {
     t = assumption_term_for_literal(&ctx->assumptions, v->data[i]);
-    assert(t >= 0);
-    v->data[i] = t;
+    assert(t >= 0 || ctx->sym_guards != NULL);
+    if (t >= 0) {
+      v->data[j] = t;
+      j ++;
+    }
   }
+  ivector_shrink(v, j);
 }
 
 extern term_t context_get_unsat_model_interpolant(context_t *ctx) {
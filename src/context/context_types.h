@@ -32,8 +32,10 @@
 #include "context/common_conjuncts.h"
 #include "context/divmod_table.h"
 #include "context/internalization_table.h"
+#include "context/lemma_cache.h"
 #include "context/pseudo_subst.h"
 #include "context/shared_terms.h"
+#include "context/symmetry_guards.h"
 #include "io/tracer.h"
 #include "solvers/cdcl/gates_manager.h"
 #include "solvers/cdcl/smt_core.h"
@@ -110,7 +112,12 @@ typedef enum {
  *   if-then-else terms
  * - FACTOR_TOP_OR: extract common factors from top-level disjuncts
  *
+ * LOG_ASSERTIONS is not a preprocessing option: it makes the context keep
+ * all the asserted formulas, which is required to clone the context.
+ *
  * BREAKSYM for QF_UF is based on the paper by Deharbe et al (CADE 2011)
+ * For the other architectures, BREAKSYM adds ordering constraints between
+ * interchangeable arithmetic or bitvector variables.
  *
  * PSEUDO_INVERSE is based on Brummayer's thesis (Boolector stuff)
  * - not implemented yet
@@ -152,6 +159,9 @@ typedef enum {
   ITE_BOUNDS_OPTION_MASK|CONDITIONAL_DEF_OPTION_MASK|FLATTEN_ITE_OPTION_MASK|\
   FACTOR_OR_OPTION_MASK)
 
+// ASSERTION LOG (for cloning)
+#define LOG_ASSERTIONS_OPTION_MASK      0x100000
+
 // SIMPLEX OPTIONS
 #define SPLX_EGRLMAS_OPTION_MASK  0x1000000
 #define SPLX_ICHECK_OPTION_MASK   0x2000000
@@ -693,6 +703,15 @@ struct context_s {
   // assumption stack
   assumption_stack_t assumptions;
 
+  // formulas asserted since the last reset (used for cloning)
+  // and number of asserted formulas at each push
+  // - the formulas are stored only if LOG_ASSERTIONS is enabled
+  // - log_incomplete is true if some formulas were asserted
+  //   while LOG_ASSERTIONS was disabled
+  ivector_t assertions;
+  ivector_t assertion_marks;
+  bool log_incomplete;
+
   // optional components: allocated if needed
   pseudo_subst_t *subst;
   mark_vector_t *marks;
@@ -701,7 +720,9 @@ struct context_s {
   int_rat_hmap_t *edge_map;
   pmap2_t *eq_cache;
   divmod_tbl_t *divmod_table;
+  sym_guard_stack_t *sym_guards;
   bfs_explorer_t *explorer;
+  lemma_exchange_t *lemmas;
 
   // buffer to store difference-logic data
   dl_data_t *dl_profile;
@@ -730,6 +751,9 @@ struct context_s {
 
   // flag for enabling adding quant instances
   bool en_quant;
+
+  // number of threads for the sharing analysis (0 or 1 means sequential)
+  uint32_t num_threads;
 };
 
 
@@ -535,6 +535,153 @@ void context_reset_divmod_table(context_t *ctx) {
 }
 
 
+/*
+ * SYMMETRY-BREAKING GUARDS
+ */
+
+/*
+ * Allocate and initialize the stack if needed
+ */
+sym_guard_stack_t *context_get_sym_guards(context_t *ctx) {
+  sym_guard_stack_t *tmp;
+
+  tmp = ctx->sym_guards;
+  if (tmp == NULL) {
+    tmp = (sym_guard_stack_t *) safe_malloc(sizeof(sym_guard_stack_t));
+    init_sym_guard_stack(tmp);
+    sym_guard_stack_set_level(tmp, ctx->base_level);
+    ctx->sym_guards = tmp;
+  }
+
+  return tmp;
+}
+
+
+/*
+ * Free the stack
+ */
+void context_free_sym_guards(context_t *ctx) {
+  sym_guard_stack_t *tmp;
+
+  tmp = ctx->sym_guards;
+  if (tmp != NULL) {
+    delete_sym_guard_stack(tmp);
+    safe_free(tmp);
+    ctx->sym_guards = NULL;
+  }
+}
+
+
+/*
+ * Push/pop/reset
+ */
+void context_sym_guards_push(context_t *ctx) {
+  sym_guard_stack_t *tmp;
+
+  tmp = ctx->sym_guards;
+  if (tmp != NULL) {
+    sym_guard_stack_push(tmp);
+  }
+}
+
+void context_sym_guards_pop(context_t *ctx) {
+  sym_guard_stack_t *tmp;
+
+  tmp = ctx->sym_guards;
+  if (tmp != NULL) {
+    sym_guard_stack_pop(tmp);
+  }
+}
+
+void context_reset_sym_guards(context_t *ctx) {
+  sym_guard_stack_t *tmp;
+
+  tmp = ctx->sym_guards;
+  if (tmp != NULL) {
+    reset_sym_guard_stack(tmp);
+  }
+}
+
+
+
+/*
+ * LEMMA CACHE
+ */
+
+/*
+ * Allocate and initialize the data if needed
+ * - one mark per push so that the next pops are balanced
+ */
+lemma_exchange_t *context_get_lemma_exchange(context_t *ctx) {
+  lemma_exchange_t *tmp;
+  uint32_t i;
+
+  assert(ctx->core != NULL);
+
+  tmp = ctx->lemmas;
+  if (tmp == NULL) {
+    tmp = (lemma_exchange_t *) safe_malloc(sizeof(lemma_exchange_t));
+    init_lemma_exchange(tmp);
+    for (i=0; i<ctx->base_level; i++) {
+      lemma_exchange_push(tmp);
+    }
+    smt_core_set_lemma_log(ctx->core, &tmp->log, MAX_CACHED_LEMMA_LENGTH);
+    ctx->lemmas = tmp;
+  }
+
+  return tmp;
+}
+
+
+/*
+ * Free the data and stop logging lemmas
+ */
+void context_free_lemma_exchange(context_t *ctx) {
+  lemma_exchange_t *tmp;
+
+  tmp = ctx->lemmas;
+  if (tmp != NULL) {
+    if (ctx->core != NULL) {
+      smt_core_set_lemma_log(ctx->core, NULL, 0);
+    }
+    delete_lemma_exchange(tmp);
+    safe_free(tmp);
+    ctx->lemmas = NULL;
+  }
+}
+
+
+/*
+ * Push/pop/reset
+ */
+void context_lemma_exchange_push(context_t *ctx) {
+  lemma_exchange_t *tmp;
+
+  tmp = ctx->lemmas;
+  if (tmp != NULL) {
+    lemma_exchange_push(tmp);
+  }
+}
+
+void context_lemma_exchange_pop(context_t *ctx) {
+  lemma_exchange_t *tmp;
+
+  tmp = ctx->lemmas;
+  if (tmp != NULL) {
+    lemma_exchange_pop(tmp);
+  }
+}
+
+void context_reset_lemma_exchange(context_t *ctx) {
+  lemma_exchange_t *tmp;
+
+  tmp = ctx->lemmas;
+  if (tmp != NULL) {
+    reset_lemma_exchange(tmp);
+  }
+}
+
+
 /*
  * Find records in the table:
  * - three functions for floor/ceil/div
@@ -189,6 +189,47 @@ extern void context_divmod_table_push(context_t *ctx);
 extern void context_divmod_table_pop(context_t *ctx);
 
 
+/*
+ * SYMMETRY-BREAKING GUARDS
+ */
+
+/*
+ * Initialization/reset/deletion and push/pop
+ * - get_sym_guards allocates and initializes the stack if needed.
+ * - free/reset/push/pop do nothing if the stack does not exist.
+ */
+extern sym_guard_stack_t *context_get_sym_guards(context_t *ctx);
+extern void context_free_sym_guards(context_t *ctx);
+extern void context_reset_sym_guards(context_t *ctx);
+extern void context_sym_guards_push(context_t *ctx);
+extern void context_sym_guards_pop(context_t *ctx);
+
+
+/*
+ * LEMMA CACHE
+ */
+
+/*
+ * Initialization/reset/deletion and push/pop of the per-context data
+ * - get_lemma_exchange allocates and initializes the data if needed
+ *   and attaches the lemma log to the core.
+ * - free detaches the log from the core.
+ * - free/reset/push/pop do nothing if the data does not exist.
+ *
+ * The context exchanges lemmas with the global cache if and only if
+ * ctx->lemmas is non-NULL.
+ */
+extern lemma_exchange_t *context_get_lemma_exchange(context_t *ctx);
+extern void context_free_lemma_exchange(context_t *ctx);
+extern void context_reset_lemma_exchange(context_t *ctx);
+extern void context_lemma_exchange_push(context_t *ctx);
+extern void context_lemma_exchange_pop(context_t *ctx);
+
+static inline bool context_lemma_cache_enabled(context_t *ctx) {
+  return ctx->lemmas != NULL;
+}
+
+
 /*
  * Check whether the record for (floor x) is in the table.
  * If so return the theory variable mapped to (floor x).
@@ -482,6 +523,14 @@ static inline void disable_or_factoring(context_t *ctx) {
   ctx->options &= ~FACTOR_OR_OPTION_MASK;
 }
 
+static inline void enable_assertion_log(context_t *ctx) {
+  ctx->options |= LOG_ASSERTIONS_OPTION_MASK;
+}
+
+static inline void disable_assertion_log(context_t *ctx) {
+  ctx->options &= ~LOG_ASSERTIONS_OPTION_MASK;
+}
+
 
 
 /*
@@ -539,6 +588,10 @@ static inline bool context_or_factoring_enabled(context_t *ctx) {
   return (ctx->options & FACTOR_OR_OPTION_MASK) != 0;
 }
 
+static inline bool context_assertion_log_enabled(context_t *ctx) {
+  return (ctx->options & LOG_ASSERTIONS_OPTION_MASK) != 0;
+}
+
 static inline bool context_has_preprocess_options(context_t *ctx) {
   return (ctx->options & PREPROCESSING_OPTIONS_MASK) != 0;
 }
@@ -702,5 +755,14 @@ static inline bool context_quant_enabled(context_t *ctx) {
 }
 
 
+/*
+ * Number of threads used by the sharing analysis in assert_formulas
+ * - 0 or 1 means sequential
+ */
+static inline void context_set_num_threads(context_t *ctx, uint32_t n) {
+  ctx->num_threads = n;
+}
+
+
 #endif /* __CONTEXT_UTILS_H */
 
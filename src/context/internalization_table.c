@@ -463,6 +463,32 @@ term_t intern_tbl_reverse_map(intern_tbl_t *tbl, occ_t x) {
 }
 
 
+/*
+ * Return the root mapped to literal l
+ * - literals and theory variables share the same codes, and the
+ *   reverse map keeps the first term mapped to a code. So we must
+ *   check that the term is Boolean and still mapped to l.
+ */
+term_t intern_tbl_term_of_literal(intern_tbl_t *tbl, literal_t l) {
+  int_hmap_pair_t *ip;
+  int32_t x;
+  term_t r;
+
+  x = literal2code(l);
+  ip = int_hmap_find(&tbl->reverse_map, x);
+  if (ip != NULL) {
+    r = ip->val;
+    if (good_term(tbl->terms, r) && is_boolean_term(tbl->terms, r) &&
+        intern_tbl_is_root(tbl, r) && intern_tbl_root_is_mapped(tbl, r) &&
+        intern_tbl_map_of_root(tbl, r) == x) {
+      return r;
+    }
+  }
+
+  return NULL_TERM;
+}
+
+
 
 #if 0
 
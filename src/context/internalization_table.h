@@ -274,6 +274,13 @@ extern void intern_tbl_remap_root(intern_tbl_t *tbl, term_t r, int32_t x);
  */
 extern term_t intern_tbl_reverse_map(intern_tbl_t *tbl, occ_t x);
 
+/*
+ * Return the Boolean root mapped to literal l (if any)
+ * - the result r is a positive root whose code is l
+ * - return NULL_TERM if there's no such root (or if it's not known)
+ */
+extern term_t intern_tbl_term_of_literal(intern_tbl_t *tbl, literal_t l);
+
 
 /*
  * SUBSTITUTIONS
@@ -0,0 +1,383 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CACHE OF LEMMAS SHARED BETWEEN CONTEXTS
+ */
+
+#include <assert.h>
+
+#include "context/lemma_cache.h"
+#include "utils/int_array_sort.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * Initialize cache: nothing allocated for the clause array yet
+ */
+void init_lemma_cache(lemma_cache_t *cache) {
+  init_int_array_hset(&cache->store, 0);
+  init_int_array_hset(&cache->rejected, 0);
+  init_int_array_hset(&cache->pending, 0);
+  cache->clause = NULL;
+  cache->nclauses = 0;
+  cache->size = 0;
+  cache->mem_used = 0;
+  cache->epoch = 0;
+  lemma_cache_set_limit(cache, DEF_LEMMA_CACHE_MEM_LIMIT);
+}
+
+
+/*
+ * Delete: the clauses are owned by the store
+ */
+void delete_lemma_cache(lemma_cache_t *cache) {
+  delete_int_array_hset(&cache->store);
+  delete_int_array_hset(&cache->rejected);
+  delete_int_array_hset(&cache->pending);
+  safe_free(cache->clause);
+  cache->clause = NULL;
+}
+
+
+/*
+ * Empty the cache
+ */
+void reset_lemma_cache(lemma_cache_t *cache) {
+  reset_int_array_hset(&cache->store);
+  reset_int_array_hset(&cache->rejected);
+  reset_int_array_hset(&cache->pending);
+  cache->nclauses = 0;
+  cache->mem_used = 0;
+  cache->epoch ++;
+}
+
+
+/*
+ * Make room for one more clause
+ */
+static void extend_lemma_cache(lemma_cache_t *cache) {
+  uint32_t n;
+
+  n = cache->size;
+  if (n == 0) {
+    n = DEF_LEMMA_CACHE_SIZE;
+  } else {
+    n += n >> 1;
+    if (n >= MAX_LEMMA_CACHE_SIZE) {
+      out_of_memory();
+    }
+  }
+  cache->clause = (harray_t **) safe_realloc(cache->clause, n * sizeof(harray_t *));
+  cache->size = n;
+}
+
+
+/*
+ * Approximate memory used by a clause of n literals: descriptor + pointers
+ * in the clause array and in the store
+ */
+static inline size_t clause_mem(uint32_t n) {
+  return sizeof(harray_t) + n * sizeof(int32_t) + 2 * sizeof(harray_t *);
+}
+
+
+/*
+ * Check whether a[0 ... n-1] is present
+ */
+bool lemma_cache_member(lemma_cache_t *cache, uint32_t n, term_t *a) {
+  return int_array_hset_find(&cache->store, n, a) != NULL;
+}
+
+
+/*
+ * Rejected clauses
+ */
+bool lemma_cache_rejected(lemma_cache_t *cache, uint32_t n, term_t *a) {
+  return int_array_hset_find(&cache->rejected, n, a) != NULL;
+}
+
+void lemma_cache_reject(lemma_cache_t *cache, uint32_t n, term_t *a) {
+  size_t mem;
+
+  mem = cache->mem_used + clause_mem(n);
+  if (mem <= cache->mem_limit && int_array_hset_find(&cache->rejected, n, a) == NULL) {
+    (void) int_array_hset_get(&cache->rejected, n, a);
+    cache->mem_used = mem;
+  }
+}
+
+
+/*
+ * Add a[0 ... n-1] if it's not present and there's room for it
+ */
+bool lemma_cache_add(lemma_cache_t *cache, uint32_t n, term_t *a) {
+  harray_t *c;
+  size_t mem;
+  uint32_t i;
+
+  assert(n > 0);
+
+  if (lemma_cache_member(cache, n, a)) {
+    return false;
+  }
+
+  mem = cache->mem_used + clause_mem(n);
+  if (mem > cache->mem_limit) {
+    return false;
+  }
+
+  c = int_array_hset_get(&cache->store, n, a);
+  i = cache->nclauses;
+  if (i == cache->size) {
+    extend_lemma_cache(cache);
+  }
+  assert(i < cache->size);
+  cache->clause[i] = c;
+  cache->nclauses = i+1;
+  cache->mem_used = mem;
+
+  return true;
+}
+
+
+/*
+ * Pending clauses
+ */
+bool lemma_cache_add_pending(lemma_cache_t *cache, uint32_t n, term_t *a) {
+  size_t mem;
+
+  assert(n > 0);
+
+  if (lemma_cache_member(cache, n, a) || lemma_cache_rejected(cache, n, a) ||
+      lemma_cache_pending(cache, n, a)) {
+    return false;
+  }
+
+  mem = cache->mem_used + clause_mem(n);
+  if (mem > cache->mem_limit) {
+    return false;
+  }
+
+  (void) int_array_hset_get(&cache->pending, n, a);
+  cache->mem_used = mem;
+
+  return true;
+}
+
+void lemma_cache_remove_pending(lemma_cache_t *cache, uint32_t n, term_t *a) {
+  if (lemma_cache_pending(cache, n, a)) {
+    int_array_hset_remove(&cache->pending, n, a);
+    assert(cache->mem_used >= clause_mem(n));
+    cache->mem_used -= clause_mem(n);
+  }
+}
+
+void lemma_cache_collect_pending(lemma_cache_t *cache, ivector_t *v, uint32_t max) {
+  harray_t *c;
+  uint32_t i;
+
+  for (i=0; i<cache->pending.size && max > 0; i++) {
+    c = cache->pending.data[i];
+    if (c != NULL && c != DELETED_HARRAY) {
+      ivector_add(v, c->data, c->nelems);
+      ivector_push(v, NULL_TERM);
+      max --;
+    }
+  }
+}
+
+
+/*
+ * Normalize a[0 ... n-1]
+ * - t and (not t) are consecutive after sorting since (not t) is t^1
+ */
+int32_t normalize_lemma(uint32_t n, term_t *a) {
+  uint32_t i, j;
+  term_t t;
+
+  if (n <= 1) return n;
+
+  int_array_sort(a, n);
+  t = a[0];
+  j = 1;
+  for (i=1; i<n; i++) {
+    if (a[i] != t) {
+      if (a[i] == opposite_term(t)) {
+        return -1;
+      }
+      t = a[i];
+      a[j] = t;
+      j ++;
+    }
+  }
+
+  return j;
+}
+
+
+/*
+ * Mark all terms in the cache
+ */
+static void mark_clause(term_table_t *terms, harray_t *c) {
+  uint32_t j;
+
+  for (j=0; j<c->nelems; j++) {
+    term_table_set_gc_mark(terms, index_of(c->data[j]));
+  }
+}
+
+void lemma_cache_gc_mark(lemma_cache_t *cache, term_table_t *terms) {
+  harray_t *c;
+  uint32_t i;
+
+  for (i=0; i<cache->nclauses; i++) {
+    mark_clause(terms, cache->clause[i]);
+  }
+  for (i=0; i<cache->pending.size; i++) {
+    c = cache->pending.data[i];
+    if (c != NULL && c != DELETED_HARRAY) {
+      mark_clause(terms, c);
+    }
+  }
+}
+
+
+/*
+ * Flatten: each clause is terminated by true_term
+ */
+void lemma_cache_flatten(lemma_cache_t *cache, ivector_t *v) {
+  harray_t *c;
+  uint32_t i;
+
+  for (i=0; i<cache->nclauses; i++) {
+    c = cache->clause[i];
+    ivector_add(v, c->data, c->nelems);
+    ivector_push(v, true_term);
+  }
+}
+
+
+/*
+ * Add the flattened clauses of a[0 ... n-1] to the pending set
+ * - a clause that's not terminated by true_term is ignored
+ */
+uint32_t lemma_cache_add_flattened(lemma_cache_t *cache, uint32_t n, term_t *a) {
+  uint32_t i, j, count;
+  int32_t k;
+
+  count = 0;
+  j = 0;
+  for (i=0; i<n; i++) {
+    if (a[i] == true_term) {
+      k = normalize_lemma(i - j, a + j);
+      if (k > 0 && k <= MAX_CACHED_LEMMA_LENGTH && lemma_cache_add_pending(cache, k, a + j)) {
+        count ++;
+      }
+      j = i+1;
+    }
+  }
+
+  return count;
+}
+
+
+
+/*
+ * PER-CONTEXT DATA
+ */
+void init_lemma_exchange(lemma_exchange_t *exchange) {
+  init_ivector(&exchange->log, 0);
+  init_int_hset(&exchange->added, 0);
+  init_ivector(&exchange->trail, 0);
+  init_ivector(&exchange->marks, 0);
+  exchange->epoch = 0;
+}
+
+void delete_lemma_exchange(lemma_exchange_t *exchange) {
+  delete_ivector(&exchange->log);
+  delete_int_hset(&exchange->added);
+  delete_ivector(&exchange->trail);
+  delete_ivector(&exchange->marks);
+}
+
+void reset_lemma_exchange(lemma_exchange_t *exchange) {
+  ivector_reset(&exchange->log);
+  int_hset_reset(&exchange->added);
+  ivector_reset(&exchange->trail);
+  ivector_reset(&exchange->marks);
+  exchange->epoch = 0;
+}
+
+
+/*
+ * Record that clause i was added
+ */
+void lemma_exchange_add_clause(lemma_exchange_t *exchange, uint32_t i) {
+  if (int_hset_add(&exchange->added, i)) {
+    ivector_push(&exchange->trail, i);
+  }
+}
+
+
+/*
+ * New epoch: empty the trail but keep the number of marks
+ */
+void lemma_exchange_set_epoch(lemma_exchange_t *exchange, uint32_t epoch) {
+  uint32_t i;
+
+  if (exchange->epoch != epoch) {
+    int_hset_reset(&exchange->added);
+    ivector_reset(&exchange->trail);
+    for (i=0; i<exchange->marks.size; i++) {
+      exchange->marks.data[i] = 0;
+    }
+    exchange->epoch = epoch;
+  }
+}
+
+
+/*
+ * Push: save the trail size
+ */
+void lemma_exchange_push(lemma_exchange_t *exchange) {
+  ivector_push(&exchange->marks, exchange->trail.size);
+}
+
+
+/*
+ * Pop: the clauses added since the last push were removed from the
+ * context. We rebuild the set from what's left on the trail.
+ */
+void lemma_exchange_pop(lemma_exchange_t *exchange) {
+  uint32_t i, n;
+
+  assert(exchange->marks.size > 0);
+
+  n = ivector_pop2(&exchange->marks);
+  if (n < exchange->trail.size) {
+    ivector_shrink(&exchange->trail, n);
+    int_hset_reset(&exchange->added);
+    for (i=0; i<n; i++) {
+      int_hset_add(&exchange->added, exchange->trail.data[i]);
+    }
+  }
+
+  // the log refers to literals that may have been deleted
+  ivector_reset(&exchange->log);
+}
@@ -0,0 +1,259 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CACHE OF LEMMAS SHARED BETWEEN CONTEXTS
+ *
+ * The cache stores clauses over Boolean terms of the global term
+ * table. Every clause in the cache must be valid in the theories
+ * (i.e., true independently of any assertion) so that it can be
+ * added to any context. A clause is stored as a sorted array of
+ * terms without duplicates, and it's hash-consed so that it's
+ * stored only once.
+ *
+ * Clauses are exported by a context after a call to check, and
+ * imported by other contexts once all their terms have been
+ * internalized. The cache has a memory limit: once it's reached,
+ * new clauses are ignored. The cache also keeps the candidate clauses
+ * that could not be shown valid, so that they're not checked again.
+ *
+ * Clauses loaded from a file are kept in a pending set until they are
+ * checked by a context that uses the cache. They are not imported
+ * before that.
+ *
+ * Each context that uses the cache keeps a lemma_exchange_t structure:
+ * - log = theory lemmas recorded by the CDCL solver during the search
+ *   (cf. smt_core_set_lemma_log)
+ * - added = set of cached clauses already added to the context
+ *   (identified by their index in the cache)
+ * - trail = the same clauses in the order they were added
+ * - marks = trail size at each push (to undo the additions on pop)
+ * - epoch = epoch of the cache when the clauses were added
+ *
+ * The cache's epoch is incremented on every reset: clause indices
+ * recorded in an earlier epoch don't refer to the current clauses.
+ */
+
+#ifndef __LEMMA_CACHE_H
+#define __LEMMA_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "terms/terms.h"
+#include "utils/int_array_hsets.h"
+#include "utils/int_hash_sets.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Cache:
+ * - store = hash-consing table for the clauses
+ * - rejected = clauses that could not be shown valid
+ * - pending = clauses not checked yet
+ * - clause[0 ... nclauses-1] = the clauses in the order they were added
+ * - size = size of the clause array
+ * - mem_used = approximate memory used by the clauses (in bytes),
+ *   including the rejected and pending ones
+ * - mem_limit = bound on mem_used
+ * - epoch = number of resets
+ */
+typedef struct lemma_cache_s {
+  int_array_hset_t store;
+  int_array_hset_t rejected;
+  int_array_hset_t pending;
+  harray_t **clause;
+  uint32_t nclauses;
+  uint32_t size;
+  size_t mem_used;
+  size_t mem_limit;
+  uint32_t epoch;
+} lemma_cache_t;
+
+#define DEF_LEMMA_CACHE_SIZE 256
+#define MAX_LEMMA_CACHE_SIZE (UINT32_MAX/sizeof(harray_t *))
+
+// default memory limit in MB
+#define DEF_LEMMA_CACHE_MEM_LIMIT 64
+
+
+/*
+ * Bounds used when clauses are exported from a context:
+ * - MAX_CACHED_LEMMA_LENGTH = max number of literals in a theory lemma
+ * - MAX_CACHED_LEARNED_LENGTH = max number of literals in a learned clause
+ * - MAX_LEMMA_VALIDATIONS = max number of new clauses checked after each call to check
+ * - MAX_LEMMA_VALIDATION_CONFLICTS = conflict budget for checking one clause
+ */
+#define MAX_CACHED_LEMMA_LENGTH 8
+#define MAX_CACHED_LEARNED_LENGTH 4
+#define MAX_LEMMA_VALIDATIONS 100
+#define MAX_LEMMA_VALIDATION_CONFLICTS 1000
+
+
+/*
+ * Initialize cache: empty, with the default memory limit
+ */
+extern void init_lemma_cache(lemma_cache_t *cache);
+
+/*
+ * Delete: free memory
+ */
+extern void delete_lemma_cache(lemma_cache_t *cache);
+
+/*
+ * Remove all clauses (keep the memory limit)
+ */
+extern void reset_lemma_cache(lemma_cache_t *cache);
+
+/*
+ * Set the memory limit (in MB, saturated at SIZE_MAX bytes)
+ * - this doesn't remove any clause
+ */
+static inline void lemma_cache_set_limit(lemma_cache_t *cache, uint32_t mb) {
+  uint64_t bytes;
+
+  bytes = ((uint64_t) mb) << 20;
+  cache->mem_limit = (bytes > (uint64_t) SIZE_MAX) ? SIZE_MAX : (size_t) bytes;
+}
+
+/*
+ * Check whether clause a[0 ... n-1] is in the cache
+ * - a must be normalized (cf. normalize_lemma)
+ */
+extern bool lemma_cache_member(lemma_cache_t *cache, uint32_t n, term_t *a);
+
+/*
+ * Check whether clause a[0 ... n-1] is in the rejected set
+ */
+extern bool lemma_cache_rejected(lemma_cache_t *cache, uint32_t n, term_t *a);
+
+/*
+ * Add clause a[0 ... n-1] to the rejected set (unless the memory limit is reached)
+ */
+extern void lemma_cache_reject(lemma_cache_t *cache, uint32_t n, term_t *a);
+
+/*
+ * Add clause a[0 ... n-1] to the cache
+ * - a must be normalized and valid
+ * - return true if the clause was added
+ * - return false if it's already present or if the memory limit is reached
+ */
+extern bool lemma_cache_add(lemma_cache_t *cache, uint32_t n, term_t *a);
+
+/*
+ * Pending clauses:
+ * - add_pending adds a[0 ... n-1] to the pending set unless it's already
+ *   known (cached, rejected, or pending) or the memory limit is reached.
+ *   It returns true if the clause was added.
+ * - remove_pending removes a[0 ... n-1] from the pending set
+ * - collect_pending copies at most max pending clauses into v,
+ *   each clause followed by NULL_TERM
+ */
+extern bool lemma_cache_add_pending(lemma_cache_t *cache, uint32_t n, term_t *a);
+extern void lemma_cache_remove_pending(lemma_cache_t *cache, uint32_t n, term_t *a);
+extern void lemma_cache_collect_pending(lemma_cache_t *cache, ivector_t *v, uint32_t max);
+
+static inline bool lemma_cache_pending(lemma_cache_t *cache, uint32_t n, term_t *a) {
+  return int_array_hset_find(&cache->pending, n, a) != NULL;
+}
+
+static inline uint32_t lemma_cache_num_pending(lemma_cache_t *cache) {
+  return cache->pending.nelems;
+}
+
+/*
+ * Normalize clause a[0 ... n-1]: sort the terms and remove duplicates
+ * - return the new size or -1 if the clause is a tautology
+ *   (i.e., it contains both t and (not t))
+ */
+extern int32_t normalize_lemma(uint32_t n, term_t *a);
+
+/*
+ * Number of clauses in the cache
+ */
+static inline uint32_t lemma_cache_num_clauses(lemma_cache_t *cache) {
+  return cache->nclauses;
+}
+
+/*
+ * Mark all terms that occur in the cache, including the pending
+ * clauses (for the garbage collector)
+ */
+extern void lemma_cache_gc_mark(lemma_cache_t *cache, term_table_t *terms);
+
+/*
+ * Copy all the clauses into vector v: each clause is followed by true_term
+ * (this is the format used to save the cache in a term archive)
+ */
+extern void lemma_cache_flatten(lemma_cache_t *cache, ivector_t *v);
+
+/*
+ * Add clauses stored in a[0 ... n-1] in the format above to the pending set
+ * - clauses with more than MAX_CACHED_LEMMA_LENGTH literals are ignored
+ * - return the number of clauses added
+ */
+extern uint32_t lemma_cache_add_flattened(lemma_cache_t *cache, uint32_t n, term_t *a);
+
+
+
+/*
+ * Per-context data
+ */
+typedef struct lemma_exchange_s {
+  ivector_t log;
+  int_hset_t added;
+  ivector_t trail;
+  ivector_t marks;
+  uint32_t epoch;
+} lemma_exchange_t;
+
+
+/*
+ * Initialize/delete/reset
+ */
+extern void init_lemma_exchange(lemma_exchange_t *exchange);
+extern void delete_lemma_exchange(lemma_exchange_t *exchange);
+extern void reset_lemma_exchange(lemma_exchange_t *exchange);
+
+/*
+ * Check whether clause i of the cache was added to the context
+ */
+static inline bool lemma_exchange_has_clause(lemma_exchange_t *exchange, uint32_t i) {
+  return int_hset_member(&exchange->added, i);
+}
+
+/*
+ * Record that clause i was added
+ */
+extern void lemma_exchange_add_clause(lemma_exchange_t *exchange, uint32_t i);
+
+/*
+ * Switch to a new epoch: forget all the added clauses
+ * - no change if epoch is the current epoch
+ */
+extern void lemma_exchange_set_epoch(lemma_exchange_t *exchange, uint32_t epoch);
+
+/*
+ * Push/pop: pop forgets the clauses added since the matching push
+ */
+extern void lemma_exchange_push(lemma_exchange_t *exchange);
+extern void lemma_exchange_pop(lemma_exchange_t *exchange);
+
+
+#endif /* __LEMMA_CACHE_H */
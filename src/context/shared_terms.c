@@ -16,9 +16,14 @@
  * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#if defined(THREAD_SAFE) && !defined(MINGW)
+#include <pthread.h>
+#endif
+
 #include <assert.h>
 
 #include "context/shared_terms.h"
+#include "utils/memalloc.h"
 
 /*
  * Initialization:
@@ -30,6 +35,7 @@ void init_sharing_map(sharing_map_t *map, intern_tbl_t *intern) {
   map->intern = intern;
   map->terms = intern->terms;
   init_int_queue(&map->queue, 128);
+  map->read_only = false;
 }
 
 
@@ -69,7 +75,11 @@ static void sharing_map_process_occurrence(sharing_map_t *map, int32_t i, int32_
 
   assert(good_term_idx(map->terms, i) && good_term_idx(map->terms, p));
 
-  root = intern_tbl_get_root(map->intern, pos_term(i));
+  if (map->read_only) {
+    root = intern_tbl_find_root(map->intern, pos_term(i));
+  } else {
+    root = intern_tbl_get_root(map->intern, pos_term(i));
+  }
   if (! intern_tbl_root_is_mapped(map->intern, root)) {
     // root not internalized yet
     i = index_of(root);
@@ -287,6 +297,141 @@ void sharing_map_add_terms(sharing_map_t *map, term_t *a, uint32_t n) {
 }
 
 
+/*
+ * PARALLEL EXPLORATION
+ */
+
+/*
+ * Worker: explore a[0 ... n-1] using its own map
+ */
+typedef struct sharing_worker_s {
+  sharing_map_t map;
+  term_t *a;
+  uint32_t n;
+} sharing_worker_t;
+
+static void run_sharing_worker(sharing_worker_t *w) {
+  sharing_map_add_terms(&w->map, w->a, w->n);
+}
+
+/*
+ * Merge the map of worker w into map
+ * - top = set of indices of all the terms explored at the top-level
+ *
+ * If i has parent p in both map and w->map then p was explored in the
+ * two groups. The sequential exploration visits p once if p is not a
+ * top-level term (so i has a unique parent). Otherwise, p is explored
+ * at least twice and i is shared.
+ */
+static void sharing_map_merge(sharing_map_t *map, sharing_worker_t *w, int_hset_t *top) {
+  int_hmap_pair_t *q, *r;
+
+  for (q = int_hmap_first_record(&w->map.hmap); q != NULL; q = int_hmap_next_record(&w->map.hmap, q)) {
+    r = int_hmap_get(&map->hmap, q->key);
+    if (r->val < 0) {
+      r->val = q->val;
+    } else if (r->val != q->val || q->val == bool_const || int_hset_member(top, q->val)) {
+      r->val = bool_const;
+    }
+  }
+}
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+static void *sharing_worker_main(void *arg) {
+  run_sharing_worker(arg);
+  return NULL;
+}
+
+/*
+ * Run the p workers: worker 0 runs in this thread
+ */
+static void run_sharing_workers(sharing_worker_t *worker, uint32_t p) {
+  pthread_t *thread;
+  bool *started;
+  uint32_t k;
+
+  thread = (pthread_t *) safe_malloc(p * sizeof(pthread_t));
+  started = (bool *) safe_malloc(p * sizeof(bool));
+
+  for (k=1; k<p; k++) {
+    started[k] = (pthread_create(thread + k, NULL, sharing_worker_main, worker + k) == 0);
+  }
+  run_sharing_worker(worker);
+  for (k=1; k<p; k++) {
+    if (started[k]) {
+      pthread_join(thread[k], NULL);
+    } else {
+      run_sharing_worker(worker + k);
+    }
+  }
+
+  safe_free(started);
+  safe_free(thread);
+}
+
+#else
+
+/*
+ * No thread support: run the workers one after the other
+ */
+static void run_sharing_workers(sharing_worker_t *worker, uint32_t p) {
+  uint32_t k;
+
+  for (k=0; k<p; k++) {
+    run_sharing_worker(worker + k);
+  }
+}
+
+#endif
+
+
+/*
+ * Process all terms in array a using up to num_threads threads
+ */
+void sharing_map_add_terms_mt(sharing_map_t *map, term_t *a, uint32_t n, uint32_t num_threads) {
+  sharing_worker_t *worker;
+  int_hset_t top;
+  uint32_t i, k, p, len;
+
+  assert(map->hmap.nelems == 0);
+
+  p = n/SHARING_MAP_MT_MIN_TERMS;
+  if (p > num_threads) p = num_threads;
+
+#if !defined(THREAD_SAFE) || defined(MINGW)
+  p = 1;
+#endif
+
+  if (p <= 1) {
+    sharing_map_add_terms(map, a, n);
+    return;
+  }
+
+  worker = (sharing_worker_t *) safe_malloc(p * sizeof(sharing_worker_t));
+  len = n/p;
+  for (k=0; k<p; k++) {
+    init_sharing_map(&worker[k].map, map->intern);
+    worker[k].map.read_only = true;
+    worker[k].a = a + k * len;
+    worker[k].n = (k < p-1) ? len : n - k * len;
+  }
+
+  run_sharing_workers(worker, p);
+
+  init_int_hset(&top, 0);
+  for (i=0; i<n; i++) {
+    int_hset_add(&top, index_of(a[i]));
+  }
+  for (k=0; k<p; k++) {
+    sharing_map_merge(map, worker + k, &top);
+    delete_sharing_map(&worker[k].map);
+  }
+  delete_int_hset(&top);
+  safe_free(worker);
+}
+
+
 /*
  * Check whether t occurs more that once among all the terms visited so far 
  * - this returns false if t is not in the map or if t has been seen only once
@@ -38,6 +38,7 @@
 #include "context/internalization_table.h"
 #include "terms/terms.h"
 #include "utils/int_hash_map.h"
+#include "utils/int_hash_sets.h"
 #include "utils/int_queues.h"
 
 
@@ -50,6 +51,9 @@
  * - intern = pointer to the relevant internalization table
  * - terms = pointer to the relevant term table
  * - queue for exploring terms
+ * - read_only: if true, the internalization table is not modified
+ *   (no path compression). This is required when several maps
+ *   are built in parallel.
  *
  * We use bool_const as a marker for terms seen more than once.
  * The hmap is based on term indices so it can't distinguish between
@@ -60,9 +64,16 @@ typedef struct sharing_map_s {
   term_table_t *terms;
   intern_tbl_t *intern;
   int_queue_t queue;
+  bool read_only;
 } sharing_map_t;
 
 
+/*
+ * Minimal number of terms per thread for sharing_map_add_terms_mt
+ */
+#define SHARING_MAP_MT_MIN_TERMS 1000
+
+
 /*
  * Initialization:
  * - intern must be the context's internalization table
@@ -97,6 +108,21 @@ extern void sharing_map_add_term(sharing_map_t *map, term_t t);
 extern void sharing_map_add_terms(sharing_map_t *map, term_t *a, uint32_t n);
 
 
+/*
+ * Parallel version of sharing_map_add_terms:
+ * - map must be empty
+ * - the array a is split into at most num_threads groups of at least
+ *   SHARING_MAP_MT_MIN_TERMS terms. Each group is explored in a separate
+ *   thread (using a separate map) then the results are merged into map.
+ * - the result is the same as sharing_map_add_terms(map, a, n)
+ * - the term table and the internalization table must not be modified
+ *   by another thread while this function runs.
+ * - if Yices is compiled without thread support, this is the same
+ *   as sharing_map_add_terms.
+ */
+extern void sharing_map_add_terms_mt(sharing_map_t *map, term_t *a, uint32_t n, uint32_t num_threads);
+
+
 /*
  * Check whether t occurs more that once among all the terms visited so far 
  * - this returns false if t is not in the map or if t has been seen only once
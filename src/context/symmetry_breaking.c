@@ -17,7 +17,7 @@
  */
 
 /*
- * SUPPORT FOR BREAKING SYMMETRIES IN UF FORMULAS
+ * SUPPORT FOR BREAKING SYMMETRIES IN UF, ARITHMETIC, AND BITVECTOR FORMULAS
  */
 
 #include <stdbool.h>
@@ -26,7 +26,10 @@
 #include "context/context_utils.h"
 #include "context/internalization_codes.h"
 #include "context/symmetry_breaking.h"
+#include "utils/hash_functions.h"
 #include "utils/int_array_sort.h"
+#include "utils/int_array_sort2.h"
+#include "utils/int_hash_map.h"
 #include "utils/memalloc.h"
 #include "utils/ptr_array_sort2.h"
 
@@ -777,7 +780,8 @@ static inline void reset_ctx_subst(ctx_subst_t *s) {
 /*
  * Get the term mapped to t in s
  * - raise an exception (by longjmp(s->env, -1) if something goes wrong
- *   (i.e., t is not in the QF_UF fragment)
+ *   (i.e., t is not in the quantifier-free UF, arithmetic, and bitvector
+ *   fragment)
  */
 static term_t ctx_subst(ctx_subst_t *s, term_t t);
 
@@ -924,6 +928,257 @@ static term_t ctx_subst_distinct(ctx_subst_t *s, composite_term_t *d) {
   return result;
 }
 
+// (bvarray t0 ... t_n-1)
+static term_t ctx_subst_bvarray(ctx_subst_t *s, composite_term_t *d) {
+  term_t *a;
+  term_t result;
+
+  assert(d->arity >= 1);
+
+  a = ctx_subst_children(s, d);
+  result = mk_bvarray(&s->mngr, d->arity, a);
+  free_istack_array(&s->stack, a);
+
+  return result;
+}
+
+// (bit t i)
+static term_t ctx_subst_bit(ctx_subst_t *s, select_term_t *d) {
+  uint32_t idx;
+  term_t t;
+
+  idx = d->idx; // d may become invalid if new terms are created
+  t = ctx_subst(s, d->arg);
+  return mk_bitextract(&s->mngr, t, idx);
+}
+
+// (t == 0), (t >= 0), (is_int t), (floor t), (ceil t), (abs t)
+static term_t ctx_subst_arith_unary(ctx_subst_t *s, term_kind_t kind, term_t t) {
+  term_t result;
+
+  t = ctx_subst(s, t);
+  switch (kind) {
+  case ARITH_EQ_ATOM:
+    result = mk_arith_term_eq0(&s->mngr, t);
+    break;
+
+  case ARITH_GE_ATOM:
+    result = mk_arith_term_geq0(&s->mngr, t);
+    break;
+
+  case ARITH_IS_INT_ATOM:
+    result = mk_arith_is_int(&s->mngr, t);
+    break;
+
+  case ARITH_FLOOR:
+    result = mk_arith_floor(&s->mngr, t);
+    break;
+
+  case ARITH_CEIL:
+    result = mk_arith_ceil(&s->mngr, t);
+    break;
+
+  default:
+    assert(kind == ARITH_ABS);
+    result = mk_arith_abs(&s->mngr, t);
+    break;
+  }
+
+  return result;
+}
+
+// binary arithmetic and bitvector terms: (op t1 t2)
+static term_t ctx_subst_binary(ctx_subst_t *s, term_kind_t kind, composite_term_t *d) {
+  term_manager_t *mngr;
+  term_t t1, t2;
+  term_t result;
+
+  assert(d->arity == 2);
+
+  t1 = ctx_subst(s, d->arg[0]);
+  t2 = ctx_subst(s, d->arg[1]);
+
+  mngr = &s->mngr;
+  switch (kind) {
+  case ARITH_BINEQ_ATOM:
+    result = mk_arith_eq(mngr, t1, t2);
+    break;
+
+  case ARITH_RDIV:
+    result = mk_arith_rdiv(mngr, t1, t2);
+    break;
+
+  case ARITH_IDIV:
+    result = mk_arith_idiv(mngr, t1, t2);
+    break;
+
+  case ARITH_MOD:
+    result = mk_arith_mod(mngr, t1, t2);
+    break;
+
+  case ARITH_DIVIDES_ATOM:
+    result = mk_arith_divides(mngr, t1, t2);
+    break;
+
+  case BV_DIV:
+    result = mk_bvdiv(mngr, t1, t2);
+    break;
+
+  case BV_REM:
+    result = mk_bvrem(mngr, t1, t2);
+    break;
+
+  case BV_SDIV:
+    result = mk_bvsdiv(mngr, t1, t2);
+    break;
+
+  case BV_SREM:
+    result = mk_bvsrem(mngr, t1, t2);
+    break;
+
+  case BV_SMOD:
+    result = mk_bvsmod(mngr, t1, t2);
+    break;
+
+  case BV_SHL:
+    result = mk_bvshl(mngr, t1, t2);
+    break;
+
+  case BV_LSHR:
+    result = mk_bvlshr(mngr, t1, t2);
+    break;
+
+  case BV_ASHR:
+    result = mk_bvashr(mngr, t1, t2);
+    break;
+
+  case BV_EQ_ATOM:
+    result = mk_bveq(mngr, t1, t2);
+    break;
+
+  case BV_GE_ATOM:
+    result = mk_bvge(mngr, t1, t2);
+    break;
+
+  default:
+    assert(kind == BV_SGE_ATOM);
+    result = mk_bvsge(mngr, t1, t2);
+    break;
+  }
+
+  return result;
+}
+
+/*
+ * Check whether t is a polynomial or a power product
+ */
+static bool is_poly_or_pprod(term_table_t *terms, term_t t) {
+  switch (term_kind(terms, t)) {
+  case POWER_PRODUCT:
+  case ARITH_POLY:
+  case BV64_POLY:
+  case BV_POLY:
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+// power product
+// we raise an exception if a variable of p is mapped to a polynomial or a product
+// (this prevents degree overflow).
+static term_t ctx_subst_pprod(ctx_subst_t *s, pprod_t *p) {
+  term_t *a;
+  term_t result;
+  uint32_t i, n;
+
+  n = p->len;
+  a = alloc_istack_array(&s->stack, n);
+  for (i=0; i<n; i++) {
+    a[i] = ctx_subst(s, p->prod[i].var);
+    if (is_poly_or_pprod(s->terms, a[i])) {
+      longjmp(s->env, -1);
+    }
+  }
+  result = mk_pprod(&s->mngr, p, n, a);
+  free_istack_array(&s->stack, a);
+
+  return result;
+}
+
+// arithmetic polynomial
+static term_t ctx_subst_poly(ctx_subst_t *s, polynomial_t *p) {
+  term_t *a;
+  term_t result;
+  uint32_t i, n;
+
+  n = p->nterms;
+  a = alloc_istack_array(&s->stack, n);
+
+  i = 0;
+  if (p->mono[0].var == const_idx) { // skip the constant
+    a[0] = const_idx;
+    i = 1;
+  }
+  while (i<n) {
+    a[i] = ctx_subst(s, p->mono[i].var);
+    i ++;
+  }
+  result = mk_arith_poly(&s->mngr, p, n, a);
+  free_istack_array(&s->stack, a);
+
+  return result;
+}
+
+// bitvector polynomial, 64bit coefficients
+static term_t ctx_subst_bvpoly64(ctx_subst_t *s, bvpoly64_t *p) {
+  term_t *a;
+  term_t result;
+  uint32_t i, n;
+
+  n = p->nterms;
+  a = alloc_istack_array(&s->stack, n);
+
+  i = 0;
+  if (p->mono[0].var == const_idx) { // skip the constant
+    a[0] = const_idx;
+    i = 1;
+  }
+  while (i<n) {
+    a[i] = ctx_subst(s, p->mono[i].var);
+    i ++;
+  }
+  result = mk_bvarith64_poly(&s->mngr, p, n, a);
+  free_istack_array(&s->stack, a);
+
+  return result;
+}
+
+// bitvector polynomial, more than 64bits
+static term_t ctx_subst_bvpoly(ctx_subst_t *s, bvpoly_t *p) {
+  term_t *a;
+  term_t result;
+  uint32_t i, n;
+
+  n = p->nterms;
+  a = alloc_istack_array(&s->stack, n);
+
+  i = 0;
+  if (p->mono[0].var == const_idx) { // skip the constant
+    a[0] = const_idx;
+    i = 1;
+  }
+  while (i<n) {
+    a[i] = ctx_subst(s, p->mono[i].var);
+    i ++;
+  }
+  result = mk_bvarith_poly(&s->mngr, p, n, a);
+  free_istack_array(&s->stack, a);
+
+  return result;
+}
+
 
 static term_t ctx_subst(ctx_subst_t *s, term_t t) {
   term_table_t *terms;
@@ -945,6 +1200,9 @@ static term_t ctx_subst(ctx_subst_t *s, term_t t) {
     switch (term_kind(terms, r)) {
     case CONSTANT_TERM:
     case UNINTERPRETED_TERM:
+    case ARITH_CONSTANT:
+    case BV64_CONSTANT:
+    case BV_CONSTANT:
       x = r;
       break;
 
@@ -981,6 +1239,73 @@ static term_t ctx_subst(ctx_subst_t *s, term_t t) {
       x = ctx_subst_distinct(s, distinct_term_desc(terms, r));
       break;
 
+    case ARITH_EQ_ATOM:
+      x = ctx_subst_arith_unary(s, ARITH_EQ_ATOM, arith_eq_arg(terms, r));
+      break;
+
+    case ARITH_GE_ATOM:
+      x = ctx_subst_arith_unary(s, ARITH_GE_ATOM, arith_ge_arg(terms, r));
+      break;
+
+    case ARITH_IS_INT_ATOM:
+      x = ctx_subst_arith_unary(s, ARITH_IS_INT_ATOM, arith_is_int_arg(terms, r));
+      break;
+
+    case ARITH_FLOOR:
+      x = ctx_subst_arith_unary(s, ARITH_FLOOR, arith_floor_arg(terms, r));
+      break;
+
+    case ARITH_CEIL:
+      x = ctx_subst_arith_unary(s, ARITH_CEIL, arith_ceil_arg(terms, r));
+      break;
+
+    case ARITH_ABS:
+      x = ctx_subst_arith_unary(s, ARITH_ABS, arith_abs_arg(terms, r));
+      break;
+
+    case ARITH_BINEQ_ATOM:
+    case ARITH_RDIV:
+    case ARITH_IDIV:
+    case ARITH_MOD:
+    case ARITH_DIVIDES_ATOM:
+    case BV_DIV:
+    case BV_REM:
+    case BV_SDIV:
+    case BV_SREM:
+    case BV_SMOD:
+    case BV_SHL:
+    case BV_LSHR:
+    case BV_ASHR:
+    case BV_EQ_ATOM:
+    case BV_GE_ATOM:
+    case BV_SGE_ATOM:
+      x = ctx_subst_binary(s, term_kind(terms, r), composite_term_desc(terms, r));
+      break;
+
+    case BV_ARRAY:
+      x = ctx_subst_bvarray(s, bvarray_term_desc(terms, r));
+      break;
+
+    case BIT_TERM:
+      x = ctx_subst_bit(s, bit_term_desc(terms, r));
+      break;
+
+    case POWER_PRODUCT:
+      x = ctx_subst_pprod(s, pprod_term_desc(terms, r));
+      break;
+
+    case ARITH_POLY:
+      x = ctx_subst_poly(s, poly_term_desc(terms, r));
+      break;
+
+    case BV64_POLY:
+      x = ctx_subst_bvpoly64(s, bvpoly64_term_desc(terms, r));
+      break;
+
+    case BV_POLY:
+      x = ctx_subst_bvpoly(s, bvpoly_term_desc(terms, r));
+      break;
+
     default:
       longjmp(s->env, -1);
       break;
@@ -1010,7 +1335,8 @@ static void ctx_subst_array(ctx_subst_t *s, term_t *a, term_t *b, uint32_t n) {
 
 
 /*
- * Apply s to vectors ctx->top_eqs, ctx->top_atoms, ctx->top_formulas, ctx->subst_eqs, andc ctx->aux_eqs
+ * Apply s to vectors ctx->top_eqs, ctx->top_atoms, ctx->top_formulas, ctx->top_interns,
+ * ctx->subst_eqs, and ctx->aux_eqs
  * - store the result in array a
  */
 static void ctx_subst_assertions(ctx_subst_t *s, context_t *ctx, term_t *a) {
@@ -1032,6 +1358,11 @@ static void ctx_subst_assertions(ctx_subst_t *s, context_t *ctx, term_t *a) {
   ctx_subst_array(s, v->data, a, n);
   a += n;
 
+  v = &ctx->top_interns;
+  n = v->size;
+  ctx_subst_array(s, v->data, a, n);
+  a += n;
+
   v = &ctx->subst_eqs;
   n = v->size;
   ctx_subst_array(s, v->data, a, n);
@@ -1093,10 +1424,13 @@ static bool check_perm_invariance(context_t *ctx, ctx_subst_t *s, term_t *c, uin
    * If we have more than MAX_ARITY assertions, we may fail to build norm1, norm2, norm3.
    */
   num_assertions = (uint64_t) ctx->top_eqs.size +  (uint64_t) ctx->top_atoms.size + (uint64_t) ctx->top_formulas.size +
-    + (uint64_t) ctx->subst_eqs.size + (uint64_t) ctx->aux_eqs.size;
+    + (uint64_t) ctx->top_interns.size + (uint64_t) ctx->subst_eqs.size + (uint64_t) ctx->aux_eqs.size;
   if (num_assertions > (uint64_t) YICES_MAX_ARITY) {
     return false;
   }
+  if (num_assertions == 0) {
+    return true;
+  }
 
   assert(num_assertions <= (uint64_t) UINT32_MAX);
 
@@ -1660,6 +1994,9 @@ static term_t make_aux_eq(term_table_t *terms, term_t t, term_t c) {
  * - n must be positive
  * - the terms (= t c[i]) must not simplify to false
  *
+ * If breaker->guard is not NULL_TERM, the clause is
+ * (or (not guard) (= t c[0]) .... (= t c[n-1])).
+ *
  * Side effect: uses break->aux
  *
  * Precaution: if (or (= t c[0]) ... (= t c[n-1])) is already
@@ -1680,7 +2017,7 @@ static void add_symmetry_breaking_clause(sym_breaker_t *breaker, term_t t, term_
 
   assert(intern_tbl_is_root(intern, t));
 
-  if (n == 1) {
+  if (n == 1 && breaker->guard == NULL_TERM) {
     /*
      * special case: we add (= t c[0]) as an auxiliary equality
      */
@@ -1705,13 +2042,16 @@ static void add_symmetry_breaking_clause(sym_breaker_t *breaker, term_t t, term_
 
       ivector_push(v, eq);
     }
+    if (breaker->guard != NULL_TERM) {
+      ivector_push(v, opposite_term(breaker->guard));
+    }
 
     /*
      * build (or v->data[0] ... v->data[n])
      * add it as a top-level formula
      */
-    int_array_sort(v->data, n);
-    or = or_term(terms, n, v->data);
+    int_array_sort(v->data, v->size);
+    or = or_term(terms, v->size, v->data);
     assert(intern_tbl_is_root(intern, or) && !term_is_false(ctx, or));
 
 #if TRACE
@@ -1818,6 +2158,524 @@ void break_symmetries(sym_breaker_t *breaker, sym_breaker_sets_t *s) {
 
 
 
+/*
+ * VECTOR OF VARIABLE CLASSES
+ */
+
+static void init_var_class_vector(var_class_vector_t *v) {
+  v->data = NULL;
+  v->nelems = 0;
+  v->size = 0;
+}
+
+static void extend_var_class_vector(var_class_vector_t *v) {
+  uint32_t n;
+
+  n = v->size;
+  if (n == 0) {
+    n = DEF_VAR_CLASS_VECTOR_SIZE;
+    assert(v->data == NULL && n <= MAX_VAR_CLASS_VECTOR_SIZE);
+  } else {
+    n += (n>>1) + 1;
+    assert(n > v->size);
+    if (n > MAX_VAR_CLASS_VECTOR_SIZE) {
+      out_of_memory();
+    }
+  }
+
+  v->data = (var_class_t *) safe_realloc(v->data, n * sizeof(var_class_t));
+  v->size = n;
+}
+
+static void delete_var_class_vector(var_class_vector_t *v) {
+  uint32_t i, n;
+
+  n = v->nelems;
+  for (i=0; i<n; i++) {
+    safe_free(v->data[i].var);
+  }
+  safe_free(v->data);
+  v->data = NULL;
+}
+
+/*
+ * Add a class for variables a[0 ... n-1]
+ */
+static void add_var_class(var_class_vector_t *v, term_t *a, uint32_t n) {
+  term_t *tmp;
+  uint32_t i;
+
+  assert(n <= UINT32_MAX/sizeof(term_t));
+
+  i = v->nelems;
+  if (i == v->size) {
+    extend_var_class_vector(v);
+  }
+  assert(i < v->size);
+
+  tmp = (term_t *) safe_malloc(n * sizeof(term_t));
+  for (i=0; i<n; i++) {
+    tmp[i] = a[i];
+  }
+  v->data[v->nelems].var = tmp;
+  v->data[v->nelems].num_vars = n;
+  v->nelems ++;
+}
+
+
+
+
+/*
+ * OCCURRENCE SIGNATURES
+ */
+
+/*
+ * Signature table:
+ * - map: variable x --> index k in vars and sig
+ * - vars[k] = variable, sig[k] = its signature
+ * - the signature of x is the sum of the hash codes of all its occurrences
+ */
+typedef struct var_sig_table_s {
+  term_table_t *terms;
+  int_hmap_t map;
+  ivector_t vars;
+  ivector_t sig;
+} var_sig_table_t;
+
+static void init_var_sig_table(var_sig_table_t *table, term_table_t *terms) {
+  table->terms = terms;
+  init_int_hmap(&table->map, 0);
+  init_ivector(&table->vars, 10);
+  init_ivector(&table->sig, 10);
+}
+
+static void delete_var_sig_table(var_sig_table_t *table) {
+  delete_int_hmap(&table->map);
+  delete_ivector(&table->vars);
+  delete_ivector(&table->sig);
+}
+
+
+/*
+ * Check whether t is a candidate variable:
+ * - t must be an arithmetic or bitvector uninterpreted term
+ * - it must be a root that's not internalized yet
+ */
+static bool is_candidate_var(sym_breaker_t *breaker, term_t t) {
+  term_table_t *terms;
+
+  terms = breaker->terms;
+  return is_pos_term(t) && term_kind(terms, t) == UNINTERPRETED_TERM &&
+    (is_arithmetic_term(terms, t) || is_bitvector_term(terms, t)) &&
+    !intern_tbl_root_is_mapped(&breaker->ctx->intern, t);
+}
+
+
+/*
+ * Record an occurrence of t in a term of the given kind:
+ * - tag = coefficient hash or position of t in that term (0 if the position doesn't matter)
+ * - t is replaced by its root then added to the exploration queue
+ */
+static void visit_occurrence(sym_breaker_t *breaker, var_sig_table_t *table, term_t t, term_kind_t kind, uint32_t tag) {
+  int_hmap_pair_t *r;
+  uint32_t h;
+
+  t = unsigned_term(intern_tbl_get_root(&breaker->ctx->intern, t));
+  if (is_candidate_var(breaker, t)) {
+    r = int_hmap_get(&table->map, t);
+    if (r->val < 0) {
+      r->val = table->vars.size;
+      ivector_push(&table->vars, t);
+      ivector_push(&table->sig, 0);
+    }
+    h = jenkins_hash_pair(kind, tag, 0x3ac8e1f7);
+    table->sig.data[r->val] = (int32_t) ((uint32_t) table->sig.data[r->val] + h);
+  }
+  push_term(&breaker->queue, &breaker->cache, t);
+}
+
+
+/*
+ * Kinds of terms where the argument position doesn't matter
+ */
+static bool commutative_kind(term_kind_t kind) {
+  return kind == EQ_TERM || kind == DISTINCT_TERM || kind == OR_TERM || kind == XOR_TERM ||
+    kind == ARITH_BINEQ_ATOM || kind == BV_EQ_ATOM;
+}
+
+static void visit_composite(sym_breaker_t *breaker, var_sig_table_t *table, term_kind_t kind, composite_term_t *c) {
+  uint32_t i, n;
+
+  n = c->arity;
+  for (i=0; i<n; i++) {
+    visit_occurrence(breaker, table, c->arg[i], kind, commutative_kind(kind) ? 0 : i+1);
+  }
+}
+
+static void visit_pprod(sym_breaker_t *breaker, var_sig_table_t *table, pprod_t *p) {
+  uint32_t i, n;
+
+  n = p->len;
+  for (i=0; i<n; i++) {
+    visit_occurrence(breaker, table, p->prod[i].var, POWER_PRODUCT, p->prod[i].exp);
+  }
+}
+
+static void visit_poly(sym_breaker_t *breaker, var_sig_table_t *table, polynomial_t *p) {
+  uint32_t i, n, h_num, h_den;
+
+  n = p->nterms;
+  i = 0;
+  if (p->mono[0].var == const_idx) { // skip constant
+    i = 1;
+  }
+  while (i<n) {
+    q_hash_decompose(&p->mono[i].coeff, &h_num, &h_den);
+    visit_occurrence(breaker, table, p->mono[i].var, ARITH_POLY, jenkins_hash_mix2(h_num, h_den));
+    i ++;
+  }
+}
+
+static void visit_bvpoly64(sym_breaker_t *breaker, var_sig_table_t *table, bvpoly64_t *p) {
+  uint32_t i, n;
+
+  n = p->nterms;
+  i = 0;
+  if (p->mono[0].var == const_idx) { // skip constant
+    i = 1;
+  }
+  while (i<n) {
+    visit_occurrence(breaker, table, p->mono[i].var, BV64_POLY, jenkins_hash_uint64(p->mono[i].coeff));
+    i ++;
+  }
+}
+
+static void visit_bvpoly(sym_breaker_t *breaker, var_sig_table_t *table, bvpoly_t *p) {
+  uint32_t i, n;
+
+  n = p->nterms;
+  i = 0;
+  if (p->mono[0].var == const_idx) { // skip constant
+    i = 1;
+  }
+  while (i<n) {
+    visit_occurrence(breaker, table, p->mono[i].var, BV_POLY, bvconst_hash(p->mono[i].coeff, p->bitsize));
+    i ++;
+  }
+}
+
+
+/*
+ * Visit the children of r and record the occurrences of candidate variables
+ * - r must be a root with positive polarity
+ */
+static void visit_children(sym_breaker_t *breaker, var_sig_table_t *table, term_t r) {
+  term_table_t *terms;
+  term_kind_t kind;
+
+  terms = breaker->terms;
+  kind = term_kind(terms, r);
+  switch (kind) {
+  case UNUSED_TERM:
+  case RESERVED_TERM:
+    assert(false);
+    abort();
+    break;
+
+  case CONSTANT_TERM:
+  case UNINTERPRETED_TERM:
+  case ARITH_CONSTANT:
+  case BV64_CONSTANT:
+  case BV_CONSTANT:
+  case VARIABLE:
+  case ARITH_ROOT_ATOM:
+  case FORALL_TERM:
+  case LAMBDA_TERM:
+    // ignore them: the invariance check fails on quantifiers and lambdas anyway
+    break;
+
+  case ARITH_EQ_ATOM:
+  case ARITH_GE_ATOM:
+  case ARITH_IS_INT_ATOM:
+  case ARITH_FLOOR:
+  case ARITH_CEIL:
+  case ARITH_ABS:
+    visit_occurrence(breaker, table, integer_value_for_idx(terms, index_of(r)), kind, 0);
+    break;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+  case APP_TERM:
+  case UPDATE_TERM:
+  case TUPLE_TERM:
+  case EQ_TERM:
+  case DISTINCT_TERM:
+  case OR_TERM:
+  case XOR_TERM:
+  case ARITH_BINEQ_ATOM:
+  case ARITH_RDIV:
+  case ARITH_IDIV:
+  case ARITH_MOD:
+  case ARITH_DIVIDES_ATOM:
+  case BV_ARRAY:
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+  case BV_EQ_ATOM:
+  case BV_GE_ATOM:
+  case BV_SGE_ATOM:
+    visit_composite(breaker, table, kind, composite_term_desc(terms, r));
+    break;
+
+  case SELECT_TERM:
+  case BIT_TERM:
+    visit_occurrence(breaker, table, select_for_idx(terms, index_of(r))->arg, kind,
+                     select_for_idx(terms, index_of(r))->idx);
+    break;
+
+  case POWER_PRODUCT:
+    visit_pprod(breaker, table, pprod_term_desc(terms, r));
+    break;
+
+  case ARITH_POLY:
+    visit_poly(breaker, table, poly_term_desc(terms, r));
+    break;
+
+  case BV64_POLY:
+    visit_bvpoly64(breaker, table, bvpoly64_term_desc(terms, r));
+    break;
+
+  case BV_POLY:
+    visit_bvpoly(breaker, table, bvpoly_term_desc(terms, r));
+    break;
+  }
+}
+
+
+/*
+ * Visit all terms in vector v
+ */
+static void visit_assertions(sym_breaker_t *breaker, ivector_t *v) {
+  uint32_t i, n;
+  term_t r;
+
+  n = v->size;
+  for (i=0; i<n; i++) {
+    r = unsigned_term(intern_tbl_get_root(&breaker->ctx->intern, v->data[i]));
+    push_term(&breaker->queue, &breaker->cache, r);
+  }
+}
+
+
+/*
+ * Ordering for sorting the candidate variables:
+ * - x and y are indices in table->vars and table->sig
+ * - we sort by type first, then signature, then variable
+ */
+static bool var_sig_lt(void *data, int32_t x, int32_t y) {
+  var_sig_table_t *table;
+  term_t tx, ty;
+  type_t tau_x, tau_y;
+
+  table = data;
+  tx = table->vars.data[x];
+  ty = table->vars.data[y];
+  tau_x = term_type(table->terms, tx);
+  tau_y = term_type(table->terms, ty);
+  if (tau_x != tau_y) {
+    return tau_x < tau_y;
+  }
+  if (table->sig.data[x] != table->sig.data[y]) {
+    return table->sig.data[x] < table->sig.data[y];
+  }
+  return tx < ty;
+}
+
+static bool same_class(var_sig_table_t *table, int32_t x, int32_t y) {
+  return term_type(table->terms, table->vars.data[x]) == term_type(table->terms, table->vars.data[y])
+    && table->sig.data[x] == table->sig.data[y];
+}
+
+
+/*
+ * Ordering for sorting classes by decreasing size:
+ * - x and y are indices in array start
+ * - the class of index x is idx[start[x] ... start[x+1]-1]
+ */
+static bool larger_class(void *data, int32_t x, int32_t y) {
+  int32_t *start;
+
+  start = data;
+  return start[x+1] - start[x] > start[y+1] - start[y];
+}
+
+
+/*
+ * Collect the classes of arithmetic and bitvector variables
+ */
+void collect_variable_classes(sym_breaker_t *breaker) {
+  var_sig_table_t table;
+  context_t *ctx;
+  int_queue_t *queue;
+  ivector_t idx, start, order, vars;
+  uint32_t i, j, n;
+
+  ctx = breaker->ctx;
+  queue = &breaker->queue;
+  assert(int_queue_is_empty(queue) && int_hset_is_empty(&breaker->cache));
+
+  init_var_sig_table(&table, breaker->terms);
+
+  visit_assertions(breaker, &ctx->top_eqs);
+  visit_assertions(breaker, &ctx->top_atoms);
+  visit_assertions(breaker, &ctx->top_formulas);
+  visit_assertions(breaker, &ctx->top_interns);
+  visit_assertions(breaker, &ctx->subst_eqs);
+  visit_assertions(breaker, &ctx->aux_eqs);
+  while (! int_queue_is_empty(queue)) {
+    visit_children(breaker, &table, int_queue_pop(queue));
+  }
+  int_queue_reset(queue);
+  int_hset_reset(&breaker->cache);
+
+  n = table.vars.size;
+  if (n >= 2) {
+    init_ivector(&idx, n);
+    init_ivector(&start, 10);
+    init_ivector(&order, 10);
+    init_ivector(&vars, 10);
+
+    for (i=0; i<n; i++) {
+      ivector_push(&idx, i);
+    }
+    int_array_sort2(idx.data, n, &table, var_sig_lt);
+
+    /*
+     * split idx into classes: each class is stored as a pair [b, e) in
+     * vector start and the index of b is stored in order
+     */
+    for (i=0; i<n; i=j) {
+      j = i+1;
+      while (j < n && same_class(&table, idx.data[i], idx.data[j])) {
+        j ++;
+      }
+      if (j - i >= 2) {
+        ivector_push(&order, start.size);
+        ivector_push(&start, i);
+        ivector_push(&start, j);
+      }
+    }
+
+    // sort the classes by decreasing size
+    int_array_sort2(order.data, order.size, start.data, larger_class);
+
+    for (i=0; i<order.size; i++) {
+      ivector_reset(&vars);
+      for (j=start.data[order.data[i]]; j<start.data[order.data[i] + 1]; j++) {
+        ivector_push(&vars, table.vars.data[idx.data[j]]);
+      }
+      add_var_class(&breaker->var_classes, vars.data, vars.size);
+    }
+
+    delete_ivector(&idx);
+    delete_ivector(&start);
+    delete_ivector(&order);
+    delete_ivector(&vars);
+  }
+
+  delete_var_sig_table(&table);
+}
+
+
+
+
+/*
+ * ORDERING CONSTRAINTS
+ */
+
+/*
+ * Add the constraint (x <= y)
+ * - x and y must be root variables of the same type
+ * - if breaker->guard is not NULL_TERM, the constraint is (or (not guard) (x <= y))
+ *
+ * We skip the constraint if it's already internalized (as in add_symmetry_breaking_clause).
+ */
+static void add_ordering_constraint(sym_breaker_t *breaker, term_t x, term_t y) {
+  term_table_t *terms;
+  context_t *ctx;
+  intern_tbl_t *intern;
+  ivector_t *v;
+  term_t c;
+
+  terms = breaker->terms;
+  ctx = breaker->ctx;
+  intern = &ctx->intern;
+
+  assert(intern_tbl_is_root(intern, x) && intern_tbl_is_root(intern, y));
+
+  if (is_arithmetic_term(terms, x)) {
+    c = mk_arith_leq(&breaker->mngr, x, y);
+  } else {
+    c = mk_bvle(&breaker->mngr, x, y);
+  }
+
+  if (breaker->guard != NULL_TERM) {
+    v = &breaker->aux;
+    ivector_reset(v);
+    ivector_push(v, c);
+    ivector_push(v, opposite_term(breaker->guard));
+    c = mk_or(&breaker->mngr, v->size, v->data);
+    ivector_reset(v);
+  }
+
+  if (intern_tbl_is_root(intern, c) && ! intern_tbl_root_is_mapped(intern, c) && ! term_is_true(ctx, c)) {
+    intern_tbl_map_root(intern, c, bool2code(true));
+    if (term_kind(terms, c) == OR_TERM) {
+      ivector_push(&ctx->top_formulas, c);
+    } else {
+      ivector_push(&ctx->top_atoms, c);
+    }
+
+#if TRACE
+    printf("Ordering constraint\n");
+    pretty_print_term_full(stdout, NULL, terms, c);
+    printf("\n");
+#endif
+    trace_puts(ctx->trace, 5, "Adding symmetry-breaking constraint\n");
+    trace_pp_term(ctx->trace, 5, terms, c);
+  }
+}
+
+
+/*
+ * Check whether the assertions are invariant by permutation of c's variables
+ */
+bool check_variable_class_invariance(sym_breaker_t *breaker, var_class_t *c) {
+  return check_constants_invariance(breaker->ctx, c->var, c->num_vars);
+}
+
+
+/*
+ * Add the constraints var[0] <= var[1] <= ... <= var[n-1]
+ */
+void break_variable_symmetries(sym_breaker_t *breaker, var_class_t *c) {
+  uint32_t i, n;
+
+  n = c->num_vars;
+  for (i=1; i<n; i++) {
+    add_ordering_constraint(breaker, c->var[i-1], c->var[i]);
+  }
+}
+
+
+
+
+
 /*
  * SYMMETRY BREAKER
  */
@@ -1836,6 +2694,9 @@ void init_sym_breaker(sym_breaker_t *breaker, context_t *ctx) {
   init_int_queue(&breaker->queue, 0);
   init_int_hset(&breaker->cache, 0);
   init_ivector(&breaker->aux, 10);
+  init_var_class_vector(&breaker->var_classes);
+  init_term_manager(&breaker->mngr, ctx->terms);
+  breaker->guard = NULL_TERM;
 }
 
 
@@ -1849,6 +2710,8 @@ void delete_sym_breaker(sym_breaker_t *breaker) {
   delete_int_queue(&breaker->queue);
   delete_int_hset(&breaker->cache);
   delete_ivector(&breaker->aux);
+  delete_var_class_vector(&breaker->var_classes);
+  delete_term_manager(&breaker->mngr);
 }
 
 
@@ -1914,11 +2777,19 @@ void collect_range_constraints(sym_breaker_t *breaker) {
  * constants in record r.
  */
 bool check_assertion_invariance(sym_breaker_t *breaker, rng_record_t *r) {
+  return check_constants_invariance(breaker->ctx, r->cst, r->num_constants);
+}
+
+
+/*
+ * Check whether the assertions are invariant by permutation of c[0 ... n-1]
+ */
+bool check_constants_invariance(context_t *ctx, term_t *c, uint32_t n) {
   ctx_subst_t subst;
   bool result;
 
-  init_ctx_subst(&subst, breaker->ctx);
-  result = check_perm_invariance(breaker->ctx, &subst, r->cst, r->num_constants);
+  init_ctx_subst(&subst, ctx);
+  result = check_perm_invariance(ctx, &subst, c, n);
   delete_ctx_subst(&subst);
 
   return result;
@@ -17,7 +17,7 @@
  */
 
 /*
- * SUPPORT FOR BREAKING SYMMETRIES IN UF FORMULAS
+ * SUPPORT FOR BREAKING SYMMETRIES IN UF, ARITHMETIC, AND BITVECTOR FORMULAS
  */
 
 #ifndef __SYMMETRY_BREAKING_H
@@ -212,12 +212,67 @@ typedef struct sym_breaker_sets_s {
 #define MAX_SBREAK_SET_SIZE (UINT32_MAX/sizeof(term_t))
 
 
+/*
+ * VARIABLE CLASSES
+ */
+
+/*
+ * In arithmetic and bitvector problems, we search for sets of
+ * variables {x_1, ..., x_n} of the same type such that the assertions
+ * are invariant by all permutations of x_1, ..., x_n. For such a set,
+ * we can add the ordering constraints x_1 <= x_2 <= ... <= x_n
+ * (unsigned ordering for bitvectors): any model can be turned into
+ * a model that satisfies these constraints by permuting the values
+ * of x_1, ..., x_n.
+ *
+ * Candidate sets are obtained by partitioning the arithmetic and
+ * bitvector variables that occur in the assertions. Two variables
+ * are in the same class if they have the same type and the same
+ * occurrence signature. The signature of x is a hash of the kinds of
+ * terms in which x occurs, and of x's coefficient or position in these
+ * terms. The invariance check is still required since variables with
+ * the same signature are not necessarily interchangeable.
+ *
+ * Class record:
+ * - var[0 ... num_vars - 1] = the variables (sorted in increasing order)
+ */
+typedef struct var_class_s {
+  term_t *var;
+  uint32_t num_vars;
+} var_class_t;
+
+
+/*
+ * Vector of classes
+ */
+typedef struct var_class_vector_s {
+  var_class_t *data;
+  uint32_t nelems;
+  uint32_t size;
+} var_class_vector_t;
+
+#define DEF_VAR_CLASS_VECTOR_SIZE 4
+#define MAX_VAR_CLASS_VECTOR_SIZE (UINT32_MAX/sizeof(var_class_t))
+
+
+/*
+ * Bound on the number of classes we check for invariance
+ * (each check requires three passes over the assertions).
+ */
+#define MAX_VAR_CLASS_CHECKS 20
+
+
+
 /*
  * Symmetry breaker
  * - pointers to the relevant context + term table
  * - vector of range constraint descriptors
+ * - vector of variable classes
  * - substitution
  * - auxiliary structures to explore terms
+ * - term manager to build ordering constraints
+ * - guard = Boolean term or NULL_TERM: if it's not NULL_TERM then
+ *   every symmetry-breaking clause C is added as (or (not guard) C)
  */
 typedef struct sym_breaker_s {
   context_t *ctx;
@@ -230,6 +285,9 @@ typedef struct sym_breaker_s {
   rng_record_t **sorted_constraints;
   uint32_t num_constraints; // size of this array
 
+  // classes of variables (sorted by decreasing size)
+  var_class_vector_t var_classes;
+
   // sets used for symmetry breaking
   sym_breaker_sets_t sets;
 
@@ -237,6 +295,9 @@ typedef struct sym_breaker_s {
   int_queue_t queue;
   int_hset_t cache;
   ivector_t aux;
+  term_manager_t mngr;
+
+  term_t guard;
 } sym_breaker_t;
 
 
@@ -273,6 +334,14 @@ extern void collect_range_constraints(sym_breaker_t *breaker);
 extern bool check_assertion_invariance(sym_breaker_t *breaker, rng_record_t *r);
 
 
+/*
+ * Check whether the assertions are invariant by permutation of
+ * constants c[0 ... n-1]
+ * - n must be at least 2
+ */
+extern bool check_constants_invariance(context_t *ctx, term_t *c, uint32_t n);
+
+
 /*
  * Check whether r1's constant set is included (strictly) in r2's constant set
  */
@@ -301,6 +370,30 @@ extern void breaker_sets_add_record(sym_breaker_sets_t *s, rng_record_t *r);
 extern void break_symmetries(sym_breaker_t *breaker, sym_breaker_sets_t *s);
 
 
+/*
+ * Collect the classes of arithmetic and bitvector variables that
+ * occur in the assertions
+ * - only variables that are not internalized yet are considered
+ * - all classes found are added to breaker->var_classes
+ */
+extern void collect_variable_classes(sym_breaker_t *breaker);
+
+
+/*
+ * Check whether the assertions are invariant by permutation of
+ * the variables in class c.
+ */
+extern bool check_variable_class_invariance(sym_breaker_t *breaker, var_class_t *c);
+
+
+/*
+ * Add the ordering constraints for class c:
+ *   var[0] <= var[1] <= ... <= var[n-1]
+ * - the assertions must be invariant by permutations of c's variables
+ */
+extern void break_variable_symmetries(sym_breaker_t *breaker, var_class_t *c);
+
+
 
 
 
@@ -0,0 +1,166 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * GUARDS FOR SYMMETRY BREAKING IN INCREMENTAL CONTEXTS
+ */
+
+#include <string.h>
+
+#include "context/symmetry_guards.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * Initialize the stack: nothing is allocated yet
+ */
+void init_sym_guard_stack(sym_guard_stack_t *stack) {
+  stack->data = NULL;
+  stack->size = 0;
+  stack->top = 0;
+  stack->level = 0;
+}
+
+
+/*
+ * Remove all guards above index n
+ */
+static void sym_guard_stack_shrink(sym_guard_stack_t *stack, uint32_t n) {
+  uint32_t i;
+
+  assert(n <= stack->top);
+  for (i=n; i<stack->top; i++) {
+    safe_free(stack->data[i].cst);
+  }
+  stack->top = n;
+}
+
+
+/*
+ * Free memory
+ */
+void delete_sym_guard_stack(sym_guard_stack_t *stack) {
+  sym_guard_stack_shrink(stack, 0);
+  safe_free(stack->data);
+  stack->data = NULL;
+}
+
+
+/*
+ * Empty the stack
+ */
+void reset_sym_guard_stack(sym_guard_stack_t *stack) {
+  sym_guard_stack_shrink(stack, 0);
+  stack->level = 0;
+}
+
+
+/*
+ * Make the stack larger
+ */
+static void extend_sym_guard_stack(sym_guard_stack_t *stack) {
+  uint32_t n;
+
+  n = stack->size;
+  if (n == 0) {
+    n = DEF_SYM_GUARD_STACK_SIZE;
+    assert(n <= MAX_SYM_GUARD_STACK_SIZE);
+  } else {
+    // try to make the stack 50% larger
+    n += (n >> 1);
+    if (n > MAX_SYM_GUARD_STACK_SIZE) {
+      out_of_memory();
+    }
+    assert(n > stack->size);
+  }
+
+  stack->data = (sym_guard_t *) safe_realloc(stack->data, n * sizeof(sym_guard_t));
+  stack->size = n;
+}
+
+
+/*
+ * Close the current level
+ */
+void sym_guard_stack_pop(sym_guard_stack_t *stack) {
+  uint32_t i;
+
+  assert(stack->level > 0);
+
+  i = stack->top;
+  while (i>0 && stack->data[i-1].level == stack->level) {
+    i --;
+  }
+  sym_guard_stack_shrink(stack, i);
+  stack->level --;
+
+  for (i=0; i<stack->top; i++) {
+    if (stack->data[i].retired != NOT_RETIRED && stack->data[i].retired > stack->level) {
+      stack->data[i].retired = NOT_RETIRED;
+    }
+  }
+}
+
+
+/*
+ * Add guard l for the constants c[0 ... n-1]
+ */
+void sym_guard_stack_add(sym_guard_stack_t *stack, literal_t l, const term_t *c, uint32_t n) {
+  sym_guard_t *g;
+  uint32_t i;
+
+  assert(n <= UINT32_MAX/sizeof(term_t));
+
+  i = stack->top;
+  if (i == stack->size) {
+    extend_sym_guard_stack(stack);
+  }
+  assert(i < stack->size);
+
+  g = stack->data + i;
+  g->lit = l;
+  g->level = stack->level;
+  g->retired = NOT_RETIRED;
+  g->num_constants = n;
+  g->cst = (term_t *) safe_malloc(n * sizeof(term_t));
+  memcpy(g->cst, c, n * sizeof(term_t));
+  stack->top = i+1;
+}
+
+
+/*
+ * Retire guard i
+ */
+void sym_guard_stack_retire(sym_guard_stack_t *stack, uint32_t i) {
+  assert(sym_guard_is_active(stack, i));
+  stack->data[i].retired = stack->level;
+}
+
+
+/*
+ * Collect the active guards
+ */
+void sym_guard_stack_collect_active(const sym_guard_stack_t *stack, ivector_t *v) {
+  uint32_t i;
+
+  for (i=0; i<stack->top; i++) {
+    if (stack->data[i].retired == NOT_RETIRED) {
+      ivector_push(v, stack->data[i].lit);
+    }
+  }
+}
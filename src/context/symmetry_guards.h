@@ -0,0 +1,149 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * GUARDS FOR SYMMETRY BREAKING IN INCREMENTAL CONTEXTS
+ *
+ * In one-check mode, symmetry-breaking clauses are added as top-level
+ * formulas. This is not sound if more assertions may be added later
+ * (they may not be invariant under the symmetries we've broken).
+ *
+ * In contexts that support multiple checks, every set of symmetry-breaking
+ * clauses is guarded by a fresh literal g: we add (or (not g) clause)
+ * and g is assumed when the context is checked. We keep track of
+ * the guards and of the constant set whose permutations were
+ * broken. When new assertions are not invariant under these
+ * permutations, the guard is retired (i.e., (not g) is asserted) and
+ * the clauses are disabled.
+ *
+ * Everything is undone on pop:
+ * - guards created at a higher level are removed
+ * - guards retired at a higher level become active again
+ */
+
+#ifndef __SYMMETRY_GUARDS_H
+#define __SYMMETRY_GUARDS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "solvers/cdcl/smt_core_base_types.h"
+#include "terms/terms.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Guard descriptor:
+ * - lit = guard literal in the CDCL solver
+ * - level = base level when the guard was created
+ * - retired = base level when the guard was retired
+ *   (or NOT_RETIRED if the guard is active)
+ * - cst[0 ... num_constants-1] = constants whose permutations were broken
+ */
+typedef struct sym_guard_s {
+  literal_t lit;
+  uint32_t level;
+  uint32_t retired;
+  uint32_t num_constants;
+  term_t *cst;
+} sym_guard_t;
+
+#define NOT_RETIRED UINT32_MAX
+
+
+/*
+ * Stack of guards:
+ * - data = stack content
+ * - size = size of the data array
+ * - top = index of the top of the stack
+ *   the stack is data[0 ... top-1]
+ * - level = current base level
+ */
+typedef struct sym_guard_stack_s {
+  sym_guard_t *data;
+  uint32_t size;
+  uint32_t top;
+  uint32_t level;
+} sym_guard_stack_t;
+
+#define DEF_SYM_GUARD_STACK_SIZE 10
+#define MAX_SYM_GUARD_STACK_SIZE (UINT32_MAX/sizeof(sym_guard_t))
+
+
+/*
+ * Initialize the stack: nothing is allocated yet
+ */
+extern void init_sym_guard_stack(sym_guard_stack_t *stack);
+
+/*
+ * Free memory
+ */
+extern void delete_sym_guard_stack(sym_guard_stack_t *stack);
+
+/*
+ * Empty the stack and reset level to 0
+ */
+extern void reset_sym_guard_stack(sym_guard_stack_t *stack);
+
+/*
+ * Set the level
+ */
+static inline void sym_guard_stack_set_level(sym_guard_stack_t *stack, uint32_t level) {
+  stack->level = level;
+}
+
+/*
+ * Start a new level
+ */
+static inline void sym_guard_stack_push(sym_guard_stack_t *stack) {
+  stack->level ++;
+}
+
+/*
+ * Close the current level:
+ * - remove all guards created at this level
+ * - restore all guards retired at this level
+ */
+extern void sym_guard_stack_pop(sym_guard_stack_t *stack);
+
+/*
+ * Add a new active guard l for the constants c[0 ... n-1]
+ */
+extern void sym_guard_stack_add(sym_guard_stack_t *stack, literal_t l, const term_t *c, uint32_t n);
+
+/*
+ * Retire guard i: it must be active
+ */
+extern void sym_guard_stack_retire(sym_guard_stack_t *stack, uint32_t i);
+
+/*
+ * Check whether guard i is active
+ */
+static inline bool sym_guard_is_active(const sym_guard_stack_t *stack, uint32_t i) {
+  assert(i < stack->top);
+  return stack->data[i].retired == NOT_RETIRED;
+}
+
+/*
+ * Add all active guard literals to vector v
+ */
+extern void sym_guard_stack_collect_active(const sym_guard_stack_t *stack, ivector_t *v);
+
+
+#endif /* __SYMMETRY_GUARDS_H */
@@ -147,7 +147,7 @@ void ef_solve(ef_client_t *efc, uint32_t n, term_t *assertions, param_t *paramet
        */
       ef_solver_check(efc->efsolver, parameters, efc->ef_parameters.gen_mode,
 		      efc->ef_parameters.max_samples, efc->ef_parameters.max_iters, efc->ef_parameters.max_numlearnt_per_round,
-		      efc->ef_parameters.ematching);
+		      efc->ef_parameters.ematching, efc->ef_parameters.num_threads);
       efc->efdone = true;
     }
   }
@@ -28,6 +28,10 @@
 
 #include <inttypes.h>
 
+#if defined(THREAD_SAFE) && !defined(MINGW)
+#include <pthread.h>
+#endif
+
 #include "context/context.h"
 #include "exists_forall/efsolver.h"
 #include "model/literal_collector.h"    //get_implicant     (pre qf normalization)
@@ -209,8 +213,14 @@ void init_ef_solver(ef_solver_t *solver, ef_prob_t *prob, smt_logic_t logic, con
   solver->numlearnt = 0;
   solver->scan_idx = 0;
 
+  solver->num_threads = 0;
+
   solver->exists_context = NULL;
   solver->forall_context = NULL;
+  solver->cnstr_context = NULL;
+  solver->cnstr_status = NULL;
+  solver->cnstr_assumptions = NULL;
+  solver->cnstr_activator = NULL;
   solver->exists_model = NULL;
 
   n = ef_prob_num_evars(prob);
@@ -240,10 +250,38 @@ void init_ef_solver(ef_solver_t *solver, ef_prob_t *prob, smt_logic_t logic, con
 }
 
 
+/*
+ * Delete the constraint contexts
+ */
+static void delete_cnstr_contexts(ef_solver_t *solver) {
+  uint32_t i, n;
+
+  if (solver->cnstr_context != NULL) {
+    n = ef_prob_num_constraints(solver->prob);
+    for (i=0; i<n; i++) {
+      if (solver->cnstr_context[i] != NULL) {
+        delete_context(solver->cnstr_context[i]);
+        safe_free(solver->cnstr_context[i]);
+      }
+      delete_ivector(solver->cnstr_assumptions + i);
+    }
+    safe_free(solver->cnstr_context);
+    safe_free(solver->cnstr_status);
+    safe_free(solver->cnstr_assumptions);
+    safe_free(solver->cnstr_activator);
+    solver->cnstr_context = NULL;
+    solver->cnstr_status = NULL;
+    solver->cnstr_assumptions = NULL;
+    solver->cnstr_activator = NULL;
+  }
+}
+
+
 /*
  * Delete the whole thing
  */
 void delete_ef_solver(ef_solver_t *solver) {
+  delete_cnstr_contexts(solver);
   if (solver->exists_context != NULL) {
     delete_context(solver->exists_context);
     safe_free(solver->exists_context);
@@ -285,6 +323,7 @@ void delete_ef_solver(ef_solver_t *solver) {
  */
 void ef_solver_stop_search(ef_solver_t *solver) {
   context_t *exists_ctx, *forall_ctx;
+  uint32_t i, n;
 
   exists_ctx = solver->exists_context;
   forall_ctx = solver->forall_context;
@@ -292,6 +331,12 @@ void ef_solver_stop_search(ef_solver_t *solver) {
   if (solver->status == EF_STATUS_SEARCHING) {
     if (exists_ctx != NULL) context_stop_search(exists_ctx);
     if (forall_ctx != NULL) context_stop_search(forall_ctx);
+    if (solver->cnstr_context != NULL) {
+      n = ef_prob_num_constraints(solver->prob);
+      for (i=0; i<n; i++) {
+        if (solver->cnstr_context[i] != NULL) context_stop_search(solver->cnstr_context[i]);
+      }
+    }
     solver->status = EF_STATUS_INTERRUPTED;
   }
 }
@@ -490,35 +535,20 @@ static context_t *get_forall_context(ef_solver_t *solver) {
  */
 
 /*
- * Check satisfiability and get a model
- * - ctx = the context
- * - parameters = heuristic settings (if parameters is NULL, the defaults are used)
- * - var = array of n uninterpreted terms
- * - n = size of array evar and value
- * Output parameters;
- * - value = array of n terms (to receive the value of each var)
- * - model = to export the model (if model is NULL, nothing is exported)
- *
- * The return code is as in check_context:
- * 1) if code = STATUS_SAT then the context is satisfiable
- *    and a model is stored in value[0 ... n-1]
- *    - value[i] = a constant term mapped to evar[i] in the model
- * 2) code = STATUS_UNSAT: not satisfiable
- *
- * 3) other codes report an error of some kind or STATUS_INTERRUPTED
+ * Get a model after a call to check_context
+ * - stat = status returned by check_context
+ * - if stat is STATUS_SAT or STATUS_UNKNOWN, a model is built and
+ *   the values of var[0 ... n-1] are stored in value[0 ... n-1]
+ * - the other parameters and the return code are as in satisfy_context below
  */
-static smt_status_t satisfy_context(ef_solver_t *solver, context_t *ctx, term_t *var, uint32_t n, term_t *value, model_t **model, bool is_exists) {
-  smt_status_t stat;
+static smt_status_t get_context_model(ef_solver_t *solver, context_t *ctx, smt_status_t stat, term_t *var, uint32_t n,
+                                      term_t *value, model_t **model, bool is_exists) {
   model_t *mdl;
   int32_t eval_code;
   uint32_t count;
   uint32_t i;
   ivector_t mdl_values;
 
-  stat = context_status(ctx);
-  assert(stat == STATUS_IDLE || stat == STATUS_UNSAT);
-
-  stat = check_context(ctx, solver->parameters);
   switch (stat) {
   case STATUS_SAT:
   case STATUS_UNKNOWN:
@@ -649,6 +679,35 @@ static smt_status_t satisfy_context(ef_solver_t *solver, context_t *ctx, term_t
 }
 
 
+/*
+ * Check satisfiability and get a model
+ * - ctx = the context
+ * - parameters = heuristic settings (if parameters is NULL, the defaults are used)
+ * - var = array of n uninterpreted terms
+ * - n = size of array evar and value
+ * Output parameters;
+ * - value = array of n terms (to receive the value of each var)
+ * - model = to export the model (if model is NULL, nothing is exported)
+ *
+ * The return code is as in check_context:
+ * 1) if code = STATUS_SAT then the context is satisfiable
+ *    and a model is stored in value[0 ... n-1]
+ *    - value[i] = a constant term mapped to evar[i] in the model
+ * 2) code = STATUS_UNSAT: not satisfiable
+ *
+ * 3) other codes report an error of some kind or STATUS_INTERRUPTED
+ */
+static smt_status_t satisfy_context(ef_solver_t *solver, context_t *ctx, term_t *var, uint32_t n, term_t *value, model_t **model, bool is_exists) {
+  smt_status_t stat;
+
+  stat = context_status(ctx);
+  assert(stat == STATUS_IDLE || stat == STATUS_UNSAT);
+
+  stat = check_context(ctx, solver->parameters);
+  return get_context_model(solver, ctx, stat, var, n, value, model, is_exists);
+}
+
+
 
 /*
  * Check satisfiability of the exists_context
@@ -1318,8 +1377,9 @@ static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, term_t doma
       break;
     }
 
-    // if reached highest generation, then break
-    if (done)
+    // if reached highest generation or interrupted, then break
+    // (forall_ctx can't be popped after an interrupt)
+    if (done || status == STATUS_INTERRUPTED)
       break;
 
     uvar_cnstr_old = uvar_cnstr;
@@ -1468,6 +1528,453 @@ static void  ef_solver_check_exists_model(ef_solver_t *solver) {
 
 
 
+
+/*
+ * EF SOLVER: BATCH CHECK OF THE UNIVERSAL CONSTRAINTS
+ */
+
+/*
+ * Each constraint i has its own context in which we assert
+ *   B_i(Y_i) AND not C_i(X_i, Y_i)
+ * once, with the exists variables X_i left uninterpreted. A candidate x
+ * is checked using the assumptions (X_i = x) so nothing is popped
+ * between two candidates and the clauses learned by the forall
+ * context are kept for the whole search.
+ *
+ * To get several counterexamples for the same candidate x, we block
+ * each counterexample y with a clause (p_i => (X_i /= x or Y_i /= y)).
+ * The activation literal p_i is created once per constraint and the
+ * clauses are kept: they don't constrain the check of another candidate.
+ * The first check of a candidate is done without p_i, so that a stale
+ * clause can't hide a counterexample if the same candidate comes back.
+ * Then p_i is added to the assumptions for the next rounds.
+ */
+
+/*
+ * Get the context for constraint i: allocate it and assert
+ * B_i(Y_i) and not C_i(X_i, Y_i) if needed.
+ * - return NULL if the assertion fails (solver->status is updated)
+ */
+static context_t *get_cnstr_context(ef_solver_t *solver, uint32_t i) {
+  context_t *ctx;
+  ef_cnstr_t *cnstr;
+  term_t a[2];
+  uint32_t j, n;
+  int32_t code;
+
+  n = ef_prob_num_constraints(solver->prob);
+  assert(i < n);
+
+  if (solver->cnstr_context == NULL) {
+    solver->cnstr_context = (context_t **) safe_malloc(n * sizeof(context_t *));
+    solver->cnstr_status = (smt_status_t *) safe_malloc(n * sizeof(smt_status_t));
+    solver->cnstr_assumptions = (ivector_t *) safe_malloc(n * sizeof(ivector_t));
+    solver->cnstr_activator = (term_t *) safe_malloc(n * sizeof(term_t));
+    for (j=0; j<n; j++) {
+      solver->cnstr_context[j] = NULL;
+      solver->cnstr_status[j] = STATUS_IDLE;
+      init_ivector(solver->cnstr_assumptions + j, 0);
+      solver->cnstr_activator[j] = NULL_TERM;
+    }
+  }
+
+  ctx = solver->cnstr_context[i];
+  if (ctx == NULL) {
+    ctx = (context_t *) safe_malloc(sizeof(context_t));
+    init_context(ctx, solver->prob->terms, solver->logic, CTX_MODE_MULTICHECKS, solver->arch, false);
+    // the tracer is not thread safe: it's not attached if the contexts are checked in parallel
+    if (solver->trace != NULL && solver->num_threads <= 1) {
+      context_set_trace(ctx, solver->trace);
+    }
+    solver->cnstr_context[i] = ctx;
+    solver->cnstr_activator[i] = NULL_TERM;
+
+    cnstr = solver->prob->cnstr + i;
+    a[0] = cnstr->assumption;
+    a[1] = opposite_term(cnstr->guarantee);
+    code = assert_formulas(ctx, 2, a);
+    if (code < 0) {
+      solver->status = EF_STATUS_ASSERT_ERROR;
+      solver->error_code = code;
+      return NULL;
+    }
+  }
+
+  return ctx;
+}
+
+
+/*
+ * Add term t as an assumption for constraint i
+ * - return false if t can't be internalized (solver->status is updated)
+ */
+static bool add_cnstr_assumption(ef_solver_t *solver, uint32_t i, term_t t) {
+  int32_t l;
+
+  l = context_add_assumption(solver->cnstr_context[i], t);
+  if (l < 0) {
+    solver->status = EF_STATUS_ASSERT_ERROR;
+    solver->error_code = l;
+    return false;
+  }
+  ivector_push(solver->cnstr_assumptions + i, l);
+
+  return true;
+}
+
+
+/*
+ * Prepare the test of the current exists model against constraint i
+ * - build the assumptions (X_i = x) where x is the current exists model
+ * - the result is stored in solver->cnstr_status[i]:
+ *   STATUS_IDLE means that the context must be checked
+ *   STATUS_UNSAT means that constraint i holds for all X_i
+ * - return false if something goes wrong (solver->status is updated)
+ */
+static bool prepare_cnstr_check(ef_solver_t *solver, uint32_t i) {
+  ef_cnstr_t *cnstr;
+  term_t *value;
+  uint32_t j, n;
+
+  if (get_cnstr_context(solver, i) == NULL) {
+    return false;
+  }
+
+  if (context_status(solver->cnstr_context[i]) == STATUS_UNSAT) {
+    // B_i(Y_i) AND not C_i(X_i, Y_i) is false
+    solver->cnstr_status[i] = STATUS_UNSAT;
+    return true;
+  }
+  assert(context_status(solver->cnstr_context[i]) == STATUS_IDLE);
+
+  cnstr = solver->prob->cnstr + i;
+  n = ef_constraint_num_evars(cnstr);
+  resize_ivector(&solver->evalue_aux, n);
+  solver->evalue_aux.size = n;
+  value = solver->evalue_aux.data;
+  ef_project_exists_model(solver->prob, solver->evalue.data, cnstr->evars, value, n);
+
+  ivector_reset(solver->cnstr_assumptions + i);
+  for (j=0; j<n; j++) {
+    if (! add_cnstr_assumption(solver, i, mk_eq(solver->prob->manager, cnstr->evars[j], value[j]))) {
+      return false;
+    }
+  }
+  solver->cnstr_status[i] = STATUS_IDLE;
+
+  return true;
+}
+
+
+/*
+ * Block the counterexample found for constraint i
+ * - cex = (Y_i /= y) where y is the counterexample
+ * - the context must be SAT or UNKNOWN
+ * - return false if the clause can't be added
+ */
+static bool block_cnstr_counterexample(ef_solver_t *solver, uint32_t i, term_t cex) {
+  context_t *ctx;
+  ef_cnstr_t *cnstr;
+  term_t *value;
+  term_t p, guard;
+  uint32_t n;
+  int32_t code;
+
+  ctx = solver->cnstr_context[i];
+  context_clear(ctx);
+
+  p = solver->cnstr_activator[i];
+  if (p == NULL_TERM) {
+    p = new_uninterpreted_term(__yices_globals.terms, bool_id);
+    solver->cnstr_activator[i] = p;
+  }
+
+  cnstr = solver->prob->cnstr + i;
+  n = ef_constraint_num_evars(cnstr);
+  if (solver->cnstr_assumptions[i].size == n) {
+    // first counterexample for this candidate
+    if (! add_cnstr_assumption(solver, i, p)) {
+      return false;
+    }
+  }
+
+  // guard = (X_i /= x)
+  resize_ivector(&solver->evalue_aux, n);
+  solver->evalue_aux.size = n;
+  value = solver->evalue_aux.data;
+  ef_project_exists_model(solver->prob, solver->evalue.data, cnstr->evars, value, n);
+  guard = mk_array_neq(solver->prob->manager, n, cnstr->evars, value);
+
+  code = assert_formula(ctx, mk_implies(solver->prob->manager, p, mk_binary_or(solver->prob->manager, guard, cex)));
+  if (code < 0) {
+    solver->status = EF_STATUS_ASSERT_ERROR;
+    solver->error_code = code;
+    return false;
+  }
+
+  return true;
+}
+
+
+/*
+ * Restore all constraint contexts to the idle state
+ * - an interrupted context can't be cleaned up so it's deleted
+ *   (it will be recreated if needed)
+ */
+static void clear_cnstr_contexts(ef_solver_t *solver) {
+  context_t *ctx;
+  uint32_t i, n;
+
+  n = ef_prob_num_constraints(solver->prob);
+  for (i=0; i<n; i++) {
+    ctx = solver->cnstr_context[i];
+    if (ctx == NULL) continue;
+
+    switch (context_status(ctx)) {
+    case STATUS_SAT:
+    case STATUS_UNKNOWN:
+      context_clear(ctx);
+      break;
+
+    case STATUS_UNSAT:
+      context_clear_unsat(ctx);
+      break;
+
+    case STATUS_IDLE:
+      break;
+
+    default:
+      delete_context(ctx);
+      safe_free(ctx);
+      solver->cnstr_context[i] = NULL;
+      solver->cnstr_activator[i] = NULL_TERM;
+      break;
+    }
+  }
+}
+
+
+/*
+ * Worker for the parallel checks:
+ * - cnstr = array of constraint indices
+ * - n = size of this array
+ * - the worker checks the contexts of cnstr[start], cnstr[start + step], ...
+ */
+typedef struct cnstr_worker_s {
+  ef_solver_t *solver;
+  const int32_t *cnstr;
+  uint32_t n;
+  uint32_t start;
+  uint32_t step;
+} cnstr_worker_t;
+
+static void run_cnstr_worker(cnstr_worker_t *w) {
+  ef_solver_t *solver;
+  ivector_t *a;
+  uint32_t j;
+  int32_t i;
+
+  solver = w->solver;
+  for (j=w->start; j<w->n; j += w->step) {
+    i = w->cnstr[j];
+    a = solver->cnstr_assumptions + i;
+    solver->cnstr_status[i] = check_context_with_assumptions(solver->cnstr_context[i], solver->parameters, a->size, a->data);
+  }
+}
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+static void *cnstr_worker_main(void *arg) {
+  run_cnstr_worker(arg);
+  return NULL;
+}
+
+/*
+ * Check the contexts of constraints a[0 ... n-1]
+ * - use up to solver->num_threads threads (including the current thread)
+ * - the results are stored in solver->cnstr_status
+ *
+ * The threads only run check_context on distinct contexts. Everything
+ * that builds terms (substitution, model construction, learning) is
+ * done by the calling thread before or after the checks.
+ */
+static void check_cnstr_contexts(ef_solver_t *solver, const int32_t *a, uint32_t n) {
+  cnstr_worker_t *worker;
+  pthread_t *thread;
+  bool *started;
+  uint32_t k, p;
+
+  p = solver->num_threads;
+  if (p > n) p = n;
+  if (p == 0) p = 1;
+
+  worker = (cnstr_worker_t *) safe_malloc(p * sizeof(cnstr_worker_t));
+  thread = (pthread_t *) safe_malloc(p * sizeof(pthread_t));
+  started = (bool *) safe_malloc(p * sizeof(bool));
+
+  for (k=0; k<p; k++) {
+    worker[k].solver = solver;
+    worker[k].cnstr = a;
+    worker[k].n = n;
+    worker[k].start = k;
+    worker[k].step = p;
+    started[k] = false;
+  }
+
+  // worker 0 runs in this thread
+  for (k=1; k<p; k++) {
+    started[k] = (pthread_create(thread + k, NULL, cnstr_worker_main, worker + k) == 0);
+  }
+  run_cnstr_worker(worker);
+  for (k=1; k<p; k++) {
+    if (started[k]) {
+      pthread_join(thread[k], NULL);
+    } else {
+      run_cnstr_worker(worker + k);
+    }
+  }
+
+  safe_free(started);
+  safe_free(thread);
+  safe_free(worker);
+}
+
+#else
+
+/*
+ * No thread support: check the contexts one after the other
+ */
+static void check_cnstr_contexts(ef_solver_t *solver, const int32_t *a, uint32_t n) {
+  cnstr_worker_t worker;
+
+  worker.solver = solver;
+  worker.cnstr = a;
+  worker.n = n;
+  worker.start = 0;
+  worker.step = 1;
+  run_cnstr_worker(&worker);
+}
+
+#endif
+
+
+/*
+ * Check whether the current exists_model can be falsified by one
+ * of the universal constraints.
+ * - all the constraints are checked (each in its own context)
+ * - for every constraint that falsifies the model, we learn a lemma from
+ *   the counterexample then we add a blocking clause in the constraint's
+ *   context and check it again. This is repeated up to
+ *   solver->max_numlearnt_per_round times.
+ * - all the lemmas are added to the exists context
+ *
+ * Update the solver->status as in ef_solver_check_exists_model.
+ */
+static void ef_solver_check_exists_model_batch(ef_solver_t *solver) {
+  ivector_t pending;
+  context_t *ctx;
+  ef_cnstr_t *cnstr;
+  smt_status_t status;
+  term_t cex_cnstr, block;
+  uint32_t i, j, k, n, nvars, round;
+  bool refuted;
+
+  n = ef_prob_num_constraints(solver->prob);
+  if (n == 0) {
+    solver->status = EF_STATUS_SAT;
+    return;
+  }
+
+  solver->num_models += 1;
+  refuted = false;
+  init_ivector(&pending, n);
+
+  for (i=0; i<n; i++) {
+    solver->numiters += 1;
+    trace_printf(solver->trace, 4, "(EF: testing candidate against constraint %"PRIu32")\n", i);
+    if (! prepare_cnstr_check(solver, i)) goto done;
+    if (solver->cnstr_status[i] == STATUS_IDLE) {
+      ivector_push(&pending, i);
+    } else {
+      trace_candidate_check(solver, i, STATUS_UNSAT);
+    }
+  }
+
+  round = 0;
+  while (pending.size > 0) {
+    check_cnstr_contexts(solver, pending.data, pending.size);
+    round ++;
+
+    /*
+     * Learn from the counterexamples: keep in pending the
+     * constraints that must be checked again
+     */
+    k = 0;
+    for (j=0; j<pending.size; j++) {
+      i = pending.data[j];
+      status = solver->cnstr_status[i];
+      trace_candidate_check(solver, i, status);
+      if (solver->status != EF_STATUS_SEARCHING) continue;
+
+      switch (status) {
+      case STATUS_SAT:
+      case STATUS_UNKNOWN:
+        refuted = true;
+        if (context_status(solver->exists_context) == STATUS_UNSAT) {
+          // nothing more to learn
+          break;
+        }
+        cnstr = solver->prob->cnstr + i;
+        nvars = ef_constraint_num_uvars(cnstr);
+        resize_ivector(&solver->uvalue_aux, nvars);
+        solver->uvalue_aux.size = nvars;
+        ctx = solver->cnstr_context[i];
+        (void) get_context_model(solver, ctx, status, cnstr->uvars, nvars, solver->uvalue_aux.data, NULL, false);
+        block = mk_array_neq(solver->prob->manager, nvars, cnstr->uvars, solver->uvalue_aux.data);
+
+        replace_forall_witness(solver, i);
+        cex_cnstr = constraint_distinct_filter(&solver->value_table, nvars, solver->uvalue_aux.data);
+        ef_solver_learn(solver, cex_cnstr, i);
+        solver->numlearnt ++;
+
+        if (solver->status == EF_STATUS_SEARCHING &&
+            context_status(solver->exists_context) != STATUS_UNSAT &&
+            round < solver->max_numlearnt_per_round &&
+            block_cnstr_counterexample(solver, i, block)) {
+          pending.data[k] = i;
+          k ++;
+        }
+        break;
+
+      case STATUS_UNSAT:
+        break;
+
+      case STATUS_INTERRUPTED:
+        solver->status = EF_STATUS_INTERRUPTED;
+        break;
+
+      default:
+        solver->status = EF_STATUS_CHECK_ERROR;
+        solver->error_code = status;
+        break;
+      }
+    }
+    pending.size = k;
+
+    if (solver->status != EF_STATUS_SEARCHING) break;
+  }
+
+ done:
+  clear_cnstr_contexts(solver);
+  delete_ivector(&pending);
+
+  if (solver->status == EF_STATUS_SEARCHING && !refuted) {
+    solver->status = EF_STATUS_SAT;
+  }
+}
+
+
+
 /*
  * EF SOLVER: OUTER LOOP
  */
@@ -1539,7 +2046,11 @@ static void ef_solver_search(ef_solver_t *solver) {
 #if TRACE_LIGHT
       printf("========= TESTING EXISTS MODEL ===========\n");
 #endif
-      ef_solver_check_exists_model(solver);
+      if (solver->num_threads > 0 && !solver->prob->has_uint) {
+        ef_solver_check_exists_model_batch(solver);
+      } else {
+        ef_solver_check_exists_model(solver);
+      }
 #if TRACE_LIGHT
       printf("========= TESTING EXISTS MODEL DONE ===========\n");
 #endif
@@ -1589,13 +2100,14 @@ static void ef_solver_search(ef_solver_t *solver) {
  */
 void ef_solver_check(ef_solver_t *solver, const param_t *parameters,
 		     ef_gen_option_t gen_mode, uint32_t max_samples, uint32_t max_iters, uint32_t max_numlearnt,
-		     bool ematching) {
+		     bool ematching, uint32_t num_threads) {
   solver->parameters = parameters;
   solver->option = gen_mode;
   solver->max_samples = max_samples;
   solver->max_iters = max_iters;
   solver->max_numlearnt_per_round = max_numlearnt;
   solver->ematching = ematching;
+  solver->num_threads = num_threads;
   solver->scan_idx = 0;
 
   // adjust mode
@@ -1608,6 +2120,7 @@ void ef_solver_check(ef_solver_t *solver, const param_t *parameters,
 
   assert(solver->exists_context == NULL &&
 	 solver->forall_context == NULL &&
+	 solver->cnstr_context == NULL &&
 	 solver->exists_model == NULL);
 
   ef_solver_search(solver);
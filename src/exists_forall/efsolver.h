@@ -145,6 +145,16 @@
  * Internal data structures:
  * - exists_context, forall_context: pointers to contexts, allocated and initialized
  *   when needed
+ * - cnstr_context: array of one forall context per universal constraint
+ *   (used if num_threads > 0). Context i is created when constraint i is
+ *   first checked and B_i(Y_i) AND not C_i(X_i, Y_i) is asserted in it.
+ *   It's kept for the whole search.
+ * - cnstr_status: result of the last check in cnstr_context[i]
+ * - cnstr_assumptions: literals assumed in the check of context i
+ *   (i.e., X_i = current exists model + activation literal)
+ * - cnstr_activator: activation literal for the clauses that block
+ *   counterexamples in context i (NULL_TERM until it's needed).
+ *   It's created once per context.
  * - evalue = array large enough to store the value of all exists variables
  * - uvalue = array large enough to store the value of all universal variables
  * - evalue_aux and uvalue_aux = auxiliary vectors (to store value vector of smaller
@@ -206,6 +216,7 @@ typedef struct ef_solver_s {
   uint32_t max_iters;        // bound on outer iterations
   uint32_t max_numlearnt_per_round;    // bound on inner iterations
   bool ematching;            // use ematching or not
+  uint32_t num_threads;      // threads for checking the universal constraints (0 means sequential scan)
 
   uint32_t num_models;       // total number of exists models
   uint32_t iters;            // number of outer iterations
@@ -216,6 +227,10 @@ typedef struct ef_solver_s {
   // Exists and forall contexts + exists model
   context_t *exists_context;
   context_t *forall_context;
+  context_t **cnstr_context;
+  smt_status_t *cnstr_status;
+  ivector_t *cnstr_assumptions;
+  term_t *cnstr_activator;
   model_t *exists_model;
   ivector_t evalue;
   term_t *uvalue;
@@ -278,10 +293,18 @@ extern void ef_solver_set_trace(ef_solver_t *solver, tracer_t *trace);
  * - also it's available as a mapping form solver->prob->evars to solver->evalues
  *
  * Also solver->iters stores the number of iterations required.
+ *
+ * If num_threads is positive and the problem has no uninterpreted sorts
+ * or functions, each universal constraint is checked in its own forall
+ * context, which is kept across iterations (the candidate model is
+ * passed as assumptions). All constraints are checked against a candidate model and the
+ * lemmas learned from all counterexamples are added to the exists context
+ * before the next candidate is computed. In thread-safe builds, the checks
+ * run in parallel using up to num_threads threads.
  */
 extern void ef_solver_check(ef_solver_t *solver, const param_t *parameters,
 			    ef_gen_option_t gen_mode, uint32_t max_samples, uint32_t max_iters, uint32_t max_numlearnt,
-			    bool ematching);
+			    bool ematching, uint32_t num_threads);
 
 
 /*
@@ -55,6 +55,7 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "ef-max-iters",
   "ef-max-lemmas-per-round",
   "ef-max-samples",
+  "ef-threads",
   "ematch-cnstr-alpha",
   "ematch-cnstr-epsilon",
   "ematch-cnstr-mode",
@@ -62,6 +63,7 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "ematch-inst-per-round",
   "ematch-inst-per-search",
   "ematch-inst-total",
+  "ematch-mbqi",
   "ematch-rounds-per-search",
   "ematch-search-total",
   "ematch-term-alpha",
@@ -82,13 +84,19 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "max-extensionality",
   "max-interface-eqs",
   "max-update-conflicts",
+  "mcsat-bv-bdd-budget",
+  "mcsat-bv-expl-cache",
   "mcsat-bv-var-size",
+  "mcsat-incremental-model",
   "mcsat-nra-bound",
   "mcsat-nra-bound-max",
   "mcsat-nra-bound-min",
+  "mcsat-nra-icp",
   "mcsat-nra-mgcd",
   "mcsat-nra-nlsat",
+  "mcsat-nra-proj-cache",
   "mcsat-var-order",
+  "memory-limit",
   "optimistic-fcheck",
   "prop-threshold",
   "r-factor",
@@ -128,6 +136,7 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_EF_MAX_ITERS,
   PARAM_EF_MAX_LEMMAS_PER_ROUND,
   PARAM_EF_MAX_SAMPLES,
+  PARAM_EF_THREADS,
   PARAM_EMATCH_CNSTR_ALPHA,
   PARAM_EMATCH_CNSTR_EPSILON,
   PARAM_EMATCH_CNSTR_MODE,
@@ -135,6 +144,7 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_EMATCH_INST_PER_ROUND,
   PARAM_EMATCH_INST_PER_SEARCH,
   PARAM_EMATCH_INST_TOTAL,
+  PARAM_EMATCH_MBQI,
   PARAM_EMATCH_ROUNDS_PER_SEARCH,
   PARAM_EMATCH_SEARCH_TOTAL,
   PARAM_EMATCH_TERM_ALPHA,
@@ -155,13 +165,19 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_MAX_EXTENSIONALITY,
   PARAM_MAX_INTERFACE_EQS,
   PARAM_MAX_UPDATE_CONFLICTS,
+  PARAM_MCSAT_BV_BDD_BUDGET,
+  PARAM_MCSAT_BV_EXPL_CACHE,
   PARAM_MCSAT_BV_VAR_SIZE,
+  PARAM_MCSAT_INCREMENTAL_MODEL,
   PARAM_MCSAT_NRA_BOUND,
   PARAM_MCSAT_NRA_BOUND_MAX,
   PARAM_MCSAT_NRA_BOUND_MIN,
+  PARAM_MCSAT_NRA_ICP,
   PARAM_MCSAT_NRA_MGCD,
   PARAM_MCSAT_NRA_NLSAT,
+  PARAM_MCSAT_NRA_PROJ_CACHE,
   PARAM_MCSAT_VAR_ORDER,
+  PARAM_MEMORY_LIMIT,
   PARAM_OPTIMISTIC_FCHECK,
   PARAM_PROP_THRESHOLD,
   PARAM_R_FACTOR,
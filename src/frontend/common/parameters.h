@@ -68,6 +68,8 @@ typedef enum yices_param {
   PARAM_CLAUSE_DECAY,
   PARAM_CACHE_TCLAUSES,
   PARAM_TCLAUSE_SIZE,
+  // memory budget
+  PARAM_MEMORY_LIMIT,
   // egraph parameters
   PARAM_DYN_ACK,
   PARAM_DYN_BOOL_ACK,
@@ -97,8 +99,10 @@ typedef enum yices_param {
   PARAM_EF_MAX_SAMPLES,
   PARAM_EF_MAX_ITERS,
   PARAM_EF_MAX_LEMMAS_PER_ROUND,
+  PARAM_EF_THREADS,
   // quant solver
   PARAM_EMATCH_EN,
+  PARAM_EMATCH_MBQI,
   PARAM_EMATCH_INST_PER_ROUND,
   PARAM_EMATCH_INST_PER_SEARCH,
   PARAM_EMATCH_INST_TOTAL,
@@ -120,7 +124,12 @@ typedef enum yices_param {
   PARAM_MCSAT_NRA_BOUND,
   PARAM_MCSAT_NRA_BOUND_MIN,
   PARAM_MCSAT_NRA_BOUND_MAX,
+  PARAM_MCSAT_NRA_ICP,
+  PARAM_MCSAT_NRA_PROJ_CACHE,
   PARAM_MCSAT_BV_VAR_SIZE,
+  PARAM_MCSAT_BV_BDD_BUDGET,
+  PARAM_MCSAT_BV_EXPL_CACHE,
+  PARAM_MCSAT_INCREMENTAL_MODEL,
   PARAM_MCSAT_VAR_ORDER,
   // error
   PARAM_UNKNOWN
@@ -828,7 +828,7 @@ smt_token_t next_smt_token(lexer_t *lex) {
   // record start of token
   lex->tk_pos = rd->pos;
   lex->tk_line = rd->line;
-  lex->tk_column = rd->column;
+  lex->tk_column = reader_column(rd);
 
   switch (c) {
   case '(':
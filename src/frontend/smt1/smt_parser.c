@@ -81,11 +81,11 @@ static void syntax_error(lexer_t *lex, int32_t expected_token) {
   switch (tk) {
   case SMT_TK_OPEN_STRING:
     fprintf(stderr, "missing string terminator \" (line %"PRId32", column %"PRId32")\n",
-            rd->line, rd->column);
+            rd->line, reader_column(rd));
     return;
   case SMT_TK_OPEN_USER_VAL:
     fprintf(stderr, "missing user-value terminator } (line %"PRId32", column %"PRId32")\n",
-            rd->line, rd->column);
+            rd->line, reader_column(rd));
     return;
   case SMT_TK_INVALID_NUMBER:
     fprintf(stderr, "invalid number %s (line %"PRId32", column %"PRId32")\n",
@@ -885,7 +885,7 @@ void smt2_syntax_error(lexer_t *lex, int32_t expected_token) {
   tk = current_token(lex);
   rd = &lex->reader;
 
-  start_error(rd->line, rd->column);
+  start_error(rd->line, reader_column(rd));
 
   switch (tk) {
   case SMT2_TK_INVALID_STRING:
@@ -1663,6 +1663,7 @@ static void show_core_stats(int fd, print_buffer_t *b, smt_core_t *core) {
   print_string_and_uint32(fd, b, " :boolean-variables ", num_vars(core));
   print_string_and_uint32(fd, b, " :atoms ", num_atoms(core));
   print_string_and_uint32(fd, b, " :clauses ", num_clauses(core));
+  print_string_and_uint64(fd, b, " :clause-memory ", (uint64_t) clause_memory(core));
   print_string_and_uint32(fd, b, " :restarts ", num_restarts(core));
   print_string_and_uint32(fd, b, " :clause-db-reduce ", num_reduce_calls(core));
   print_string_and_uint32(fd, b, " :clause-db-simplify ", num_simplify_calls(core));
@@ -1696,6 +1697,14 @@ static void show_quantsolver_stats(int fd, print_buffer_t *b, quant_solver_t *so
   print_string_and_uint32(fd, b, " :ematch-instances ", quant_solver_num_instances(solver));
   print_string_and_uint32(fd, b, " :ematch-rounds ", solver->stats.num_rounds);
   print_string_and_uint32(fd, b, " :ematch-searches ", solver->stats.num_search);
+  print_string_and_uint32(fd, b, " :ematch-redundant ", solver->stats.num_redundant);
+  print_string_and_uint32(fd, b, " :ematch-true ", solver->stats.num_true);
+  print_string_and_uint32(fd, b, " :ematch-delayed ", solver->stats.num_delayed);
+  if (solver->mbqi.enabled) {
+    print_string_and_uint32(fd, b, " :ematch-mbqi-rounds ", solver->mbqi.num_rounds);
+    print_string_and_uint32(fd, b, " :ematch-mbqi-checks ", solver->mbqi.num_checks);
+    print_string_and_uint32(fd, b, " :ematch-mbqi-instances ", solver->mbqi.num_instances);
+  }
   print_string_and_uint32(fd, b, " :ematch-trial-fdepth ", solver->em.exec.fdepth);
   print_string_and_uint32(fd, b, " :ematch-trial-vdepth ", solver->em.exec.vdepth);
   print_string_and_uint32(fd, b, " :ematch-cnstr-epsilon ", solver->cnstr_learner.learner.epsilon);
@@ -2652,6 +2661,21 @@ static void timeout_handler(void *data) {
   }
 }
 
+/*
+ * Recover from an interruption that's not caused by a timeout
+ * (i.e., the search exceeded the memory budget).
+ * - cmd = command name for tracing
+ * - return STATUS_UNKNOWN
+ */
+static smt_status_t recover_from_interrupt(smt2_globals_t *g, const char *cmd) {
+  trace_printf(g->tracer, 2, "(%s: out of memory)\n", cmd);
+  if (context_get_mode(g->ctx) == CTX_MODE_INTERACTIVE) {
+    context_cleanup(g->ctx);
+    assert(context_status(g->ctx) == STATUS_IDLE);
+  }
+  return STATUS_UNKNOWN;
+}
+
 /*
  * Call check_context with the given search parameters.
  * - if g->timeout is positive, set a timeout first
@@ -2661,7 +2685,11 @@ static smt_status_t check_sat_with_timeout(smt2_globals_t *g, const param_t *par
 
   if (g->timeout == 0) {
     // no timeout
-    return check_context(g->ctx, params);
+    stat = check_context(g->ctx, params);
+    if (stat == STATUS_INTERRUPTED) {
+      stat = recover_from_interrupt(g, "check-sat");
+    }
+    return stat;
   }
 
   /*
@@ -2707,6 +2735,9 @@ static smt_status_t check_sat_with_assumptions(smt2_globals_t *g, const param_t
     // no timeout
     stat = check_with_assumptions(g->ctx, params, a->assumptions.size, a->assumptions.data, &a->core);
     a->status = stat;
+    if (stat == STATUS_INTERRUPTED) {
+      stat = recover_from_interrupt(g, "check-sat-assuming");
+    }
     return stat;
   }
 
@@ -2754,6 +2785,9 @@ static smt_status_t check_sat_with_model(smt2_globals_t *g, const param_t *param
   if (g->timeout == 0) {
     // no timeout
     stat = check_with_model(g->ctx, params, n, vars, values);
+    if (stat == STATUS_INTERRUPTED) {
+      stat = recover_from_interrupt(g, "check-sat-assuming-model");
+    }
     g->check_with_model_status = stat;
     return stat;
   }
@@ -4486,6 +4520,9 @@ static void explain_unknown_status(smt2_globals_t *g) {
         assert(g->trivially_sat);
         print_error("the context is satisfiable");
       }
+    } else if (context_memout(g->ctx)) {
+      print_kw_symbol_pair(":reason-unknown", "memout");
+      flush_out();
     } else {
       switch (context_status(g->ctx)) {
       case STATUS_UNKNOWN:
@@ -5143,6 +5180,10 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_uint32_value(g->parameters.tclause_size);
     break;
 
+  case PARAM_MEMORY_LIMIT:
+    print_uint32_value(g->parameters.memory_limit);
+    break;
+
   case PARAM_DYN_ACK:
     print_boolean_value(g->parameters.use_dyn_ack);
     break;
@@ -5243,10 +5284,18 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_uint32_value(g->ef_client.ef_parameters.max_numlearnt_per_round);
     break;
 
+  case PARAM_EF_THREADS:
+    print_uint32_value(g->ef_client.ef_parameters.num_threads);
+    break;
+
   case PARAM_EMATCH_EN:
     print_boolean_value(g->ef_client.ef_parameters.ematching);
     break;
 
+  case PARAM_EMATCH_MBQI:
+    print_boolean_value(g->ef_client.ef_parameters.ematch_mbqi);
+    break;
+
   case PARAM_EMATCH_INST_PER_ROUND:
     print_uint32_value(g->ef_client.ef_parameters.ematch_inst_per_round);
     break;
@@ -5307,6 +5356,18 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_string_value(ematchmode2string[g->ef_client.ef_parameters.ematch_term_mode]);
     break;
 
+  case PARAM_MCSAT_BV_BDD_BUDGET:
+    print_uint32_value(g->mcsat_options.bv_bdd_budget);
+    break;
+
+  case PARAM_MCSAT_BV_EXPL_CACHE:
+    print_uint32_value(g->mcsat_options.bv_explanation_cache_size);
+    break;
+
+  case PARAM_MCSAT_INCREMENTAL_MODEL:
+    print_boolean_value(g->mcsat_options.incremental_model);
+    break;
+
   case PARAM_MCSAT_NRA_BOUND:
     print_boolean_value(g->mcsat_options.nra_bound);
     break;
@@ -5319,6 +5380,10 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_int32_value(g->mcsat_options.nra_bound_min);
     break;
 
+  case PARAM_MCSAT_NRA_ICP:
+    print_boolean_value(g->mcsat_options.nra_icp);
+    break;
+
   case PARAM_MCSAT_NRA_MGCD:
     print_boolean_value(g->mcsat_options.nra_mgcd);
     break;
@@ -5327,6 +5392,10 @@ static bool yices_get_option(smt2_globals_t *g, yices_param_t p) {
     print_boolean_value(g->mcsat_options.nra_nlsat);
     break;
 
+  case PARAM_MCSAT_NRA_PROJ_CACHE:
+    print_uint32_value(g->mcsat_options.nra_projection_cache_size);
+    break;
+
   case PARAM_MCSAT_VAR_ORDER:
     print_terms_value(g,g->mcsat_options.var_order);
     break;
@@ -5786,6 +5855,12 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_MEMORY_LIMIT:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      g->parameters.memory_limit = n;
+    }
+    break;
+
   case PARAM_DYN_ACK:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       g->parameters.use_dyn_ack = tt;
@@ -5952,12 +6027,24 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_EF_THREADS:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      g->ef_client.ef_parameters.num_threads = n;
+    }
+    break;
+
   case PARAM_EMATCH_EN:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       g->ef_client.ef_parameters.ematching = tt;
     }
     break;
 
+  case PARAM_EMATCH_MBQI:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->ef_client.ef_parameters.ematch_mbqi = tt;
+    }
+    break;
+
   case PARAM_EMATCH_INST_PER_ROUND:
     if (param_val_to_pos32(param, val, &n, &reason)) {
       g->ef_client.ef_parameters.ematch_inst_per_round = n;
@@ -6098,6 +6185,26 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_MCSAT_NRA_ICP:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->mcsat_options.nra_icp = tt;
+      context = g->ctx;
+      if (context != NULL) {
+        context->mcsat_options.nra_icp = tt;
+      }
+    }
+    break;
+
+  case PARAM_MCSAT_NRA_PROJ_CACHE:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      g->mcsat_options.nra_projection_cache_size = n;
+      context = g->ctx;
+      if (context != NULL) {
+        context->mcsat_options.nra_projection_cache_size = n;
+      }
+    }
+    break;
+
   case PARAM_MCSAT_BV_VAR_SIZE:
     if (param_val_to_pos32(param, val, &n, &reason)) {
       g->mcsat_options.bv_var_size = n;
@@ -6108,6 +6215,36 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_MCSAT_BV_BDD_BUDGET:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      g->mcsat_options.bv_bdd_budget = n;
+      context = g->ctx;
+      if (context != NULL) {
+        context->mcsat_options.bv_bdd_budget = n;
+      }
+    }
+    break;
+
+  case PARAM_MCSAT_BV_EXPL_CACHE:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      g->mcsat_options.bv_explanation_cache_size = n;
+      context = g->ctx;
+      if (context != NULL) {
+        context->mcsat_options.bv_explanation_cache_size = n;
+      }
+    }
+    break;
+
+  case PARAM_MCSAT_INCREMENTAL_MODEL:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->mcsat_options.incremental_model = tt;
+      context = g->ctx;
+      if (context != NULL) {
+        context->mcsat_options.incremental_model = tt;
+      }
+    }
+    break;
+
   case PARAM_MCSAT_VAR_ORDER:
     if (param_val_to_terms(param, val, &terms, &reason)) {
       g->mcsat_options.var_order = terms;
@@ -23,6 +23,8 @@
 
 #include <assert.h>
 #include <ctype.h>
+#include <stdbool.h>
+#include <string.h>
 
 // perfect hash functions generated by gperf
 #include "frontend/smt2/smt2_hash_tokens.h"
@@ -449,21 +451,55 @@ void smt2_lexer_activate_two_dot_five(void) {
 }
 
 
+/*
+ * Character classes: smt2_char_class[c] for 0 <= c < 256
+ * - SMT2_CHAR_SIMPLE: c can occur in simple symbols and keywords
+ * - SMT2_CHAR_DIGIT: c is a decimal digit
+ * The table is filled in when a lexer is initialized, because
+ * the simple characters depend on the locale.
+ */
+#define SMT2_CHAR_SIMPLE ((uint8_t) 1)
+#define SMT2_CHAR_DIGIT  ((uint8_t) 2)
+
+static uint8_t smt2_char_class[256];
+
+static bool simple_char(int c);
+
+static void smt2_init_char_class(void) {
+  uint32_t c;
+
+  for (c=0; c<256; c++) {
+    smt2_char_class[c] = 0;
+    if (simple_char(c)) smt2_char_class[c] |= SMT2_CHAR_SIMPLE;
+    if (isdigit(c)) smt2_char_class[c] |= SMT2_CHAR_DIGIT;
+  }
+}
+
+
 /*
  * Lexer initialization
  */
 int32_t init_smt2_file_lexer(lexer_t *lex, const char *filename) {
   smt2_activate_default();
+  smt2_init_char_class();
   return init_file_lexer(lex, filename);
 }
 
 void init_smt2_stream_lexer(lexer_t *lex, FILE *f, const char *name) {
   smt2_activate_default();
+  smt2_init_char_class();
   init_stream_lexer(lex, f, name);
 }
 
+void init_smt2_read_ahead_lexer(lexer_t *lex, FILE *f, const char *name) {
+  smt2_activate_default();
+  smt2_init_char_class();
+  init_read_ahead_lexer(lex, f, name);
+}
+
 void init_smt2_string_lexer(lexer_t *lex, char *data, const char *name) {
   smt2_activate_default();
+  smt2_init_char_class();
   init_string_lexer(lex, data, name);
 }
 
@@ -504,6 +540,60 @@ const char *smt2_keyword_to_string(smt2_keyword_t kw) {
 }
 
 
+/*
+ * Fast path when the input is in memory (cf. reader_block_avail):
+ * - append the longest sequence of characters of class k that starts
+ *   with the current character to the buffer, skip it, and return
+ *   the new current character
+ * - if the sequence reaches the end of the block, continue in the
+ *   next one (for read-ahead readers)
+ * - none of the classes includes '\n' so the line does not change
+ */
+static int smt2_scan_block(reader_t *rd, string_buffer_t *buffer, uint8_t k) {
+  const unsigned char *p, *q, *end;
+  int c;
+
+  assert(reader_block_avail(rd) > 0);
+
+  do {
+    p = reader_block_current(rd);
+    end = p + reader_block_avail(rd);
+    q = p;
+    while (q < end && (smt2_char_class[*q] & k)) {
+      q ++;
+    }
+    string_buffer_append_chars(buffer, (const char *) p, (uint32_t) (q - p));
+    c = reader_block_skip(rd, (uint64_t) (q - p));
+  } while (q == end && reader_block_avail(rd) > 0);
+
+  return c;
+}
+
+/*
+ * Skip a comment in memory: move to the next '\n' or to the end of
+ * the input and return the new current character.
+ */
+static int smt2_skip_comment_block(reader_t *rd) {
+  const unsigned char *p, *q;
+  uint64_t n;
+  int c;
+
+  assert(reader_block_avail(rd) > 0);
+
+  do {
+    n = reader_block_avail(rd);
+    p = reader_block_current(rd);
+    q = memchr(p, '\n', n);
+    if (q != NULL) {
+      n = q - p;
+    }
+    c = reader_block_skip(rd, n);
+  } while (q == NULL && reader_block_avail(rd) > 0);
+
+  return c;
+}
+
+
 /*
  * Read a string literal
  * - current char is "
@@ -717,10 +807,14 @@ static smt2_token_t smt2_read_number(lexer_t *lex) {
   assert(string_buffer_length(buffer) == 0 && isdigit(c) && c != '0');
 
   // first sequence of digits
-  do {
-    string_buffer_append_char(buffer, c);
-    c = reader_next_char(rd);
-  } while (isdigit(c));
+  if (reader_block_avail(rd) > 0) {
+    c = smt2_scan_block(rd, buffer, SMT2_CHAR_DIGIT);
+  } else {
+    do {
+      string_buffer_append_char(buffer, c);
+      c = reader_next_char(rd);
+    } while (isdigit(c));
+  }
 
   tk = SMT2_TK_NUMERAL;
   if (c == '.') {
@@ -807,7 +901,7 @@ static smt2_token_t smt2_read_number0(lexer_t *lex) {
  * accept non-ASCII characters, depending on the locale and
  * how isalnum(c) decides).
  */
-static bool issimple(int c) {
+static bool simple_char(int c) {
   if (isalnum(c)) {
     return true;
   }
@@ -837,6 +931,13 @@ static bool issimple(int c) {
   }
 }
 
+static inline bool issimple(int c) {
+  if (0 <= c && c < 256) {
+    return smt2_char_class[c] & SMT2_CHAR_SIMPLE;
+  }
+  return simple_char(c);
+}
+
 
 /*
  * Read a keyword:
@@ -859,10 +960,16 @@ static smt2_token_t smt2_read_keyword(lexer_t *lex) {
 
   assert(string_buffer_length(buffer) == 0 && c == ':');
 
-  do {
-    string_buffer_append_char(buffer, c);
-    c = reader_next_char(rd);
-  } while (issimple(c));
+  string_buffer_append_char(buffer, c);
+  c = reader_next_char(rd);
+  if (reader_block_avail(rd) > 0) {
+    c = smt2_scan_block(rd, buffer, SMT2_CHAR_SIMPLE);
+  } else {
+    while (issimple(c)) {
+      string_buffer_append_char(buffer, c);
+      c = reader_next_char(rd);
+    }
+  }
   string_buffer_close(buffer);
 
   tk = SMT2_TK_KEYWORD;
@@ -897,10 +1004,14 @@ static smt2_token_t smt2_read_symbol(lexer_t *lex) {
 
   assert(string_buffer_length(buffer) == 0 && issimple(c));
 
-  do {
-    string_buffer_append_char(buffer, c);
-    c = reader_next_char(rd);
-  } while (issimple(c));
+  if (reader_block_avail(rd) > 0) {
+    c = smt2_scan_block(rd, buffer, SMT2_CHAR_SIMPLE);
+  } else {
+    do {
+      string_buffer_append_char(buffer, c);
+      c = reader_next_char(rd);
+    } while (issimple(c));
+  }
   string_buffer_close(buffer);
 
   tk = SMT2_TK_SYMBOL;
@@ -992,15 +1103,19 @@ smt2_token_t next_smt2_token(lexer_t *lex) {
     while (isspace(c)) c = reader_next_char(rd);
     if (c != ';') break;
     // comments: read everything until the end of the line or EOF
-    do {
-      c = reader_next_char(rd);
-    } while (c != '\n' && c != EOF);
+    if (reader_block_avail(rd) > 0) {
+      c = smt2_skip_comment_block(rd);
+    } else {
+      do {
+        c = reader_next_char(rd);
+      } while (c != '\n' && c != EOF);
+    }
   }
 
   // record start of token
   lex->tk_pos = rd->pos;
   lex->tk_line = rd->line;
-  lex->tk_column = rd->column;
+  lex->tk_column = reader_column(rd);
 
   switch (c) {
   case '(':
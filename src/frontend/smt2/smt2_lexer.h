@@ -302,6 +302,13 @@ static inline void init_smt2_stdin_lexer(lexer_t *lex) {
   init_smt2_stream_lexer(lex, stdin, "stdin");
 }
 
+/*
+ * Variant: the input is read by a separate thread while commands are
+ * processed (see init_read_ahead_reader). This should not be used in
+ * interactive mode.
+ */
+extern void init_smt2_read_ahead_lexer(lexer_t *lex, FILE *f, const char *name);
+
 extern void init_smt2_string_lexer(lexer_t *lex, char *data, const char *name);
 
 
@@ -525,7 +525,7 @@ yices_token_t next_yices_token(lexer_t *lex) {
   // record token position (start of token)
   lex->tk_pos = rd->pos;
   lex->tk_line = rd->line;
-  lex->tk_column = rd->column;
+  lex->tk_column = reader_column(rd);
 
   switch (c) {
   case '(':
@@ -71,7 +71,7 @@ static void export_syntax_error(lexer_t *lex, int32_t expected_token) {
   case TK_OPEN_STRING:
     error->code = INVALID_TOKEN;
     error->line = rd->line;
-    error->column = rd->column;
+    error->column = reader_column(rd);
     break;
 
   case TK_EMPTY_BVCONST:
@@ -196,7 +196,7 @@ static void syntax_error(lexer_t *lex, FILE *err, int32_t expected_token) {
   switch (tk) {
   case TK_OPEN_STRING:
     fprintf(err, "missing string terminator \" (line %"PRId32", column %"PRId32")\n",
-            rd->line, rd->column);
+            rd->line, reader_column(rd));
     break;
 
   case TK_EMPTY_BVCONST:
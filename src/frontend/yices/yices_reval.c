@@ -1308,6 +1308,10 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_pos32_param(param2string[p], parameters.tclause_size, n);
     break;
 
+  case PARAM_MEMORY_LIMIT:
+    show_pos32_param(param2string[p], parameters.memory_limit, n);
+    break;
+
   case PARAM_DYN_ACK:
     show_bool_param(param2string[p], parameters.use_dyn_ack, n);
     break;
@@ -1408,10 +1412,18 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_pos32_param(param2string[p], ef_client_globals.ef_parameters.max_numlearnt_per_round, n);
     break;
 
+  case PARAM_EF_THREADS:
+    show_pos32_param(param2string[p], ef_client_globals.ef_parameters.num_threads, n);
+    break;
+
   case PARAM_EMATCH_EN:
     show_bool_param(param2string[p], ef_client_globals.ef_parameters.ematching, n);
     break;
 
+  case PARAM_EMATCH_MBQI:
+    show_bool_param(param2string[p], ef_client_globals.ef_parameters.ematch_mbqi, n);
+    break;
+
   case PARAM_EMATCH_INST_PER_ROUND:
     show_pos32_param(param2string[p], ef_client_globals.ef_parameters.ematch_inst_per_round, n);
     break;
@@ -1728,6 +1740,13 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_MEMORY_LIMIT:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      parameters.memory_limit = n;
+      print_ok();
+    }
+    break;
+
   case PARAM_DYN_ACK:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       parameters.use_dyn_ack = tt;
@@ -1917,6 +1936,13 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_EF_THREADS:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      ef_client_globals.ef_parameters.num_threads = n;
+      print_ok();
+    }
+    break;
+
   case PARAM_EMATCH_EN:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       ef_client_globals.ef_parameters.ematching = tt;
@@ -1924,6 +1950,13 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_EMATCH_MBQI:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      ef_client_globals.ef_parameters.ematch_mbqi = tt;
+      print_ok();
+    }
+    break;
+
   case PARAM_EMATCH_INST_PER_ROUND:
     if (param_val_to_pos32(param, val, &n, &reason)) {
       ef_client_globals.ef_parameters.ematch_inst_per_round = n;
@@ -211,7 +211,7 @@ typedef enum optid {
   var_elim_opt,               // apply var elimination during internalization
   flatten_opt,                // flatten or and disequality terms
   learneq_opt,                // learn UF equalities
-  breaksym_opt,               // break symmetries in UF
+  breaksym_opt,               // break symmetries
   arith_elim_opt,             // eliminate arithmetic variables
   bvarith_elim_opt,           // simplification of bitvector arithmetic expressions
   keep_ite_opt,               // keep term if-then-else in the egraph
@@ -1984,7 +1984,7 @@ static int process_benchmark(char *filename) {
   if (learn_eq && arch == CTX_ARCH_EG) {
     enable_eq_abstraction(&context);
   }
-  if (break_sym && arch == CTX_ARCH_EG) {
+  if (break_sym) {
     enable_symmetry_breaking(&context);
   }
   if (arith_elim) {
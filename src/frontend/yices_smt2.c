@@ -87,6 +87,8 @@ extern const char * const yices_rev;
  * - interactive: set option :print-success to true.
  *   and  print a prompt before parsing commands if stdin is a terminal.
  * - timeout: command-line option
+ * - read_ahead: if this flag is true, the input (stdin or the input
+ *   file) is read in a separate thread while the commands are processed.
  *
  * - filename = name of the input file (NULL means read stdin)
  */
@@ -96,6 +98,7 @@ static tstack_t stack;
 
 static bool incremental;
 static bool interactive;
+static bool read_ahead;
 static bool smt2_model_format;
 static bool bvdecimal;
 static bool show_stats;
@@ -120,6 +123,7 @@ static pvector_t trace_tags;
 static bool ef_en_ematch;
 static int32_t ef_mbqi_max_iter;
 static int32_t ef_mbqi_max_lemma_per_round;
+static int32_t ef_num_threads;
 
 static int32_t ef_ematch_inst_per_round;
 static int32_t ef_ematch_inst_per_search;
@@ -153,6 +157,7 @@ typedef enum optid {
   verbosity_opt,           // set verbosity on the command line
   incremental_opt,         // enable incremental mode
   interactive_opt,         // enable interactive mode
+  read_ahead_opt,          // read the input in a separate thread
   smt2format_opt,          // use SMT-LIB2 format for models
   bvdecimal_opt,           // use (_ bv<xxx> n) for bit-vector constants
   timeout_opt,             // give a timeout
@@ -170,6 +175,7 @@ typedef enum optid {
   ematch_en_opt,                    // enable ematching
   mbqi_max_iter_opt,                // set max mbqi iterations
   mbqi_lemmas_per_round_opt,        // set max mbqi lemmas per round
+  ef_threads_opt,                   // set number of threads for the forall checks
   ematch_inst_per_round_opt,        // set max ematch instances per round
   ematch_inst_per_search_opt,       // set max ematch instances per search
   ematch_inst_total_opt,            // set max ematch instances
@@ -201,6 +207,7 @@ static option_desc_t options[NUM_OPTIONS] = {
   { "timeout", 't', MANDATORY_INT, timeout_opt },
   { "incremental", '\0', FLAG_OPTION, incremental_opt },
   { "interactive", '\0', FLAG_OPTION, interactive_opt },
+  { "read-ahead", '\0', FLAG_OPTION, read_ahead_opt },
   { "smt2-model-format", '\0', FLAG_OPTION, smt2format_opt },
   { "bvconst-in-decimal", '\0', FLAG_OPTION, bvdecimal_opt },
   { "delegate", '\0', MANDATORY_STRING, delegate_opt },
@@ -217,6 +224,7 @@ static option_desc_t options[NUM_OPTIONS] = {
   { "ematch", '\0', FLAG_OPTION, ematch_en_opt },
   { "mbqi-max-iter", '\0', MANDATORY_INT, mbqi_max_iter_opt },
   { "mbqi-lemmas-per-round", '\0', MANDATORY_INT, mbqi_lemmas_per_round_opt },
+  { "ef-threads", '\0', MANDATORY_INT, ef_threads_opt },
   { "ematch-inst-per-round", '\0', MANDATORY_INT, ematch_inst_per_round_opt },
   { "ematch-inst-per-search", '\0', MANDATORY_INT, ematch_inst_per_search_opt },
   { "ematch-inst-total", '\0', MANDATORY_INT, ematch_inst_total_opt },
@@ -264,6 +272,7 @@ static void print_help(const char *progname) {
          "    --stats, -s               Print statistics once all commands have been processed\n"
          "    --incremental             Enable support for push/pop\n"
          "    --interactive             Run in interactive mode (ignored if a filename is given)\n"
+         "    --read-ahead              Read the input in a separate thread while commands are processed\n"
          "    --smt2-model-format       Display models in the SMT-LIB 2 format (default = false)\n"
          "    --bvconst-in-decimal      Display bit-vector constants as decimal numbers (default = false)\n"
          "    --delegate=<satsolver>    Use an external SAT solver (can be cadical, cryptominisat, kissat, or y2sat)\n"
@@ -308,6 +317,7 @@ static void print_ef_help(const char *progname) {
   printf("   (mbqi)\n");
   printf("    --mbqi-max-iter=<M>             Set the max number of mbqi iterations (default: %d)\n", DEF_MBQI_MAX_ITERS);
   printf("    --mbqi-lemmas-per-round=<M>     Set the max number of lemmas per mbqi round (default: %d)\n", DEF_MBQI_MAX_LEMMAS_PER_ROUND);
+  printf("    --ef-threads=<M>                Set the number of threads for checking the universal constraints (default: %d)\n", DEF_EF_NUM_THREADS);
   printf("   (ematch)\n");
   printf("    --ematch-inst-per-round=<M>     Set the max number of instances per ematch round (default: %d)\n", DEFAULT_MAX_INSTANCES_PER_ROUND);
   printf("    --ematch-inst-per-search=<M>    Set the max number of instances per ematch seach (default: %d)\n", DEFAULT_MAX_INSTANCES_PER_SEARCH);
@@ -369,6 +379,7 @@ static void parse_command_line(int argc, char *argv[]) {
   filename = NULL;
   incremental = false;
   interactive = false;
+  read_ahead = false;
   smt2_model_format = false;
   bvdecimal = false;
   show_stats = false;
@@ -390,6 +401,7 @@ static void parse_command_line(int argc, char *argv[]) {
   ef_en_ematch = DEF_EMATCH_EN;
   ef_mbqi_max_iter = -1;
   ef_mbqi_max_lemma_per_round = -1;
+  ef_num_threads = -1;
   ef_ematch_inst_per_round = -1;
   ef_ematch_inst_per_search = -1;
   ef_ematch_inst_total = -1;
@@ -471,6 +483,10 @@ static void parse_command_line(int argc, char *argv[]) {
         interactive = true;
         break;
 
+      case read_ahead_opt:
+        read_ahead = true;
+        break;
+
       case delegate_opt:
         if (delegate == NULL) {
           unknown_delegate = true;
@@ -570,6 +586,11 @@ static void parse_command_line(int argc, char *argv[]) {
         ef_mbqi_max_lemma_per_round = elem.i_value;
         break;
 
+      case ef_threads_opt:
+        if (! validate_integer_option(&parser, &elem, 0, INT32_MAX)) goto bad_usage;
+        ef_num_threads = elem.i_value;
+        break;
+
       case ematch_inst_per_round_opt:
         if (! validate_integer_option(&parser, &elem, 0, INT32_MAX)) goto bad_usage;
         ef_ematch_inst_per_round = elem.i_value;
@@ -785,6 +806,16 @@ static void setup_ef(void) {
     q_clear(&q);
   }
 
+  if (ef_num_threads >= 0) {
+    aval_t aval_max;
+    rational_t q;
+    q_init(&q);
+    q_set32(&q, ef_num_threads);
+    aval_max = attr_vtbl_rational(__smt2_globals.avtbl, &q);
+    smt2_set_option(":yices-ef-threads", aval_max);
+    q_clear(&q);
+  }
+
   if (ef_ematch_inst_per_round >= 0) {
     aval_t aval_max;
     rational_t q;
@@ -1036,6 +1067,7 @@ static void force_utf8(void) {
 
 
 int main(int argc, char *argv[]) {
+  FILE *f;
   int32_t code;
   uint32_t i;
   bool prompt;
@@ -1046,14 +1078,26 @@ int main(int argc, char *argv[]) {
 
   if (filename != NULL) {
     // read from file
-    if (init_smt2_file_lexer(&lexer, filename) < 0) {
+    if (read_ahead) {
+      // don't memory-map the file: this is useful if it's a pipe
+      f = fopen(filename, "r");
+      if (f == NULL) {
+        perror(filename);
+        exit(YICES_EXIT_FILE_NOT_FOUND);
+      }
+      init_smt2_read_ahead_lexer(&lexer, f, filename);
+    } else if (init_smt2_file_lexer(&lexer, filename) < 0) {
       perror(filename);
       exit(YICES_EXIT_FILE_NOT_FOUND);
     }
   } else {
     // read from stdin
-    init_smt2_stdin_lexer(&lexer);
     prompt = interactive && isatty(STDIN_FILENO);
+    if (read_ahead && !prompt) {
+      init_smt2_read_ahead_lexer(&lexer, stdin, "stdin");
+    } else {
+      init_smt2_stdin_lexer(&lexer);
+    }
   }
 
   init_handlers();
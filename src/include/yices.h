@@ -1962,6 +1962,39 @@ __YICES_DLLSPEC__ extern term_t yices_bvslt_atom(term_t t1, term_t t2);  // t1 <
 
 
 
+/*****************************
+ *  BATCH TERM CONSTRUCTION  *
+ ****************************/
+
+/*
+ * Build many terms in a single call.
+ * - code[0 ... size-1] is a sequence of instructions in postfix order
+ *   (cf. term_batch_op_t in yices_types.h)
+ * - each instruction [op, n, a_1, ..., a_n] builds one node.
+ *   For most opcodes, a_1 ... a_n are the indices of nodes built
+ *   by earlier instructions.
+ * - nodes is either NULL or a term vector initialized by yices_init_term_vector.
+ *
+ * All the instructions are checked first then the terms are built
+ * with a single lock acquisition.
+ *
+ * The function returns the term built by the last instruction.
+ * If nodes is non-NULL, the term built by instruction i is stored in
+ * nodes->data[i].
+ *
+ * Error report:
+ * - if the code is malformed (bad opcode, bad arity, bad node index, or empty):
+ *   code = INVALID_BATCH_CODE
+ *   badval = index in code of the first bad instruction
+ * - if a node can't be built, the error is set by the corresponding
+ *   term constructor, except that badval is the index of the node
+ *   that failed (i.e., the node would be nodes->data[badval]).
+ * In both cases, the function returns NULL_TERM and nodes is empty.
+ */
+__YICES_DLLSPEC__ extern term_t yices_build_terms(uint32_t size, const int32_t code[], term_vector_t *nodes);
+
+
+
 
 /**************
  *  PARSING   *
@@ -2632,6 +2665,39 @@ __YICES_DLLSPEC__ extern void yices_garbage_collect(const term_t t[], uint32_t n
                                                     int32_t keep_named);
 
 
+/*
+ * Young-generation garbage collection.
+ * - t = optional array of terms
+ * - nt = size of t
+ * - keep_named specifies whether the named terms should all be preserved
+ *
+ * Only the terms created since the last call to the garbage collector
+ * (i.e., yices_garbage_collect or yices_garbage_collect_young) can be
+ * deleted. All older terms are preserved. The roots are the same as for
+ * yices_garbage_collect. Types are never deleted by this function.
+ *
+ * The cost of a young collection depends on the number of young terms
+ * and on the number of roots, not on the total number of terms. An
+ * application that builds many temporary terms can call this function
+ * often (e.g., when yices_num_young_terms exceeds a threshold) and
+ * call yices_garbage_collect less frequently.
+ */
+__YICES_DLLSPEC__ extern void yices_garbage_collect_young(const term_t t[], uint32_t nt, int32_t keep_named);
+
+
+/*
+ * Number of terms created since the last garbage collection
+ */
+__YICES_DLLSPEC__ extern uint32_t yices_num_young_terms(void);
+
+
+/*
+ * Get the garbage-collection statistics.
+ * - the statistics are stored in *stats (see yices_types.h)
+ */
+__YICES_DLLSPEC__ extern void yices_get_gc_stats(yices_gc_stats_t *stats);
+
+
 
 
 /****************************
@@ -2786,6 +2852,10 @@ __YICES_DLLSPEC__ extern void yices_free_config(ctx_config_t *config);
  *                    | "LIA"               |  linear integer arithmetic
  *                    | "LRA"               |  linear real arithmetic
  *                    | "LIRA"              |  mixed linear arithmetic (real + integer variables)
+ *   ----------------------------------------------------------------------------------------
+ *        "threads"   | non-negative integer|  number of threads used to analyze term sharing
+ *                    |                     |  when formulas are asserted (0 or 1 means no
+ *                    |                     |  threads; default is 0)
  *
  *
  *
@@ -2955,6 +3025,36 @@ __YICES_DLLSPEC__ extern context_t *yices_new_context(const ctx_config_t *config
 __YICES_DLLSPEC__ extern void yices_free_context(context_t *ctx);
 
 
+/*
+ * Clone a context
+ * - return a new context with the same configuration as ctx, in which
+ *   all the formulas asserted in ctx (since it was created or reset)
+ *   are asserted, with the same push/pop structure.
+ * - ctx must keep its assertions: option "log-assertions" must be
+ *   enabled before the first assertion (see yices_context_enable_option).
+ *   The clone inherits this option.
+ * - the new context is independent of ctx. It must be deleted using
+ *   yices_free_context.
+ *
+ * The clone's status is IDLE, or UNSAT if the assertions simplify
+ * to false. Learned clauses, blocking clauses (see yices_assert_blocking_clause),
+ * and models are not copied. Search parameters are not part of a
+ * context and must be given to the clone's check functions.
+ *
+ * Return NULL if there's an error.
+ *
+ * Error report:
+ * - if ctx's status is SEARCHING
+ *   code = CTX_INVALID_OPERATION
+ * - if option "log-assertions" was not enabled when formulas were
+ *   asserted in ctx
+ *   code = CTX_OPERATION_NOT_SUPPORTED
+ * - other error codes are possible if asserting the formulas in the
+ *   clone fails (this should not happen).
+ */
+__YICES_DLLSPEC__ extern context_t *yices_clone_context(context_t *ctx);
+
+
 /*
  * Get status: return the context's status flag
  * - return one of the codes defined in yices_types.h,
@@ -2971,6 +3071,22 @@ __YICES_DLLSPEC__ extern void yices_free_context(context_t *ctx);
 __YICES_DLLSPEC__ extern smt_status_t yices_context_status(context_t *ctx);
 
 
+/*
+ * Check whether the last call to check_context was interrupted
+ * because the solver exceeded its memory budget.
+ * - the budget is set by search parameter "memory-limit" (in MB)
+ * - it bounds the memory of the CDCL(T) core only: the SAT solver used
+ *   by the bit-vector solver and the MCSAT allocators are not counted
+ * - return 1 if the search was stopped by the budget
+ * - return 0 otherwise (or if ctx is an MCSAT context)
+ *
+ * If the memory budget is exceeded, the solver first deletes learned
+ * clauses. If that's not enough, the search is interrupted and
+ * check_context returns STATUS_INTERRUPTED.
+ */
+__YICES_DLLSPEC__ extern int32_t yices_context_memout(context_t *ctx);
+
+
 /*
  * Reset: remove all assertions and restore ctx's
  * status to STATUS_IDLE.
@@ -3035,13 +3151,26 @@ __YICES_DLLSPEC__ extern int32_t yices_pop(context_t *ctx);
  *   - this requires the context to include the egraph
  *
  *   break-symmetries: attempt to detect symmetries and add constraints
- *   to remove them (this can be used only if the context is created for QF_UF)
+ *   to remove them. For QF_UF, this detects symmetries between uninterpreted
+ *   constants. For other logics, this detects sets of interchangeable
+ *   arithmetic or bitvector variables x_1, ..., x_n and adds the ordering
+ *   constraints x_1 <= ... <= x_n.
  *
  *   assert-ite-bounds: try to determine upper and lower bound on if-then-else
  *   terms and assert these bounds. For example, if term t is defined as
  *   (ite c 10 (ite d 3 20)), then the context with include the assertion
  *   3 <= t <= 20.
  *
+ *   lemma-cache: exchange lemmas with the global lemma cache (disabled by
+ *   default). If enabled, yices_check_context adds the cached lemmas whose
+ *   terms are all internalized in the context before the search, and it
+ *   exports new lemmas to the cache after the search. See the LEMMA CACHE
+ *   section below. This option is not supported by MCSAT contexts.
+ *
+ *   log-assertions: keep all the asserted formulas (disabled by default).
+ *   This is required by yices_clone_context and it must be enabled before
+ *   any formula is asserted.
+ *
  * The parameter must be given as a string. For example, to disable var-elim,
  * call  yices_context_disable_option(ctx, "var-elim")
  *
@@ -3049,6 +3178,8 @@ __YICES_DLLSPEC__ extern int32_t yices_pop(context_t *ctx);
  *
  * Error codes:
  *  CTX_UNKNOWN_PARAMETER if the option name is not one of the above.
+ *  CTX_OPERATION_NOT_SUPPORTED if the option is lemma-cache and ctx
+ *  uses MCSAT.
  */
 __YICES_DLLSPEC__ extern int32_t yices_context_enable_option(context_t *ctx, const char *option);
 __YICES_DLLSPEC__ extern int32_t yices_context_disable_option(context_t *ctx, const char *option);
@@ -3586,6 +3717,136 @@ __YICES_DLLSPEC__ extern int32_t yices_export_formulas_to_dimacs(const term_t f[
 
 
 
+/*******************
+ *  TERM ARCHIVES  *
+ ******************/
+
+/*
+ * A term archive is a binary file that stores a set of terms and
+ * all the types and terms they depend on, including their names.
+ * Loading an archive is much faster than parsing the same terms.
+ *
+ * Save terms t[0 ... n-1] in an archive
+ * - filename = name of the archive file (overwritten if it exists)
+ * - n = number of terms in t
+ *
+ * Return code: 0 if the archive was written, -1 if there's an error.
+ *
+ * Error reports:
+ * if t[i] is not a valid term
+ *   code = INVALID_TERM
+ *   term1 = t[i]
+ * if one of the terms depends on a type variable or type instance
+ *   code = ARCHIVE_UNSUPPORTED_TERM
+ *   term1 = the first such term found
+ * if there's an error when opening or writing to filename
+ *   code = OUTPUT_ERROR
+ */
+__YICES_DLLSPEC__ extern int32_t yices_save_terms(const char *filename, uint32_t n, const term_t t[]);
+
+
+/*
+ * Load an archive built by yices_save_terms
+ * - filename = name of the archive file
+ * - v = term vector (must be initialized by yices_init_term_vector)
+ *
+ * The terms saved in the archive are rebuilt in the global term table and
+ * stored in v, in the order they were given to yices_save_terms.
+ *
+ * Names stored in the archive are handled as follows:
+ * - if a name refers to an existing uninterpreted type (resp. an existing
+ *   uninterpreted term of the same type), then that type or term is reused.
+ * - otherwise, a fresh type or term is created. It gets the name
+ *   only if that name is not already in use.
+ *
+ * Return code: 0 if the archive was loaded, -1 otherwise.
+ * If there's an error, v is empty.
+ *
+ * Error reports:
+ * if the file can't be opened or read
+ *   code = INPUT_ERROR
+ * if the file is not an archive or was produced by an incompatible
+ * version of Yices
+ *   code = ARCHIVE_FORMAT_ERROR
+ */
+__YICES_DLLSPEC__ extern int32_t yices_load_terms(const char *filename, term_vector_t *v);
+
+
+
+/*****************
+ *  LEMMA CACHE  *
+ ****************/
+
+/*
+ * The lemma cache stores clauses learned by contexts so that they can
+ * be reused by other contexts that solve related problems. It's shared
+ * by all contexts that enable option "lemma-cache" (see
+ * yices_context_enable_option).
+ *
+ * After each call to yices_check_context, such a context exports the short
+ * theory lemmas and learned clauses it produced. A clause is exported only
+ * if all its literals correspond to Boolean terms, and if it's valid in the
+ * theories (i.e., true independently of the assertions). Validity is checked
+ * by a separate solver with a small conflict budget, and at most a few clauses
+ * are checked per call. Before each search, the context adds the cached clauses
+ * whose terms are all internalized.
+ *
+ * The cache is created when the first lemma is exported. Its memory
+ * is bounded: once the limit is reached, new clauses are ignored. The
+ * terms in the cache are preserved by the garbage collector. The cache
+ * is deleted by yices_exit and yices_reset.
+ */
+
+/*
+ * Set the memory limit of the cache in MB (the default is 64MB)
+ * - this does not remove clauses if the cache already uses more memory
+ */
+__YICES_DLLSPEC__ extern void yices_set_lemma_cache_limit(uint32_t mb);
+
+
+/*
+ * Number of clauses in the cache (not counting the loaded clauses
+ * that are not checked yet)
+ */
+__YICES_DLLSPEC__ extern uint32_t yices_lemma_cache_size(void);
+
+
+/*
+ * Remove all clauses from the cache
+ */
+__YICES_DLLSPEC__ extern void yices_reset_lemma_cache(void);
+
+
+/*
+ * Save the cache in a term archive (cf. yices_save_terms)
+ * - filename = name of the file (overwritten if it exists)
+ *
+ * Return code: 0 if the file was written, -1 if there's an error.
+ *
+ * Error reports:
+ * if there's an error when opening or writing to filename
+ *   code = OUTPUT_ERROR
+ */
+__YICES_DLLSPEC__ extern int32_t yices_save_lemma_cache(const char *filename);
+
+
+/*
+ * Load the clauses saved by yices_save_lemma_cache
+ * - filename = name of the file
+ *
+ * Terms are rebuilt as in yices_load_terms. The clauses are not trusted:
+ * they are kept aside until a context that uses the cache checks them
+ * before its next search. Only the valid ones are added to the cache.
+ *
+ * Return code: number of clauses loaded (not counting the clauses already
+ * known), or -1 if there's an error.
+ *
+ * Error reports: same as yices_load_terms
+ */
+__YICES_DLLSPEC__ extern int32_t yices_load_lemma_cache(const char *filename);
+
+
+
 
 /***********************
  *  VALUES IN A MODEL  *
@@ -3822,6 +4083,23 @@ __YICES_DLLSPEC__ extern void yices_reset_yval_vector(yval_vector_t *v);
 __YICES_DLLSPEC__ extern int32_t yices_get_value(model_t *mdl, term_t t, yval_t *val);
 
 
+/*
+ * Values of terms a[0 ... n-1] as node descriptors.
+ * - a must be an array of n terms
+ * - val must be large enough to store n descriptors
+ *
+ * All terms are evaluated in a single pass: subterms shared by
+ * several a[i]s are evaluated once. The values computed are also kept in
+ * a cache attached to mdl so later queries on the same model reuse them.
+ *
+ * The function returns 0 if all values can be computed and stores
+ * the descriptors in val: val[i] = value of a[i] in mdl.
+ * Otherwise, it returns -1 and sets the error report. The error codes
+ * are the same as for yices_get_value.
+ */
+__YICES_DLLSPEC__ extern int32_t yices_get_values(model_t *mdl, uint32_t n, const term_t a[], yval_t val[]);
+
+
 /*
  * Queries on the value of a rational node:
  * - if v->node_tag is YVAL_RATIONAL, the functions below check whether v's value
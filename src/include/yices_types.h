@@ -190,6 +190,82 @@ typedef enum term_constructor {
 } term_constructor_t;
 
 
+
+/*****************************
+ *  BATCH TERM CONSTRUCTION  *
+ ****************************/
+
+/*
+ * Opcodes for yices_build_terms.
+ *
+ * A batch is an array of 32bit integers that encodes a sequence of
+ * instructions. Each instruction is of the form [op, n, a_1, ..., a_n]
+ * and builds one node. Nodes are numbered 0, 1, 2, ... in the order
+ * of the instructions. Unless specified otherwise, the operands a_1 ... a_n
+ * are indices of nodes built by earlier instructions.
+ *
+ * The comments give the arity and the equivalent API function.
+ */
+typedef enum term_batch_op {
+  // leaves: the operands are not node indices
+  YICES_BATCH_TERM,          // [op, 1, t]: existing term t
+  YICES_BATCH_INT32,         // [op, 1, v]: integer constant v (yices_int32)
+  YICES_BATCH_BVCONST32,     // [op, 2, n, v]: n-bit constant (yices_bvconst_uint32)
+
+  // boolean and generic terms
+  YICES_BATCH_NOT,           // 1: yices_not
+  YICES_BATCH_AND,           // n: yices_and
+  YICES_BATCH_OR,            // n: yices_or
+  YICES_BATCH_XOR,           // n: yices_xor
+  YICES_BATCH_IFF,           // 2: yices_iff
+  YICES_BATCH_IMPLIES,       // 2: yices_implies
+  YICES_BATCH_ITE,           // 3: yices_ite
+  YICES_BATCH_EQ,            // 2: yices_eq
+  YICES_BATCH_NEQ,           // 2: yices_neq
+  YICES_BATCH_DISTINCT,      // n: yices_distinct
+  YICES_BATCH_APP,           // n: yices_application (a_1 is the function)
+
+  // arithmetic
+  YICES_BATCH_ADD,           // n: yices_sum
+  YICES_BATCH_SUB,           // 2: yices_sub
+  YICES_BATCH_NEG,           // 1: yices_neg
+  YICES_BATCH_MUL,           // n: yices_product
+  YICES_BATCH_ARITH_EQ,      // 2: yices_arith_eq_atom
+  YICES_BATCH_ARITH_NEQ,     // 2: yices_arith_neq_atom
+  YICES_BATCH_ARITH_GEQ,     // 2: yices_arith_geq_atom
+  YICES_BATCH_ARITH_GT,      // 2: yices_arith_gt_atom
+  YICES_BATCH_ARITH_LEQ,     // 2: yices_arith_leq_atom
+  YICES_BATCH_ARITH_LT,      // 2: yices_arith_lt_atom
+
+  // bitvectors
+  YICES_BATCH_BVADD,         // n: yices_bvsum
+  YICES_BATCH_BVSUB,         // 2: yices_bvsub
+  YICES_BATCH_BVNEG,         // 1: yices_bvneg
+  YICES_BATCH_BVMUL,         // n: yices_bvproduct
+  YICES_BATCH_BVDIV,         // 2: yices_bvdiv
+  YICES_BATCH_BVREM,         // 2: yices_bvrem
+  YICES_BATCH_BVNOT,         // 1: yices_bvnot
+  YICES_BATCH_BVAND,         // n: yices_bvand
+  YICES_BATCH_BVOR,          // n: yices_bvor
+  YICES_BATCH_BVXOR,         // n: yices_bvxor
+  YICES_BATCH_BVSHL,         // 2: yices_bvshl
+  YICES_BATCH_BVLSHR,        // 2: yices_bvlshr
+  YICES_BATCH_BVASHR,        // 2: yices_bvashr
+  YICES_BATCH_BVCONCAT,      // n: yices_bvconcat
+  YICES_BATCH_BVEXTRACT,     // [op, 3, a, i, j]: yices_bvextract (i and j are integers)
+  YICES_BATCH_BVEQ,          // 2: yices_bveq_atom
+  YICES_BATCH_BVNEQ,         // 2: yices_bvneq_atom
+  YICES_BATCH_BVGE,          // 2: yices_bvge_atom
+  YICES_BATCH_BVGT,          // 2: yices_bvgt_atom
+  YICES_BATCH_BVLE,          // 2: yices_bvle_atom
+  YICES_BATCH_BVLT,          // 2: yices_bvlt_atom
+  YICES_BATCH_BVSGE,         // 2: yices_bvsge_atom
+  YICES_BATCH_BVSGT,         // 2: yices_bvsgt_atom
+  YICES_BATCH_BVSLE,         // 2: yices_bvsle_atom
+  YICES_BATCH_BVSLT,         // 2: yices_bvslt_atom
+} term_batch_op_t;
+
+
 /**********************
  *  VALUES IN MODELS  *
  *********************/
@@ -344,6 +420,7 @@ typedef enum error_code {
   BAD_TYPE_DECREF,         // added 2013/10/03
   INVALID_TYPE_OP,         // added 2014/12/03
   INVALID_TERM_OP,         // added 2014/12/04
+  INVALID_BATCH_CODE,
 
   /*
    * Parser errors
@@ -465,6 +542,9 @@ typedef enum error_code {
    * Input/output and system errors
    */
   OUTPUT_ERROR = 9000,
+  INPUT_ERROR = 9001,
+  ARCHIVE_FORMAT_ERROR = 9002,
+  ARCHIVE_UNSUPPORTED_TERM = 9003,
 
   /*
    * Catch-all code for anything else.
@@ -602,10 +682,16 @@ typedef enum error_code {
  *  EVAL_NO_IMPLICANT
  *
  *
+ * Errors for term archives
+ *  ARCHIVE_UNSUPPORTED_TERM   term1
+ *
+ *
  * Other error codes. No field is meaningful in the error_report,
  * except the error code:
  *
  *  OUTPUT_ERROR
+ *  INPUT_ERROR
+ *  ARCHIVE_FORMAT_ERROR
  *  INTERNAL_EXCEPTION
  */
 typedef struct error_report_s {
@@ -619,6 +705,22 @@ typedef struct error_report_s {
   int64_t badval;
 } error_report_t;
 
+/*
+ * Garbage-collection statistics (cumulative since yices_init or yices_reset)
+ * - full_collections = number of calls to yices_garbage_collect
+ * - young_collections = number of calls to yices_garbage_collect_young
+ * - terms_reclaimed = number of terms deleted
+ * - types_reclaimed = number of types deleted
+ * - bytes_reclaimed = estimate of the memory freed by deleting terms
+ */
+typedef struct yices_gc_stats_s {
+  uint32_t full_collections;
+  uint32_t young_collections;
+  uint64_t terms_reclaimed;
+  uint64_t types_reclaimed;
+  uint64_t bytes_reclaimed;
+} yices_gc_stats_t;
+
 /*
  * A context for interpolation. It consists of two regular context objects
  * ctx_A and ctx_B.
@@ -29,6 +29,19 @@
 #include <stdbool.h>
 #include <assert.h>
 
+#if !defined(MINGW)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+#include <errno.h>
+#include <pthread.h>
+#include "utils/memalloc.h"
+#endif
+
 #include "io/reader.h"
 
 
@@ -45,7 +58,7 @@ extern int getc_unlocked(FILE *);
 
 /*
  * Read and return the next char from a stream reader
- * - update pos, line, column
+ * - update pos, line, line_start
  */
 static int file_reader_next_char(reader_t *reader) {
   assert(reader->is_stream);
@@ -56,7 +69,7 @@ static int file_reader_next_char(reader_t *reader) {
 
   if (reader->current == '\n') {
     reader->line ++;
-    reader->column = 0;
+    reader->line_start = reader->pos;
   }
 
   // getc_unlocked is unsafe in multithreading applications
@@ -67,7 +80,6 @@ static int file_reader_next_char(reader_t *reader) {
   reader->current = getc_unlocked(reader->input.stream);
 #endif
   reader->pos ++;
-  reader->column ++;
 
   return reader->current;
 }
@@ -76,7 +88,7 @@ static int file_reader_next_char(reader_t *reader) {
 
 /*
  * Read and return the next char from a string reader
- * - update pos, line, column
+ * - update pos, line, line_start
  */
 static int string_reader_next_char(reader_t *reader) {
   char c;
@@ -89,7 +101,7 @@ static int string_reader_next_char(reader_t *reader) {
 
   if (reader->current == '\n') {
     reader->line ++;
-    reader->column = 0;
+    reader->line_start = reader->pos;
   }
 
   c = reader->input.data[reader->pos];
@@ -98,7 +110,6 @@ static int string_reader_next_char(reader_t *reader) {
     reader->current = EOF;
   }
   reader->pos ++;
-  reader->column ++;
 
   return reader->current;
 }
@@ -107,6 +118,79 @@ static int string_reader_next_char(reader_t *reader) {
 
 
 
+/*
+ * Read and return the next char from a memory-mapped file
+ * - update pos, line, line_start
+ * - this is called by reader_next_char when the fast path
+ *   can't be used (after '\n' or at the end of the block).
+ */
+static int block_reader_next_char(reader_t *reader) {
+  assert(reader->is_stream && reader->block != NULL);
+
+  if (reader->current == EOF) {
+    return EOF;
+  }
+
+  if (reader->current == '\n') {
+    reader->line ++;
+    reader->line_start = reader->pos;
+  }
+
+  if (reader->pos < reader->block_end) {
+    reader->current = reader->block[reader->pos];
+  } else {
+    reader->current = EOF;
+  }
+  reader->pos ++;
+
+  return reader->current;
+}
+
+
+#if !defined(MINGW)
+
+/*
+ * Attempt to memory-map a file
+ * - return true if that works and initialize block and block_size
+ * - return false if the file can't be opened, is not a regular file
+ *   (e.g., a pipe), is empty, or mmap fails. The caller falls back
+ *   to stdio in all these cases.
+ */
+static bool map_file(reader_t *reader, const char *filename) {
+  struct stat sb;
+  void *addr;
+  int fd;
+
+  fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  addr = MAP_FAILED;
+  if (fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_size > 0 &&
+      (uint64_t) sb.st_size <= (uint64_t) SIZE_MAX) {
+    addr = mmap(NULL, (size_t) sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+
+  if (addr == MAP_FAILED) {
+    return false;
+  }
+
+#if defined(POSIX_MADV_SEQUENTIAL)
+  (void) posix_madvise(addr, (size_t) sb.st_size, POSIX_MADV_SEQUENTIAL);
+#endif
+
+  reader->block = (const unsigned char *) addr;
+  reader->block_end = (uint64_t) sb.st_size;
+
+  return true;
+}
+
+#endif
+
+
+
 /*
  * Initialize reader for file of the given name
  * - return -1 if the file could not be open
@@ -118,14 +202,28 @@ static int string_reader_next_char(reader_t *reader) {
 int32_t init_file_reader(reader_t *reader, const char *filename) {
   FILE *f;
 
-  f = fopen(filename, "r");
-  reader->input.stream = f; // keep it NULL if there's an error
   reader->pos = 0;
   reader->line = 0;
-  reader->column = 1;
+  reader->line_start = -1;
   reader->is_stream = true;
-  reader->read = file_reader_next_char;
   reader->name = filename;
+  reader->block = NULL;
+  reader->block_base = 0;
+  reader->block_end = 0;
+  reader->ahead = NULL;
+
+#if !defined(MINGW)
+  if (map_file(reader, filename)) {
+    reader->input.stream = NULL;
+    reader->read = block_reader_next_char;
+    reader->current = '\n';
+    return 0;
+  }
+#endif
+
+  f = fopen(filename, "r");
+  reader->input.stream = f; // keep it NULL if there's an error
+  reader->read = file_reader_next_char;
 
   if (f == NULL) {
     reader->current = EOF;
@@ -145,12 +243,241 @@ void init_stream_reader(reader_t *reader, FILE *f, const char *name) {
   reader->input.stream = f;
   reader->pos = 0;
   reader->line = 0;
-  reader->column = 1;
+  reader->line_start = -1;
   reader->is_stream = true;
   reader->read = file_reader_next_char;
   reader->name = name;
+  reader->block = NULL;
+  reader->block_base = 0;
+  reader->block_end = 0;
+  reader->ahead = NULL;
+}
+
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+/*
+ * READ-AHEAD READER
+ */
+
+/*
+ * The input is read by a separate thread in chunks of READ_AHEAD_CHUNK_SIZE
+ * bytes (or less) and stored in a circular queue of READ_AHEAD_NCHUNKS chunks.
+ * - chunks head, head+1, ..., head+count-1 (modulo READ_AHEAD_NCHUNKS)
+ *   contain data. The reader uses chunk head while the producer fills
+ *   chunk head+count.
+ * - size[i] = number of bytes in chunk i
+ * - done is set by the producer on end-of-file or read error
+ * - stop is set by the reader to terminate the producer
+ */
+#define READ_AHEAD_CHUNK_SIZE 65536
+#define READ_AHEAD_NCHUNKS 8
+
+struct read_ahead_s {
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  int fd;
+  uint32_t head;
+  uint32_t count;
+  bool done;
+  bool stop;
+  bool holding;  // true if the reader uses chunk head
+  uint32_t size[READ_AHEAD_NCHUNKS];
+  unsigned char *data[READ_AHEAD_NCHUNKS];
+};
+
+
+/*
+ * Producer: fill chunks until end-of-file, error, or stop
+ * - the thread can be canceled only while it's waiting in read
+ */
+static void *read_ahead_main(void *arg) {
+  read_ahead_t *ahead;
+  uint32_t i;
+  ssize_t n;
+  int old;
+
+  ahead = arg;
+  pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old);
+
+  for (;;) {
+    pthread_mutex_lock(&ahead->lock);
+    while (ahead->count == READ_AHEAD_NCHUNKS && !ahead->stop) {
+      pthread_cond_wait(&ahead->cond, &ahead->lock);
+    }
+    if (ahead->stop) {
+      pthread_mutex_unlock(&ahead->lock);
+      break;
+    }
+    i = (ahead->head + ahead->count) % READ_AHEAD_NCHUNKS;
+    pthread_mutex_unlock(&ahead->lock);
+
+    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, &old);
+    do {
+      n = read(ahead->fd, ahead->data[i], READ_AHEAD_CHUNK_SIZE);
+    } while (n < 0 && errno == EINTR);
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old);
+
+    pthread_mutex_lock(&ahead->lock);
+    if (n <= 0) {
+      ahead->done = true;
+    } else {
+      ahead->size[i] = (uint32_t) n;
+      ahead->count ++;
+    }
+    pthread_cond_broadcast(&ahead->cond);
+    pthread_mutex_unlock(&ahead->lock);
+
+    if (n <= 0) break;
+  }
+
+  return NULL;
+}
+
+
+/*
+ * Get the next chunk from the queue
+ * - release the current chunk then wait for the next one
+ * - return false on end-of-file
+ */
+static bool read_ahead_next_chunk(reader_t *reader) {
+  read_ahead_t *ahead;
+  bool ok;
+
+  ahead = reader->ahead;
+
+  pthread_mutex_lock(&ahead->lock);
+  if (ahead->holding) {
+    ahead->head = (ahead->head + 1) % READ_AHEAD_NCHUNKS;
+    ahead->count --;
+    ahead->holding = false;
+    pthread_cond_broadcast(&ahead->cond);
+  }
+  while (ahead->count == 0 && !ahead->done) {
+    pthread_cond_wait(&ahead->cond, &ahead->lock);
+  }
+  ok = ahead->count > 0;
+  if (ok) {
+    ahead->holding = true;
+    reader->block = ahead->data[ahead->head];
+    reader->block_base = reader->block_end;
+    reader->block_end += ahead->size[ahead->head];
+  }
+  pthread_mutex_unlock(&ahead->lock);
+
+  return ok;
+}
+
+
+/*
+ * Read and return the next char from a read-ahead reader
+ * - update pos, line, line_start
+ * - this is called by reader_next_char after '\n' or at the
+ *   end of the current chunk.
+ */
+static int read_ahead_reader_next_char(reader_t *reader) {
+  assert(reader->is_stream && reader->ahead != NULL);
+
+  if (reader->current == EOF) {
+    return EOF;
+  }
+
+  if (reader->current == '\n') {
+    reader->line ++;
+    reader->line_start = reader->pos;
+  }
+
+  if (reader->pos < reader->block_end || read_ahead_next_chunk(reader)) {
+    reader->current = reader->block[reader->pos - reader->block_base];
+  } else {
+    reader->current = EOF;
+  }
+  reader->pos ++;
+
+  return reader->current;
+}
+
+
+/*
+ * Stop the producer and free the queue
+ */
+static void delete_read_ahead(reader_t *reader) {
+  read_ahead_t *ahead;
+  uint32_t i;
+
+  ahead = reader->ahead;
+
+  pthread_mutex_lock(&ahead->lock);
+  ahead->stop = true;
+  pthread_cond_broadcast(&ahead->cond);
+  pthread_mutex_unlock(&ahead->lock);
+
+  // the producer may be blocked in read
+  pthread_cancel(ahead->thread);
+  pthread_join(ahead->thread, NULL);
+
+  pthread_cond_destroy(&ahead->cond);
+  pthread_mutex_destroy(&ahead->lock);
+  for (i=0; i<READ_AHEAD_NCHUNKS; i++) {
+    safe_free(ahead->data[i]);
+  }
+  safe_free(ahead);
+
+  reader->ahead = NULL;
+  reader->block = NULL;
+}
+
+
+/*
+ * Initialize reader for stream f with read ahead
+ * - if the thread can't be created, this is a regular stream reader
+ */
+void init_read_ahead_reader(reader_t *reader, FILE *f, const char *name) {
+  read_ahead_t *ahead;
+  uint32_t i;
+
+  init_stream_reader(reader, f, name);
+
+  ahead = (read_ahead_t *) safe_malloc(sizeof(read_ahead_t));
+  pthread_mutex_init(&ahead->lock, NULL);
+  pthread_cond_init(&ahead->cond, NULL);
+  ahead->fd = fileno(f);
+  ahead->head = 0;
+  ahead->count = 0;
+  ahead->done = false;
+  ahead->stop = false;
+  ahead->holding = false;
+  for (i=0; i<READ_AHEAD_NCHUNKS; i++) {
+    ahead->size[i] = 0;
+    ahead->data[i] = (unsigned char *) safe_malloc(READ_AHEAD_CHUNK_SIZE);
+  }
+
+  if (pthread_create(&ahead->thread, NULL, read_ahead_main, ahead) != 0) {
+    pthread_cond_destroy(&ahead->cond);
+    pthread_mutex_destroy(&ahead->lock);
+    for (i=0; i<READ_AHEAD_NCHUNKS; i++) {
+      safe_free(ahead->data[i]);
+    }
+    safe_free(ahead);
+    return;
+  }
+
+  reader->ahead = ahead;
+  reader->read = read_ahead_reader_next_char;
 }
 
+#else
+
+/*
+ * No threads: regular stream reader
+ */
+void init_read_ahead_reader(reader_t *reader, FILE *f, const char *name) {
+  init_stream_reader(reader, f, name);
+}
+
+#endif
+
 
 /*
  * Initialize reader for string data
@@ -160,10 +487,14 @@ void init_string_reader(reader_t *reader, const char *data, const char *name) {
   reader->input.data = data;
   reader->pos = 0;
   reader->line = 0;
-  reader->column = 1;
+  reader->line_start = -1;
   reader->is_stream = false;
   reader->read = string_reader_next_char;
   reader->name = name;
+  reader->block = NULL;
+  reader->block_base = 0;
+  reader->block_end = 0;
+  reader->ahead = NULL;
 }
 
 
@@ -178,7 +509,7 @@ void reset_string_reader(reader_t *reader, const char *data) {
   reader->input.data = data;
   reader->pos = 0;
   reader->line = 0;
-  reader->column = 1;
+  reader->line_start = -1;
 }
 
 
@@ -187,6 +518,19 @@ void reset_string_reader(reader_t *reader, const char *data) {
  * Close reader: return EOF on error, 0 otherwise
  */
 int close_reader(reader_t *reader) {
+#if defined(THREAD_SAFE) && !defined(MINGW)
+  if (reader->ahead != NULL) {
+    delete_read_ahead(reader);
+  }
+#endif
+
+#if !defined(MINGW)
+  if (reader->block != NULL) {
+    assert(reader->is_stream && reader->input.stream == NULL);
+    return munmap((void *) reader->block, (size_t) reader->block_end) == 0 ? 0 : EOF;
+  }
+#endif
+
   if (reader->is_stream) {
     return fclose(reader->input.stream);
   } else {
@@ -195,6 +539,25 @@ int close_reader(reader_t *reader) {
 }
 
 
+/*
+ * Variant: don't close the stream
+ */
+void close_reader_only(reader_t *reader) {
+#if defined(THREAD_SAFE) && !defined(MINGW)
+  if (reader->ahead != NULL) {
+    delete_read_ahead(reader);
+  }
+#endif
+
+#if !defined(MINGW)
+  if (reader->block != NULL) {
+    munmap((void *) reader->block, (size_t) reader->block_end);
+    reader->block = NULL;
+  }
+#endif
+}
+
+
 #if 0
 /*
  * Experimental variant: use wide characters
@@ -214,7 +577,7 @@ static int file_reader_next_wchar(reader_t *reader) {
 
   if (reader->current == '\n') { // this should works in UTF-8?
     reader->line ++;
-    reader->column ++;
+    reader->line_start = reader->pos;
   }
 
 #if defined(LINUX)
@@ -228,7 +591,6 @@ static int file_reader_next_wchar(reader_t *reader) {
   } else {
     reader->current = c;
     reader->pos ++;
-    reader->column += wcwidth(c);
   }
 
   return c;
@@ -245,7 +607,7 @@ int32_t init_wide_file_reader(reader_t *reader, const char *filename) {
   reader->input.stream = f; // keep it NULL if there's an error
   reader->pos = 0;
   reader->line = 0;
-  reader->column = 1;
+  reader->line_start = -1;
   reader->is_stream = true;
   reader->read = file_reader_next_wchar;
   reader->name = filename;
@@ -264,7 +626,7 @@ void init_wide_stream_reader(reader_t *reader, FILE *f, const char *name) {
   reader->input.stream = f;
   reader->pos = 0;
   reader->line = 0;
-  reader->column = 1;
+  reader->line_start = -1;
   reader->is_stream = true;
   reader->read = file_reader_next_wchar;
   reader->name = name;
@@ -24,28 +24,40 @@
 #ifndef __READER_H
 #define __READER_H
 
+#include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
 
 
 /*
  * - current = current character
- * - pos, line, column = position in input stream
+ * - pos, line = position in input stream
+ * - line_start = position of the last '\n' (the column is computed
+ *   from pos and line_start when needed)
  * - for file reader, stream = input
  *   for string reader, data = null terminated string.
  * - name = filename or whatever else is given at initialization.
  * - read = read function: get next character
  *   return EOF on last character
+ * - block = part of the input that's available in memory: either
+ *   the whole file if it's memory-mapped or the current chunk of a
+ *   read-ahead reader. block[0] is the character at position
+ *   block_base + 1 and block[block_end - block_base - 1] is the one
+ *   at position block_end. For other readers, block is NULL and
+ *   block_base = block_end = 0.
+ * - ahead = state of the read-ahead thread (NULL if not used)
  */
 typedef struct reader_s reader_t;
 
+typedef struct read_ahead_s read_ahead_t;
+
 typedef int (*read_fun_t)(reader_t *reader);
 
 struct reader_s {
   int current;
   uint64_t pos;
   uint32_t line;
-  uint32_t column;
+  int64_t line_start;
   read_fun_t read;
   int32_t is_stream; // true for stream, false for string readers
   union {
@@ -53,6 +65,10 @@ struct reader_s {
     const char *data;
   } input;
   const char *name;
+  const unsigned char *block;
+  uint64_t block_base;
+  uint64_t block_end;
+  read_ahead_t *ahead;
 };
 
 
@@ -79,6 +95,8 @@ struct reader_s {
  *   or 0 otherwise
  * - if the file was not open, any subsequent attempt
  *   to read will return EOF
+ * - if the file is a regular file, it is memory-mapped when
+ *   possible (and read with stdio otherwise)
  */
 extern int32_t init_file_reader(reader_t *reader, const char *filename);
 
@@ -95,6 +113,18 @@ static inline void init_stdin_reader(reader_t *reader) {
   init_stream_reader(reader, stdin, "stdin");
 }
 
+/*
+ * Initialize reader for an already opened stream, with read ahead:
+ * - a separate thread reads the input in chunks and stores them in
+ *   a bounded queue while the caller processes the previous chunks.
+ * - the thread reads whatever is available (it does not wait for a
+ *   full chunk) so this can be used with pipes.
+ * - this requires a thread-safe build: otherwise, this is the same
+ *   as init_stream_reader.
+ * - f must not have been read from before.
+ */
+extern void init_read_ahead_reader(reader_t *reader, FILE *f, const char *name);
+
 /*
  * Initialize reader for string data
  */
@@ -131,6 +161,12 @@ extern void reset_string_reader(reader_t *reader, const char *data);
  */
 extern int close_reader(reader_t *reader);
 
+/*
+ * Variant: release the memory-mapped file or the read-ahead thread
+ * but don't close the stream.
+ */
+extern void close_reader_only(reader_t *reader);
+
 
 /*
  * Get current character, position, line or column numbers
@@ -144,7 +180,7 @@ static inline uint32_t reader_line(reader_t *reader) {
 }
 
 static inline uint32_t reader_column(reader_t *reader) {
-  return reader->column;
+  return (uint32_t) ((int64_t) reader->pos - reader->line_start);
 }
 
 static inline uint64_t reader_position(reader_t *reader) {
@@ -155,10 +191,65 @@ static inline uint64_t reader_position(reader_t *reader) {
 /*
  * Read one character, update position data and return the new
  * character.
+ * - if the next character is in the block, it's read directly
+ *   (except after '\n' so that the read function can update line
+ *   and line_start)
  */
 static inline int reader_next_char(reader_t *reader) {
+  uint64_t i;
+
+  i = reader->pos;
+  if (i < reader->block_end && reader->current != '\n') {
+    reader->current = reader->block[i - reader->block_base];
+    reader->pos = i + 1;
+    return reader->current;
+  }
   return reader->read(reader);
 }
 
 
+/*
+ * Direct access to the block, for lexers that scan a token at once:
+ * - reader_block_avail(reader) = number of characters available in
+ *   the block, starting from the current character (0 if there's no
+ *   block or the current character is EOF)
+ * - reader_block_current(reader) = pointer to the current character
+ *   in the block (valid if reader_block_avail(reader) > 0)
+ */
+static inline uint64_t reader_block_avail(reader_t *reader) {
+  uint64_t i;
+
+  i = reader->pos;
+  return (i > reader->block_base && i <= reader->block_end) ? reader->block_end - i + 1 : 0;
+}
+
+static inline const unsigned char *reader_block_current(reader_t *reader) {
+  assert(reader_block_avail(reader) > 0);
+  return reader->block + (reader->pos - reader->block_base - 1);
+}
+
+
+/*
+ * Skip n characters in the block and return the new current character
+ * - n must be at most reader_block_avail(reader)
+ * - the current character and the next n-1 must not be '\n'
+ *   (so the line does not change)
+ * - if n = reader_block_avail(reader), the new current character is
+ *   the first one after the block (i.e., the start of the next chunk
+ *   or EOF)
+ */
+static inline int reader_block_skip(reader_t *reader, uint64_t n) {
+  assert(n <= reader_block_avail(reader));
+
+  if (n == 0) {
+    return reader->current;
+  }
+  reader->pos += n - 1;
+  reader->current = reader->block[reader->pos - reader->block_base - 1];
+  assert(reader->current != '\n');
+
+  return reader_next_char(reader);
+}
+
+
 #endif /* __READER_H */
@@ -0,0 +1,1741 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TERM ARCHIVES: SAVE AND LOAD
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <gmp.h>
+
+#if !defined(MINGW)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "io/term_archive.h"
+#include "terms/bvarith64_buffer_terms.h"
+#include "terms/bvarith_buffer_terms.h"
+#include "terms/rba_buffer_terms.h"
+#include "utils/int_array_sort.h"
+#include "utils/int_hash_map.h"
+#include "utils/memalloc.h"
+#include "utils/refcount_strings.h"
+#include "utils/string_buffers.h"
+
+#include "yices_limits.h"
+
+
+/*
+ * Size of the header: magic + five 32bit integers
+ */
+#define ARCHIVE_HEADER_SIZE 24
+
+/*
+ * In an archive, types and terms are identified by an index.
+ * - indices 0 to NUM_PREDEFINED-1 are the predefined types (bool, int, real)
+ *   and the predefined terms (const_idx, bool_const, zero_const).
+ * - the k-th type or term record of the archive has index k + NUM_PREDEFINED.
+ * A reference to a term is (index << 1) | polarity.
+ */
+#define NUM_PREDEFINED 3
+
+
+/*
+ * Checksum of the archive body (32bit FNV-1a)
+ */
+static uint32_t archive_checksum(const uint8_t *data, size_t n) {
+  uint32_t h;
+  size_t i;
+
+  h = 2166136261u;
+  for (i=0; i<n; i++) {
+    h ^= data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+
+
+/*************
+ *  WRITER   *
+ ************/
+
+typedef struct archive_writer_s {
+  term_table_t *terms;
+  type_table_t *types;
+  int_hmap_t term_id;     // term index --> archive index
+  int_hmap_t type_id;     // type --> archive index
+  ivector_t term_order;   // term indices in dependency order
+  ivector_t type_order;   // types in dependency order
+  ivector_t stack;
+  ivector_t aux;
+  term_t bad;             // term with an unsupported type
+  uint8_t *data;          // body of the archive
+  size_t size;
+  size_t capacity;
+} archive_writer_t;
+
+
+static void init_archive_writer(archive_writer_t *w, term_manager_t *mngr) {
+  w->terms = term_manager_get_terms(mngr);
+  w->types = term_manager_get_types(mngr);
+  init_int_hmap(&w->term_id, 0);
+  init_int_hmap(&w->type_id, 0);
+  init_ivector(&w->term_order, 64);
+  init_ivector(&w->type_order, 16);
+  init_ivector(&w->stack, 64);
+  init_ivector(&w->aux, 16);
+  w->bad = NULL_TERM;
+  w->data = NULL;
+  w->size = 0;
+  w->capacity = 0;
+}
+
+static void delete_archive_writer(archive_writer_t *w) {
+  delete_int_hmap(&w->term_id);
+  delete_int_hmap(&w->type_id);
+  delete_ivector(&w->term_order);
+  delete_ivector(&w->type_order);
+  delete_ivector(&w->stack);
+  delete_ivector(&w->aux);
+  safe_free(w->data);
+  w->data = NULL;
+}
+
+
+/*
+ * Make room for n more bytes
+ */
+static void archive_extend(archive_writer_t *w, size_t n) {
+  size_t cap;
+
+  cap = w->capacity;
+  if (w->size + n > cap) {
+    if (cap == 0) cap = 4096;
+    while (w->size + n > cap) {
+      cap += cap >> 1;
+      if (cap > SIZE_MAX/2) {
+        out_of_memory();
+      }
+    }
+    w->data = (uint8_t *) safe_realloc(w->data, cap);
+    w->capacity = cap;
+  }
+}
+
+static void put_u8(archive_writer_t *w, uint8_t x) {
+  archive_extend(w, 1);
+  w->data[w->size] = x;
+  w->size ++;
+}
+
+static void put_u32(archive_writer_t *w, uint32_t x) {
+  uint8_t *p;
+
+  archive_extend(w, 4);
+  p = w->data + w->size;
+  p[0] = (uint8_t) x;
+  p[1] = (uint8_t) (x >> 8);
+  p[2] = (uint8_t) (x >> 16);
+  p[3] = (uint8_t) (x >> 24);
+  w->size += 4;
+}
+
+static void put_u64(archive_writer_t *w, uint64_t x) {
+  put_u32(w, (uint32_t) x);
+  put_u32(w, (uint32_t) (x >> 32));
+}
+
+static void put_bytes(archive_writer_t *w, const char *s, uint32_t n) {
+  archive_extend(w, n);
+  memcpy(w->data + w->size, s, n);
+  w->size += n;
+}
+
+/*
+ * Name: 0 for no name, or (length + 1) followed by the characters
+ */
+static void put_name(archive_writer_t *w, const char *name) {
+  uint32_t n;
+
+  if (name == NULL) {
+    put_u32(w, 0);
+  } else {
+    n = strlen(name);
+    put_u32(w, n + 1);
+    put_bytes(w, name, n);
+  }
+}
+
+/*
+ * Rational: either tag 0 + 64bit numerator and denominator
+ * or tag 1 + string in base 16
+ */
+static void put_rational(archive_writer_t *w, rational_t *q) {
+  int64_t num;
+  uint64_t den;
+  mpq_t aux;
+  char *s;
+  size_t n;
+
+  if (q_get_int64(q, &num, &den)) {
+    put_u8(w, 0);
+    put_u64(w, (uint64_t) num);
+    put_u64(w, den);
+  } else {
+    mpq_init(aux);
+    q_get_mpq(q, aux);
+    n = mpz_sizeinbase(mpq_numref(aux), 16) + mpz_sizeinbase(mpq_denref(aux), 16) + 3;
+    s = (char *) safe_malloc(n);
+    mpq_get_str(s, 16, aux);
+    put_u8(w, 1);
+    put_name(w, s);
+    safe_free(s);
+    mpq_clear(aux);
+  }
+}
+
+static void put_bvconst(archive_writer_t *w, const uint32_t *c, uint32_t nbits) {
+  uint32_t i, k;
+
+  k = (nbits + 31) >> 5;
+  for (i=0; i<k; i++) {
+    put_u32(w, c[i]);
+  }
+}
+
+static void put_type_ref(archive_writer_t *w, type_t tau) {
+  int_hmap_pair_t *r;
+
+  if (tau < NUM_PREDEFINED) {
+    put_u32(w, tau);
+  } else {
+    r = int_hmap_find(&w->type_id, tau);
+    assert(r != NULL && r->val >= NUM_PREDEFINED);
+    put_u32(w, r->val);
+  }
+}
+
+static void put_term_ref(archive_writer_t *w, term_t t) {
+  int_hmap_pair_t *r;
+  int32_t i;
+
+  i = index_of(t);
+  if (i < NUM_PREDEFINED) {
+    put_u32(w, t);
+  } else {
+    r = int_hmap_find(&w->term_id, i);
+    assert(r != NULL && r->val >= NUM_PREDEFINED);
+    put_u32(w, ((uint32_t) r->val << 1) | polarity_of(t));
+  }
+}
+
+
+/*
+ * Collect the types that tau depends on
+ * - return false if tau contains a type variable or instance
+ */
+static bool archive_collect_type(archive_writer_t *w, type_t tau) {
+  type_table_t *types;
+  int_hmap_pair_t *r;
+  tuple_type_t *tup;
+  function_type_t *fun;
+  ivector_t *stack;
+  bool done;
+  uint32_t i, k;
+
+  types = w->types;
+  stack = &w->stack;
+  k = stack->size;
+  ivector_push(stack, tau);
+
+  while (stack->size > k) {
+    tau = ivector_last(stack);
+    if (tau < NUM_PREDEFINED || int_hmap_find(&w->type_id, tau) != NULL) {
+      ivector_pop(stack);
+      continue;
+    }
+
+    done = true;
+    switch (type_kind(types, tau)) {
+    case BITVECTOR_TYPE:
+    case SCALAR_TYPE:
+    case UNINTERPRETED_TYPE:
+      break;
+
+    case TUPLE_TYPE:
+      tup = tuple_type_desc(types, tau);
+      for (i=0; i<tup->nelem; i++) {
+        if (tup->elem[i] >= NUM_PREDEFINED && int_hmap_find(&w->type_id, tup->elem[i]) == NULL) {
+          ivector_push(stack, tup->elem[i]);
+          done = false;
+        }
+      }
+      break;
+
+    case FUNCTION_TYPE:
+      fun = function_type_desc(types, tau);
+      if (fun->range >= NUM_PREDEFINED && int_hmap_find(&w->type_id, fun->range) == NULL) {
+        ivector_push(stack, fun->range);
+        done = false;
+      }
+      for (i=0; i<fun->ndom; i++) {
+        if (fun->domain[i] >= NUM_PREDEFINED && int_hmap_find(&w->type_id, fun->domain[i]) == NULL) {
+          ivector_push(stack, fun->domain[i]);
+          done = false;
+        }
+      }
+      break;
+
+    default:
+      // type variable or instance
+      stack->size = k;
+      return false;
+    }
+
+    if (done) {
+      r = int_hmap_get(&w->type_id, tau);
+      r->val = NUM_PREDEFINED + w->type_order.size;
+      ivector_push(&w->type_order, tau);
+      ivector_pop(stack);
+    }
+  }
+
+  return true;
+}
+
+
+/*
+ * Store the children of term index i in vector v
+ * - the constant index (const_idx) of polynomials is skipped
+ */
+static void archive_term_children(term_table_t *terms, int32_t i, ivector_t *v) {
+  composite_term_t *d;
+  pprod_t *pp;
+  polynomial_t *p;
+  bvpoly64_t *p64;
+  bvpoly_t *q;
+  root_atom_t *ra;
+  uint32_t k;
+
+  switch (kind_for_idx(terms, i)) {
+  case CONSTANT_TERM:
+  case ARITH_CONSTANT:
+  case BV64_CONSTANT:
+  case BV_CONSTANT:
+  case VARIABLE:
+  case UNINTERPRETED_TERM:
+    break;
+
+  case ARITH_EQ_ATOM:
+  case ARITH_GE_ATOM:
+  case ARITH_IS_INT_ATOM:
+  case ARITH_FLOOR:
+  case ARITH_CEIL:
+  case ARITH_ABS:
+    ivector_push(v, integer_value_for_idx(terms, i));
+    break;
+
+  case ARITH_ROOT_ATOM:
+    ra = root_atom_for_idx(terms, i);
+    ivector_push(v, ra->x);
+    ivector_push(v, ra->p);
+    break;
+
+  case SELECT_TERM:
+  case BIT_TERM:
+    ivector_push(v, select_for_idx(terms, i)->arg);
+    break;
+
+  case POWER_PRODUCT:
+    pp = pprod_for_idx(terms, i);
+    for (k=0; k<pp->len; k++) {
+      ivector_push(v, pp->prod[k].var);
+    }
+    break;
+
+  case ARITH_POLY:
+    p = polynomial_for_idx(terms, i);
+    for (k=0; k<p->nterms; k++) {
+      if (p->mono[k].var != const_idx) ivector_push(v, p->mono[k].var);
+    }
+    break;
+
+  case BV64_POLY:
+    p64 = bvpoly64_for_idx(terms, i);
+    for (k=0; k<p64->nterms; k++) {
+      if (p64->mono[k].var != const_idx) ivector_push(v, p64->mono[k].var);
+    }
+    break;
+
+  case BV_POLY:
+    q = bvpoly_for_idx(terms, i);
+    for (k=0; k<q->nterms; k++) {
+      if (q->mono[k].var != const_idx) ivector_push(v, q->mono[k].var);
+    }
+    break;
+
+  default:
+    // all other kinds are composite
+    d = composite_for_idx(terms, i);
+    for (k=0; k<d->arity; k++) {
+      ivector_push(v, d->arg[k]);
+    }
+    break;
+  }
+}
+
+
+/*
+ * Collect the terms t depends on (and their types)
+ * - return false if a type is not supported (and set w->bad)
+ */
+static bool archive_collect_term(archive_writer_t *w, term_t t) {
+  term_table_t *terms;
+  int_hmap_pair_t *r;
+  ivector_t *stack, *aux;
+  int32_t i, j;
+  uint32_t k;
+  bool done;
+
+  terms = w->terms;
+  stack = &w->stack;
+  aux = &w->aux;
+  assert(stack->size == 0);
+  ivector_push(stack, index_of(t));
+
+  while (stack->size > 0) {
+    i = ivector_last(stack);
+    if (i < NUM_PREDEFINED || int_hmap_find(&w->term_id, i) != NULL) {
+      ivector_pop(stack);
+      continue;
+    }
+
+    done = true;
+    ivector_reset(aux);
+    archive_term_children(terms, i, aux);
+    for (k=0; k<aux->size; k++) {
+      j = index_of(aux->data[k]);
+      if (j >= NUM_PREDEFINED && int_hmap_find(&w->term_id, j) == NULL) {
+        ivector_push(stack, j);
+        done = false;
+      }
+    }
+
+    if (done) {
+      if (! archive_collect_type(w, type_for_idx(terms, i))) {
+        w->bad = pos_term(i);
+        ivector_reset(stack);
+        return false;
+      }
+      r = int_hmap_get(&w->term_id, i);
+      r->val = NUM_PREDEFINED + w->term_order.size;
+      ivector_push(&w->term_order, i);
+      ivector_pop(stack);
+    }
+  }
+
+  return true;
+}
+
+
+/*
+ * Write the record for type tau
+ */
+static void archive_write_type(archive_writer_t *w, type_t tau) {
+  type_table_t *types;
+  tuple_type_t *tup;
+  function_type_t *fun;
+  uint32_t i;
+
+  types = w->types;
+  put_u8(w, type_kind(types, tau));
+  switch (type_kind(types, tau)) {
+  case BITVECTOR_TYPE:
+    put_u32(w, bv_type_size(types, tau));
+    break;
+
+  case SCALAR_TYPE:
+    put_u32(w, scalar_type_cardinal(types, tau));
+    break;
+
+  case UNINTERPRETED_TYPE:
+    break;
+
+  case TUPLE_TYPE:
+    tup = tuple_type_desc(types, tau);
+    put_u32(w, tup->nelem);
+    for (i=0; i<tup->nelem; i++) {
+      put_type_ref(w, tup->elem[i]);
+    }
+    break;
+
+  case FUNCTION_TYPE:
+    fun = function_type_desc(types, tau);
+    put_u32(w, fun->ndom);
+    put_type_ref(w, fun->range);
+    for (i=0; i<fun->ndom; i++) {
+      put_type_ref(w, fun->domain[i]);
+    }
+    break;
+
+  default:
+    assert(false);
+    break;
+  }
+  put_name(w, type_name(types, tau));
+}
+
+
+/*
+ * Write the record for term index i
+ */
+static void archive_write_term(archive_writer_t *w, int32_t i) {
+  term_table_t *terms;
+  composite_term_t *d;
+  select_term_t *s;
+  root_atom_t *ra;
+  pprod_t *pp;
+  polynomial_t *p;
+  bvpoly64_t *p64;
+  bvpoly_t *q;
+  bvconst64_term_t *c64;
+  bvconst_term_t *c;
+  uint32_t k;
+
+  terms = w->terms;
+  put_u8(w, kind_for_idx(terms, i));
+  put_type_ref(w, type_for_idx(terms, i));
+
+  switch (kind_for_idx(terms, i)) {
+  case CONSTANT_TERM:
+    put_u32(w, integer_value_for_idx(terms, i));
+    break;
+
+  case ARITH_CONSTANT:
+    put_rational(w, rational_for_idx(terms, i));
+    break;
+
+  case BV64_CONSTANT:
+    c64 = bvconst64_for_idx(terms, i);
+    put_u32(w, c64->bitsize);
+    put_u64(w, c64->value);
+    break;
+
+  case BV_CONSTANT:
+    c = bvconst_for_idx(terms, i);
+    put_u32(w, c->bitsize);
+    put_bvconst(w, c->data, c->bitsize);
+    break;
+
+  case VARIABLE:
+  case UNINTERPRETED_TERM:
+    break;
+
+  case ARITH_EQ_ATOM:
+  case ARITH_GE_ATOM:
+  case ARITH_IS_INT_ATOM:
+  case ARITH_FLOOR:
+  case ARITH_CEIL:
+  case ARITH_ABS:
+    put_term_ref(w, integer_value_for_idx(terms, i));
+    break;
+
+  case ARITH_ROOT_ATOM:
+    ra = root_atom_for_idx(terms, i);
+    put_u32(w, ra->k);
+    put_u32(w, ra->r);
+    put_term_ref(w, ra->x);
+    put_term_ref(w, ra->p);
+    break;
+
+  case SELECT_TERM:
+  case BIT_TERM:
+    s = select_for_idx(terms, i);
+    put_u32(w, s->idx);
+    put_term_ref(w, s->arg);
+    break;
+
+  case POWER_PRODUCT:
+    pp = pprod_for_idx(terms, i);
+    put_u32(w, pp->len);
+    for (k=0; k<pp->len; k++) {
+      put_term_ref(w, pp->prod[k].var);
+      put_u32(w, pp->prod[k].exp);
+    }
+    break;
+
+  case ARITH_POLY:
+    p = polynomial_for_idx(terms, i);
+    put_u32(w, p->nterms);
+    for (k=0; k<p->nterms; k++) {
+      put_term_ref(w, p->mono[k].var);
+      put_rational(w, &p->mono[k].coeff);
+    }
+    break;
+
+  case BV64_POLY:
+    p64 = bvpoly64_for_idx(terms, i);
+    put_u32(w, p64->bitsize);
+    put_u32(w, p64->nterms);
+    for (k=0; k<p64->nterms; k++) {
+      put_term_ref(w, p64->mono[k].var);
+      put_u64(w, p64->mono[k].coeff);
+    }
+    break;
+
+  case BV_POLY:
+    q = bvpoly_for_idx(terms, i);
+    put_u32(w, q->bitsize);
+    put_u32(w, q->nterms);
+    for (k=0; k<q->nterms; k++) {
+      put_term_ref(w, q->mono[k].var);
+      put_bvconst(w, q->mono[k].coeff, q->bitsize);
+    }
+    break;
+
+  default:
+    d = composite_for_idx(terms, i);
+    put_u32(w, d->arity);
+    for (k=0; k<d->arity; k++) {
+      put_term_ref(w, d->arg[k]);
+    }
+    break;
+  }
+
+  put_name(w, term_name(terms, pos_term(i)));
+}
+
+
+/*
+ * Store the header in buffer h
+ */
+static void archive_header(archive_writer_t *w, uint32_t nroots, uint8_t h[ARCHIVE_HEADER_SIZE]) {
+  uint32_t x[5];
+  uint32_t i;
+
+  x[0] = TERM_ARCHIVE_VERSION;
+  x[1] = w->type_order.size;
+  x[2] = w->term_order.size;
+  x[3] = nroots;
+  x[4] = archive_checksum(w->data, w->size);
+
+  memcpy(h, TERM_ARCHIVE_MAGIC, 4);
+  for (i=0; i<5; i++) {
+    h[4 + 4*i] = (uint8_t) x[i];
+    h[5 + 4*i] = (uint8_t) (x[i] >> 8);
+    h[6 + 4*i] = (uint8_t) (x[i] >> 16);
+    h[7 + 4*i] = (uint8_t) (x[i] >> 24);
+  }
+}
+
+
+int32_t save_term_archive(term_manager_t *mngr, const char *filename, uint32_t n, const term_t *a, term_t *bad) {
+  archive_writer_t writer;
+  uint8_t header[ARCHIVE_HEADER_SIZE];
+  FILE *f;
+  uint32_t i;
+  int32_t code;
+
+  init_archive_writer(&writer, mngr);
+
+  for (i=0; i<n; i++) {
+    if (! archive_collect_term(&writer, a[i])) {
+      *bad = writer.bad;
+      code = TERM_ARCHIVE_UNSUPPORTED;
+      goto done;
+    }
+  }
+
+  for (i=0; i<writer.type_order.size; i++) {
+    archive_write_type(&writer, writer.type_order.data[i]);
+  }
+  for (i=0; i<writer.term_order.size; i++) {
+    archive_write_term(&writer, writer.term_order.data[i]);
+  }
+  for (i=0; i<n; i++) {
+    put_term_ref(&writer, a[i]);
+  }
+  archive_header(&writer, n, header);
+
+  f = fopen(filename, "wb");
+  if (f == NULL) {
+    code = TERM_ARCHIVE_OPEN_ERROR;
+    goto done;
+  }
+
+  code = TERM_ARCHIVE_OK;
+  if (fwrite(header, 1, ARCHIVE_HEADER_SIZE, f) != ARCHIVE_HEADER_SIZE ||
+      fwrite(writer.data, 1, writer.size, f) != writer.size) {
+    code = TERM_ARCHIVE_IO_ERROR;
+  }
+  if (fclose(f) == EOF) {
+    code = TERM_ARCHIVE_IO_ERROR;
+  }
+
+ done:
+  delete_archive_writer(&writer);
+  return code;
+}
+
+
+
+/*************
+ *  LOADER   *
+ ************/
+
+/*
+ * The archive content is in data[0 ... size-1].
+ * - pos = read position
+ * - error is set if we read past the end or find a bad record
+ * - type_map[k] = type for archive index k + NUM_PREDEFINED
+ * - term_map[k] = term for archive index k + NUM_PREDEFINED
+ */
+typedef struct archive_loader_s {
+  const uint8_t *data;
+  size_t size;
+  size_t pos;
+  bool error;
+  term_manager_t *mngr;
+  term_table_t *terms;
+  type_table_t *types;
+  ivector_t type_map;
+  ivector_t term_map;
+  ivector_t args;
+  rational_t q;
+  bvconstant_t c;
+  string_buffer_t name;
+} archive_loader_t;
+
+
+static void init_archive_loader(archive_loader_t *ld, term_manager_t *mngr, const uint8_t *data, size_t size) {
+  ld->data = data;
+  ld->size = size;
+  ld->pos = 0;
+  ld->error = false;
+  ld->mngr = mngr;
+  ld->terms = term_manager_get_terms(mngr);
+  ld->types = term_manager_get_types(mngr);
+  init_ivector(&ld->type_map, 16);
+  init_ivector(&ld->term_map, 64);
+  init_ivector(&ld->args, 16);
+  q_init(&ld->q);
+  init_bvconstant(&ld->c);
+  init_string_buffer(&ld->name, 32);
+}
+
+static void delete_archive_loader(archive_loader_t *ld) {
+  delete_ivector(&ld->type_map);
+  delete_ivector(&ld->term_map);
+  delete_ivector(&ld->args);
+  q_clear(&ld->q);
+  delete_bvconstant(&ld->c);
+  delete_string_buffer(&ld->name);
+}
+
+
+/*
+ * Check whether n more bytes are available
+ */
+static bool has_bytes(archive_loader_t *ld, size_t n) {
+  if (ld->size - ld->pos < n) {
+    ld->error = true;
+    return false;
+  }
+  return true;
+}
+
+static uint8_t get_u8(archive_loader_t *ld) {
+  if (! has_bytes(ld, 1)) return 0;
+  return ld->data[ld->pos ++];
+}
+
+static uint32_t get_u32(archive_loader_t *ld) {
+  const uint8_t *p;
+
+  if (! has_bytes(ld, 4)) return 0;
+  p = ld->data + ld->pos;
+  ld->pos += 4;
+  return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static uint64_t get_u64(archive_loader_t *ld) {
+  uint64_t x;
+
+  x = get_u32(ld);
+  return x | ((uint64_t) get_u32(ld) << 32);
+}
+
+/*
+ * Read a count: fail if the remaining data can't contain n
+ * items of at least k bytes each.
+ */
+static uint32_t get_count(archive_loader_t *ld, uint32_t k) {
+  uint32_t n;
+
+  n = get_u32(ld);
+  if (! ld->error && (n > YICES_MAX_ARITY || (ld->size - ld->pos)/k < n)) {
+    ld->error = true;
+    n = 0;
+  }
+  return n;
+}
+
+/*
+ * Read a name into ld->name
+ * - return false if there's no name
+ */
+static bool get_name(archive_loader_t *ld) {
+  uint32_t n;
+
+  string_buffer_reset(&ld->name);
+  n = get_u32(ld);
+  if (n == 0 || ld->error) return false;
+  n --;
+  if (! has_bytes(ld, n)) return false;
+  string_buffer_append_chars(&ld->name, (const char *) ld->data + ld->pos, n);
+  string_buffer_close(&ld->name);
+  ld->pos += n;
+  return true;
+}
+
+/*
+ * Read a rational into ld->q
+ */
+static void get_rational(archive_loader_t *ld) {
+  int64_t num;
+  uint64_t den;
+
+  switch (get_u8(ld)) {
+  case 0:
+    num = (int64_t) get_u64(ld);
+    den = get_u64(ld);
+    if (den == 0) {
+      ld->error = true;
+    } else {
+      q_set_int64(&ld->q, num, den);
+    }
+    break;
+
+  case 1:
+    if (! get_name(ld) || q_set_from_string_base(&ld->q, ld->name.data, 16) < 0) {
+      ld->error = true;
+    }
+    break;
+
+  default:
+    ld->error = true;
+    break;
+  }
+}
+
+/*
+ * Read a bitvector constant of n bits into ld->c
+ */
+static void get_bvconst(archive_loader_t *ld, uint32_t n) {
+  uint32_t i, k;
+
+  k = (n + 31) >> 5;
+  if (! has_bytes(ld, 4 * (size_t) k)) return;
+  bvconstant_set_bitsize(&ld->c, n);
+  for (i=0; i<k; i++) {
+    ld->c.data[i] = get_u32(ld);
+  }
+  bvconst_normalize(ld->c.data, n);
+}
+
+static type_t get_type_ref(archive_loader_t *ld) {
+  uint32_t x;
+
+  x = get_u32(ld);
+  if (x < NUM_PREDEFINED) {
+    return x;
+  }
+  x -= NUM_PREDEFINED;
+  if (x >= ld->type_map.size) {
+    ld->error = true;
+    return bool_id;
+  }
+  return ld->type_map.data[x];
+}
+
+/*
+ * Term reference: index 0 (const_idx) is accepted only if allow_const is true
+ * - the polarity bit must be 0 unless the term is Boolean
+ */
+static term_t get_term_ref(archive_loader_t *ld, bool allow_const) {
+  uint32_t x, i;
+  term_t t;
+
+  x = get_u32(ld);
+  i = x >> 1;
+  if (i < NUM_PREDEFINED) {
+    if (i == const_idx && (x != const_idx || !allow_const)) {
+      ld->error = true;
+      return true_term;
+    }
+    t = x;
+  } else {
+    i -= NUM_PREDEFINED;
+    if (i >= ld->term_map.size) {
+      ld->error = true;
+      return true_term;
+    }
+    t = ld->term_map.data[i] ^ (x & 1);
+  }
+
+  if (is_neg_term(t) && !is_boolean_term(ld->terms, t)) {
+    ld->error = true;
+    return true_term;
+  }
+  return t;
+}
+
+
+/*
+ * Read a type record and build the type
+ */
+static type_t archive_load_type(archive_loader_t *ld) {
+  type_table_t *types;
+  type_kind_t kind;
+  type_t tau, range, aux;
+  uint32_t i, n;
+
+  types = ld->types;
+  kind = get_u8(ld);
+  tau = NULL_TYPE;
+  ivector_reset(&ld->args);
+
+  switch (kind) {
+  case BITVECTOR_TYPE:
+    n = get_u32(ld);
+    if (n == 0 || n > YICES_MAX_BVSIZE) break;
+    tau = bv_type(types, n);
+    break;
+
+  case SCALAR_TYPE:
+    n = get_u32(ld);
+    if (n == 0 || ld->error) break;
+    if (get_name(ld)) {
+      aux = get_type_by_name(types, ld->name.data);
+      if (aux != NULL_TYPE && is_scalar_type(types, aux) && scalar_type_cardinal(types, aux) == n) {
+        return aux;
+      }
+    }
+    tau = new_scalar_type(types, n);
+    goto set_name;
+
+  case UNINTERPRETED_TYPE:
+    if (get_name(ld)) {
+      aux = get_type_by_name(types, ld->name.data);
+      if (aux != NULL_TYPE && is_uninterpreted_type(types, aux)) {
+        return aux;
+      }
+    }
+    if (ld->error) break;
+    tau = new_uninterpreted_type(types);
+    goto set_name;
+
+  case TUPLE_TYPE:
+    n = get_count(ld, 4);
+    for (i=0; i<n; i++) {
+      ivector_push(&ld->args, get_type_ref(ld));
+    }
+    if (n == 0 || ld->error) break;
+    tau = tuple_type(types, n, ld->args.data);
+    break;
+
+  case FUNCTION_TYPE:
+    n = get_count(ld, 4);
+    range = get_type_ref(ld);
+    for (i=0; i<n; i++) {
+      ivector_push(&ld->args, get_type_ref(ld));
+    }
+    if (n == 0 || ld->error) break;
+    tau = function_type(types, range, n, ld->args.data);
+    break;
+
+  default:
+    break;
+  }
+
+  if (tau == NULL_TYPE || ld->error) {
+    ld->error = true;
+    return NULL_TYPE;
+  }
+
+  if (! get_name(ld)) {
+    return tau;
+  }
+
+ set_name:
+  if (! ld->error && ld->name.index > 0 && get_type_by_name(types, ld->name.data) == NULL_TYPE) {
+    set_type_name(types, tau, clone_string(ld->name.data));
+  }
+  return tau;
+}
+
+
+/*
+ * Minimal arity for a composite term
+ */
+static uint32_t composite_min_arity(term_kind_t kind) {
+  switch (kind) {
+  case ITE_TERM:
+  case ITE_SPECIAL:
+  case UPDATE_TERM:
+    return 3;
+
+  case TUPLE_TERM:
+  case BV_ARRAY:
+    return 1;
+
+  default:
+    return 2;
+  }
+}
+
+
+/*
+ * OPERAND CHECKS
+ *
+ * The term constructors assume well-typed arguments. A corrupted archive
+ * may still have a valid checksum, so we check the operands of every
+ * record before building the term (as the check functions of yices_api.c).
+ */
+static bool all_boolean_terms(term_table_t *terms, uint32_t n, const term_t *a) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (! is_boolean_term(terms, a[i])) return false;
+  }
+  return true;
+}
+
+static bool all_arith_terms(term_table_t *terms, uint32_t n, const term_t *a) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (! is_arithmetic_term(terms, a[i])) return false;
+  }
+  return true;
+}
+
+// all bitvectors of nbits bits
+static bool all_bv_terms(term_table_t *terms, uint32_t n, const term_t *a, uint32_t nbits) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (! is_bitvector_term(terms, a[i]) || term_bitsize(terms, a[i]) != nbits) return false;
+  }
+  return true;
+}
+
+// all terms have a common supertype
+static bool all_compatible_terms(term_table_t *terms, uint32_t n, const term_t *a) {
+  uint32_t i;
+  type_t tau;
+
+  tau = term_type(terms, a[0]);
+  for (i=1; i<n; i++) {
+    tau = super_type(terms->types, tau, term_type(terms, a[i]));
+    if (tau == NULL_TYPE) return false;
+  }
+  return true;
+}
+
+// f is a function of arity n and a[i] is in f's domain
+static bool good_fun_args(term_table_t *terms, term_t f, uint32_t n, const term_t *a) {
+  function_type_t *desc;
+  uint32_t i;
+
+  if (! is_function_term(terms, f)) return false;
+  desc = function_type_desc(terms->types, term_type(terms, f));
+  if (desc->ndom != n) return false;
+  for (i=0; i<n; i++) {
+    if (! is_subtype(terms->types, term_type(terms, a[i]), desc->domain[i])) return false;
+  }
+  return true;
+}
+
+// v[0 ... n-1] are variables without duplicates
+static bool good_bound_vars(term_table_t *terms, uint32_t n, const term_t *v) {
+  ivector_t aux;
+  uint32_t i;
+  bool ok;
+
+  if (n > YICES_MAX_VARS) return false;
+  for (i=0; i<n; i++) {
+    if (is_neg_term(v[i]) || term_kind(terms, v[i]) != VARIABLE) return false;
+  }
+
+  init_ivector(&aux, n);
+  ivector_copy(&aux, v, n);
+  int_array_sort(aux.data, n);
+  ok = true;
+  for (i=1; i<n; i++) {
+    if (aux.data[i-1] == aux.data[i]) {
+      ok = false;
+      break;
+    }
+  }
+  delete_ivector(&aux);
+
+  return ok;
+}
+
+/*
+ * Root atom: x must occur in polynomial p with degree > k
+ */
+static bool good_root_atom(archive_loader_t *ld, uint32_t k, term_t x, term_t p) {
+  rba_buffer_t *b;
+
+  if (! is_arithmetic_term(ld->terms, x) || ! is_arithmetic_term(ld->terms, p)) {
+    return false;
+  }
+  b = term_manager_get_arith_buffer(ld->mngr);
+  reset_rba_buffer(b);
+  rba_buffer_add_term(b, ld->terms, p);
+  return rba_buffer_degree(b) > 0 && k < rba_buffer_var_degree(b, x);
+}
+
+/*
+ * Power product in ld->args: the variables must have type tau
+ * and the total degree must be between 1 and YICES_MAX_DEGREE.
+ */
+static bool good_pprod(archive_loader_t *ld, type_t tau) {
+  term_table_t *terms;
+  uint64_t d;
+  uint32_t i, n, nbits;
+  term_t x;
+
+  terms = ld->terms;
+  n = ld->args.size;
+  nbits = is_bv_type(ld->types, tau) ? bv_type_size(ld->types, tau) : 0;
+  if (nbits == 0 && !is_arithmetic_type(tau)) return false;
+
+  d = 0;
+  for (i=0; i<n; i += 2) {
+    x = ld->args.data[i];
+    if (ld->args.data[i+1] <= 0) return false;
+    if (nbits == 0 && !is_arithmetic_term(terms, x)) return false;
+    if (nbits > 0 && !all_bv_terms(terms, 1, &x, nbits)) return false;
+    d += ((uint64_t) term_degree(terms, x)) * (uint32_t) ld->args.data[i+1];
+    if (d > YICES_MAX_DEGREE) return false;
+  }
+  return true;
+}
+
+/*
+ * Operands of a composite term (stored in ld->args)
+ */
+static bool good_composite(archive_loader_t *ld, term_kind_t kind, type_t tau) {
+  term_table_t *terms;
+  type_table_t *types;
+  term_t *a;
+  uint32_t n;
+
+  terms = ld->terms;
+  types = ld->types;
+  a = ld->args.data;
+  n = ld->args.size;
+
+  switch (kind) {
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    return n == 3 && is_boolean_term(terms, a[0]) &&
+      is_subtype(types, term_type(terms, a[1]), tau) &&
+      is_subtype(types, term_type(terms, a[2]), tau);
+
+  case APP_TERM:
+    return good_fun_args(terms, a[0], n-1, a+1);
+
+  case UPDATE_TERM:
+    return good_fun_args(terms, a[0], n-2, a+1) &&
+      is_subtype(types, term_type(terms, a[n-1]), function_type_desc(types, term_type(terms, a[0]))->range);
+
+  case TUPLE_TERM:
+    return n <= YICES_MAX_ARITY;
+
+  case EQ_TERM:
+    return n == 2 && all_compatible_terms(terms, n, a);
+
+  case DISTINCT_TERM:
+    return n <= YICES_MAX_ARITY && all_compatible_terms(terms, n, a);
+
+  case FORALL_TERM:
+    return good_bound_vars(terms, n-1, a) && is_boolean_term(terms, a[n-1]);
+
+  case LAMBDA_TERM:
+    return good_bound_vars(terms, n-1, a);
+
+  case OR_TERM:
+  case XOR_TERM:
+    return all_boolean_terms(terms, n, a);
+
+  case BV_ARRAY:
+    return n <= YICES_MAX_BVSIZE && all_boolean_terms(terms, n, a);
+
+  case ARITH_BINEQ_ATOM:
+  case ARITH_RDIV:
+  case ARITH_IDIV:
+  case ARITH_MOD:
+    return n == 2 && all_arith_terms(terms, n, a);
+
+  case ARITH_DIVIDES_ATOM:
+    return n == 2 && term_kind(terms, a[0]) == ARITH_CONSTANT && is_arithmetic_term(terms, a[1]);
+
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+  case BV_EQ_ATOM:
+  case BV_GE_ATOM:
+  case BV_SGE_ATOM:
+    return n == 2 && is_bitvector_term(terms, a[0]) && all_bv_terms(terms, n, a, term_bitsize(terms, a[0]));
+
+  default:
+    return false;
+  }
+}
+
+
+/*
+ * Build a power product: x[0]^d[0] ... x[n-1]^d[n-1]
+ * - the variables and exponents are stored in ld->args
+ * - they must be checked first (cf. good_pprod)
+ */
+static term_t archive_build_pprod(archive_loader_t *ld, type_t tau) {
+  term_manager_t *mngr;
+  rba_buffer_t *b;
+  bvarith64_buffer_t *b64;
+  bvarith_buffer_t *bv;
+  uint32_t i, n, nbits;
+
+  mngr = ld->mngr;
+  n = ld->args.size;
+
+  if (is_arithmetic_type(tau)) {
+    b = term_manager_get_arith_buffer(mngr);
+    rba_buffer_set_one(b);
+    for (i=0; i<n; i += 2) {
+      rba_buffer_mul_term_power(b, ld->terms, ld->args.data[i], ld->args.data[i+1]);
+    }
+    return mk_arith_term(mngr, b);
+  }
+
+  if (! is_bv_type(ld->types, tau)) {
+    ld->error = true;
+    return NULL_TERM;
+  }
+
+  nbits = bv_type_size(ld->types, tau);
+  if (nbits <= 64) {
+    b64 = term_manager_get_bvarith64_buffer(mngr);
+    bvarith64_buffer_prepare(b64, nbits);
+    bvarith64_buffer_set_one(b64);
+    for (i=0; i<n; i += 2) {
+      bvarith64_buffer_mul_term_power(b64, ld->terms, ld->args.data[i], ld->args.data[i+1]);
+    }
+    return mk_bvarith64_term(mngr, b64);
+  }
+
+  bv = term_manager_get_bvarith_buffer(mngr);
+  bvarith_buffer_prepare(bv, nbits);
+  bvarith_buffer_set_one(bv);
+  for (i=0; i<n; i += 2) {
+    bvarith_buffer_mul_term_power(bv, ld->terms, ld->args.data[i], ld->args.data[i+1]);
+  }
+  return mk_bvarith_term(mngr, bv);
+}
+
+
+/*
+ * Build a composite term from the arguments in ld->args
+ * - the arguments must be checked first (cf. good_composite)
+ */
+static term_t archive_build_composite(archive_loader_t *ld, term_kind_t kind, type_t tau) {
+  term_manager_t *mngr;
+  term_t *a;
+  uint32_t n;
+
+  mngr = ld->mngr;
+  a = ld->args.data;
+  n = ld->args.size;
+
+  switch (kind) {
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    return (n == 3) ? mk_ite(mngr, a[0], a[1], a[2], tau) : NULL_TERM;
+
+  case APP_TERM:
+    return mk_application(mngr, a[0], n-1, a+1);
+
+  case UPDATE_TERM:
+    return mk_update(mngr, a[0], n-2, a+1, a[n-1]);
+
+  case TUPLE_TERM:
+    return mk_tuple(mngr, n, a);
+
+  case EQ_TERM:
+    return (n == 2) ? mk_eq(mngr, a[0], a[1]) : NULL_TERM;
+
+  case DISTINCT_TERM:
+    return mk_distinct(mngr, n, a);
+
+  case FORALL_TERM:
+    return mk_forall(mngr, n-1, a, a[n-1]);
+
+  case LAMBDA_TERM:
+    return mk_lambda(mngr, n-1, a, a[n-1]);
+
+  case OR_TERM:
+    return mk_or(mngr, n, a);
+
+  case XOR_TERM:
+    return mk_xor(mngr, n, a);
+
+  case BV_ARRAY:
+    return mk_bvarray(mngr, n, a);
+
+  default:
+    break;
+  }
+
+  // binary terms
+  if (n != 2) {
+    return NULL_TERM;
+  }
+
+  switch (kind) {
+  case ARITH_BINEQ_ATOM:
+    return mk_arith_eq(mngr, a[0], a[1]);
+
+  case ARITH_RDIV:
+    return mk_arith_rdiv(mngr, a[0], a[1]);
+
+  case ARITH_IDIV:
+    return mk_arith_idiv(mngr, a[0], a[1]);
+
+  case ARITH_MOD:
+    return mk_arith_mod(mngr, a[0], a[1]);
+
+  case ARITH_DIVIDES_ATOM:
+    return mk_arith_divides(mngr, a[0], a[1]);
+
+  case BV_DIV:
+    return mk_bvdiv(mngr, a[0], a[1]);
+
+  case BV_REM:
+    return mk_bvrem(mngr, a[0], a[1]);
+
+  case BV_SDIV:
+    return mk_bvsdiv(mngr, a[0], a[1]);
+
+  case BV_SREM:
+    return mk_bvsrem(mngr, a[0], a[1]);
+
+  case BV_SMOD:
+    return mk_bvsmod(mngr, a[0], a[1]);
+
+  case BV_SHL:
+    return mk_bvshl(mngr, a[0], a[1]);
+
+  case BV_LSHR:
+    return mk_bvlshr(mngr, a[0], a[1]);
+
+  case BV_ASHR:
+    return mk_bvashr(mngr, a[0], a[1]);
+
+  case BV_EQ_ATOM:
+    return mk_bveq(mngr, a[0], a[1]);
+
+  case BV_GE_ATOM:
+    return mk_bvge(mngr, a[0], a[1]);
+
+  case BV_SGE_ATOM:
+    return mk_bvsge(mngr, a[0], a[1]);
+
+  default:
+    return NULL_TERM;
+  }
+}
+
+
+/*
+ * Read a term record and build the term
+ */
+static term_t archive_load_term(archive_loader_t *ld) {
+  term_manager_t *mngr;
+  term_table_t *terms;
+  term_kind_t kind;
+  type_t tau;
+  term_t t, x, p;
+  rba_buffer_t *b;
+  bvarith64_buffer_t *b64;
+  bvarith_buffer_t *bv;
+  uint32_t i, n, k, r, nbits;
+  uint64_t c;
+
+  mngr = ld->mngr;
+  terms = ld->terms;
+  kind = get_u8(ld);
+  tau = get_type_ref(ld);
+  t = NULL_TERM;
+  ivector_reset(&ld->args);
+  if (ld->error) return NULL_TERM;
+
+  switch (kind) {
+  case CONSTANT_TERM:
+    k = get_u32(ld);
+    if (ld->error || k > (uint32_t) INT32_MAX ||
+        !(is_uninterpreted_type(ld->types, tau) ||
+          (is_scalar_type(ld->types, tau) && k < scalar_type_cardinal(ld->types, tau)))) {
+      break;
+    }
+    t = mk_constant(mngr, tau, k);
+    break;
+
+  case ARITH_CONSTANT:
+    get_rational(ld);
+    if (ld->error) break;
+    t = mk_arith_constant(mngr, &ld->q);
+    break;
+
+  case BV64_CONSTANT:
+    nbits = get_u32(ld);
+    c = get_u64(ld);
+    if (ld->error || nbits == 0 || nbits > 64) break;
+    bvconstant_copy64(&ld->c, nbits, c);
+    t = mk_bv_constant(mngr, &ld->c);
+    break;
+
+  case BV_CONSTANT:
+    nbits = get_u32(ld);
+    if (nbits <= 64 || nbits > YICES_MAX_BVSIZE) break;
+    get_bvconst(ld, nbits);
+    if (ld->error) break;
+    t = mk_bv_constant(mngr, &ld->c);
+    break;
+
+  case VARIABLE:
+    t = mk_variable(mngr, tau);
+    break;
+
+  case UNINTERPRETED_TERM:
+    if (get_name(ld)) {
+      x = get_term_by_name(terms, ld->name.data);
+      if (x != NULL_TERM && term_kind(terms, x) == UNINTERPRETED_TERM && term_type(terms, x) == tau) {
+        return x;
+      }
+    }
+    if (ld->error) break;
+    t = mk_uterm(mngr, tau);
+    goto set_name;
+
+  case ARITH_EQ_ATOM:
+  case ARITH_GE_ATOM:
+  case ARITH_IS_INT_ATOM:
+  case ARITH_FLOOR:
+  case ARITH_CEIL:
+  case ARITH_ABS:
+    x = get_term_ref(ld, false);
+    if (ld->error || ! is_arithmetic_term(terms, x)) break;
+    switch (kind) {
+    case ARITH_EQ_ATOM: t = mk_arith_term_eq0(mngr, x); break;
+    case ARITH_GE_ATOM: t = mk_arith_term_geq0(mngr, x); break;
+    case ARITH_IS_INT_ATOM: t = mk_arith_is_int(mngr, x); break;
+    case ARITH_FLOOR: t = mk_arith_floor(mngr, x); break;
+    case ARITH_CEIL: t = mk_arith_ceil(mngr, x); break;
+    default: t = mk_arith_abs(mngr, x); break;
+    }
+    break;
+
+  case ARITH_ROOT_ATOM:
+    k = get_u32(ld);
+    r = get_u32(ld);
+    x = get_term_ref(ld, false);
+    p = get_term_ref(ld, false);
+    if (ld->error || r > ROOT_ATOM_GT || !good_root_atom(ld, k, x, p)) break;
+    t = mk_arith_root_atom(mngr, k, x, p, (root_atom_rel_t) r);
+    break;
+
+  case SELECT_TERM:
+  case BIT_TERM:
+    k = get_u32(ld);
+    x = get_term_ref(ld, false);
+    if (ld->error) break;
+    if (kind == SELECT_TERM) {
+      if (is_tuple_term(terms, x) && k < tuple_type_desc(ld->types, term_type(terms, x))->nelem) {
+        t = mk_select(mngr, k, x);
+      }
+    } else if (is_bitvector_term(terms, x) && k < term_bitsize(terms, x)) {
+      t = mk_bitextract(mngr, x, k);
+    }
+    break;
+
+  case POWER_PRODUCT:
+    n = get_count(ld, 8);
+    for (i=0; i<n; i++) {
+      ivector_push(&ld->args, get_term_ref(ld, false));
+      ivector_push(&ld->args, get_u32(ld));
+    }
+    if (n == 0 || ld->error || !good_pprod(ld, tau)) break;
+    t = archive_build_pprod(ld, tau);
+    break;
+
+  case ARITH_POLY:
+    n = get_count(ld, 5);
+    b = term_manager_get_arith_buffer(mngr);
+    reset_rba_buffer(b);
+    for (i=0; i<n && !ld->error; i++) {
+      x = get_term_ref(ld, true);
+      get_rational(ld);
+      if (ld->error) break;
+      if (x != const_idx && !is_arithmetic_term(terms, x)) {
+        ld->error = true;
+        break;
+      }
+      if (x == const_idx) {
+        rba_buffer_add_const(b, &ld->q);
+      } else {
+        rba_buffer_add_const_times_term(b, terms, &ld->q, x);
+      }
+    }
+    if (n == 0 || ld->error) break;
+    t = mk_arith_term(mngr, b);
+    break;
+
+  case BV64_POLY:
+    nbits = get_u32(ld);
+    n = get_count(ld, 12);
+    if (n == 0 || ld->error || nbits == 0 || nbits > 64) break;
+    b64 = term_manager_get_bvarith64_buffer(mngr);
+    bvarith64_buffer_prepare(b64, nbits);
+    for (i=0; i<n && !ld->error; i++) {
+      x = get_term_ref(ld, true);
+      c = get_u64(ld);
+      if (ld->error) break;
+      if (x != const_idx && !all_bv_terms(terms, 1, &x, nbits)) {
+        ld->error = true;
+        break;
+      }
+      if (x == const_idx) {
+        bvarith64_buffer_add_const(b64, c);
+      } else {
+        bvarith64_buffer_add_const_times_term(b64, terms, c, x);
+      }
+    }
+    if (ld->error) break;
+    t = mk_bvarith64_term(mngr, b64);
+    break;
+
+  case BV_POLY:
+    nbits = get_u32(ld);
+    n = get_count(ld, 8);
+    if (n == 0 || ld->error || nbits <= 64 || nbits > YICES_MAX_BVSIZE) break;
+    bv = term_manager_get_bvarith_buffer(mngr);
+    bvarith_buffer_prepare(bv, nbits);
+    for (i=0; i<n && !ld->error; i++) {
+      x = get_term_ref(ld, true);
+      get_bvconst(ld, nbits);
+      if (ld->error) break;
+      if (x != const_idx && !all_bv_terms(terms, 1, &x, nbits)) {
+        ld->error = true;
+        break;
+      }
+      if (x == const_idx) {
+        bvarith_buffer_add_const(bv, ld->c.data);
+      } else {
+        bvarith_buffer_add_const_times_term(bv, terms, ld->c.data, x);
+      }
+    }
+    if (ld->error) break;
+    t = mk_bvarith_term(mngr, bv);
+    break;
+
+  default:
+    if (kind < ITE_TERM || kind > BV_SGE_ATOM) break;
+    n = get_count(ld, 4);
+    for (i=0; i<n; i++) {
+      ivector_push(&ld->args, get_term_ref(ld, false));
+    }
+    if (ld->error || n < composite_min_arity(kind) || !good_composite(ld, kind, tau)) break;
+    t = archive_build_composite(ld, kind, tau);
+    break;
+  }
+
+  if (t == NULL_TERM || ld->error || ! is_subtype(ld->types, term_type(terms, t), tau)) {
+    ld->error = true;
+    return NULL_TERM;
+  }
+
+  if (! get_name(ld)) {
+    return t;
+  }
+
+ set_name:
+  if (! ld->error && ld->name.index > 0 && is_pos_term(t) &&
+      term_name(terms, t) == NULL && get_term_by_name(terms, ld->name.data) == NULL_TERM) {
+    set_term_name(terms, t, clone_string(ld->name.data));
+  }
+  return t;
+}
+
+
+/*
+ * Check the header then load all the records
+ */
+static int32_t archive_load(archive_loader_t *ld, ivector_t *v) {
+  uint32_t x[5];
+  uint32_t i, k;
+  type_t tau;
+  term_t t;
+
+  if (ld->size < ARCHIVE_HEADER_SIZE || memcmp(ld->data, TERM_ARCHIVE_MAGIC, 4) != 0) {
+    return TERM_ARCHIVE_FORMAT_ERROR;
+  }
+  ld->pos = 4;
+  for (i=0; i<5; i++) {
+    x[i] = get_u32(ld);
+  }
+  if (x[0] != TERM_ARCHIVE_VERSION) {
+    return TERM_ARCHIVE_VERSION_ERROR;
+  }
+  if (archive_checksum(ld->data + ARCHIVE_HEADER_SIZE, ld->size - ARCHIVE_HEADER_SIZE) != x[4]) {
+    return TERM_ARCHIVE_FORMAT_ERROR;
+  }
+
+  for (i=0; i<x[1]; i++) {
+    tau = archive_load_type(ld);
+    if (ld->error) return TERM_ARCHIVE_FORMAT_ERROR;
+    ivector_push(&ld->type_map, tau);
+  }
+  for (i=0; i<x[2]; i++) {
+    t = archive_load_term(ld);
+    if (ld->error) return TERM_ARCHIVE_FORMAT_ERROR;
+    ivector_push(&ld->term_map, t);
+  }
+
+  // roots
+  k = v->size;
+  for (i=0; i<x[3]; i++) {
+    ivector_push(v, get_term_ref(ld, false));
+  }
+  if (ld->error || ld->pos != ld->size) {
+    v->size = k;
+    return TERM_ARCHIVE_FORMAT_ERROR;
+  }
+
+  return TERM_ARCHIVE_OK;
+}
+
+
+#if !defined(MINGW)
+
+int32_t load_term_archive(term_manager_t *mngr, const char *filename, ivector_t *v) {
+  archive_loader_t loader;
+  struct stat sb;
+  void *addr;
+  int32_t code;
+  int fd;
+
+  fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    return TERM_ARCHIVE_OPEN_ERROR;
+  }
+  if (fstat(fd, &sb) < 0) {
+    close(fd);
+    return TERM_ARCHIVE_IO_ERROR;
+  }
+  if (! S_ISREG(sb.st_mode) || sb.st_size < ARCHIVE_HEADER_SIZE ||
+      (uint64_t) sb.st_size > (uint64_t) SIZE_MAX) {
+    close(fd);
+    return TERM_ARCHIVE_FORMAT_ERROR;
+  }
+  addr = mmap(NULL, (size_t) sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return TERM_ARCHIVE_IO_ERROR;
+  }
+
+#if defined(POSIX_MADV_SEQUENTIAL)
+  (void) posix_madvise(addr, (size_t) sb.st_size, POSIX_MADV_SEQUENTIAL);
+#endif
+
+  init_archive_loader(&loader, mngr, (const uint8_t *) addr, (size_t) sb.st_size);
+  code = archive_load(&loader, v);
+  delete_archive_loader(&loader);
+  munmap(addr, (size_t) sb.st_size);
+
+  return code;
+}
+
+#else
+
+/*
+ * No mmap: read the whole file
+ */
+int32_t load_term_archive(term_manager_t *mngr, const char *filename, ivector_t *v) {
+  archive_loader_t loader;
+  uint8_t *data;
+  size_t size, cap, k;
+  int32_t code;
+  FILE *f;
+
+  f = fopen(filename, "rb");
+  if (f == NULL) {
+    return TERM_ARCHIVE_OPEN_ERROR;
+  }
+
+  cap = 65536;
+  size = 0;
+  data = (uint8_t *) safe_malloc(cap);
+  for (;;) {
+    k = fread(data + size, 1, cap - size, f);
+    size += k;
+    if (size < cap) break;
+    cap += cap >> 1;
+    data = (uint8_t *) safe_realloc(data, cap);
+  }
+  if (ferror(f)) {
+    fclose(f);
+    safe_free(data);
+    return TERM_ARCHIVE_IO_ERROR;
+  }
+  fclose(f);
+
+  init_archive_loader(&loader, mngr, data, size);
+  code = archive_load(&loader, v);
+  delete_archive_loader(&loader);
+  safe_free(data);
+
+  return code;
+}
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TERM ARCHIVES
+ *
+ * Binary files that store a set of terms (the roots) together with
+ * all the types and terms they depend on. Loading an archive is much
+ * cheaper than parsing the same terms from text: there's no lexing,
+ * no symbol lookup, and no type checking.
+ *
+ * File layout (all integers are stored little-endian):
+ * - header: magic "YTAR", version, number of types, number of terms,
+ *   number of roots, checksum of the rest of the file.
+ * - type records, in dependency order.
+ * - term records, in dependency order.
+ * - the roots.
+ *
+ * Types and terms refer to earlier records by index. The predefined
+ * types (bool, int, real) and terms (true, zero) are not stored.
+ * Each record keeps the base name of the type or term if it has one.
+ *
+ * On loading, the file is mapped in memory (when mmap is available)
+ * and decoded in place. Types and terms are rebuilt through the term
+ * manager so they are hash-consed with the existing terms:
+ * - if a name stored in the archive refers to an uninterpreted type
+ *   (resp. an uninterpreted term of the same type) in the current
+ *   tables, that type or term is reused;
+ * - otherwise, a fresh object is created and the name is given to it
+ *   if the name is not already in use.
+ *
+ * Type variables and instance types are not supported.
+ */
+
+#ifndef __TERM_ARCHIVE_H
+#define __TERM_ARCHIVE_H
+
+#include <stdint.h>
+
+#include "terms/term_manager.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Current version and magic number
+ */
+#define TERM_ARCHIVE_VERSION 1
+#define TERM_ARCHIVE_MAGIC "YTAR"
+
+
+/*
+ * Error codes returned by the save/load functions
+ */
+enum {
+  TERM_ARCHIVE_OK = 0,
+  TERM_ARCHIVE_OPEN_ERROR = -1,     // can't open or create the file
+  TERM_ARCHIVE_IO_ERROR = -2,       // read or write failed
+  TERM_ARCHIVE_FORMAT_ERROR = -3,   // bad magic number, checksum, or record
+  TERM_ARCHIVE_VERSION_ERROR = -4,  // unsupported version
+  TERM_ARCHIVE_UNSUPPORTED = -5,    // a term can't be stored in an archive
+};
+
+
+/*
+ * Save terms a[0 ... n-1] and their dependencies in file filename
+ * - all terms in a must be valid terms in mngr's term table
+ * - return TERM_ARCHIVE_OK if the file was written
+ * - return TERM_ARCHIVE_UNSUPPORTED if one of the terms depends on a
+ *   type variable or instance type. In this case, *bad is set to
+ *   the first term found with such a type.
+ * - return TERM_ARCHIVE_OPEN_ERROR or TERM_ARCHIVE_IO_ERROR if the
+ *   file can't be created or written (errno is set).
+ */
+extern int32_t save_term_archive(term_manager_t *mngr, const char *filename, uint32_t n, const term_t *a, term_t *bad);
+
+/*
+ * Load archive filename and add the roots to vector v (in the order
+ * they were given to save_term_archive).
+ * - return TERM_ARCHIVE_OK if the archive was loaded
+ * - return a negative error code otherwise. In this case, v is unchanged
+ *   but some of the types and terms may have been created.
+ */
+extern int32_t load_term_archive(term_manager_t *mngr, const char *filename, ivector_t *v);
+
+
+#endif /* __TERM_ARCHIVE_H */
@@ -32,39 +32,32 @@ typedef struct {
   mcsat_literal_t blocker;
 } bcp_watcher_t;
 
-/** Reference for the watcher */
-typedef int32_t bcp_watch_list_element_ref_t;
-
-#define bcp_watch_list_element_ref_null (-1)
-
+/** A watch-list: watchers stored contiguously */
 typedef struct {
-  /** The watcher element */
-  bcp_watcher_t watcher;
-  /** The next one */
-  bcp_watch_list_element_ref_t next;
-} bcp_watch_list_element_t;
+  /** The watchers */
+  bcp_watcher_t* data;
+  /** Number of watchers */
+  uint32_t size;
+  /** Capacity of data */
+  uint32_t capacity;
+} bcp_watch_list_t;
 
 /**
  * Map from each literal to a list of clauses where we're watching this
- * literal.
+ * literal. Each list is a contiguous array of watchers, so that propagation
+ * goes through the watchers in order, without following links.
  */
 typedef struct {
 
-  /** Memory for bcp watchers */
-  bcp_watch_list_element_t* memory;
+  /** Map from literal indices to watchlists */
+  bcp_watch_list_t* watch_lists;
 
-  /** Size of the used cells */
+  /** Number of watch-lists */
   uint32_t size;
 
-  /** Capacity of the memory */
+  /** Capacity of the watch_lists array */
   uint32_t capacity;
 
-  /** Free list */
-  ivector_t free_list;
-
-  /** Map from literals to watchlists */
-  ivector_t watch_lists;
-
   /** List of used variable slots */
   ivector_t variables_list;
 
@@ -89,16 +82,21 @@ void bcp_watch_manager_add_to_watch(bcp_watch_manager_t* wlm,
 /** Sweep the clauses given the gc information */
 void bcp_watch_manager_sweep(bcp_watch_manager_t* wlm, const gc_info_t* gc_clauses, const gc_info_t* gc_vars);
 
+/**
+ * Iterator over a watch-list that can remove elements. The kept elements
+ * are compacted in place. Watchers can be added to other lists while
+ * iterating, but not to the list being iterated.
+ */
 typedef struct {
 
-  /** The trigger literal */
-  mcsat_literal_t l;
+  /** Index of the trigger literal */
+  uint32_t l_index;
 
   /** The watch-list manager */
   bcp_watch_manager_t* wlm;
 
-  /** The current and previous element */
-  bcp_watch_list_element_ref_t wle, wle_prev;
+  /** The current element and the element after the last kept one */
+  uint32_t current, keep;
 
 } bcp_remove_iterator_t;
 
@@ -108,17 +106,37 @@ void bcp_remove_iterator_construct(bcp_remove_iterator_t* it, bcp_watch_manager_
 /** Destruct a remove iterator for the given watcher and removes any elements marked to remove */
 void bcp_remove_iterator_destruct(bcp_remove_iterator_t* it);
 
-/** Returns the current watcher */
-bcp_watcher_t* bcp_remove_iterator_get_watcher(const bcp_remove_iterator_t* it);
-
 /** Returns true if the iterator is finished */
-bool bcp_remove_iterator_done(const bcp_remove_iterator_t* it);
+static inline
+bool bcp_remove_iterator_done(const bcp_remove_iterator_t* it) {
+  return it->l_index >= it->wlm->size || it->current >= it->wlm->watch_lists[it->l_index].size;
+}
+
+/** Returns the current watcher */
+static inline
+bcp_watcher_t* bcp_remove_iterator_get_watcher(const bcp_remove_iterator_t* it) {
+  assert(!bcp_remove_iterator_done(it));
+  return it->wlm->watch_lists[it->l_index].data + it->current;
+}
 
 /** Move the iterator to the next list and keep the current list */
-void bcp_remove_iterator_next_and_keep(bcp_remove_iterator_t* it);
+static inline
+void bcp_remove_iterator_next_and_keep(bcp_remove_iterator_t* it) {
+  assert(!bcp_remove_iterator_done(it));
+  bcp_watch_list_t* list = it->wlm->watch_lists + it->l_index;
+  if (it->keep != it->current) {
+    list->data[it->keep] = list->data[it->current];
+  }
+  it->keep ++;
+  it->current ++;
+}
 
 /** Move the iterator to the next list and remove the current lits */
-void bcp_remove_iterator_next_and_remove(bcp_remove_iterator_t* it);
+static inline
+void bcp_remove_iterator_next_and_remove(bcp_remove_iterator_t* it) {
+  assert(!bcp_remove_iterator_done(it));
+  it->current ++;
+}
 
 
 #endif /* BCP_WATCH_MANAGER_H_ */
@@ -557,7 +557,7 @@ void bool_plugin_propagate(plugin_t* plugin, trail_token_t* prop) {
     // Only for Boolean variables
     if (variable_db_is_boolean(bp->ctx->var_db, var)) {
       assert(trail_has_value(trail, var));
-      var_value = trail_get_value(trail, var)->b;
+      var_value = trail_get_boolean_value(trail, var);
 
       if (ctx_trace_enabled(bp->ctx, "bool::propagate")) {
         ctx_trace_printf(bp->ctx, "checking propagation due to ");
@@ -81,7 +81,7 @@ bool literal_has_value(mcsat_literal_t l, const mcsat_trail_t* trail) {
 static inline
 mcsat_literal_t literal_construct_from_trail(variable_t x, const mcsat_trail_t* trail) {
   assert(trail_has_value(trail, x));
-  return literal_construct(x, !trail_get_value(trail, x)->b);
+  return literal_construct(x, !trail_get_boolean_value(trail, x));
 }
 
 /** Return tre level of the literal (must have value != NONE) */
@@ -105,7 +105,7 @@ bool literal_get_value(mcsat_literal_t l, const mcsat_trail_t* trail) {
 
   l_var = literal_get_variable(l);
   assert(trail_has_value(trail, l_var));
-  l_var_value = trail_get_value(trail, l_var)->b;
+  l_var_value = trail_get_boolean_value(trail, l_var);
   if (literal_is_negated(l)) {
     return !l_var_value;
   } else {
@@ -116,13 +116,15 @@ bool literal_get_value(mcsat_literal_t l, const mcsat_trail_t* trail) {
 /** Return true if the literal is assigned to false */
 static inline
 bool literal_is_false(mcsat_literal_t l, const mcsat_trail_t* trail) {
-  return literal_has_value(l, trail) && !literal_get_value(l, trail);
+  int32_t status = trail_get_boolean_status(trail, literal_get_variable(l));
+  return status >= 0 && status == literal_is_negated(l);
 }
 
 /** Return true if the literal is assigned to true */
 static inline
 bool literal_is_true(mcsat_literal_t l, const mcsat_trail_t* trail) {
-  return literal_has_value(l, trail) && literal_get_value(l, trail);
+  int32_t status = trail_get_boolean_status(trail, literal_get_variable(l));
+  return status >= 0 && status != literal_is_negated(l);
 }
 
 /** Set the value of the literal */
@@ -101,6 +101,12 @@ void bdds_delete(CUDD* cudd) {
   safe_free(cudd);
 }
 
+uint32_t bdds_node_count(CUDD* cudd) {
+  long count = Cudd_ReadNodeCount(cudd->cudd);
+  assert(count >= 0);
+  return count > UINT32_MAX ? UINT32_MAX : (uint32_t) count;
+}
+
 BDD** bdds_allocate_reserve(CUDD* cudd, uint32_t n) {
   assert(n > 0);
   if (cudd->reserve[cudd->reserve_i].size > 0) {
@@ -43,6 +43,9 @@ CUDD* bdds_new();
 /** Destruct and delete cudd */
 void bdds_delete(CUDD* cudd);
 
+/** Number of live nodes in the BDDs (dead nodes are not counted) */
+uint32_t bdds_node_count(CUDD* cudd);
+
 /**
  * Given the term and BDDs of all the children compute the BDDs into
  * the output. The out_bdds should be initialized to NULL.
@@ -1162,3 +1162,24 @@ void bv_bdd_manager_mark_terms(bv_bdd_manager_t* bddm) {
     term_table_set_gc_mark(bddm->ctx->terms, index_of(t));
   }
 }
+
+uint32_t bv_bdd_manager_node_count(const bv_bdd_manager_t* bddm) {
+  return bdds_node_count(bddm->cudd);
+}
+
+void bv_bdd_manager_gc(bv_bdd_manager_t* bddm) {
+  uint32_t i;
+  for (i = 0; i < bddm->term_list.size; ++ i) {
+    term_t t = bddm->term_list.data[i];
+    term_info_t* t_info = bv_bdd_manager_get_info(bddm, t);
+    // Variables keep their bit BDDs
+    if (t_info->unassigned_variable == t) {
+      continue;
+    }
+    BDD** t_bdds = bv_bdd_manager_get_bdds_from_info(bddm, t_info);
+    bdds_clear(bddm->cudd, t_bdds, 2*t_info->value.bitsize);
+    // Force recomputation
+    t_info->bdd_timestamp = 0;
+    t_info->unassigned_variable = NULL_TERM;
+  }
+}
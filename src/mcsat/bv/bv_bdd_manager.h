@@ -132,5 +132,15 @@ bool bv_bdd_manager_bdd_is_point(const bv_bdd_manager_t* bddm, bdd_t bdd, uint32
 /** Intersect the two BDDs (result attached) */
 bdd_t bv_bdd_manager_bdd_intersect(bv_bdd_manager_t* bddm, bdd_t bdd1, bdd_t bdd2);
 
+/** Number of live BDD nodes in the manager */
+uint32_t bv_bdd_manager_node_count(const bv_bdd_manager_t* bddm);
+
+/**
+ * Release the BDDs cached for the compound terms so that the nodes only
+ * they refer to can be reclaimed. The BDDs are recomputed on demand. BDDs
+ * obtained from the manager remain valid only if they have been attached.
+ */
+void bv_bdd_manager_gc(bv_bdd_manager_t* bddm);
+
 /** Mark all the terms in the term manager */
 void bv_bdd_manager_mark_terms(bv_bdd_manager_t* bddm);
@@ -62,14 +62,16 @@ void bv_subexplainer_construct(bv_subexplainer_t* exp, const char* name, plugin_
   exp->explain_propagation     = NULL;
 }
 
-void bv_explainer_construct(bv_explainer_t* exp, plugin_context_t* ctx, watch_list_manager_t* wlm, bv_evaluator_t* eval) {
+void bv_explainer_construct(bv_explainer_t* exp, plugin_context_t* ctx, watch_list_manager_t* wlm, bv_evaluator_t* eval, bv_explanation_cache_t* cache) {
 
   exp->ctx = ctx;
   exp->tm = ctx->tm;
   exp->wlm = wlm;
   exp->eval = eval;
+  exp->cache = cache;
 
   init_ivector(&exp->tmp_conflict_vec, 0);
+  init_ivector(&exp->tmp_key, 0);
 
   bool use_yices = true;
 
@@ -88,6 +90,7 @@ void bv_explainer_destruct(bv_explainer_t* exp) {
   uint32_t i;
 
   delete_ivector(&exp->tmp_conflict_vec);
+  delete_ivector(&exp->tmp_key);
 
   // Delete all the sub-explainers
   for(i = 0; i < exp->subexplainers.size; ++ i) {
@@ -194,8 +197,93 @@ void print_counters(bv_explainer_t* exp){
   }
 }
 
+/** Append the value to the cache key */
+static
+void bv_explainer_key_push_value(ivector_t* key, const mcsat_value_t* value) {
+  uint32_t i;
+  if (value->type == VALUE_BOOLEAN) {
+    ivector_push(key, value->b);
+  } else {
+    assert(value->type == VALUE_BV);
+    const bvconstant_t* bv = &value->bv_value;
+    ivector_push(key, bv->bitsize);
+    for (i = 0; i < bv->width; ++ i) {
+      ivector_push(key, bv->data[i]);
+    }
+  }
+}
+
+/**
+ * Compute the cache key for explaining core_in with x as the explained
+ * variable. The explainers only look at the core atoms and at the values
+ * of the variables in the atoms (including the atoms themselves), so the
+ * key records these variables (sorted) with their values, and the core
+ * atoms in the given order. Returns false if some variable other than x
+ * has no value.
+ */
+static
+bool bv_explainer_get_key(bv_explainer_t* exp, const ivector_t* core_in, variable_t x, bool is_conflict, ivector_t* key) {
+  uint32_t i;
+
+  const mcsat_trail_t* trail = exp->ctx->trail;
+
+  ivector_reset(key);
+
+  // Collect the variables of the core
+  ivector_t vars;
+  init_ivector(&vars, 0);
+  for (i = 0; i < core_in->size; ++ i) {
+    variable_t atom_var = core_in->data[i];
+    variable_list_ref_t list_ref = watch_list_manager_get_list_of(exp->wlm, atom_var);
+    variable_t* atom_vars = watch_list_manager_get_list(exp->wlm, list_ref);
+    for (; *atom_vars != variable_null; atom_vars++) {
+      ivector_push(&vars, *atom_vars);
+    }
+  }
+  ivector_remove_duplicates(&vars);
+
+  // Header: kind, variable and the number of core atoms
+  ivector_push(key, is_conflict);
+  ivector_push(key, x);
+  ivector_push(key, core_in->size);
+
+  // Variables and their values (sorted)
+  bool ok = true;
+  for (i = 0; i < vars.size; ++ i) {
+    variable_t var = vars.data[i];
+    if (trail_has_value(trail, var)) {
+      ivector_push(key, var);
+      bv_explainer_key_push_value(key, trail_get_value(trail, var));
+    } else if (var != x) {
+      ok = false;
+      break;
+    }
+  }
+
+  // Core atoms, the order matters for the explainers
+  for (i = 0; ok && i < core_in->size; ++ i) {
+    ivector_push(key, core_in->data[i]);
+  }
+
+  delete_ivector(&vars);
+
+  return ok;
+}
+
 void bv_explainer_get_conflict(bv_explainer_t* exp, const ivector_t* conflict_in, variable_t conflict_var, ivector_t* conflict_out) {
 
+  // Get it from the cache if possible
+  bool use_cache = bv_explanation_cache_is_enabled(exp->cache) &&
+      bv_explainer_get_key(exp, conflict_in, conflict_var, true, &exp->tmp_key);
+  if (use_cache && bv_explanation_cache_find(exp->cache, &exp->tmp_key, conflict_out)) {
+    if (ctx_trace_enabled(exp->ctx, "mcsat::bv::conflict")) {
+      FILE* out = ctx_trace_out(exp->ctx);
+      fprintf(out, "cached explanation\n");
+    }
+    bv_explainer_normalize_conflict(exp, conflict_out);
+    return;
+  }
+
   // Get the explainer to use
   uint32_t i = 0;
   bv_subexplainer_t* subexplainer = NULL;
@@ -233,6 +321,11 @@ void bv_explainer_get_conflict(bv_explainer_t* exp, const ivector_t* conflict_in
     bv_explainer_check_conflict(exp, conflict_out);
   }
 
+  // Remember it (before normalization, that depends on the trail)
+  if (use_cache) {
+    bv_explanation_cache_add(exp->cache, &exp->tmp_key, conflict_out);
+  }
+
   // Normalize conflict
   bv_explainer_normalize_conflict(exp, conflict_out);
 
@@ -243,11 +336,20 @@ void bv_explainer_get_conflict(bv_explainer_t* exp, const ivector_t* conflict_in
 
 term_t bv_explainer_explain_propagation(bv_explainer_t* exp, variable_t x, const ivector_t* reasons_in, ivector_t* reasons_out) {
 
-  // Get the explainer to use
   uint32_t i = 0;
   bv_subexplainer_t* subexplainer = NULL;
   term_t subst = NULL_TERM;
 
+  // Get it from the cache if possible (substitution is stored last)
+  bool use_cache = bv_explanation_cache_is_enabled(exp->cache) &&
+      bv_explainer_get_key(exp, reasons_in, x, false, &exp->tmp_key);
+  if (use_cache && bv_explanation_cache_find(exp->cache, &exp->tmp_key, reasons_out)) {
+    assert(reasons_out->size > 0);
+    subst = ivector_pop2(reasons_out);
+    bv_explainer_normalize_conflict(exp, reasons_out);
+    return subst;
+  }
+
   // Until someone explains (full_sat always explains in the end)
   for (; subst == NULL_TERM; ++ i) {
 
@@ -281,6 +383,13 @@ term_t bv_explainer_explain_propagation(bv_explainer_t* exp, variable_t x, const
     
   }
 
+  // Remember it
+  if (use_cache) {
+    ivector_push(reasons_out, subst);
+    bv_explanation_cache_add(exp->cache, &exp->tmp_key, reasons_out);
+    ivector_pop(reasons_out);
+  }
+
   // Normalize the explanation
   bv_explainer_normalize_conflict(exp, reasons_out);
 
@@ -24,6 +24,7 @@
 #include "mcsat/plugin.h"
 
 #include "bv_evaluator.h"
+#include "bv_explanation_cache.h"
 
 #include "utils/int_vectors.h"
 #include "utils/ptr_vectors.h"
@@ -96,10 +97,16 @@ typedef struct {
   /** List of sub-explainers, to use in order */
   pvector_t subexplainers;
 
+  /** Cache of explanations (not owned) */
+  bv_explanation_cache_t* cache;
+
+  /** Temp vector for cache keys */
+  ivector_t tmp_key;
+
 } bv_explainer_t;
 
-/** Construct the explainer */
-void bv_explainer_construct(bv_explainer_t* exp, plugin_context_t* ctx, watch_list_manager_t* wlm, bv_evaluator_t* eval);
+/** Construct the explainer (the cache is shared, it's not owned by the explainer) */
+void bv_explainer_construct(bv_explainer_t* exp, plugin_context_t* ctx, watch_list_manager_t* wlm, bv_evaluator_t* eval, bv_explanation_cache_t* cache);
 
 /** Destruct the explainer */
 void bv_explainer_destruct(bv_explainer_t* exp);
@@ -0,0 +1,147 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mcsat/bv/bv_explanation_cache.h"
+
+#include "utils/hash_functions.h"
+
+#include <assert.h>
+
+/** Each entry takes 4 integers in the entries vector */
+#define ENTRY_SIZE 4
+
+#define ENTRY_START(cache, i) ((cache)->entries.data[ENTRY_SIZE*(i)])
+#define ENTRY_KEY_SIZE(cache, i) ((cache)->entries.data[ENTRY_SIZE*(i) + 1])
+#define ENTRY_EXPL_SIZE(cache, i) ((cache)->entries.data[ENTRY_SIZE*(i) + 2])
+#define ENTRY_NEXT(cache, i) ((cache)->entries.data[ENTRY_SIZE*(i) + 3])
+
+void bv_explanation_cache_construct(bv_explanation_cache_t* cache, statistics_t* stats) {
+  init_ivector(&cache->data, 0);
+  init_ivector(&cache->entries, 0);
+  init_int_hmap(&cache->hash_to_entry, 0);
+  cache->budget = 0;
+  cache->stats.hits = statistics_new_int(stats, "mcsat::bv::explanation_cache_hits");
+  cache->stats.misses = statistics_new_int(stats, "mcsat::bv::explanation_cache_misses");
+  cache->stats.resets = statistics_new_int(stats, "mcsat::bv::explanation_cache_resets");
+}
+
+void bv_explanation_cache_destruct(bv_explanation_cache_t* cache) {
+  delete_ivector(&cache->data);
+  delete_ivector(&cache->entries);
+  delete_int_hmap(&cache->hash_to_entry);
+}
+
+static inline
+uint32_t bv_explanation_cache_size(const bv_explanation_cache_t* cache) {
+  return cache->entries.size / ENTRY_SIZE;
+}
+
+void bv_explanation_cache_reset(bv_explanation_cache_t* cache) {
+  if (cache->entries.size > 0) {
+    ivector_reset(&cache->data);
+    ivector_reset(&cache->entries);
+    int_hmap_reset(&cache->hash_to_entry);
+    (*cache->stats.resets) ++;
+  }
+}
+
+void bv_explanation_cache_set_budget(bv_explanation_cache_t* cache, uint32_t budget) {
+  cache->budget = budget;
+  if (bv_explanation_cache_size(cache) > budget) {
+    bv_explanation_cache_reset(cache);
+  }
+}
+
+static inline
+int32_t bv_explanation_cache_hash(const ivector_t* key) {
+  // Hash map keys must be non-negative
+  return jenkins_hash_intarray(key->data, key->size) & INT32_MAX;
+}
+
+/** Check if the key of entry i is equal to key */
+static
+bool bv_explanation_cache_key_eq(const bv_explanation_cache_t* cache, int32_t i, const ivector_t* key) {
+  uint32_t k;
+  if (ENTRY_KEY_SIZE(cache, i) != key->size) {
+    return false;
+  }
+  const int32_t* entry_key = cache->data.data + ENTRY_START(cache, i);
+  for (k = 0; k < key->size; ++ k) {
+    if (entry_key[k] != key->data[k]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool bv_explanation_cache_find(bv_explanation_cache_t* cache, const ivector_t* key, ivector_t* out) {
+  uint32_t k;
+
+  if (cache->budget == 0) {
+    return false;
+  }
+
+  int32_t hash = bv_explanation_cache_hash(key);
+  int_hmap_pair_t* find = int_hmap_find(&cache->hash_to_entry, hash);
+  int32_t i = find == NULL ? -1 : find->val;
+  for (; i >= 0; i = ENTRY_NEXT(cache, i)) {
+    if (bv_explanation_cache_key_eq(cache, i, key)) {
+      const int32_t* expl = cache->data.data + ENTRY_START(cache, i) + key->size;
+      for (k = 0; k < ENTRY_EXPL_SIZE(cache, i); ++ k) {
+        ivector_push(out, expl[k]);
+      }
+      (*cache->stats.hits) ++;
+      return true;
+    }
+  }
+
+  (*cache->stats.misses) ++;
+  return false;
+}
+
+void bv_explanation_cache_add(bv_explanation_cache_t* cache, const ivector_t* key, const ivector_t* explanation) {
+  uint32_t k;
+
+  if (cache->budget == 0) {
+    return;
+  }
+
+  // Make room
+  if (bv_explanation_cache_size(cache) >= cache->budget) {
+    bv_explanation_cache_reset(cache);
+  }
+
+  int32_t hash = bv_explanation_cache_hash(key);
+  int_hmap_pair_t* find = int_hmap_get(&cache->hash_to_entry, hash);
+  int32_t i = bv_explanation_cache_size(cache);
+
+  // Add the entry, in front of the ones with the same hash
+  ivector_push(&cache->entries, cache->data.size);
+  ivector_push(&cache->entries, key->size);
+  ivector_push(&cache->entries, explanation->size);
+  ivector_push(&cache->entries, find->val);
+  find->val = i;
+
+  // Copy the data
+  for (k = 0; k < key->size; ++ k) {
+    ivector_push(&cache->data, key->data[k]);
+  }
+  for (k = 0; k < explanation->size; ++ k) {
+    ivector_push(&cache->data, explanation->data[k]);
+  }
+}
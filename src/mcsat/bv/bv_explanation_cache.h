@@ -0,0 +1,87 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mcsat/utils/statistics.h"
+
+#include "utils/int_vectors.h"
+#include "utils/int_hash_map.h"
+
+/**
+ * Cache of explanations computed by the bit-vector explainer. The key is
+ * an integer sequence describing everything the explainers look at (the
+ * core literals, the explained variable and the values of all the
+ * variables involved) so a cached explanation can be reused whenever the
+ * same key shows up again. The explanations are sequences of terms, so the
+ * cache must be reset when terms are garbage collected.
+ *
+ * The size is bounded by a budget (number of explanations). When the
+ * budget is exceeded the cache is emptied.
+ */
+typedef struct {
+
+  /** Keys and explanations, stored one after the other */
+  ivector_t data;
+
+  /** Cached entries: start of key in data, key size, explanation size, next with same hash */
+  ivector_t entries;
+
+  /** Map from key hashes to the first entry with the hash */
+  int_hmap_t hash_to_entry;
+
+  /** Maximal number of entries (0 to disable) */
+  uint32_t budget;
+
+  struct {
+    statistic_int_t* hits;
+    statistic_int_t* misses;
+    statistic_int_t* resets;
+  } stats;
+
+} bv_explanation_cache_t;
+
+/** Construct the cache (initially with budget 0, i.e. disabled) */
+void bv_explanation_cache_construct(bv_explanation_cache_t* cache, statistics_t* stats);
+
+/** Destruct the cache */
+void bv_explanation_cache_destruct(bv_explanation_cache_t* cache);
+
+/** Remove all entries */
+void bv_explanation_cache_reset(bv_explanation_cache_t* cache);
+
+/** Set the budget. If the cache exceeds the budget, it is emptied. */
+void bv_explanation_cache_set_budget(bv_explanation_cache_t* cache, uint32_t budget);
+
+/** Check whether the cache is enabled */
+static inline
+bool bv_explanation_cache_is_enabled(const bv_explanation_cache_t* cache) {
+  return cache->budget > 0;
+}
+
+/**
+ * Find the explanation for the given key. If found, the explanation is
+ * added to the end of out and the return value is true.
+ */
+bool bv_explanation_cache_find(bv_explanation_cache_t* cache, const ivector_t* key, ivector_t* out);
+
+/** Add an explanation for the given key (the key must not be in the cache) */
+void bv_explanation_cache_add(bv_explanation_cache_t* cache, const ivector_t* key, const ivector_t* explanation);
@@ -104,6 +104,9 @@ typedef struct {
   /** Explainer */
   bv_explainer_t explainer;
 
+  /** Cache of explanations (survives explainer resets) */
+  bv_explanation_cache_t explanation_cache;
+
   /** Variables processed in propagation */
   ivector_t processed_variables;
 
@@ -121,6 +124,8 @@ typedef struct {
     statistic_int_t* propagations;
     statistic_int_t* evaluations;
     statistic_int_t* constraints_attached;
+    statistic_int_t* bdd_gcs;
+    statistic_int_t* bdd_budget_stops;
   } stats;
 
 } bv_plugin_t;
@@ -159,7 +164,8 @@ void bv_plugin_construct(plugin_t* plugin, plugin_context_t* ctx) {
 
   bv_evaluator_construct(&bv->evaluator, ctx);
 
-  bv_explainer_construct(&bv->explainer, ctx, &bv->wlm, &bv->evaluator);
+  bv_explanation_cache_construct(&bv->explanation_cache, ctx->stats);
+  bv_explainer_construct(&bv->explainer, ctx, &bv->wlm, &bv->evaluator, &bv->explanation_cache);
 
   init_ivector(&bv->processed_variables, 0);
   bv->processed_variables_size = 0;
@@ -198,6 +204,8 @@ void bv_plugin_construct(plugin_t* plugin, plugin_context_t* ctx) {
   bv->stats.propagations = statistics_new_int(bv->ctx->stats, "mcsat::bv::propagations");
   bv->stats.evaluations = statistics_new_int(bv->ctx->stats, "mcsat::bv::evaluations");
   bv->stats.constraints_attached = statistics_new_int(bv->ctx->stats, "mcsat::bv::constraints_attached");
+  bv->stats.bdd_gcs = statistics_new_int(bv->ctx->stats, "mcsat::bv::bdd_gcs");
+  bv->stats.bdd_budget_stops = statistics_new_int(bv->ctx->stats, "mcsat::bv::bdd_budget_stops");
 }
 
 static
@@ -217,6 +225,7 @@ void bv_plugin_destruct(plugin_t* plugin) {
   bv_bdd_manager_delete(bv->bddm);
   bv_evaluator_destruct(&bv->evaluator);
   bv_explainer_destruct(&bv->explainer);
+  bv_explanation_cache_destruct(&bv->explanation_cache);
   delete_ivector(&bv->processed_variables);
   delete_int_hmap(&bv->visited_cache);
   delete_generic_heap(&bv->visit_heap);
@@ -638,6 +647,22 @@ void bv_plugin_process_fully_assigned_constraint(bv_plugin_t* bv, trail_token_t*
   }
 }
 
+/**
+ * Check whether the BDD manager is within the node budget (option
+ * bv_bdd_budget). If not, release the cached intermediate BDDs and check
+ * again.
+ */
+static
+bool bv_plugin_bdd_budget_ok(bv_plugin_t* bv) {
+  uint32_t budget = bv->ctx->options->bv_bdd_budget;
+  if (budget == 0 || bv_bdd_manager_node_count(bv->bddm) <= budget) {
+    return true;
+  }
+  bv_bdd_manager_gc(bv->bddm);
+  (*bv->stats.bdd_gcs) ++;
+  return bv_bdd_manager_node_count(bv->bddm) <= budget;
+}
+
 /**
  * Process a constraint cstr(x, y1, ..., yn) that is detected to be unit in x,
  * i.e., x is considered unassigned, and all y_i are assigned:
@@ -685,6 +710,17 @@ void bv_plugin_process_unit_constraint(bv_plugin_t* bv, trail_token_t* prop, var
     return;
   }
 
+  // If the BDDs are over budget, we can't compute the feasible set of x
+  // so we give up: the search stops with status unknown.
+  if (!bv_plugin_bdd_budget_ok(bv)) {
+    if (ctx_trace_enabled(ctx, "mcsat::bv::propagate")) {
+      ctx_trace_printf(ctx, "BDD budget exceeded, stopping\n");
+    }
+    (*bv->stats.bdd_budget_stops) ++;
+    ctx->request_unknown(ctx);
+    return;
+  }
+
   // Get the constraint value
   bool constraint_value = trail_get_value(trail, cstr)->b;
 
@@ -1141,6 +1177,7 @@ void bv_plugin_get_conflict(plugin_t* plugin, ivector_t* conflict) {
   }
 
   // Explain with the appropriate theory
+  bv_explanation_cache_set_budget(&bv->explanation_cache, bv->ctx->options->bv_explanation_cache_size);
   switch (bv->conflict_type) {
   case BV_CONFLICT_UNIT:
     bv_explainer_get_conflict(&bv->explainer, &conflict_core, bv->conflict_variable, conflict);
@@ -1206,6 +1243,7 @@ term_t bv_plugin_explain_propagation(plugin_t* plugin, variable_t var, ivector_t
     }
 
     assert(lemma_reasons.size == 0);
+    bv_explanation_cache_set_budget(&bv->explanation_cache, bv->ctx->options->bv_explanation_cache_size);
     term_t subst = bv_explainer_explain_propagation(&bv->explainer, var, &explain_core, reasons);
     if (ctx_trace_enabled(bv->ctx, "mcsat::bv::explain")) {
       ctx_trace_printf(bv->ctx, "bv_plugin_explain_propagation(): subst = ");
@@ -1341,7 +1379,9 @@ void bv_plugin_gc_mark_and_clear(plugin_t* plugin) {
   bv_bdd_manager_mark_terms(bv->bddm);
   // Reset all the explainers
   bv_explainer_destruct(&bv->explainer);
-  bv_explainer_construct(&bv->explainer, bv->ctx, &bv->wlm, &bv->evaluator);
+  bv_explainer_construct(&bv->explainer, bv->ctx, &bv->wlm, &bv->evaluator, &bv->explanation_cache);
+  // Cached explanations refer to terms and variables that might be gone
+  bv_explanation_cache_reset(&bv->explanation_cache);
   // Clear the evaluation cache
   bv_evaluator_clear_cache(&bv->evaluator);
 }
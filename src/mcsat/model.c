@@ -85,30 +85,6 @@ void mcsat_model_new_variable_notify(mcsat_model_t* m, variable_t x) {
   }
 }
 
-bool mcsat_model_has_value(const mcsat_model_t* m, variable_t x) {
-  // Make sure enough space
-  if (x >= m->size) {
-    return false;
-  }
-  return (m->values[x].type != VALUE_NONE);
-}
-
-const mcsat_value_t* mcsat_model_get_value(const mcsat_model_t* m, variable_t x) {
-  if (x >= m->size) {
-    return &mcsat_value_none;
-  } else {
-    return m->values + x;
-  }
-}
-
-uint32_t mcsat_model_get_value_timestamp(const mcsat_model_t* m, variable_t x) {
-  if (x >= m->size) {
-    return 0;
-  } else {
-    return m->timestamps[x];
-  }
-}
-
 void mcsat_model_set_value(mcsat_model_t* m, variable_t x, const mcsat_value_t* value) {
   // Make sure enough space
   if (x >= m->size) {
@@ -50,13 +50,22 @@ void mcsat_model_destruct(mcsat_model_t* m);
 void mcsat_model_new_variable_notify(mcsat_model_t* m, variable_t x);
 
 /** Does the variable have a value */
-bool mcsat_model_has_value(const mcsat_model_t* m, variable_t x);
+static inline
+bool mcsat_model_has_value(const mcsat_model_t* m, variable_t x) {
+  return x < m->size && m->values[x].type != VALUE_NONE;
+}
 
 /** Get the timestamp of the variable */
-uint32_t mcsat_model_get_value_timestamp(const mcsat_model_t* m, variable_t x);
+static inline
+uint32_t mcsat_model_get_value_timestamp(const mcsat_model_t* m, variable_t x) {
+  return x < m->size ? m->timestamps[x] : 0;
+}
 
 /** Get the value of the variable */
-const mcsat_value_t* mcsat_model_get_value(const mcsat_model_t* m, variable_t x);
+static inline
+const mcsat_value_t* mcsat_model_get_value(const mcsat_model_t* m, variable_t x) {
+  return x < m->size ? m->values + x : &mcsat_value_none;
+}
 
 /** Set x -> value. */
 void mcsat_model_set_value(mcsat_model_t* m, variable_t x, const mcsat_value_t* value);
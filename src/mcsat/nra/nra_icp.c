@@ -0,0 +1,420 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mcsat/nra/nra_icp.h"
+#include "mcsat/nra/poly_constraint.h"
+#include "mcsat/tracing.h"
+
+#include "utils/int_array_sort.h"
+#include "utils/int_hash_map.h"
+#include "utils/int_queues.h"
+
+#include <poly/polynomial.h>
+#include <poly/interval.h>
+#include <poly/value.h>
+#include <poly/variable_list.h>
+
+/** Maximal number of constraints in the antecedent of a bound lemma */
+#define NRA_ICP_MAX_REASONS 8
+
+/** ICP data for one run */
+typedef struct {
+  /** Asserted constraints participating */
+  ivector_t constraints;
+  /** For each constraint, the indices of its variables (terminated by -1) */
+  ivector_t constraint_vars;
+  /** Start of the variables of each constraint in constraint_vars */
+  ivector_t constraint_vars_start;
+  /** Map from lp variables to their index */
+  int_hmap_t var_to_index;
+  /** The lp variables */
+  ivector_t vars;
+  /** For each variable, the constraints it occurs in */
+  ivector_t* occurrences;
+  /** For each variable, the constraints used to derive its interval */
+  ivector_t* reasons;
+  /** Whether constraint is in the queue */
+  ivector_t in_queue;
+} nra_icp_t;
+
+static
+int32_t nra_icp_get_var_index(nra_icp_t* icp, lp_variable_t x) {
+  int_hmap_pair_t* find = int_hmap_get(&icp->var_to_index, x);
+  if (find->val < 0) {
+    find->val = icp->vars.size;
+    ivector_push(&icp->vars, x);
+  }
+  return find->val;
+}
+
+static
+void nra_icp_construct(nra_icp_t* icp, nra_plugin_t* nra) {
+  uint32_t i, j;
+
+  init_ivector(&icp->constraints, 0);
+  init_ivector(&icp->constraint_vars, 0);
+  init_ivector(&icp->constraint_vars_start, 0);
+  init_int_hmap(&icp->var_to_index, 0);
+  init_ivector(&icp->vars, 0);
+  init_ivector(&icp->in_queue, 0);
+
+  const mcsat_trail_t* trail = nra->ctx->trail;
+
+  // Collect the asserted constraints and their variables
+  const ivector_t* all_constraint_vars = poly_constraint_db_get_constraints(nra->constraint_db);
+  for (i = 0; i < all_constraint_vars->size; ++ i) {
+    variable_t constraint_var = all_constraint_vars->data[i];
+    if (!variable_db_is_boolean(nra->ctx->var_db, constraint_var) || !trail_has_value(trail, constraint_var)) {
+      continue;
+    }
+    const poly_constraint_t* cstr = poly_constraint_db_get(nra->constraint_db, constraint_var);
+    if (poly_constraint_is_root_constraint(cstr) || !poly_constraint_is_valid(cstr)) {
+      continue;
+    }
+    ivector_push(&icp->constraints, constraint_var);
+    ivector_push(&icp->constraint_vars_start, icp->constraint_vars.size);
+    ivector_push(&icp->in_queue, true);
+    lp_variable_list_t vars;
+    lp_variable_list_construct(&vars);
+    lp_polynomial_get_variables(poly_constraint_get_polynomial(cstr), &vars);
+    for (j = 0; j < vars.list_size; ++ j) {
+      ivector_push(&icp->constraint_vars, nra_icp_get_var_index(icp, vars.list[j]));
+    }
+    ivector_push(&icp->constraint_vars, -1);
+    lp_variable_list_destruct(&vars);
+  }
+
+  // Occurrence lists and reasons
+  icp->occurrences = safe_malloc(sizeof(ivector_t)*(icp->vars.size + 1));
+  icp->reasons = safe_malloc(sizeof(ivector_t)*(icp->vars.size + 1));
+  for (i = 0; i < icp->vars.size; ++ i) {
+    init_ivector(icp->occurrences + i, 0);
+    init_ivector(icp->reasons + i, 0);
+  }
+  for (i = 0; i < icp->constraints.size; ++ i) {
+    int32_t* x = icp->constraint_vars.data + icp->constraint_vars_start.data[i];
+    for (; *x >= 0; x ++) {
+      ivector_push(icp->occurrences + *x, i);
+    }
+  }
+}
+
+static
+void nra_icp_destruct(nra_icp_t* icp) {
+  uint32_t i;
+  for (i = 0; i < icp->vars.size; ++ i) {
+    delete_ivector(icp->occurrences + i);
+    delete_ivector(icp->reasons + i);
+  }
+  safe_free(icp->occurrences);
+  safe_free(icp->reasons);
+  delete_ivector(&icp->constraints);
+  delete_ivector(&icp->constraint_vars);
+  delete_ivector(&icp->constraint_vars_start);
+  delete_int_hmap(&icp->var_to_index);
+  delete_ivector(&icp->vars);
+  delete_ivector(&icp->in_queue);
+}
+
+/** Add all elements of from to the set to (both sorted, no duplicates) */
+static
+void nra_icp_reasons_merge(ivector_t* to, const ivector_t* from) {
+  uint32_t i, j;
+  if (from->size == 0) {
+    return;
+  }
+  ivector_add(to, from->data, from->size);
+  int_array_sort(to->data, to->size);
+  for (i = 0, j = 0; i < to->size; ++ i) {
+    if (j == 0 || to->data[j-1] != to->data[i]) {
+      to->data[j ++] = to->data[i];
+    }
+  }
+  ivector_shrink(to, j);
+}
+
+/** Add constraint index c to the set to */
+static
+void nra_icp_reasons_add(ivector_t* to, int32_t c) {
+  ivector_t single;
+  init_ivector(&single, 1);
+  ivector_push(&single, c);
+  nra_icp_reasons_merge(to, &single);
+  delete_ivector(&single);
+}
+
+static inline
+bool nra_icp_interval_b_open(const lp_interval_t* I) {
+  return I->is_point ? false : I->b_open;
+}
+
+/** Is the lower bound of I strictly tighter than the lower bound of J */
+static
+bool nra_icp_lower_tighter(const lp_interval_t* I, const lp_interval_t* J) {
+  int cmp = lp_value_cmp(lp_interval_get_lower_bound(I), lp_interval_get_lower_bound(J));
+  return cmp > 0 || (cmp == 0 && I->a_open && !J->a_open);
+}
+
+/** Is the upper bound of I strictly tighter than the upper bound of J */
+static
+bool nra_icp_upper_tighter(const lp_interval_t* I, const lp_interval_t* J) {
+  int cmp = lp_value_cmp(lp_interval_get_upper_bound(I), lp_interval_get_upper_bound(J));
+  return cmp < 0 || (cmp == 0 && nra_icp_interval_b_open(I) && !nra_icp_interval_b_open(J));
+}
+
+/** Get the interval of x in m (full interval if not set) */
+static
+void nra_icp_get_interval(lp_interval_assignment_t* m, lp_variable_t x, lp_interval_t* out) {
+  const lp_interval_t* I = lp_interval_assignment_get_interval(m, x);
+  lp_interval_t tmp;
+  if (I == NULL) {
+    lp_interval_construct_full(&tmp);
+  } else {
+    lp_interval_construct_copy(&tmp, I);
+  }
+  lp_interval_swap(&tmp, out);
+  lp_interval_destruct(&tmp);
+}
+
+/** Make a yices constant from an lp value (must be rational) */
+static
+term_t nra_icp_mk_constant(nra_plugin_t* nra, const lp_value_t* v) {
+  lp_rational_t lp_q;
+  rational_t q;
+  term_t result;
+
+  assert(lp_value_is_rational(v));
+  lp_rational_construct(&lp_q);
+  lp_value_get_rational(v, &lp_q);
+  q_init(&q);
+  q_set_mpq(&q, &lp_q);
+  result = mk_arith_constant(nra->ctx->tm, &q);
+  q_clear(&q);
+  lp_rational_destruct(&lp_q);
+
+  return result;
+}
+
+/**
+ * Make the bound atom for the lower (or upper) bound of I. Returns NULL_TERM
+ * if the bound, after rounding, is not tighter than the current feasible
+ * interval.
+ */
+static
+term_t nra_icp_mk_bound(nra_plugin_t* nra, variable_t x, const lp_interval_t* I, const lp_interval_t* current, bool lower) {
+  term_manager_t* tm = nra->ctx->tm;
+  term_t x_term = variable_db_get_term(nra->ctx->var_db, x);
+  const lp_value_t* v = lower ? lp_interval_get_lower_bound(I) : lp_interval_get_upper_bound(I);
+  bool open = lower ? I->a_open : nra_icp_interval_b_open(I);
+  term_t result = NULL_TERM;
+
+  if (lp_value_is_rational(v)) {
+    term_t c = nra_icp_mk_constant(nra, v);
+    if (lower) {
+      result = open ? mk_arith_gt(tm, x_term, c) : mk_arith_geq(tm, x_term, c);
+    } else {
+      result = open ? mk_arith_lt(tm, x_term, c) : mk_arith_leq(tm, x_term, c);
+    }
+  } else {
+    // Round outward to an integer
+    lp_integer_t z;
+    lp_value_t z_value;
+    lp_integer_construct(&z);
+    if (lower) {
+      lp_value_floor(v, &z);
+    } else {
+      lp_value_ceiling(v, &z);
+    }
+    lp_value_construct(&z_value, LP_VALUE_INTEGER, &z);
+    const lp_value_t* current_bound = lower ? lp_interval_get_lower_bound(current) : lp_interval_get_upper_bound(current);
+    int cmp = lp_value_cmp(&z_value, current_bound);
+    if ((lower && cmp > 0) || (!lower && cmp < 0)) {
+      term_t c = nra_icp_mk_constant(nra, &z_value);
+      result = lower ? mk_arith_geq(tm, x_term, c) : mk_arith_leq(tm, x_term, c);
+    }
+    lp_value_destruct(&z_value);
+    lp_integer_destruct(&z);
+  }
+
+  return result;
+}
+
+/** Add the lemma (reasons => bound), or not(reasons) if bound is NULL_TERM */
+static
+void nra_icp_add_lemma(nra_plugin_t* nra, nra_icp_t* icp, trail_token_t* prop, const ivector_t* reasons, term_t bound) {
+  uint32_t i;
+  ivector_t disjuncts;
+
+  init_ivector(&disjuncts, reasons->size + 1);
+  for (i = 0; i < reasons->size; ++ i) {
+    variable_t constraint_var = icp->constraints.data[reasons->data[i]];
+    term_t t = variable_db_get_term(nra->ctx->var_db, constraint_var);
+    bool value = trail_get_boolean_value(nra->ctx->trail, constraint_var);
+    ivector_push(&disjuncts, value ? opposite_term(t) : t);
+  }
+  if (bound != NULL_TERM) {
+    ivector_push(&disjuncts, bound);
+  }
+
+  term_t lemma = mk_or(nra->ctx->tm, disjuncts.size, disjuncts.data);
+  if (ctx_trace_enabled(nra->ctx, "mcsat::nra::icp")) {
+    ctx_trace_printf(nra->ctx, "nra_plugin_icp(): lemma ");
+    ctx_trace_term(nra->ctx, lemma);
+  }
+  prop->lemma(prop, lemma);
+  (*nra->stats.icp_lemmas) ++;
+
+  delete_ivector(&disjuncts);
+}
+
+void nra_plugin_icp(nra_plugin_t* nra, trail_token_t* prop) {
+  uint32_t i, steps, max_steps;
+  int32_t c, *x;
+  bool conflict = false;
+
+  assert(trail_is_at_base_level(nra->ctx->trail));
+
+  nra_icp_t icp;
+  nra_icp_construct(&icp, nra);
+
+  lp_interval_assignment_t* m = nra->lp_data.lp_interval_assignment;
+  lp_interval_assignment_reset(m);
+
+  // Old intervals of the variables of the current constraint
+  lp_interval_t* old = NULL;
+  uint32_t old_size = 0;
+
+  int_queue_t queue;
+  init_int_queue(&queue, 0);
+  for (i = 0; i < icp.constraints.size; ++ i) {
+    int_queue_push(&queue, i);
+  }
+
+  max_steps = 10 * icp.constraints.size + 100;
+  for (steps = 0; !conflict && !int_queue_is_empty(&queue) && steps < max_steps; ++ steps) {
+
+    c = int_queue_pop(&queue);
+    icp.in_queue.data[c] = false;
+
+    variable_t constraint_var = icp.constraints.data[c];
+    const poly_constraint_t* cstr = poly_constraint_db_get(nra->constraint_db, constraint_var);
+    bool negated = !trail_get_boolean_value(nra->ctx->trail, constraint_var);
+    int32_t* vars = icp.constraint_vars.data + icp.constraint_vars_start.data[c];
+
+    // Remember the intervals
+    uint32_t n = 0;
+    for (x = vars; *x >= 0; x ++, n ++) {
+      if (n == old_size) {
+        old_size = old_size + old_size/2 + 10;
+        old = safe_realloc(old, sizeof(lp_interval_t)*old_size);
+      }
+      lp_interval_construct_full(old + n);
+      nra_icp_get_interval(m, icp.vars.data[*x], old + n);
+    }
+
+    // Revise
+    int result = lp_polynomial_constraint_infer_bounds(poly_constraint_get_polynomial(cstr), poly_constraint_get_sign_condition(cstr), negated, m);
+
+    if (result == -1) {
+      // Infeasible: constraint together with the reasons of its variables
+      ivector_t reasons;
+      init_ivector(&reasons, 0);
+      nra_icp_reasons_add(&reasons, c);
+      for (x = vars; *x >= 0; x ++) {
+        nra_icp_reasons_merge(&reasons, icp.reasons + *x);
+      }
+      if (ctx_trace_enabled(nra->ctx, "mcsat::nra::icp")) {
+        ctx_trace_printf(nra->ctx, "nra_plugin_icp(): conflict\n");
+      }
+      nra_icp_add_lemma(nra, &icp, prop, &reasons, NULL_TERM);
+      delete_ivector(&reasons);
+      conflict = true;
+    } else if (result == 1) {
+      // Update the reasons of the tightened variables, and requeue
+      lp_interval_t current;
+      lp_interval_construct_full(&current);
+      uint32_t k = 0;
+      for (x = vars; *x >= 0; x ++, k ++) {
+        nra_icp_get_interval(m, icp.vars.data[*x], &current);
+        if (nra_icp_lower_tighter(&current, old + k) || nra_icp_upper_tighter(&current, old + k)) {
+          int32_t* y;
+          ivector_t* x_reasons = icp.reasons + *x;
+          nra_icp_reasons_add(x_reasons, c);
+          for (y = vars; *y >= 0; y ++) {
+            if (*y != *x) {
+              nra_icp_reasons_merge(x_reasons, icp.reasons + *y);
+            }
+          }
+          // Revise the other constraints of x
+          ivector_t* x_occurrences = icp.occurrences + *x;
+          for (i = 0; i < x_occurrences->size; ++ i) {
+            int32_t d = x_occurrences->data[i];
+            if (d != c && !icp.in_queue.data[d]) {
+              icp.in_queue.data[d] = true;
+              int_queue_push(&queue, d);
+            }
+          }
+        }
+      }
+      lp_interval_destruct(&current);
+    }
+
+    for (i = 0; i < n; ++ i) {
+      lp_interval_destruct(old + i);
+    }
+  }
+
+  // Add the bounds that improve the feasible sets (single reason bounds are
+  // already obtained in propagation)
+  if (!conflict) {
+    lp_interval_t I, current;
+    lp_interval_construct_full(&I);
+    lp_interval_construct_full(&current);
+    for (i = 0; i < icp.vars.size; ++ i) {
+      const ivector_t* reasons = icp.reasons + i;
+      if (reasons->size < 2 || reasons->size > NRA_ICP_MAX_REASONS) {
+        continue;
+      }
+      lp_variable_t x_lp = icp.vars.data[i];
+      variable_t x_var = nra_plugin_get_variable_from_lp_variable(nra, x_lp);
+      if (trail_has_value(nra->ctx->trail, x_var)) {
+        continue;
+      }
+      nra_icp_get_interval(m, x_lp, &I);
+      feasible_set_db_approximate_value(nra->feasible_set_db, x_var, &current);
+      if (nra_icp_lower_tighter(&I, &current)) {
+        term_t bound = nra_icp_mk_bound(nra, x_var, &I, &current, true);
+        if (bound != NULL_TERM) {
+          nra_icp_add_lemma(nra, &icp, prop, reasons, bound);
+        }
+      }
+      if (nra_icp_upper_tighter(&I, &current)) {
+        term_t bound = nra_icp_mk_bound(nra, x_var, &I, &current, false);
+        if (bound != NULL_TERM) {
+          nra_icp_add_lemma(nra, &icp, prop, reasons, bound);
+        }
+      }
+    }
+    lp_interval_destruct(&I);
+    lp_interval_destruct(&current);
+  }
+
+  safe_free(old);
+  delete_int_queue(&queue);
+  nra_icp_destruct(&icp);
+}
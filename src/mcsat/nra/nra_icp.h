@@ -0,0 +1,38 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+ 
+#pragma once
+
+#include "mcsat/nra/nra_plugin_internal.h"
+
+/**
+ * Interval constraint propagation over the polynomial constraints asserted
+ * at the base level. Each asserted (non-root) constraint is used to narrow
+ * the intervals of its variables (given the intervals of the other
+ * variables), until a fixpoint is reached or the revision budget is
+ * exhausted. The constraints that contributed to each interval are tracked.
+ *
+ * When an interval is tighter than the current feasible set of the
+ * variable, a lemma (c1 && ... && cn) => bound is added, so that the bound
+ * enters the feasible set database with a proper explanation. Bounds with
+ * algebraic endpoints are rounded outward to integers. If the constraints
+ * are found infeasible, the lemma not (c1 && ... && cn) is added instead.
+ *
+ * Must be called at base level.
+ */
+void nra_plugin_icp(nra_plugin_t* nra, trail_token_t* prop);
@@ -43,6 +43,7 @@
 #include "mcsat/watch_list_manager.h"
 #include "mcsat/nra/poly_constraint.h"
 #include "mcsat/nra/nra_plugin_explain.h"
+#include "mcsat/nra/nra_icp.h"
 
 #include "terms/terms.h"
 #include "utils/int_array_sort2.h"
@@ -67,6 +68,7 @@ void nra_plugin_stats_init(nra_plugin_t* nra) {
   nra->stats.evaluations = statistics_new_int(nra->ctx->stats, "mcsat::nra::evaluations");
   nra->stats.constraint_regular = statistics_new_int(nra->ctx->stats, "mcsat::nra::constraints_regular");
   nra->stats.constraint_root = statistics_new_int(nra->ctx->stats, "mcsat::nra::constraints_root");
+  nra->stats.icp_lemmas = statistics_new_int(nra->ctx->stats, "mcsat::nra::icp_lemmas");
 }
 
 static
@@ -121,6 +123,9 @@ void nra_plugin_construct(plugin_t* plugin, plugin_context_t* ctx) {
   nra->lp_data.lp_assignment = lp_assignment_new(nra->lp_data.lp_var_db);
   nra->lp_data.lp_interval_assignment = lp_interval_assignment_new(nra->lp_data.lp_var_db);
 
+  // Projection cache (budget is set from the options before explaining)
+  nra->projection_cache = projection_cache_new(nra->lp_data.lp_ctx, ctx->stats);
+
   // Tracing in libpoly
   if (false) {
 //    lp_trace_enable("coefficient");
@@ -207,6 +212,8 @@ void nra_plugin_destruct(plugin_t* plugin) {
 
   feasible_set_db_delete(nra->feasible_set_db);
 
+  projection_cache_delete(nra->projection_cache);
+
   lp_polynomial_context_detach(nra->lp_data.lp_ctx);
   lp_variable_order_detach(nra->lp_data.lp_var_order);
   lp_variable_db_detach(nra->lp_data.lp_var_db);
@@ -2048,6 +2055,11 @@ void nra_plugin_learn(plugin_t* plugin, trail_token_t* prop) {
     trail_print(trail, ctx_trace_out(nra->ctx));
   }
 
+  // Narrow the variable bounds with interval constraint propagation
+  if (nra->ctx->options->nra_icp) {
+    nra_plugin_icp(nra, prop);
+  }
+
   // Get constraints at
   // - constraint_db->constraints
   const ivector_t* all_constraint_vars = poly_constraint_db_get_constraints(nra->constraint_db);
@@ -220,7 +220,7 @@ void lp_projection_map_add(lp_projection_map_t* map, const lp_polynomial_t* p) {
   lp_polynomial_t** p_r_factors = 0;
   size_t* p_r_factors_multiplicities = 0;
   size_t p_r_factors_size = 0;
-  lp_polynomial_factor_square_free(p_r, &p_r_factors, &p_r_factors_multiplicities, &p_r_factors_size);
+  projection_cache_factor_square_free(map->nra->projection_cache, p_r, &p_r_factors, &p_r_factors_multiplicities, &p_r_factors_size);
 
   uint32_t i;
 
@@ -675,8 +675,8 @@ void lp_projection_map_add_psc(lp_projection_map_t* map, lp_polynomial_t*** poly
   uint32_t psc_size = p_deg > q_deg ? q_deg + 1 : p_deg + 1;
   polynomial_buffer_ensure_size(polynomial_buffer, polynomial_buffer_size, psc_size, map->ctx);
 
-  // Get the psc
-  lp_polynomial_psc(*polynomial_buffer, p, q);
+  // Get the psc (model independent, so we go through the cache)
+  projection_cache_psc(map->nra->projection_cache, *polynomial_buffer, p, q);
   // Add the initial sequence of the psc
   uint32_t psc_i;
   for (psc_i = 0; psc_i < psc_size; ++ psc_i) {
@@ -1036,6 +1036,7 @@ void nra_plugin_explain_conflict(nra_plugin_t* nra, const int_mset_t* pos, const
   }
 
   // Create the map from variables to
+  projection_cache_set_budget(nra->projection_cache, nra->ctx->options->nra_projection_cache_size);
   lp_projection_map_t projection_map;
   lp_projection_map_construct(&projection_map, nra);
 
@@ -1101,6 +1102,7 @@ void nra_plugin_explain_conflict(nra_plugin_t* nra, const int_mset_t* pos, const
 void nra_plugin_describe_cell(nra_plugin_t* nra, term_t p, ivector_t* out_literals) {
 
   // Create the map from variables to polynomials
+  projection_cache_set_budget(nra->projection_cache, nra->ctx->options->nra_projection_cache_size);
   lp_projection_map_t projection_map;
   lp_projection_map_construct(&projection_map, nra);
   projection_map.use_root_constraints_for_cells = false;
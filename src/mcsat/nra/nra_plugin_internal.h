@@ -26,6 +26,7 @@
 #include "mcsat/utils/scope_holder.h"
 #include "mcsat/utils/int_mset.h"
 #include "mcsat/nra/feasible_set_db.h"
+#include "mcsat/nra/projection_cache.h"
 
 #include "terms/term_manager.h"
 
@@ -88,6 +89,7 @@ struct nra_plugin_s {
     statistic_int_t* evaluations;
     statistic_int_t* constraint_regular;
     statistic_int_t* constraint_root;
+    statistic_int_t* icp_lemmas;
   } stats;
 
   /** Database of polynomial constraints */
@@ -96,6 +98,9 @@ struct nra_plugin_s {
   /** Map from variables to their feasible sets */
   feasible_set_db_t* feasible_set_db;
 
+  /** Cache of projection results (psc, factorizations) */
+  projection_cache_t* projection_cache;
+
   /** Data related to libpoly */
   struct {
 
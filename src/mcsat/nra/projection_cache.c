@@ -0,0 +1,372 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mcsat/nra/projection_cache.h"
+
+#include "utils/hash_functions.h"
+#include "utils/memalloc.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <poly/polynomial.h>
+
+typedef enum {
+  PROJECTION_CACHE_PSC,
+  PROJECTION_CACHE_FACTORS
+} projection_cache_kind_t;
+
+/**
+ * Entry in the cache. Entries are kept in a doubly linked LRU list (through
+ * prev and next, with element 0 as the list head) and in the hash buckets
+ * (through bucket_next). Free entries are linked through bucket_next.
+ */
+typedef struct {
+  /** Kind of the entry */
+  projection_cache_kind_t kind;
+  /** Hash of the key */
+  uint32_t hash;
+  /** Top variable */
+  lp_variable_t x;
+  /** The key polynomials (q is NULL for factorizations) */
+  lp_polynomial_t* p;
+  lp_polynomial_t* q;
+  /** The result */
+  lp_polynomial_t** result;
+  /** The multiplicities (for factorizations) */
+  size_t* multiplicities;
+  /** Size of the result */
+  uint32_t result_size;
+  /** Next in the hash bucket (or the free list) */
+  uint32_t bucket_next;
+  /** LRU list */
+  uint32_t prev;
+  uint32_t next;
+} projection_cache_entry_t;
+
+struct projection_cache_struct {
+
+  /** Entries, the first one is the LRU list head */
+  projection_cache_entry_t* entries;
+
+  /** Number of entries used (including the head and the free ones) */
+  uint32_t entries_size;
+
+  /** Capacity of the entries */
+  uint32_t entries_capacity;
+
+  /** List of free entries (0 if none) */
+  uint32_t free_list;
+
+  /** Hash buckets (0 is empty), size is a power of 2 */
+  uint32_t* buckets;
+
+  /** Number of buckets */
+  uint32_t buckets_size;
+
+  /** Number of polynomials in the cache (keys and results) */
+  uint32_t polys;
+
+  /** Budget for the number of polynomials */
+  uint32_t budget;
+
+  /** The polynomial context */
+  const lp_polynomial_context_t* ctx;
+
+  struct {
+    statistic_int_t* hits;
+    statistic_int_t* misses;
+    statistic_int_t* evictions;
+  } stats;
+};
+
+#define PROJECTION_CACHE_INITIAL_SIZE 64
+
+projection_cache_t* projection_cache_new(const lp_polynomial_context_t* ctx, statistics_t* stats) {
+  projection_cache_t* cache = safe_malloc(sizeof(projection_cache_t));
+
+  cache->entries = safe_malloc(sizeof(projection_cache_entry_t)*PROJECTION_CACHE_INITIAL_SIZE);
+  cache->entries_size = 1;
+  cache->entries_capacity = PROJECTION_CACHE_INITIAL_SIZE;
+  cache->entries[0].prev = 0;
+  cache->entries[0].next = 0;
+  cache->free_list = 0;
+
+  cache->buckets = safe_malloc(sizeof(uint32_t)*PROJECTION_CACHE_INITIAL_SIZE);
+  cache->buckets_size = PROJECTION_CACHE_INITIAL_SIZE;
+  uint32_t i;
+  for (i = 0; i < cache->buckets_size; ++ i) {
+    cache->buckets[i] = 0;
+  }
+
+  cache->polys = 0;
+  cache->budget = 0;
+  cache->ctx = ctx;
+
+  cache->stats.hits = statistics_new_int(stats, "mcsat::nra::projection_cache_hits");
+  cache->stats.misses = statistics_new_int(stats, "mcsat::nra::projection_cache_misses");
+  cache->stats.evictions = statistics_new_int(stats, "mcsat::nra::projection_cache_evictions");
+
+  return cache;
+}
+
+static
+uint32_t projection_cache_entry_polys(const projection_cache_entry_t* e) {
+  return e->result_size + (e->q == NULL ? 1 : 2);
+}
+
+static
+void projection_cache_entry_destruct(projection_cache_entry_t* e) {
+  uint32_t i;
+  lp_polynomial_delete(e->p);
+  if (e->q != NULL) {
+    lp_polynomial_delete(e->q);
+  }
+  for (i = 0; i < e->result_size; ++ i) {
+    lp_polynomial_delete(e->result[i]);
+  }
+  safe_free(e->result);
+  safe_free(e->multiplicities);
+}
+
+static
+void projection_cache_lru_remove(projection_cache_t* cache, uint32_t i) {
+  projection_cache_entry_t* e = cache->entries + i;
+  cache->entries[e->prev].next = e->next;
+  cache->entries[e->next].prev = e->prev;
+}
+
+/** Insert as most recently used (right after the head) */
+static
+void projection_cache_lru_add(projection_cache_t* cache, uint32_t i) {
+  projection_cache_entry_t* head = cache->entries;
+  projection_cache_entry_t* e = cache->entries + i;
+  e->prev = 0;
+  e->next = head->next;
+  cache->entries[head->next].prev = i;
+  head->next = i;
+}
+
+/** Remove entry i from its bucket, delete it and put it on the free list */
+static
+void projection_cache_evict(projection_cache_t* cache, uint32_t i) {
+  projection_cache_entry_t* e = cache->entries + i;
+  uint32_t* link = cache->buckets + (e->hash & (cache->buckets_size - 1));
+  while (*link != i) {
+    assert(*link != 0);
+    link = &cache->entries[*link].bucket_next;
+  }
+  *link = e->bucket_next;
+
+  projection_cache_lru_remove(cache, i);
+  assert(cache->polys >= projection_cache_entry_polys(e));
+  cache->polys -= projection_cache_entry_polys(e);
+  projection_cache_entry_destruct(e);
+
+  e->bucket_next = cache->free_list;
+  cache->free_list = i;
+}
+
+/** Evict least recently used entries until we're in the budget */
+static
+void projection_cache_shrink(projection_cache_t* cache) {
+  while (cache->polys > cache->budget) {
+    uint32_t lru = cache->entries[0].prev;
+    assert(lru != 0);
+    projection_cache_evict(cache, lru);
+    (*cache->stats.evictions) ++;
+  }
+}
+
+void projection_cache_reset(projection_cache_t* cache) {
+  while (cache->entries[0].prev != 0) {
+    projection_cache_evict(cache, cache->entries[0].prev);
+  }
+  assert(cache->polys == 0);
+}
+
+void projection_cache_delete(projection_cache_t* cache) {
+  projection_cache_reset(cache);
+  safe_free(cache->entries);
+  safe_free(cache->buckets);
+  safe_free(cache);
+}
+
+void projection_cache_set_budget(projection_cache_t* cache, uint32_t budget) {
+  cache->budget = budget;
+  projection_cache_shrink(cache);
+}
+
+/** Double the number of buckets and rehash */
+static
+void projection_cache_rehash(projection_cache_t* cache) {
+  uint32_t i, n, mask;
+
+  n = 2 * cache->buckets_size;
+  safe_free(cache->buckets);
+  cache->buckets = safe_malloc(sizeof(uint32_t)*n);
+  cache->buckets_size = n;
+  for (i = 0; i < n; ++ i) {
+    cache->buckets[i] = 0;
+  }
+
+  mask = n - 1;
+  for (i = cache->entries[0].next; i != 0; i = cache->entries[i].next) {
+    projection_cache_entry_t* e = cache->entries + i;
+    e->bucket_next = cache->buckets[e->hash & mask];
+    cache->buckets[e->hash & mask] = i;
+  }
+}
+
+/** Get a new entry, added to the LRU list and to the bucket of the given hash */
+static
+uint32_t projection_cache_new_entry(projection_cache_t* cache, uint32_t hash) {
+  uint32_t i;
+
+  if (cache->free_list != 0) {
+    i = cache->free_list;
+    cache->free_list = cache->entries[i].bucket_next;
+  } else {
+    if (cache->entries_size == cache->entries_capacity) {
+      cache->entries_capacity += cache->entries_capacity / 2;
+      cache->entries = safe_realloc(cache->entries, sizeof(projection_cache_entry_t)*cache->entries_capacity);
+    }
+    i = cache->entries_size ++;
+    if (cache->entries_size > cache->buckets_size) {
+      projection_cache_rehash(cache);
+    }
+  }
+
+  projection_cache_entry_t* e = cache->entries + i;
+  e->hash = hash;
+  e->bucket_next = cache->buckets[hash & (cache->buckets_size - 1)];
+  cache->buckets[hash & (cache->buckets_size - 1)] = i;
+  projection_cache_lru_add(cache, i);
+
+  return i;
+}
+
+static
+uint32_t projection_cache_hash(projection_cache_kind_t kind, lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q) {
+  uint32_t p_hash = lp_polynomial_hash(p);
+  uint32_t q_hash = q == NULL ? 0 : lp_polynomial_hash(q);
+  return jenkins_hash_triple(p_hash, q_hash, x, 0x1276aa31 + kind);
+}
+
+/** Find the entry and move it to the front of the LRU list (returns 0 if not found) */
+static
+uint32_t projection_cache_find(projection_cache_t* cache, uint32_t hash, projection_cache_kind_t kind, lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q) {
+  uint32_t i = cache->buckets[hash & (cache->buckets_size - 1)];
+  while (i != 0) {
+    projection_cache_entry_t* e = cache->entries + i;
+    if (e->hash == hash && e->kind == kind && e->x == x &&
+        lp_polynomial_eq(e->p, p) && (q == NULL || lp_polynomial_eq(e->q, q))) {
+      projection_cache_lru_remove(cache, i);
+      projection_cache_lru_add(cache, i);
+      (*cache->stats.hits) ++;
+      return i;
+    }
+    i = e->bucket_next;
+  }
+  (*cache->stats.misses) ++;
+  return 0;
+}
+
+void projection_cache_psc(projection_cache_t* cache, lp_polynomial_t** psc, const lp_polynomial_t* p, const lp_polynomial_t* q) {
+  lp_variable_t x = lp_polynomial_top_variable(p);
+  assert(lp_polynomial_top_variable(q) == x);
+
+  size_t p_deg = lp_polynomial_degree(p);
+  size_t q_deg = lp_polynomial_degree(q);
+  uint32_t psc_size = p_deg > q_deg ? q_deg + 1 : p_deg + 1;
+
+  if (cache->budget == 0) {
+    lp_polynomial_psc(psc, p, q);
+    return;
+  }
+
+  uint32_t i, hash;
+  hash = projection_cache_hash(PROJECTION_CACHE_PSC, x, p, q);
+  i = projection_cache_find(cache, hash, PROJECTION_CACHE_PSC, x, p, q);
+  if (i == 0) {
+    lp_polynomial_psc(psc, p, q);
+    i = projection_cache_new_entry(cache, hash);
+    projection_cache_entry_t* e = cache->entries + i;
+    e->kind = PROJECTION_CACHE_PSC;
+    e->x = x;
+    e->p = lp_polynomial_new_copy(p);
+    e->q = lp_polynomial_new_copy(q);
+    e->result = safe_malloc(sizeof(lp_polynomial_t*)*psc_size);
+    e->multiplicities = NULL;
+    e->result_size = psc_size;
+    uint32_t k;
+    for (k = 0; k < psc_size; ++ k) {
+      e->result[k] = lp_polynomial_new_copy(psc[k]);
+    }
+    cache->polys += projection_cache_entry_polys(e);
+    projection_cache_shrink(cache);
+  } else {
+    projection_cache_entry_t* e = cache->entries + i;
+    assert(e->result_size == psc_size);
+    uint32_t k;
+    for (k = 0; k < psc_size; ++ k) {
+      lp_polynomial_assign(psc[k], e->result[k]);
+    }
+  }
+}
+
+void projection_cache_factor_square_free(projection_cache_t* cache, const lp_polynomial_t* p, lp_polynomial_t*** factors, size_t** multiplicities, size_t* size) {
+
+  if (cache->budget == 0) {
+    lp_polynomial_factor_square_free(p, factors, multiplicities, size);
+    return;
+  }
+
+  lp_variable_t x = lp_polynomial_top_variable(p);
+
+  uint32_t i, k, hash;
+  hash = projection_cache_hash(PROJECTION_CACHE_FACTORS, x, p, NULL);
+  i = projection_cache_find(cache, hash, PROJECTION_CACHE_FACTORS, x, p, NULL);
+  if (i == 0) {
+    lp_polynomial_factor_square_free(p, factors, multiplicities, size);
+    i = projection_cache_new_entry(cache, hash);
+    projection_cache_entry_t* e = cache->entries + i;
+    e->kind = PROJECTION_CACHE_FACTORS;
+    e->x = x;
+    e->p = lp_polynomial_new_copy(p);
+    e->q = NULL;
+    e->result = safe_malloc(sizeof(lp_polynomial_t*)*(*size));
+    e->multiplicities = safe_malloc(sizeof(size_t)*(*size));
+    e->result_size = *size;
+    for (k = 0; k < *size; ++ k) {
+      e->result[k] = lp_polynomial_new_copy((*factors)[k]);
+      e->multiplicities[k] = (*multiplicities)[k];
+    }
+    cache->polys += projection_cache_entry_polys(e);
+    projection_cache_shrink(cache);
+  } else {
+    projection_cache_entry_t* e = cache->entries + i;
+    *size = e->result_size;
+    *factors = safe_malloc(sizeof(lp_polynomial_t*)*(e->result_size));
+    *multiplicities = safe_malloc(sizeof(size_t)*(e->result_size));
+    for (k = 0; k < e->result_size; ++ k) {
+      (*factors)[k] = lp_polynomial_new_copy(e->result[k]);
+      (*multiplicities)[k] = e->multiplicities[k];
+    }
+  }
+}
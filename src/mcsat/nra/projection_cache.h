@@ -0,0 +1,60 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+ 
+#pragma once
+
+#include <poly/poly.h>
+#include <stdint.h>
+
+#include "mcsat/utils/statistics.h"
+
+/**
+ * Cache for the model-independent parts of the CAD projection: the
+ * principal subresultant coefficients of pairs of polynomials and the
+ * square-free factorizations. Entries are keyed by the polynomials (as
+ * hashed under the current variable order) and their top variable.
+ *
+ * The cache is owned by the plugin and it's not affected by push/pop. Its
+ * size is bounded by a budget (number of cached polynomials) and entries
+ * are evicted in least-recently-used order.
+ */
+typedef struct projection_cache_struct projection_cache_t;
+
+/** Create a new cache (initially with budget 0, i.e. disabled) */
+projection_cache_t* projection_cache_new(const lp_polynomial_context_t* ctx, statistics_t* stats);
+
+/** Delete the cache */
+void projection_cache_delete(projection_cache_t* cache);
+
+/** Remove all entries */
+void projection_cache_reset(projection_cache_t* cache);
+
+/** Set the budget. If the cache exceeds the budget, entries are evicted. */
+void projection_cache_set_budget(projection_cache_t* cache, uint32_t budget);
+
+/**
+ * Same as lp_polynomial_psc(psc, p, q): both p and q must have the same top
+ * variable, and psc must have room for min(deg(p), deg(q)) + 1 polynomials.
+ */
+void projection_cache_psc(projection_cache_t* cache, lp_polynomial_t** psc, const lp_polynomial_t* p, const lp_polynomial_t* q);
+
+/**
+ * Same as lp_polynomial_factor_square_free(). The returned factors and
+ * arrays are owned by the caller.
+ */
+void projection_cache_factor_square_free(projection_cache_t* cache, const lp_polynomial_t* p, lp_polynomial_t*** factors, size_t** multiplicities, size_t* size);
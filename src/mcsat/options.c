@@ -24,9 +24,14 @@ extern void init_mcsat_options(mcsat_options_t *opts) {
   opts->nra_nlsat = false;
   opts->nra_mgcd = false;
   opts->nra_bound = false;
+  opts->nra_icp = false;
   opts->nra_bound_min = -1;
   opts->nra_bound_max = -1;
+  opts->nra_projection_cache_size = 20000;
   opts->bv_var_size = -1;
+  opts->bv_bdd_budget = 0;
+  opts->bv_explanation_cache_size = 10000;
+  opts->incremental_model = true;
   opts->var_order = NULL;
 }
 
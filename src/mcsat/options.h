@@ -31,9 +31,19 @@ typedef struct mcsat_options_s {
   bool nra_mgcd;
   bool nra_nlsat;
   bool nra_bound;
+  bool nra_icp;
   int32_t nra_bound_min;
   int32_t nra_bound_max;
+  // budget (number of polynomials) of the nra projection cache, 0 to disable
+  uint32_t nra_projection_cache_size;
   int32_t bv_var_size;
+  // budget (number of live BDD nodes) of the bv plugin, 0 for no limit
+  // (the search stops with status unknown when it is exceeded)
+  uint32_t bv_bdd_budget;
+  // budget (number of explanations) of the bv explanation cache, 0 to disable
+  uint32_t bv_explanation_cache_size;
+  // keep the decided assumptions between checks with model
+  bool incremental_model;
   // ordering for forcing assignment order
   ivector_t* var_order;
 } mcsat_options_t;
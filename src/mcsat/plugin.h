@@ -98,6 +98,12 @@ struct plugin_context_s {
   /** Request garbage collection */
   void (*request_gc) (plugin_context_t* self);
 
+  /**
+   * Stop the search with status UNKNOWN: the plugin can't decide the problem
+   * (e.g., a resource budget is exhausted).
+   */
+  void (*request_unknown) (plugin_context_t* self);
+
   /** Request decision calls for a specific type */
   void (*request_decision_calls) (plugin_context_t* self, type_kind_t type);
 
@@ -122,6 +122,9 @@ struct mcsat_solver_s {
   /** Flag to stop the search */
   bool stop_search;
 
+  /** The search was stopped by a plugin that can't decide the problem */
+  bool search_incomplete;
+
   /** Exception handler */
   jmp_buf* exception;
 
@@ -277,6 +280,8 @@ struct mcsat_solver_s {
     statistic_avg_t* avg_conflict_size;
     // GC calls
     statistic_int_t* gc_calls;
+    // Assumption decision levels kept from the previous check
+    statistic_int_t* assumption_levels_kept;
   } solver_stats;
 
   struct {
@@ -321,6 +326,7 @@ void mcsat_stats_init(mcsat_solver_t* mcsat) {
   mcsat->solver_stats.gc_calls = statistics_new_int(&mcsat->stats, "mcsat::gc_calls");
   mcsat->solver_stats.lemmas = statistics_new_int(&mcsat->stats, "mcsat::lemmas");
   mcsat->solver_stats.restarts = statistics_new_int(&mcsat->stats, "mcsat::restarts");
+  mcsat->solver_stats.assumption_levels_kept = statistics_new_int(&mcsat->stats, "mcsat::assumption_levels_kept");
 }
 
 static
@@ -627,6 +633,15 @@ void mcsat_plugin_context_gc(plugin_context_t* self) {
   mcsat_request_gc(mctx->mcsat);
 }
 
+static
+void mcsat_plugin_context_unknown(plugin_context_t* self) {
+  mcsat_plugin_context_t* mctx;
+
+  mctx = (mcsat_plugin_context_t*) self;
+  mctx->mcsat->search_incomplete = true;
+  mctx->mcsat->stop_search = true;
+}
+
 static inline
 void mcsat_set_top_decision(mcsat_solver_t* mcsat, variable_t x) {
   assert(mcsat->top_decision_var == variable_null);
@@ -714,6 +729,7 @@ void mcsat_plugin_context_construct(mcsat_plugin_context_t* ctx, mcsat_solver_t*
   ctx->ctx.request_term_notification_by_type = mcsat_plugin_term_notification_by_type;
   ctx->ctx.request_restart = mcsat_plugin_context_restart;
   ctx->ctx.request_gc = mcsat_plugin_context_gc;
+  ctx->ctx.request_unknown = mcsat_plugin_context_unknown;
   ctx->ctx.bump_variable = mcsat_plugin_context_bump_variable;
   ctx->ctx.bump_variable_n = mcsat_plugin_context_bump_variable_n;
   ctx->ctx.cmp_variables = mcsat_plugin_context_cmp_variables;
@@ -796,6 +812,7 @@ void mcsat_construct(mcsat_solver_t* mcsat, const context_t* ctx) {
   assert(ctx->types != NULL);
 
   mcsat->stop_search = false;
+  mcsat->search_incomplete = false;
   mcsat->ctx = ctx;
   mcsat->exception = (jmp_buf*) &ctx->env;
   mcsat->types = ctx->types;
@@ -1002,10 +1019,23 @@ void mcsat_backtrack_to(mcsat_solver_t* mcsat, uint32_t level);
 static
 void mcsat_gc(mcsat_solver_t* mcsat, bool mark_and_gc_internal);
 
+/**
+ * Backtrack the assumption decisions kept by mcsat_clear() (if any) so that
+ * the trail is at the base level.
+ */
+static
+void mcsat_drop_assumptions(mcsat_solver_t* mcsat) {
+  mcsat->assumption_i = 0;
+  mcsat->assumptions_decided_level = -1;
+  mcsat_backtrack_to(mcsat, mcsat->trail->decision_level_base);
+}
+
 void mcsat_push(mcsat_solver_t* mcsat) {
 
   assert(mcsat->status == STATUS_IDLE); // We must have clear before
 
+  mcsat_drop_assumptions(mcsat);
+
   if (trace_enabled(mcsat->ctx->trace, "mcsat::push")) {
     mcsat_trace_printf(mcsat->ctx->trace, "mcsat::push start\n");
     trail_print(mcsat->trail, trace_out(mcsat->ctx->trace));
@@ -1050,6 +1080,8 @@ void mcsat_pop(mcsat_solver_t* mcsat) {
     trail_print(mcsat->trail, trace_out(mcsat->ctx->trace));
   }
 
+  mcsat_drop_assumptions(mcsat);
+
   if (mcsat->inconsistent_push_calls > 0) {
     mcsat->inconsistent_push_calls --;
     mcsat->status = STATUS_IDLE;
@@ -1115,9 +1147,16 @@ void mcsat_pop(mcsat_solver_t* mcsat) {
 void mcsat_clear(mcsat_solver_t* mcsat) {
   // Clear to be ready for more assertions:
   // - Pop internal to base level
-  mcsat->assumption_i = 0;
-  mcsat->assumptions_decided_level = -1;
-  mcsat_backtrack_to(mcsat, mcsat->trail->decision_level_base);
+  // - If we found a model under assumptions, keep the levels where the
+  //   assumptions were decided: the next check with model can reuse them
+  //   and anything else backtracks them (see mcsat_drop_assumptions)
+  if (mcsat->status == STATUS_SAT && mcsat->ctx->mcsat_options.incremental_model &&
+      mcsat->assumptions_decided_level > (int32_t) mcsat->trail->decision_level_base) {
+    mcsat->assumption_i = 0;
+    mcsat_backtrack_to(mcsat, mcsat->assumptions_decided_level);
+  } else {
+    mcsat_drop_assumptions(mcsat);
+  }
   mcsat->status = STATUS_IDLE;
 }
 
@@ -2246,7 +2285,9 @@ bool mcsat_decide_assumption(mcsat_solver_t* mcsat, model_t* mdl, uint32_t n_ass
     // If the variable already has a value in the trail check for consistency
     if (trail_has_value(mcsat->trail, var)) {
       // If the value is different from given value, we are in conflict
-      assert(trail_get_assignment_type(mcsat->trail, var) == PROPAGATION);
+      // (decisions can only be assumptions kept from the previous check)
+      assert(trail_get_assignment_type(mcsat->trail, var) == PROPAGATION ||
+             (int32_t) trail_get_level(mcsat->trail, var) <= mcsat->assumptions_decided_level);
       const mcsat_value_t* var_trail_value = trail_get_value(mcsat->trail, var);
       bool eq = mcsat_value_eq(&var_mdl_value, var_trail_value);
       if (!eq) {
@@ -2500,6 +2541,70 @@ void mcsat_check_model(mcsat_solver_t* mcsat, bool assert) {
 static
 void mcsat_assert_formulas_internal(mcsat_solver_t* mcsat, uint32_t n, const term_t *f, bool preprocess);
 
+/**
+ * Keep the assumption decisions of the previous check (see mcsat_clear) that
+ * also decide the current assumptions to their value in mdl, and backtrack
+ * the rest. The levels are kept as a prefix, so all the lemmas, propagations
+ * and feasible sets computed under them remain valid.
+ */
+static
+void mcsat_resume_assumptions(mcsat_solver_t* mcsat, model_t* mdl) {
+  uint32_t i, level, keep_level;
+  variable_t var;
+  term_t var_term;
+  value_t value;
+  mcsat_value_t var_mdl_value;
+  int_hset_t assumption_set;
+  bool eq;
+
+  if (mcsat->assumptions_decided_level < 0) {
+    // Nothing kept
+    assert(trail_is_at_base_level(mcsat->trail));
+    return;
+  }
+
+  init_int_hset(&assumption_set, 0);
+  for (i = 0; i < mcsat->assumption_vars.size; ++ i) {
+    int_hset_add(&assumption_set, mcsat->assumption_vars.data[i]);
+  }
+
+  // Decisions are on the trail in the order of their levels
+  keep_level = mcsat->trail->decision_level_base;
+  for (i = 0; i < trail_size(mcsat->trail); ++ i) {
+    var = trail_at(mcsat->trail, i);
+    if (trail_get_assignment_type(mcsat->trail, var) != DECISION) {
+      continue;
+    }
+    level = trail_get_level(mcsat->trail, var);
+    if (!int_hset_member(&assumption_set, var)) {
+      break;
+    }
+    var_term = variable_db_get_term(mcsat->var_db, var);
+    value = model_get_term_value(mdl, var_term);
+    mcsat_value_construct_from_value(&var_mdl_value, &mdl->vtbl, value);
+    eq = mcsat_value_eq(&var_mdl_value, trail_get_value(mcsat->trail, var));
+    mcsat_value_destruct(&var_mdl_value);
+    if (!eq) {
+      break;
+    }
+    keep_level = level;
+  }
+
+  delete_int_hset(&assumption_set);
+
+  mcsat->assumptions_decided_level = -1;
+  mcsat_backtrack_to(mcsat, keep_level);
+  if (keep_level > mcsat->trail->decision_level_base) {
+    mcsat->assumptions_decided_level = keep_level;
+    (*mcsat->solver_stats.assumption_levels_kept) += keep_level - mcsat->trail->decision_level_base;
+  }
+
+  if (trace_enabled(mcsat->ctx->trace, "mcsat::incremental")) {
+    mcsat_trace_printf(mcsat->ctx->trace, "mcsat_resume_assumptions(): kept %"PRIu32" levels\n",
+        keep_level - mcsat->trail->decision_level_base);
+  }
+}
+
 void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params, model_t* mdl, uint32_t n_assumptions, const term_t assumptions[]) {
 
   uint32_t restart_resource;
@@ -2521,6 +2626,7 @@ void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params, model_t* mdl, uin
       term_t x_pre = preprocessor_apply(&mcsat->preprocessor, x, NULL, true);
       if (x != x_pre) {
         // Assert x = t although we solved it already :(
+        mcsat_drop_assumptions(mcsat);
         term_t eq = mk_eq(&mcsat->tm, x, x_pre);
         mcsat_assert_formulas_internal(mcsat, 1, &eq, false);
       }
@@ -2535,8 +2641,8 @@ void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params, model_t* mdl, uin
   mcsat->interpolant = NULL_TERM;
   mcsat->variable_in_conflict = variable_null;
   mcsat->assumption_i = 0;
-  mcsat->assumptions_decided_level = -1;
   mcsat->assumptions_model = mdl;
+  mcsat_resume_assumptions(mcsat, mdl);
 
   // Start the search
   mcsat->status = STATUS_SEARCHING;
@@ -2651,9 +2757,10 @@ void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params, model_t* mdl, uin
 
   if (mcsat->stop_search) {
     if (mcsat->status == STATUS_SEARCHING) {
-      mcsat->status = STATUS_INTERRUPTED;
+      mcsat->status = mcsat->search_incomplete ? STATUS_UNKNOWN : STATUS_INTERRUPTED;
     }
     mcsat->stop_search = false;
+    mcsat->search_incomplete = false;
   }
 
   // Make sure any additional terms are registered
@@ -2732,6 +2839,7 @@ void mcsat_assert_formulas_internal(mcsat_solver_t* mcsat, uint32_t n, const ter
 }
 
 int32_t mcsat_assert_formulas(mcsat_solver_t* mcsat, uint32_t n, const term_t *f) {
+  mcsat_drop_assumptions(mcsat);
   mcsat_assert_formulas_internal(mcsat, n, f, true);
   mcsat->interpolant = NULL_TERM;
   return CTX_NO_ERROR;
@@ -32,6 +32,7 @@ void trail_construct(mcsat_trail_t* trail, const variable_db_t* var_db) {
   init_ivector(&trail->level, 0);
   init_ivector(&trail->index, 0);
   init_ivector(&trail->id, 0);
+  init_ivector(&trail->bool_value, 0);
   init_ivector(&trail->unassigned, 0);
   trail->inconsistent = false;
 }
@@ -54,6 +55,7 @@ void trail_construct_copy(mcsat_trail_t* trail, const mcsat_trail_t* from) {
   init_ivector_copy(&trail->level, &from->level);
   init_ivector_copy(&trail->index, &from->index);
   init_ivector_copy(&trail->id, &from->id);
+  init_ivector_copy(&trail->bool_value, &from->bool_value);
   init_ivector_copy(&trail->unassigned, &from->unassigned);
   trail->inconsistent = from->inconsistent;
 }
@@ -69,6 +71,7 @@ void trail_destruct(mcsat_trail_t* trail) {
   delete_ivector(&trail->level);
   delete_ivector(&trail->index);
   delete_ivector(&trail->id);
+  delete_ivector(&trail->bool_value);
   delete_ivector(&trail->unassigned);
 }
 
@@ -81,6 +84,7 @@ void trail_new_variable_notify(mcsat_trail_t* trail, variable_t x) {
     ivector_push(&trail->level, -1);
     ivector_push(&trail->index, -1);
     ivector_push(&trail->id, -1);
+    ivector_push(&trail->bool_value, -1);
   }
 }
 
@@ -171,6 +175,9 @@ void trail_set_value(mcsat_trail_t* trail, variable_t x, const mcsat_value_t* va
   // Set the value
   assert(value->type != VALUE_BOOLEAN || variable_db_is_boolean(trail->var_db, x));
   mcsat_model_set_value(&trail->model, x, value);
+  if (value->type == VALUE_BOOLEAN) {
+    trail->bool_value.data[x] = value->b;
+  }
 }
 
 static inline
@@ -179,6 +186,7 @@ void trail_undo_value(mcsat_trail_t* trail, variable_t x) {
   trail->index.data[x] = -1;
   trail->level.data[x] = -1;
   trail->id.data[x] = -1;
+  trail->bool_value.data[x] = -1;
   ivector_push(&trail->unassigned, x);
 }
 
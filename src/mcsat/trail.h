@@ -76,6 +76,13 @@ struct mcsat_trail_s {
   /** Id of the source of the value */
   ivector_t id;
 
+  /**
+   * Boolean values per variable, kept next to the level/index arrays so that
+   * Boolean propagation doesn't go through the model values: 1 for true, 0
+   * for false and -1 if unassigned or not Boolean.
+   */
+  ivector_t bool_value;
+
   /** List of unassigned variables */
   ivector_t unassigned;
 
@@ -214,9 +221,20 @@ uint32_t trail_get_value_timestamp(const mcsat_trail_t* trail, variable_t var) {
 /** Get the boolean value of the variable */
 static inline
 bool trail_get_boolean_value(const mcsat_trail_t* trail, variable_t var) {
-  const mcsat_value_t* value = trail_get_value(trail, var);
-  assert(value->type == VALUE_BOOLEAN);
-  return value->b;
+  assert(trail_get_value(trail, var)->type == VALUE_BOOLEAN);
+  assert(trail->bool_value.data[var] == trail_get_value(trail, var)->b);
+  return trail->bool_value.data[var];
+}
+
+/**
+ * Get the boolean status of the variable: 1 if assigned to true, 0 if
+ * assigned to false, and -1 if unassigned or not Boolean.
+ */
+static inline
+int32_t trail_get_boolean_status(const mcsat_trail_t* trail, variable_t var) {
+  assert(var < trail->bool_value.size);
+  assert(trail->bool_value.data[var] < 0 || trail_get_value(trail, var)->b == trail->bool_value.data[var]);
+  return trail->bool_value.data[var];
 }
 
 /** Add a new decision x -> value */
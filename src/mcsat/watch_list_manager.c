@@ -18,46 +18,46 @@
  
 #include "mcsat/watch_list_manager.h"
 
+#include "utils/memalloc.h"
+
 void watch_list_manager_construct(watch_list_manager_t* wlm, variable_db_t* var_db) {
   init_ivector(&wlm->vlist_memory, 0);
-  init_pvector(&wlm->wlist_memory, 0);
-  init_ivector(&wlm->all_watchers, 0);
+  wlm->wlist_memory = NULL;
+  wlm->wlist_size = 0;
+  wlm->wlist_capacity = 0;
   init_ivector(&wlm->all_lists, 0);
-  init_int_hmap(&wlm->list_to_constraint_map, 0);
   init_int_hmap(&wlm->constraint_to_list_map, 0);
   wlm->var_db = var_db;
 }
 
 void watch_list_manager_destruct(watch_list_manager_t* wlm) {
   uint32_t i;
-  delete_int_hmap(&wlm->list_to_constraint_map);
   delete_int_hmap(&wlm->constraint_to_list_map);
-  for (i = 0; i < wlm->wlist_memory.size; ++ i) {
-    ivector_t* list_vector = wlm->wlist_memory.data[i];
-    if (list_vector != NULL) {
-      delete_ivector(list_vector);
-      safe_free(list_vector);
-    }
+  for (i = 0; i < wlm->wlist_size; ++ i) {
+    delete_ivector(wlm->wlist_memory + i);
   }
-  delete_pvector(&wlm->wlist_memory);
+  safe_free(wlm->wlist_memory);
   delete_ivector(&wlm->vlist_memory);
-  delete_ivector(&wlm->all_watchers);
   delete_ivector(&wlm->all_lists);
 }
 
-static
+static inline
 ivector_t* watch_list_manager_get_list_of_lists(watch_list_manager_t* wlm, variable_t watcher) {
-  if (watcher >= wlm->wlist_memory.size) {
+  if (watcher >= wlm->wlist_size) {
     return NULL;
   } else {
-    return wlm->wlist_memory.data[watcher];
+    return wlm->wlist_memory + watcher;
   }
 }
+
 variable_list_ref_t watch_list_manager_new_list(watch_list_manager_t* wlm, const variable_t* list, uint32_t size, variable_t constraint) {
   uint32_t i;
   variable_list_ref_t ref;
 
-  // Reference of the constraint
+  // The constraint goes first
+  ivector_push(&wlm->vlist_memory, constraint);
+
+  // Reference of the list
   ref = wlm->vlist_memory.size;
 
   // Copy the elements and null-terminate
@@ -67,7 +67,6 @@ variable_list_ref_t watch_list_manager_new_list(watch_list_manager_t* wlm, const
   ivector_push(&wlm->vlist_memory, variable_null);
 
   // Remember the association with the constraint
-  int_hmap_add(&wlm->list_to_constraint_map, ref, constraint);
   int_hmap_add(&wlm->constraint_to_list_map, constraint, ref);
 
   // Remember the list
@@ -95,11 +94,9 @@ void watch_list_manager_gc_mark(watch_list_manager_t* wlm, gc_info_t* gc_vars) {
 void watch_list_manager_gc_sweep_lists(watch_list_manager_t* wlm, const gc_info_t* gc_vars) {
 
   gc_info_t gc_lists;
-  int_hmap_t new_list_to_constraint_map;
   int_hmap_t new_constraint_to_list_map;
   variable_list_ref_t new_vlist_top = 0;
 
-  init_int_hmap(&new_list_to_constraint_map, 0);
   init_int_hmap(&new_constraint_to_list_map, 0);
 
   // Relocation of lists
@@ -116,8 +113,9 @@ void watch_list_manager_gc_sweep_lists(watch_list_manager_t* wlm, const gc_info_
     variable_t old_constraint = watch_list_manager_get_constraint(wlm, old_vlist_ref);
     variable_t new_constraint = gc_info_get_reloc(gc_vars, old_constraint);
     if (new_constraint != gc_vars->null_value) {
-      // Add to map list -> constraint
-      int_hmap_add(&new_list_to_constraint_map, new_vlist_top, new_constraint);
+      // Constraint goes first
+      wlm->vlist_memory.data[new_vlist_top ++] = new_constraint;
+      // Add to map constraint -> list
       int_hmap_add(&new_constraint_to_list_map, new_constraint, new_vlist_top);
       // We keep this one
       wlm->all_lists.data[ref_keep ++] = new_vlist_top;
@@ -133,14 +131,12 @@ void watch_list_manager_gc_sweep_lists(watch_list_manager_t* wlm, const gc_info_
     }
   }
   ivector_shrink(&wlm->all_lists, ref_keep);
+  ivector_shrink(&wlm->vlist_memory, new_vlist_top);
 
   // Go through the watchers and update their watchlists using the gc_lists map
-  uint32_t watch_i;
-  for (watch_i = 0; watch_i < wlm->all_watchers.size; ++ watch_i) {
-    variable_t watcher = wlm->all_watchers.data[watch_i];
-    assert(watcher < wlm->wlist_memory.size);
-    ivector_t* wlist = wlm->wlist_memory.data[watcher];
-    assert(wlist != 0);
+  variable_t watcher;
+  for (watcher = 0; watcher < wlm->wlist_size; ++ watcher) {
+    ivector_t* wlist = wlm->wlist_memory + watcher;
     uint32_t wlist_i, wlist_keep;
     for (wlist_i = 0, wlist_keep = 0; wlist_i < wlist->size; wlist_i ++) {
       variable_list_ref_t old_list = wlist->data[wlist_i];
@@ -153,9 +149,7 @@ void watch_list_manager_gc_sweep_lists(watch_list_manager_t* wlm, const gc_info_
     ivector_shrink(wlist, wlist_keep);
   }
 
-  // Swap in the map from lists to constraints
-  delete_int_hmap(&wlm->list_to_constraint_map);
-  wlm->list_to_constraint_map = new_list_to_constraint_map;
+  // Swap in the map from constraints to lists
   delete_int_hmap(&wlm->constraint_to_list_map);
   wlm->constraint_to_list_map = new_constraint_to_list_map;
 
@@ -163,10 +157,8 @@ void watch_list_manager_gc_sweep_lists(watch_list_manager_t* wlm, const gc_info_
 }
 
 variable_t watch_list_manager_get_constraint(watch_list_manager_t* wlm, variable_list_ref_t var_list) {
-  int_hmap_pair_t* find;
-  find = int_hmap_find(&wlm->list_to_constraint_map, var_list);
-  assert(find != NULL);
-  return find->val;
+  assert(var_list > 0 && var_list < wlm->vlist_memory.size);
+  return wlm->vlist_memory.data[var_list - 1];
 }
 
 bool watch_list_manager_has_constraint(watch_list_manager_t* wlm, variable_t constraint) {
@@ -186,27 +178,24 @@ variable_t* watch_list_manager_get_list(watch_list_manager_t* wlm, variable_list
 
 void watch_list_manager_add_to_watch(watch_list_manager_t* wlm, variable_list_ref_t var_list, variable_t watcher) {
   assert(watcher != variable_null);
-  if (watcher >= wlm->wlist_memory.size) {
-    // Extend the vector if necessary (fill with NULL)
-    size_t new_size = wlm->wlist_memory.size;
-    while (watcher >= new_size) {
-      new_size = new_size + new_size / 2 + 1;
+  if (watcher >= wlm->wlist_size) {
+    // Extend the vector if necessary (fill with empty lists)
+    if (watcher >= wlm->wlist_capacity) {
+      uint32_t new_capacity = wlm->wlist_capacity;
+      while (watcher >= new_capacity) {
+        new_capacity = new_capacity + new_capacity / 2 + 1;
+      }
+      wlm->wlist_memory = (ivector_t*) safe_realloc(wlm->wlist_memory, new_capacity * sizeof(ivector_t));
+      wlm->wlist_capacity = new_capacity;
     }
-    resize_pvector(&wlm->wlist_memory, new_size);
-    while (watcher >= wlm->wlist_memory.size) {
-      pvector_push(&wlm->wlist_memory, NULL);
+    while (watcher >= wlm->wlist_size) {
+      init_ivector(wlm->wlist_memory + wlm->wlist_size, 0);
+      wlm->wlist_size ++;
     }
   }
 
-  // Create the new vector if not there
-  if (wlm->wlist_memory.data[watcher] == NULL) {
-    wlm->wlist_memory.data[watcher] = safe_malloc(sizeof(ivector_t));
-    init_ivector(wlm->wlist_memory.data[watcher], 0);
-    ivector_push(&wlm->all_watchers, watcher);
-  }
-
   // Add the variable list to the watch-list for the watcher
-  ivector_push(wlm->wlist_memory.data[watcher], var_list);
+  ivector_push(wlm->wlist_memory + watcher, var_list);
 }
 
 void remove_iterator_construct(remove_iterator_t* it, watch_list_manager_t* wlm, variable_t watcher) {
@@ -222,7 +211,7 @@ void remove_iterator_destruct(remove_iterator_t* it) {
   }
   ivector_t* current_list = watch_list_manager_get_list_of_lists(it->wlm, it->watcher);
   if (current_list != NULL) {
-    ivector_shrink(it->wlm->wlist_memory.data[it->watcher], it->keep);
+    ivector_shrink(current_list, it->keep);
   }
 }
 
@@ -265,9 +254,9 @@ void watch_list_manager_print(watch_list_manager_t* wlm, FILE* out) {
   variable_t x;
   uint32_t i;
 
-  for (x = 0; x < wlm->wlist_memory.size; ++ x) {
-    ivector_t* list_of_lists = wlm->wlist_memory.data[x];
-    if (list_of_lists) {
+  for (x = 0; x < wlm->wlist_size; ++ x) {
+    ivector_t* list_of_lists = wlm->wlist_memory + x;
+    if (list_of_lists->size > 0) {
       fprintf(out, "lists of ");
       variable_db_print_variable(wlm->var_db, x, out);
       fprintf(out, "\n");
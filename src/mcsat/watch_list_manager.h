@@ -40,27 +40,35 @@ typedef int32_t variable_list_ref_t;
  *
  * For the purposes of such checks there is a remove iterator below, that can
  * be used to remove C_ref from the watch-list of x.
+ *
+ * The lists are stored contiguously in one array, each preceded by its
+ * constraint, so that the constraint and the variables of a watched list
+ * are available without any lookups.
  */
 typedef struct {
 
-  /** Memory where the variable lists are stored (null terminated) */
+  /**
+   * Memory where the variable lists are stored (null terminated). Each list
+   * is preceded by its constraint, i.e. [C, x1, ..., xn, null] with the
+   * reference pointing to x1.
+   */
   ivector_t vlist_memory;
 
   /**
-   * Memory of where all the watch-lists are stored (indexed by variable).
-   * Each variable maps to a ivector of references into vlist_memory.
+   * The watch-lists (indexed by variable), stored inline. Each variable maps
+   * to a vector of references into vlist_memory.
    */
-  pvector_t wlist_memory;
+  ivector_t* wlist_memory;
 
-  /** List of all watchers ever added */
-  ivector_t all_watchers;
+  /** Number of watch-lists */
+  uint32_t wlist_size;
+
+  /** Capacity of wlist_memory */
+  uint32_t wlist_capacity;
 
   /** List of all lists ever created */
   ivector_t all_lists;
 
-  /** Map from variable lists to constraints */
-  int_hmap_t list_to_constraint_map;
-
   /** Map from variable constraints to variable lists */
   int_hmap_t constraint_to_list_map;
 
@@ -0,0 +1,648 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * MODEL-BASED PROJECTION FOR BITVECTORS
+ */
+
+#include <assert.h>
+
+#include "model/bv_projection.h"
+#include "model/model_queries.h"
+#include "terms/bv_constants.h"
+#include "terms/bvarith64_buffer_terms.h"
+#include "terms/bvarith_buffer_terms.h"
+
+
+/*
+ * Initialize: no variables, no literals
+ */
+void init_bv_projector(bv_projector_t *proj, model_t *mdl, term_manager_t *mngr) {
+  proj->mdl = mdl;
+  proj->mngr = mngr;
+  proj->terms = term_manager_get_terms(mngr);
+  init_ivector(&proj->evars, 10);
+  init_ivector(&proj->literals, 10);
+  init_ivector(&proj->residue, 0);
+
+  proj->mode = BVPROJ_ANY;
+  init_ivector(&proj->lb, 10);
+  init_ivector(&proj->lb_strict, 10);
+  init_ivector(&proj->ub, 10);
+  init_ivector(&proj->ub_strict, 10);
+  init_ivector(&proj->diseq, 10);
+  init_ivector(&proj->kept, 10);
+  init_int_hmap(&proj->cache, 0);
+}
+
+
+/*
+ * Delete: free memory
+ */
+void delete_bv_projector(bv_projector_t *proj) {
+  delete_ivector(&proj->evars);
+  delete_ivector(&proj->literals);
+  delete_ivector(&proj->residue);
+  delete_ivector(&proj->lb);
+  delete_ivector(&proj->lb_strict);
+  delete_ivector(&proj->ub);
+  delete_ivector(&proj->ub_strict);
+  delete_ivector(&proj->diseq);
+  delete_ivector(&proj->kept);
+  delete_int_hmap(&proj->cache);
+}
+
+
+/*
+ * Add a variable to eliminate
+ */
+void bvproj_add_var(bv_projector_t *proj, term_t x) {
+  assert(is_pos_term(x) && term_kind(proj->terms, x) == UNINTERPRETED_TERM &&
+         is_bitvector_term(proj->terms, x));
+  ivector_push(&proj->evars, x);
+}
+
+
+/*
+ * Add a literal
+ */
+void bvproj_add_literal(bv_projector_t *proj, term_t t) {
+  assert(is_boolean_term(proj->terms, t));
+  ivector_push(&proj->literals, t);
+}
+
+
+
+/*
+ * OCCURRENCE CHECK
+ */
+
+/*
+ * Check whether y occurs in t
+ * - the results are cached in proj->cache (which must be reset
+ *   when y changes)
+ */
+static bool bvproj_occurs(bv_projector_t *proj, term_t y, term_t t);
+
+static bool bvproj_occurs_in_composite(bv_projector_t *proj, term_t y, composite_term_t *c) {
+  uint32_t i, n;
+
+  n = c->arity;
+  for (i=0; i<n; i++) {
+    if (bvproj_occurs(proj, y, c->arg[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool bvproj_occurs_in_pprod(bv_projector_t *proj, term_t y, pprod_t *p) {
+  uint32_t i, n;
+
+  n = p->len;
+  for (i=0; i<n; i++) {
+    if (bvproj_occurs(proj, y, p->prod[i].var)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool bvproj_occurs_in_arith_poly(bv_projector_t *proj, term_t y, polynomial_t *p) {
+  uint32_t i, n;
+
+  n = p->nterms;
+  for (i=0; i<n; i++) {
+    if (p->mono[i].var != const_idx && bvproj_occurs(proj, y, p->mono[i].var)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool bvproj_occurs_in_bv_poly(bv_projector_t *proj, term_t y, bvpoly_t *p) {
+  uint32_t i, n;
+
+  n = p->nterms;
+  for (i=0; i<n; i++) {
+    if (p->mono[i].var != const_idx && bvproj_occurs(proj, y, p->mono[i].var)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool bvproj_occurs_in_bv64_poly(bv_projector_t *proj, term_t y, bvpoly64_t *p) {
+  uint32_t i, n;
+
+  n = p->nterms;
+  for (i=0; i<n; i++) {
+    if (p->mono[i].var != const_idx && bvproj_occurs(proj, y, p->mono[i].var)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool bvproj_occurs(bv_projector_t *proj, term_t y, term_t t) {
+  term_table_t *terms;
+  int_hmap_pair_t *r;
+  bool result;
+  int32_t i;
+
+  terms = proj->terms;
+  i = index_of(t);
+  if (i == index_of(y)) {
+    return true;
+  }
+
+  r = int_hmap_find(&proj->cache, i);
+  if (r != NULL) {
+    return r->val;
+  }
+
+  switch (kind_for_idx(terms, i)) {
+  case CONSTANT_TERM:
+  case ARITH_CONSTANT:
+  case BV64_CONSTANT:
+  case BV_CONSTANT:
+  case VARIABLE:
+  case UNINTERPRETED_TERM:
+    result = false;
+    break;
+
+  case ARITH_EQ_ATOM:
+  case ARITH_GE_ATOM:
+  case ARITH_IS_INT_ATOM:
+  case ARITH_FLOOR:
+  case ARITH_CEIL:
+  case ARITH_ABS:
+    result = bvproj_occurs(proj, y, integer_value_for_idx(terms, i));
+    break;
+
+  case SELECT_TERM:
+  case BIT_TERM:
+    result = bvproj_occurs(proj, y, select_for_idx(terms, i)->arg);
+    break;
+
+  case POWER_PRODUCT:
+    result = bvproj_occurs_in_pprod(proj, y, pprod_for_idx(terms, i));
+    break;
+
+  case ARITH_POLY:
+    result = bvproj_occurs_in_arith_poly(proj, y, polynomial_for_idx(terms, i));
+    break;
+
+  case BV64_POLY:
+    result = bvproj_occurs_in_bv64_poly(proj, y, bvpoly64_for_idx(terms, i));
+    break;
+
+  case BV_POLY:
+    result = bvproj_occurs_in_bv_poly(proj, y, bvpoly_for_idx(terms, i));
+    break;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+  case APP_TERM:
+  case UPDATE_TERM:
+  case TUPLE_TERM:
+  case EQ_TERM:
+  case DISTINCT_TERM:
+  case FORALL_TERM:
+  case LAMBDA_TERM:
+  case OR_TERM:
+  case XOR_TERM:
+  case ARITH_BINEQ_ATOM:
+  case ARITH_RDIV:
+  case ARITH_IDIV:
+  case ARITH_MOD:
+  case ARITH_DIVIDES_ATOM:
+  case BV_ARRAY:
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+  case BV_EQ_ATOM:
+  case BV_GE_ATOM:
+  case BV_SGE_ATOM:
+    result = bvproj_occurs_in_composite(proj, y, composite_for_idx(terms, i));
+    break;
+
+  default:
+    // not supported (e.g., ARITH_ROOT_ATOM): assume that y occurs
+    result = true;
+    break;
+  }
+
+  int_hmap_add(&proj->cache, i, result);
+
+  return result;
+}
+
+
+
+/*
+ * BOUNDS ON A VARIABLE
+ */
+
+/*
+ * Set the comparison mode for the current variable:
+ * - return false if it's incompatible with the current mode
+ */
+static bool bvproj_set_mode(bv_projector_t *proj, bvproj_mode_t mode) {
+  if (proj->mode == BVPROJ_ANY) {
+    proj->mode = mode;
+  }
+  return proj->mode == mode;
+}
+
+static void bvproj_add_lb(bv_projector_t *proj, term_t t, bool strict) {
+  ivector_push(&proj->lb, t);
+  ivector_push(&proj->lb_strict, strict);
+}
+
+static void bvproj_add_ub(bv_projector_t *proj, term_t t, bool strict) {
+  ivector_push(&proj->ub, t);
+  ivector_push(&proj->ub_strict, strict);
+}
+
+
+/*
+ * Process literal l that contains y:
+ * - if l is a bound on y, store it in lb/ub/diseq and return true
+ * - return false otherwise
+ */
+static bool bvproj_add_bound(bv_projector_t *proj, term_t y, term_t l) {
+  term_table_t *terms;
+  composite_term_t *atom;
+  term_t a, b;
+  bool pos;
+
+  terms = proj->terms;
+  pos = is_pos_term(l);
+
+  switch (term_kind(terms, l)) {
+  case BV_GE_ATOM:
+  case BV_SGE_ATOM:
+    if (!bvproj_set_mode(proj, term_kind(terms, l) == BV_GE_ATOM ? BVPROJ_UNSIGNED : BVPROJ_SIGNED)) {
+      return false;
+    }
+    atom = composite_term_desc(terms, l);
+    assert(atom->arity == 2);
+    a = atom->arg[0];
+    b = atom->arg[1];
+    if (a == y && !bvproj_occurs(proj, y, b)) {
+      // pos: y >= b, neg: y < b
+      if (pos) {
+        bvproj_add_lb(proj, b, false);
+      } else {
+        bvproj_add_ub(proj, b, true);
+      }
+      return true;
+    }
+    if (b == y && !bvproj_occurs(proj, y, a)) {
+      // pos: a >= y, neg: a < y
+      if (pos) {
+        bvproj_add_ub(proj, a, false);
+      } else {
+        bvproj_add_lb(proj, a, true);
+      }
+      return true;
+    }
+    return false;
+
+  case BV_EQ_ATOM:
+    atom = composite_term_desc(terms, l);
+    assert(atom->arity == 2);
+    a = atom->arg[0];
+    b = atom->arg[1];
+    if (b == y) {
+      b = a;
+      a = y;
+    }
+    if (a != y || bvproj_occurs(proj, y, b)) {
+      return false;
+    }
+    if (pos) {
+      bvproj_add_lb(proj, b, false);
+      bvproj_add_ub(proj, b, false);
+    } else {
+      ivector_push(&proj->diseq, b);
+    }
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+
+
+/*
+ * COMPARISONS IN THE MODEL
+ */
+
+/*
+ * Value of t in the model
+ * - return NULL if t can't be evaluated and store the error code in *code
+ */
+static value_bv_t *bvproj_value(bv_projector_t *proj, term_t t, int32_t *code) {
+  value_t v;
+
+  v = model_get_term_value(proj->mdl, t);
+  if (v < 0) {
+    *code = v;
+    return NULL;
+  }
+  return vtbl_bitvector(model_get_vtbl(proj->mdl), v);
+}
+
+/*
+ * Compare two values using the current mode
+ */
+static bool bvproj_value_lt(bv_projector_t *proj, value_bv_t *a, value_bv_t *b) {
+  assert(a->nbits == b->nbits);
+  if (proj->mode == BVPROJ_SIGNED) {
+    return bvconst_slt(a->data, b->data, a->nbits);
+  } else {
+    return bvconst_lt(a->data, b->data, a->nbits);
+  }
+}
+
+
+/*
+ * Select the best bound in vector b (with strict flags in s)
+ * - largest value if upper is false, smallest value otherwise
+ * - if several bounds have the same value, prefer a strict one
+ * - return the index of the bound in b, or -1 if there's an error
+ *   (the error code is stored in *code)
+ */
+static int32_t bvproj_best_bound(bv_projector_t *proj, ivector_t *b, ivector_t *s, bool upper, int32_t *code) {
+  value_bv_t *best, *v;
+  uint32_t i, n;
+  int32_t k;
+
+  n = b->size;
+  assert(n > 0);
+
+  k = 0;
+  best = bvproj_value(proj, b->data[0], code);
+  if (best == NULL) return -1;
+
+  for (i=1; i<n; i++) {
+    v = bvproj_value(proj, b->data[i], code);
+    if (v == NULL) return -1;
+    if ((upper ? bvproj_value_lt(proj, v, best) : bvproj_value_lt(proj, best, v)) ||
+        (s->data[i] && !s->data[k] && !bvproj_value_lt(proj, v, best) && !bvproj_value_lt(proj, best, v))) {
+      best = v;
+      k = i;
+    }
+  }
+
+  return k;
+}
+
+
+
+/*
+ * CONSTRUCTION OF THE RESULT
+ */
+
+/*
+ * Add literal t to kept (unless it's true)
+ */
+static void bvproj_keep(bv_projector_t *proj, term_t t) {
+  if (t != true_term) {
+    ivector_push(&proj->kept, t);
+  }
+}
+
+// a >= b or a > b in the current mode
+static term_t bvproj_mk_ge(bv_projector_t *proj, term_t a, term_t b, bool strict) {
+  if (proj->mode == BVPROJ_SIGNED) {
+    return strict ? mk_bvsgt(proj->mngr, a, b) : mk_bvsge(proj->mngr, a, b);
+  } else {
+    return strict ? mk_bvgt(proj->mngr, a, b) : mk_bvge(proj->mngr, a, b);
+  }
+}
+
+/*
+ * Smallest or largest constant of n bits in the current mode
+ */
+static term_t bvproj_mk_extremum(bv_projector_t *proj, uint32_t n, bool largest) {
+  bvconstant_t c;
+  term_t t;
+
+  init_bvconstant(&c);
+  if (proj->mode == BVPROJ_SIGNED) {
+    bvconstant_set_all_zero(&c, n);
+    if (largest) {
+      bvconst_set_max_signed(c.data, n);
+    } else {
+      bvconst_set_min_signed(c.data, n);
+    }
+  } else if (largest) {
+    bvconstant_set_all_one(&c, n);
+  } else {
+    bvconstant_set_all_zero(&c, n);
+  }
+  t = mk_bv_constant(proj->mngr, &c);
+  delete_bvconstant(&c);
+
+  return t;
+}
+
+/*
+ * Term t + 1
+ */
+static term_t bvproj_mk_succ(bv_projector_t *proj, term_t t) {
+  bvarith64_buffer_t *b64;
+  bvarith_buffer_t *b;
+  bvconstant_t one;
+  uint32_t n;
+
+  n = term_bitsize(proj->terms, t);
+  if (n <= 64) {
+    b64 = term_manager_get_bvarith64_buffer(proj->mngr);
+    bvarith64_buffer_set_term(b64, proj->terms, t);
+    bvarith64_buffer_add_const(b64, 1);
+    return mk_bvarith64_term(proj->mngr, b64);
+  } else {
+    init_bvconstant(&one);
+    bvconstant_copy64(&one, n, 1);
+    b = term_manager_get_bvarith_buffer(proj->mngr);
+    bvarith_buffer_set_term(b, proj->terms, t);
+    bvarith_buffer_add_const(b, one.data);
+    delete_bvconstant(&one);
+    return mk_bvarith_term(proj->mngr, b);
+  }
+}
+
+
+/*
+ * Eliminate y from the literals
+ * - return 1 if y is eliminated, 0 if it can't be eliminated
+ * - return a negative code if there's an evaluation error
+ */
+static int32_t bvproj_elim_var(bv_projector_t *proj, term_t y) {
+  value_bv_t *vy, *vt;
+  uint32_t i, n;
+  int32_t l, u, code;
+  term_t t, lo, up;
+  bool ls, us;
+
+  proj->mode = BVPROJ_ANY;
+  ivector_reset(&proj->lb);
+  ivector_reset(&proj->lb_strict);
+  ivector_reset(&proj->ub);
+  ivector_reset(&proj->ub_strict);
+  ivector_reset(&proj->diseq);
+  ivector_reset(&proj->kept);
+  int_hmap_reset(&proj->cache);
+
+  n = proj->literals.size;
+  for (i=0; i<n; i++) {
+    t = proj->literals.data[i];
+    if (!bvproj_occurs(proj, y, t)) {
+      ivector_push(&proj->kept, t);
+    } else if (!bvproj_add_bound(proj, y, t)) {
+      return 0;
+    }
+  }
+
+  code = 0;
+
+  // replace the disequalities by strict bounds
+  n = proj->diseq.size;
+  if (n > 0) {
+    vy = bvproj_value(proj, y, &code);
+    if (vy == NULL) return code;
+    for (i=0; i<n; i++) {
+      t = proj->diseq.data[i];
+      vt = bvproj_value(proj, t, &code);
+      if (vt == NULL) return code;
+      if (bvproj_value_lt(proj, vy, vt)) {
+        bvproj_add_ub(proj, t, true);
+      } else {
+        bvproj_add_lb(proj, t, true);
+      }
+    }
+  }
+
+  lo = NULL_TERM; // prevent GCC warnings
+  up = NULL_TERM;
+  ls = false;
+  us = false;
+
+  l = -1;
+  if (proj->lb.size > 0) {
+    l = bvproj_best_bound(proj, &proj->lb, &proj->lb_strict, false, &code);
+    if (l < 0) return code;
+  }
+  u = -1;
+  if (proj->ub.size > 0) {
+    u = bvproj_best_bound(proj, &proj->ub, &proj->ub_strict, true, &code);
+    if (u < 0) return code;
+  }
+
+  // the best lower bound implies all the others
+  if (l >= 0) {
+    lo = proj->lb.data[l];
+    ls = proj->lb_strict.data[l];
+    n = proj->lb.size;
+    for (i=0; i<n; i++) {
+      if (i != (uint32_t) l) {
+        bvproj_keep(proj, bvproj_mk_ge(proj, lo, proj->lb.data[i], proj->lb_strict.data[i] && !ls));
+      }
+    }
+  }
+
+  // same thing for the upper bounds
+  if (u >= 0) {
+    up = proj->ub.data[u];
+    us = proj->ub_strict.data[u];
+    n = proj->ub.size;
+    for (i=0; i<n; i++) {
+      if (i != (uint32_t) u) {
+        bvproj_keep(proj, bvproj_mk_ge(proj, proj->ub.data[i], up, proj->ub_strict.data[i] && !us));
+      }
+    }
+  }
+
+  // the interval must not be empty
+  if (l >= 0 && u >= 0) {
+    bvproj_keep(proj, bvproj_mk_ge(proj, up, lo, ls || us));
+    if (ls && us) {
+      // lo < y < up: lo + 1 doesn't overflow since lo < up
+      bvproj_keep(proj, bvproj_mk_ge(proj, up, bvproj_mk_succ(proj, lo), true));
+    }
+  } else if (l >= 0 && ls) {
+    n = term_bitsize(proj->terms, y);
+    bvproj_keep(proj, bvproj_mk_ge(proj, bvproj_mk_extremum(proj, n, true), lo, true));
+  } else if (u >= 0 && us) {
+    n = term_bitsize(proj->terms, y);
+    bvproj_keep(proj, bvproj_mk_ge(proj, up, bvproj_mk_extremum(proj, n, false), true));
+  }
+
+  // the new literals replace the old ones
+  ivector_reset(&proj->literals);
+  ivector_copy(&proj->literals, proj->kept.data, proj->kept.size);
+
+  return 1;
+}
+
+
+/*
+ * Eliminate all the variables we can
+ */
+int32_t bvproj_eliminate(bv_projector_t *proj) {
+  uint32_t i, n;
+  int32_t code;
+  term_t x;
+
+  n = proj->evars.size;
+  for (i=0; i<n; i++) {
+    x = proj->evars.data[i];
+    code = bvproj_elim_var(proj, x);
+    if (code < 0) {
+      return code;
+    }
+    if (code == 0) {
+      ivector_push(&proj->residue, x);
+    }
+  }
+
+  return 0;
+}
+
+
+/*
+ * Collect the results
+ */
+void bvproj_get_formula_vector(bv_projector_t *proj, ivector_t *v) {
+  ivector_add(v, proj->literals.data, proj->literals.size);
+}
+
+void bvproj_get_residual_vars(bv_projector_t *proj, ivector_t *v) {
+  ivector_add(v, proj->residue.data, proj->residue.size);
+}
@@ -0,0 +1,147 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * MODEL-BASED PROJECTION FOR BITVECTORS
+ *
+ * Given a conjunction of literals A(X, Y) where Y are bitvector
+ * variables, and a model M of A, this module eliminates variables
+ * of Y from A. The result is a conjunction E such that E is true in M
+ * and E => EXISTS Y: A(X, Y).
+ *
+ * A variable y is eliminated if all the literals that contain y
+ * are bounds on y, that is, literals of one of the forms
+ *    (bvge y t), (bvge t y), (bvsge y t), (bvsge t y),
+ *    (= y t), or the negation of such literals
+ * where y does not occur in t. Unsigned and signed bounds can't be
+ * mixed. A disequality (/= y t) is replaced by (< y t) or (> t y)
+ * depending on the values of y and t in M.
+ *
+ * The literals then define an interval: L_1, ..., L_k <= y <= U_1, ... U_m
+ * (some bounds may be strict). If L is the largest lower bound and U is
+ * the smallest upper bound in M, we replace the bounds on y by
+ *    L_i <= L for all i, U <= U_j for all j, and L <= U
+ * (adjusted for strict bounds). Since comparisons are modulo 2^n,
+ * this is exact: no bound wraps around.
+ *
+ * Any other occurrence of y (e.g., y in an arithmetic or logical
+ * operation) prevents elimination. Such variables are left in the
+ * literals and reported as residual variables.
+ */
+
+#ifndef __BV_PROJECTION_H
+#define __BV_PROJECTION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "model/models.h"
+#include "terms/term_manager.h"
+#include "utils/int_hash_map.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Comparison mode for the bounds on a variable
+ */
+typedef enum bvproj_mode {
+  BVPROJ_ANY,       // only equalities/disequalities so far
+  BVPROJ_UNSIGNED,
+  BVPROJ_SIGNED,
+} bvproj_mode_t;
+
+
+/*
+ * Projector:
+ * - mdl = model
+ * - mngr = term manager + terms = its term table
+ * - evars = variables to eliminate
+ * - literals = current set of literals
+ * - residue = variables that could not be eliminated
+ *
+ * Data for the variable being eliminated:
+ * - lb = lower bounds, lb_strict[i] = 1 if lb[i] is strict
+ * - ub = upper bounds, ub_strict[i] = 1 if ub[i] is strict
+ * - diseq = terms t such that (/= y t) is a literal
+ * - kept = literals that don't contain y
+ * - cache = occurrence check cache
+ */
+typedef struct bv_projector_s {
+  model_t *mdl;
+  term_manager_t *mngr;
+  term_table_t *terms;
+  ivector_t evars;
+  ivector_t literals;
+  ivector_t residue;
+
+  bvproj_mode_t mode;
+  ivector_t lb;
+  ivector_t lb_strict;
+  ivector_t ub;
+  ivector_t ub_strict;
+  ivector_t diseq;
+  ivector_t kept;
+  int_hmap_t cache;
+} bv_projector_t;
+
+
+/*
+ * Initialize: no variables, no literals
+ * - mdl = model that satisfies all the literals
+ * - mngr = term manager
+ */
+extern void init_bv_projector(bv_projector_t *proj, model_t *mdl, term_manager_t *mngr);
+
+/*
+ * Delete: free memory
+ */
+extern void delete_bv_projector(bv_projector_t *proj);
+
+/*
+ * Add variable x to eliminate
+ * - x must be an uninterpreted term of bitvector type
+ */
+extern void bvproj_add_var(bv_projector_t *proj, term_t x);
+
+/*
+ * Add literal t
+ * - t must be true in the model
+ */
+extern void bvproj_add_literal(bv_projector_t *proj, term_t t);
+
+/*
+ * Eliminate as many variables as possible
+ * - the variables that can't be eliminated are stored in proj->residue
+ * - return a negative value if the model can't be evaluated
+ *   (this is the error code from the evaluator), 0 otherwise.
+ */
+extern int32_t bvproj_eliminate(bv_projector_t *proj);
+
+/*
+ * Add the resulting literals to vector v
+ */
+extern void bvproj_get_formula_vector(bv_projector_t *proj, ivector_t *v);
+
+/*
+ * Add the residual variables to vector v
+ */
+extern void bvproj_get_residual_vars(bv_projector_t *proj, ivector_t *v);
+
+
+#endif /* __BV_PROJECTION_H */
@@ -33,6 +33,8 @@
  * NOTE: we could use model-based projection in both cases, but
  * experiments with the exists/forall solver seem to show that
  * substitution works better for Boolean and bitvector variables.
+ * Bitvector variables are handled by projection (cf. bv_projection.h)
+ * only when gen_model_by_projection is called directly.
  */
 
 #include <assert.h>
@@ -26,6 +26,24 @@
 #include "utils/memalloc.h"
 
 
+/*
+ * Persistent evaluator attached to mdl: allocate it if needed
+ * - its cache survives from one query to the next until the model
+ *   is modified or a garbage collection happens (cf. models.h)
+ */
+static evaluator_t *model_evaluator(model_t *mdl) {
+  evaluator_t *eval;
+
+  eval = mdl->evaluator;
+  if (eval == NULL) {
+    eval = (evaluator_t *) safe_malloc(sizeof(evaluator_t));
+    init_evaluator(eval, mdl);
+    mdl->evaluator = eval;
+  }
+  return eval;
+}
+
+
 /*
  * Get the value of t in mdl
  * - this function first tries a simple lookup in mdl. If that fails,
@@ -39,14 +57,11 @@
  * Returns an index in mdl->vtbl otherwise (concrete value).
  */
 value_t model_get_term_value(model_t *mdl, term_t t) {
-  evaluator_t evaluator;
   value_t v;
 
   v = model_find_term_value(mdl, t);
   if (v == null_value) {
-    init_evaluator(&evaluator, mdl);
-    v = eval_in_model(&evaluator, t);
-    delete_evaluator(&evaluator);
+    v = eval_in_model(model_evaluator(mdl), t);
   }
 
   return v;
@@ -86,7 +101,7 @@ bool formula_holds_in_model(model_t *mdl, term_t f, int32_t *code) {
  * - return 0 otherwise.
  */
 int32_t evaluate_term_array(model_t *mdl, uint32_t n, const term_t a[], value_t b[]) {
-  evaluator_t evaluator;
+  evaluator_t *evaluator;
   uint32_t i, k;
   value_t v;
 
@@ -108,20 +123,18 @@ int32_t evaluate_term_array(model_t *mdl, uint32_t n, const term_t a[], value_t
   /*
    * Second pass: if k > 0, use the evaluator to complete array b
    * Stop on the first error if any
+   * - all terms share the evaluator's cache so common subterms
+   *   are evaluated once.
    */
   if (k > 0) {
-    init_evaluator(&evaluator, mdl);
+    evaluator = model_evaluator(mdl);
     for (i=0; i<n; i++) {
       if (b[i] < 0) {
-	v = eval_in_model(&evaluator, a[i]);
+	v = eval_in_model(evaluator, a[i]);
 	b[i] = v;
-	if (v < 0) break;
+	if (v < 0) return v;
       }
     }
-    delete_evaluator(&evaluator);
-    if (v < 0) {
-      return v;
-    }
   }
 
   return 0;
@@ -135,7 +148,7 @@ int32_t evaluate_term_array(model_t *mdl, uint32_t n, const term_t a[], value_t
  *   the corresponding error code in *code
  */
 bool formulas_hold_in_model(model_t *mdl, uint32_t n, const term_t a[], int32_t *code) {
-  evaluator_t evaluator;
+  evaluator_t *evaluator;
   value_table_t *vtbl;
   uint32_t i;
   value_t v;
@@ -145,10 +158,10 @@ bool formulas_hold_in_model(model_t *mdl, uint32_t n, const term_t a[], int32_t
   *code = 0;
 
   vtbl = model_get_vtbl(mdl);
-  init_evaluator(&evaluator, mdl);
+  evaluator = model_evaluator(mdl);
   for (i=0; i<n; i++) {
     assert(is_boolean_term(mdl->terms, a[i]));
-    v = eval_in_model(&evaluator, a[i]);
+    v = eval_in_model(evaluator, a[i]);
     if (v < 0) {
       answer = false;
       *code = v;
@@ -159,7 +172,6 @@ bool formulas_hold_in_model(model_t *mdl, uint32_t n, const term_t a[], int32_t
       break;
     }
   }
-  delete_evaluator(&evaluator);
 
   return answer;
 }
@@ -24,6 +24,7 @@
 #include <inttypes.h>
 #include <string.h>
 
+#include "model/model_eval.h"
 #include "model/models.h"
 #include "utils/memalloc.h"
 
@@ -51,7 +52,7 @@ static const char *name_of_const(term_table_t *terms, value_unint_t *d) {
  * - terms = attached term table
  * - keep_subst = whether to support alias_map or not
  * - map and vtbl are given default sizes
- * - alias_map is NULL
+ * - alias_map and evaluator are NULL
  */
 void init_model(model_t *model, term_table_t *terms, bool keep_subst) {
   init_value_table(&model->vtbl, 0, terms->types);
@@ -59,6 +60,7 @@ void init_model(model_t *model, term_table_t *terms, bool keep_subst) {
 
   init_int_hmap(&model->map, 0);
   model->alias_map = NULL;
+  model->evaluator = NULL;
   model->terms = terms;
   model->has_alias = keep_subst;
 
@@ -76,6 +78,7 @@ void delete_model(model_t *model) {
     safe_free(model->alias_map);
     model->alias_map = NULL;
   }
+  model_clear_eval_cache(model);
 }
 
 
@@ -139,6 +142,8 @@ void model_map_term(model_t *model, term_t t, value_t v) {
 
   assert(good_term(model->terms, t));
 
+  model_clear_eval_cache(model);
+
   r = int_hmap_get(&model->map, t);
   assert(r->val < 0);
   r->val = v;
@@ -170,6 +175,8 @@ void model_add_substitution(model_t *model, term_t t, term_t u) {
          good_term(model->terms, u) && t != u && model->has_alias &&
          int_hmap_find(&model->map, t) == NULL);
 
+  model_clear_eval_cache(model);
+
   alias = model->alias_map;
   if (alias == NULL) {
     alias = (int_hmap_t *) safe_malloc(sizeof(int_hmap_t));
@@ -183,6 +190,18 @@ void model_add_substitution(model_t *model, term_t t, term_t u) {
 }
 
 
+/*
+ * Delete the persistent evaluator
+ */
+void model_clear_eval_cache(model_t *model) {
+  if (model->evaluator != NULL) {
+    delete_evaluator(model->evaluator);
+    safe_free(model->evaluator);
+    model->evaluator = NULL;
+  }
+}
+
+
 /*
  * ITERATOR
  */
@@ -282,8 +301,10 @@ static void mdl_mark_alias(void *aux, const int_hmap_pair_t *r) {
  * Prepare for garbage collection: mark all the terms present in model
  * - all marked terms will be considered as roots on the next call
  *   to term_table_gc
+ * - the evaluation cache is emptied (it may refer to dead terms)
  */
 void model_gc_mark(model_t *model) {
+  model_clear_eval_cache(model);
   int_hmap_iterate(&model->map, model->terms, mdl_mark_map);
   if (model->alias_map != NULL) {
     int_hmap_iterate(model->alias_map, model->terms, mdl_mark_alias);
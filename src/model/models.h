@@ -57,11 +57,16 @@
  * - has_alias: flag true if the model is intended to support
  *   the internal substitution table (alias_map). (NOTE: has_alias
  *   is set at construction time and it may be true even if alias_map is NULL).
+ * - evaluator = persistent evaluator used by the queries in model_queries.h
+ *   (allocated on demand). Its cache keeps the values of all terms evaluated
+ *   so far so that repeated queries on the same model don't evaluate
+ *   shared subterms again.
  */
 struct model_s {
   value_table_t vtbl;
   int_hmap_t map;
   int_hmap_t *alias_map;
+  struct evaluator_s *evaluator;
   term_table_t *terms;
   bool has_alias;
 };
@@ -72,7 +77,7 @@ struct model_s {
  * - terms = attached term table
  * - keep_subst = whether to support alias_map or not
  * - map and vtbl are given default sizes
- * - alias_map is NULL
+ * - alias_map and evaluator are NULL
  */
 extern void init_model(model_t *model, term_table_t *terms, bool keep_subst);
 
@@ -130,6 +135,14 @@ extern void model_map_term(model_t *model, term_t t, value_t v);
 extern void model_add_substitution(model_t *model, term_t t, term_t u);
 
 
+/*
+ * Delete the persistent evaluator and its cache
+ * - this is called by model_map_term and model_add_substitution since
+ *   the cached values may depend on a default value given to t
+ */
+extern void model_clear_eval_cache(model_t *model);
+
+
 /*
  * Iteration: call f(aux, t) for every term t stored in the model
  * - this includes every t in model->map (term mapped to a value)
@@ -160,6 +173,8 @@ extern void model_collect_terms(model_t *model, bool all, void *aux, model_filte
  * Prepare for garbage collection: mark all the terms present in model
  * - all marked terms will be considered as roots on the next call
  *   to term_table_gc
+ * - the evaluation cache is not a root: it's emptied since it may
+ *   refer to terms that will be deleted.
  */
 extern void model_gc_mark(model_t *model);
 
@@ -118,6 +118,7 @@ void init_projector(projector_t *proj, model_t *mdl, term_manager_t *mngr, uint3
   init_ivector(&proj->buffer, 10);
   proj->elim_subst = NULL;
   proj->arith_proj = NULL;
+  proj->bv_proj = NULL;
   proj->val_subst = NULL;
 
   proj->is_presburger = true;  
@@ -170,6 +171,19 @@ static void proj_build_arith_proj(projector_t *proj) {
   proj->arith_proj = tmp;
 }
 
+/*
+ * Allocate and initialize bv_proj
+ */
+static void proj_build_bv_proj(projector_t *proj) {
+  bv_projector_t *tmp;
+
+  assert(proj->bv_proj == NULL);
+
+  tmp = (bv_projector_t *) safe_malloc(sizeof(bv_projector_t));
+  init_bv_projector(tmp, proj->mdl, proj->mngr);
+  proj->bv_proj = tmp;
+}
+
 /*
  * Allocate and initialize presburger projector
  * - use default sizes
@@ -257,6 +271,14 @@ static void proj_delete_arith_proj(projector_t *proj) {
   }
 }
 
+static void proj_delete_bv_proj(projector_t *proj) {
+  if (proj->bv_proj != NULL) {
+    delete_bv_projector(proj->bv_proj);
+    safe_free(proj->bv_proj);
+    proj->bv_proj = NULL;
+  }
+}
+
 static void proj_delete_presburger_proj(projector_t *proj) {
   if (proj->presburger != NULL) {
     delete_presburger_projector(proj->presburger);
@@ -286,6 +308,7 @@ void delete_projector(projector_t *proj) {
 
   proj_delete_elim_subst(proj);
   proj_delete_arith_proj(proj);
+  proj_delete_bv_proj(proj);
   proj_delete_val_subst(proj);
   proj_delete_presburger_proj(proj);
 }
@@ -682,6 +705,77 @@ static void proj_process_presburger_literals(projector_t *proj) {
 
 
 
+/*
+ * BITVECTORS
+ */
+
+/*
+ * Eliminate the bitvector variables that occur only in bounds
+ * - the variables that can't be eliminated are kept in proj->evars
+ */
+static void proj_process_bv_literals(projector_t *proj) {
+  bv_projector_t *bvproj;
+  term_table_t *terms;
+  uint32_t i, j, n;
+  term_t x;
+  int32_t code;
+
+  proj_build_bv_proj(proj);
+  bvproj = proj->bv_proj;
+
+  // move the bitvector variables from proj->evars to bvproj
+  terms = proj->terms;
+  n = proj->num_evars;
+  j = 0;
+  for (i=0; i<n; i++) {
+    x = proj->evars[i];
+    if (is_bitvector_term(terms, x)) {
+      bvproj_add_var(bvproj, x);
+    } else {
+      proj->evars[j] = x;
+      j ++;
+    }
+  }
+  proj->num_evars = j;
+
+  if (bvproj->evars.size == 0) {
+    goto done;
+  }
+
+  n = proj->gen_literals.size;
+  for (i=0; i<n; i++) {
+    bvproj_add_literal(bvproj, proj->gen_literals.data[i]);
+  }
+  code = bvproj_eliminate(bvproj);
+  if (code < 0) {
+    proj_error(proj, PROJ_ERROR_IN_EVAL, code);
+    goto done;
+  }
+
+  // collect the result in proj->gen_literals
+  ivector_reset(&proj->gen_literals);
+  bvproj_get_formula_vector(bvproj, &proj->gen_literals);
+
+  // put back the residual variables: they'll be replaced by their value
+  ivector_reset(&proj->buffer);
+  bvproj_get_residual_vars(bvproj, &proj->buffer);
+  n = proj->buffer.size;
+  for (i=0; i<n; i++) {
+    proj->evars[j] = proj->buffer.data[i];
+    j ++;
+  }
+  proj->num_evars = j;
+
+#if TRACE
+  printf("[1]  --> bv projection: %"PRIu32" residual variables\n", n);
+  fflush(stdout);
+#endif
+
+ done:
+  proj_delete_bv_proj(proj);
+}
+
+
 
 /*
  * LAST PHASE
@@ -752,8 +846,12 @@ proj_flag_t run_projector(projector_t *proj, ivector_t *v) {
     }
   }
 
+  if (proj->flag == NO_ERROR && proj->num_evars > 0 && proj->gen_literals.size > 0) {
+    proj_process_bv_literals(proj);
+  }
+
   if (proj->flag == NO_ERROR && proj->num_evars > 0) {  
-    // some variables were not eliminated in the first two phases
+    // some variables were not eliminated in the first three phases
     // replace them by their value in the model
     proj_elim_by_model_value(proj);
   } 
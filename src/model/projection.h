@@ -31,7 +31,9 @@
  * The quantifier elimination is based on substitution (for Boolean
  * variables) and on arithmetic elimination using a mix of
  * substitution, Fourier-Motkin, and Virtual Term Substitution (as
- * implemented in arith_projection).
+ * implemented in arith_projection). Bitvector variables that occur
+ * only in bounds are eliminated by interval projection (as implemented
+ * in bv_projection).
  */
 
 #ifndef __PROJECTION_H
@@ -40,6 +42,7 @@
 #include <stdint.h>
 
 #include "model/arith_projection.h"
+#include "model/bv_projection.h"
 #include "model/presburger.h"
 #include "model/models.h"
 #include "terms/elim_subst.h"
@@ -81,6 +84,7 @@ typedef enum {
  * Auxiliary data structures (allocated when needed).
  * - elim_subst: eliminate Boolean/bitvector variables by substitution
  * - arith_proj: to eliminate arithmetic variables
+ * - bv_proj: to eliminate bitvector variables
  * - val_subst: to eliminate whatever is left (replace Y by its value
  *   in the model).
  */
@@ -110,6 +114,7 @@ typedef struct projector_s {
   ivector_t buffer;
   elim_subst_t *elim_subst;
   arith_projector_t *arith_proj;
+  bv_projector_t *bv_proj;
   term_subst_t *val_subst;
 
   //cooper playground
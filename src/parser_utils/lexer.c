@@ -76,6 +76,15 @@ void init_stream_lexer(lexer_t *lex, FILE *f, const char *name) {
 }
 
 
+/*
+ * Same thing, with read ahead
+ */
+void init_read_ahead_lexer(lexer_t *lex, FILE *f, const char *name) {
+  init_read_ahead_reader(&lex->reader, f, name);
+  init_lexer(lex);
+}
+
+
 #if 0
 /*
  * HACK/EXPERIMENT: use UTF-8 encoded input
@@ -189,6 +198,7 @@ int close_lexer(lexer_t *lex) {
  * - if lex->next is NULL (toplevel lexer), delete the internal buffer
  */
 void close_lexer_only(lexer_t *lex) {
+  close_reader_only(&lex->reader);
   if (lex->next == NULL) {
     if (lex->buffer != NULL) {
       delete_string_buffer(lex->buffer);
@@ -93,6 +93,11 @@ extern int32_t init_file_lexer(lexer_t *lex, const char *filename);
  */
 extern void init_stream_lexer(lexer_t *lex, FILE *f,  const char *name);
 
+/*
+ * Variant: read f in a separate thread (see init_read_ahead_reader)
+ */
+extern void init_read_ahead_lexer(lexer_t *lex, FILE *f, const char *name);
+
 /*
  * Use stdin
  */
@@ -199,13 +199,14 @@ static uint32_t clause_length(clause_t *cl) {
  * \param len = number of literals
  * \param lit = array of len literals
  * The watched pointers are not initialized
+ * The clause is allocated in s->clause_region
  */
-static clause_t *new_clause(uint32_t len, literal_t *lit) {
+static clause_t *new_clause(smt_core_t *s, uint32_t len, literal_t *lit) {
   clause_t *result;
   uint32_t i;
 
-  result = (clause_t *) safe_malloc(sizeof(clause_t) + sizeof(literal_t) +
-                                    len * sizeof(literal_t));
+  result = (clause_t *) objregion_alloc(&s->clause_region, sizeof(clause_t) + sizeof(literal_t) +
+                                        len * sizeof(literal_t));
 
   for (i=0; i<len; i++) {
     result->cl[i] = lit[i];
@@ -219,8 +220,8 @@ static clause_t *new_clause(uint32_t len, literal_t *lit) {
  * Delete clause cl
  * cl must be a non-learned clause, allocated via the previous function.
  */
-static inline void delete_clause(clause_t *cl) {
-  safe_free(cl);
+static inline void delete_clause(smt_core_t *s, clause_t *cl) {
+  objregion_free(&s->clause_region, cl);
 }
 
 /*
@@ -230,13 +231,13 @@ static inline void delete_clause(clause_t *cl) {
  * The watched pointers are not initialized.
  * The activity is initialized to 0.0
  */
-static clause_t *new_learned_clause(uint32_t len, literal_t *lit) {
+static clause_t *new_learned_clause(smt_core_t *s, uint32_t len, literal_t *lit) {
   learned_clause_t *tmp;
   clause_t *result;
   uint32_t i;
 
-  tmp = (learned_clause_t *) safe_malloc(sizeof(learned_clause_t) + sizeof(literal_t) +
-                                         len * sizeof(literal_t));
+  tmp = (learned_clause_t *) objregion_alloc(&s->clause_region, sizeof(learned_clause_t) + sizeof(literal_t) +
+                                             len * sizeof(literal_t));
   tmp->activity = 0.0;
   result = &(tmp->clause);
 
@@ -252,8 +253,8 @@ static clause_t *new_learned_clause(uint32_t len, literal_t *lit) {
  * Delete learned clause cl
  * cl must have been allocated via the new_learned_clause function
  */
-static inline void delete_learned_clause(clause_t *cl) {
-  safe_free(learned(cl));
+static inline void delete_learned_clause(smt_core_t *s, clause_t *cl) {
+  objregion_free(&s->clause_region, learned(cl));
 }
 
 
@@ -1538,6 +1539,7 @@ void init_smt_core(smt_core_t *s, uint32_t n, void *th,
   s->bad_assumption = null_literal;
 
   // clause database: all empty
+  init_objregion(&s->clause_region);
   s->problem_clauses = new_clause_vector(DEF_CLAUSE_VECTOR_SIZE);
   s->learned_clauses = new_clause_vector(DEF_CLAUSE_VECTOR_SIZE);
   init_ivector(&s->binary_clauses, 0);
@@ -1590,8 +1592,15 @@ void init_smt_core(smt_core_t *s, uint32_t n, void *th,
 
   s->etable = NULL;
   s->trace = NULL;
+  s->lemma_log = NULL;
+  s->lemma_log_max = 0;
 
   s->interrupt_push = false;
+
+  s->memory_limit = 0;
+  s->memout = false;
+  s->conflict_limit = 0;
+  s->conflict_bound = 0;
 }
 
 
@@ -1613,26 +1622,15 @@ void smt_core_reset_thsolver(smt_core_t *s, void *th, th_ctrl_interface_t *ctrl,
  */
 void delete_smt_core(smt_core_t *s) {
   uint32_t i, n;
-  clause_t **cl;
 
   delete_ivector(&s->buffer);
   delete_ivector(&s->buffer2);
   delete_ivector(&s->explanation);
 
-  // Delete all the clauses
-  cl = s->problem_clauses;
-  n = get_cv_size(cl);
-  for (i=0; i<n; i++) {
-    delete_clause(cl[i]);
-  }
-  delete_clause_vector(cl);
-
-  cl = s->learned_clauses;
-  n = get_cv_size(cl);
-  for (i=0; i<n; i++) {
-    delete_learned_clause(cl[i]);
-  }
-  delete_clause_vector(cl);
+  // Delete all the clauses: they're all in the clause region
+  delete_clause_vector(s->problem_clauses);
+  delete_clause_vector(s->learned_clauses);
+  delete_objregion(&s->clause_region);
 
   delete_ivector(&s->binary_clauses);
 
@@ -1670,7 +1668,6 @@ void delete_smt_core(smt_core_t *s) {
  */
 void reset_smt_core(smt_core_t *s) {
   uint32_t i, n;
-  clause_t **cl;
 
   s->status = STATUS_IDLE;
 
@@ -1687,19 +1684,9 @@ void reset_smt_core(smt_core_t *s) {
   s->bad_assumption = null_literal;
 
   // delete the clauses
-  cl = s->problem_clauses;
-  n = get_cv_size(cl);
-  for (i=0; i<n; i++) {
-    delete_clause(cl[i]);
-  }
-  reset_clause_vector(cl);
-
-  cl = s->learned_clauses;
-  n = get_cv_size(cl);
-  for (i=0; i<n; i++) {
-    delete_learned_clause(cl[i]);
-  }
-  reset_clause_vector(cl);
+  reset_clause_vector(s->problem_clauses);
+  reset_clause_vector(s->learned_clauses);
+  reset_objregion(&s->clause_region);
 
   ivector_reset(&s->binary_clauses);
 
@@ -1751,6 +1738,7 @@ void reset_smt_core(smt_core_t *s) {
   //  reset_etable(s);
 
   s->interrupt_push = false;
+  s->memout = false;
 }
 
 
@@ -1824,6 +1812,34 @@ void smt_core_set_trace(smt_core_t *s, tracer_t *tracer) {
 }
 
 
+/*
+ * Lemma log
+ */
+void smt_core_set_lemma_log(smt_core_t *s, ivector_t *v, uint32_t max_len) {
+  s->lemma_log = v;
+  s->lemma_log_max = max_len;
+}
+
+
+/*
+ * Collect the short learned clauses
+ */
+void smt_core_collect_learned_clauses(smt_core_t *s, uint32_t max_len, ivector_t *v) {
+  clause_t **cv;
+  uint32_t i, n, len;
+
+  cv = s->learned_clauses;
+  n = get_cv_size(cv);
+  for (i=0; i<n; i++) {
+    len = clause_length(cv[i]);
+    if (len <= max_len) {
+      ivector_add(v, cv[i]->cl, len);
+      ivector_push(v, null_literal);
+    }
+  }
+}
+
+
 extern double avg_learned_clause_size(smt_core_t *core) {
   uint32_t num_clauses;
   double r;
@@ -2976,7 +2992,7 @@ static void add_learned_clause(smt_core_t *s, uint32_t n, literal_t *a) {
     l1 = a[j]; a[j] = a[1]; a[1] = l1;
 
     // create the new clause with l0 and l1 as watched literals
-    cl = new_learned_clause(n, a);
+    cl = new_learned_clause(s, n, a);
     add_clause_to_vector(&s->learned_clauses, cl);
     increase_clause_activity(s, cl);
 
@@ -3069,7 +3085,7 @@ static bool try_cache_theory_clause(smt_core_t *s, uint32_t n, literal_t *a) {
 #endif
 
     // create the new clause with l0 and l1 as watched literals
-    cl = new_learned_clause(n, a);
+    cl = new_learned_clause(s, n, a);
     add_clause_to_vector(&s->learned_clauses, cl);
     increase_clause_activity(s, cl);
 
@@ -3929,7 +3945,7 @@ static clause_t *new_problem_clause(smt_core_t *s, uint32_t n, literal_t *a) {
   fflush(stdout);
 #endif
 
-  cl = new_clause(n, a);
+  cl = new_clause(s, n, a);
   add_clause_to_vector(&s->problem_clauses, cl);
 
   // add cl at the start of watch lists
@@ -4466,6 +4482,12 @@ static void add_all_lemmas(smt_core_t *s) {
        * the theory solver is allowed to create lemmas within backtrack.
        */
       n = lemma_length(lemma);
+      if (s->lemma_log != NULL && n <= s->lemma_log_max &&
+          s->lemma_log->size < MAX_LEMMA_LOG_SIZE) {
+        // add_lemma may modify the lemma so we copy it first
+        ivector_add(s->lemma_log, lemma, n);
+        ivector_push(s->lemma_log, null_literal);
+      }
       add_lemma(s, n, lemma);
       n ++; // skip the end marker
       j += n;
@@ -4761,7 +4783,7 @@ static void delete_learned_clauses(smt_core_t *s) {
   j = 0;
   for (i = 0; i<n; i++) {
     if (is_clause_to_be_removed(v[i])) {
-      delete_learned_clause(v[i]);
+      delete_learned_clause(s, v[i]);
     } else {
       s->stats.learned_literals += clause_length(v[i]);
       v[j] = v[i];
@@ -5062,7 +5084,7 @@ static void simplify_clause_set(smt_core_t *s) {
     j = 0;
     for (i=0; i<n; i++) {
       if (is_clause_to_be_removed(v[i])) {
-        delete_clause(v[i]);
+        delete_clause(s, v[i]);
       } else {
         v[j] = v[i];
         j ++;
@@ -5082,7 +5104,7 @@ static void simplify_clause_set(smt_core_t *s) {
   j = 0;
   for (i=0; i<n; i++) {
     if (is_clause_to_be_removed(v[i])) {
-      delete_learned_clause(v[i]);
+      delete_learned_clause(s, v[i]);
     } else {
       v[j] = v[i];
       j ++;
@@ -5346,14 +5368,14 @@ static void restore_clauses(smt_core_t *s, uint32_t n) {
   v = s->learned_clauses;
   m = get_cv_size(v);
   for (i=0; i<m; i++) {
-    delete_learned_clause(v[i]);
+    delete_learned_clause(s, v[i]);
   }
   reset_clause_vector(v);
 
   v = s->problem_clauses;
   m = get_cv_size(v);
   for (i=n; i<m; i++) {
-    delete_clause(v[i]);
+    delete_clause(s, v[i]);
   }
   set_cv_size(v, n);
 
@@ -5829,7 +5851,7 @@ static void remove_garbage_clauses(smt_core_t *s) {
   j = 0;
   for (i=0; i<n; i++) {
     if (is_clause_to_be_removed(v[i])) {
-      delete_clause(v[i]);
+      delete_clause(s, v[i]);
     } else {
       v[j] = v[i];
       j++;
@@ -5845,7 +5867,7 @@ static void remove_garbage_clauses(smt_core_t *s) {
   j = 0;
   for (i=0; i<n; i++) {
     if (is_clause_to_be_removed(v[i])) {
-      delete_learned_clause(v[i]);
+      delete_learned_clause(s, v[i]);
     } else {
       v[j] = v[i];
       j ++;
@@ -6033,6 +6055,8 @@ void start_search(smt_core_t *s, uint32_t n, const literal_t *a) {
   }
 
   s->status = STATUS_SEARCHING;
+  s->memout = false;
+  s->conflict_bound = s->stats.conflicts + s->conflict_limit;
   s->inconsistent = false;
   s->theory_conflict = false;
   s->conflict = NULL;
@@ -6079,6 +6103,46 @@ void stop_search(smt_core_t *s) {
 }
 
 
+/*
+ * Memory used by s
+ */
+size_t smt_memory_usage(smt_core_t *s) {
+  size_t vbytes, lbytes;
+
+  // value, antecedent, level, activity, heap index + heap array
+  vbytes = sizeof(uint8_t) + sizeof(antecedent_t) + sizeof(uint32_t) + sizeof(double)
+    + sizeof(int32_t) + sizeof(bvar_t);
+  // bin, watch
+  lbytes = sizeof(literal_t *) + sizeof(link_t);
+
+  return objregion_in_use(&s->clause_region) + s->vsize * vbytes + s->lsize * lbytes;
+}
+
+
+/*
+ * Enforce the memory budget
+ */
+void smt_check_memory_limit(smt_core_t *s) {
+  if (s->memory_limit > 0 && smt_memory_usage(s) > s->memory_limit) {
+    reduce_clause_database(s);
+    if (smt_memory_usage(s) > s->memory_limit) {
+      s->memout = true;
+      stop_search(s);
+    }
+  }
+}
+
+
+/*
+ * Enforce the conflict budget
+ */
+void smt_check_conflict_limit(smt_core_t *s) {
+  if (s->conflict_limit > 0 && s->stats.conflicts >= s->conflict_bound) {
+    stop_search(s);
+  }
+}
+
+
 /*
  * Core solving function.
  *
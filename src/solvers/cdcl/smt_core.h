@@ -58,6 +58,7 @@
 #include "solvers/cdcl/gates_hash_table.h"
 #include "utils/bitvectors.h"
 #include "utils/int_vectors.h"
+#include "utils/object_stores.h"
 
 #include "yices_types.h"
 
@@ -1010,6 +1011,7 @@ typedef struct smt_core_s {
   ivector_t explanation;
 
   /* Clause database */
+  object_region_t clause_region;   // all problem and learned clauses are allocated here
   clause_t **problem_clauses;
   clause_t **learned_clauses;
 
@@ -1056,7 +1058,25 @@ typedef struct smt_core_s {
   /* Tracer object (default to NULL) */
   tracer_t *trace;
 
+  /* Lemma log (default to NULL): cf. smt_core_set_lemma_log */
+  ivector_t *lemma_log;
+  uint32_t lemma_log_max;
+
   bool interrupt_push;
+
+  /*
+   * Memory budget:
+   * - memory_limit = bound on smt_memory_usage(s) in bytes (0 means no limit)
+   * - memout = true if the last search was stopped because of this limit
+   *
+   * Conflict budget:
+   * - conflict_limit = max number of conflicts in a search (0 means no limit)
+   * - conflict_bound = number of conflicts at which the current search stops
+   */
+  size_t memory_limit;
+  bool memout;
+  uint64_t conflict_limit;
+  uint64_t conflict_bound;
 } smt_core_t;
 
 
@@ -1170,6 +1190,30 @@ extern void reset_smt_core(smt_core_t *s);
 extern void smt_core_set_trace(smt_core_t *s, tracer_t *tracer);
 
 
+/*
+ * Attach a lemma log:
+ * - if v is non-NULL, every theory lemma of length at most max_len
+ *   that's added to the clause database is copied into v, as a sequence
+ *   of literals terminated by null_literal
+ * - the lemmas are copied as they were produced by the theory solver
+ *   (before simplification)
+ * - logging stops when v contains more than MAX_LEMMA_LOG_SIZE elements
+ * - if v is NULL, logging is disabled
+ */
+#define MAX_LEMMA_LOG_SIZE 100000
+
+extern void smt_core_set_lemma_log(smt_core_t *s, ivector_t *v, uint32_t max_len);
+
+
+/*
+ * Copy the learned clauses of length at most max_len into v
+ * - each clause is stored as a sequence of literals terminated by null_literal
+ * - binary learned clauses are not included (they're stored in the
+ *   binary watch vectors)
+ */
+extern void smt_core_collect_learned_clauses(smt_core_t *s, uint32_t max_len, ivector_t *v);
+
+
 /*
  * EXPERIMENTAL: create the etable
  */
@@ -1229,6 +1273,34 @@ extern void set_randomness(smt_core_t *s, float random_factor);
 extern void set_random_seed(smt_core_t *s, uint32_t seed);
 
 
+/*
+ * Set the memory budget (in bytes). 0 means no limit.
+ */
+static inline void set_memory_limit(smt_core_t *s, size_t limit) {
+  s->memory_limit = limit;
+}
+
+/*
+ * Set the memory budget in MB. 0 means no limit.
+ * - the conversion to bytes is done in 64 bits and saturates at SIZE_MAX
+ *   (so a large limit doesn't wrap around when size_t is 32 bits)
+ */
+static inline void set_memory_limit_mb(smt_core_t *s, uint32_t mb) {
+  uint64_t bytes;
+
+  bytes = ((uint64_t) mb) << 20;
+  set_memory_limit(s, (bytes > (uint64_t) SIZE_MAX) ? SIZE_MAX : (size_t) bytes);
+}
+
+
+/*
+ * Set the conflict budget of each search. 0 means no limit.
+ */
+static inline void set_conflict_limit(smt_core_t *s, uint64_t limit) {
+  s->conflict_limit = limit;
+}
+
+
 /*
  * Activate theory-clause caching
  * - cl_size = max size of clauses to be cached
@@ -1378,6 +1450,11 @@ static inline uint32_t num_clauses(smt_core_t *s) {
     num_prob_clauses(s) + num_learned_clauses(s);
 }
 
+// memory used by the problem and learned clauses (in bytes)
+static inline size_t clause_memory(smt_core_t *s) {
+  return objregion_in_use(&s->clause_region);
+}
+
 // average size of the learned clauses
 extern double avg_learned_clause_size(smt_core_t *core);
 
@@ -1723,6 +1800,34 @@ extern void start_search(smt_core_t *s, uint32_t n, const literal_t *a);
 extern void stop_search(smt_core_t *s);
 
 
+/*
+ * Memory used by s: clause database + variable and literal arrays
+ * - this does not include the theory solver
+ */
+extern size_t smt_memory_usage(smt_core_t *s);
+
+/*
+ * Enforce the memory budget:
+ * - if smt_memory_usage(s) exceeds s->memory_limit, try to free memory
+ *   by deleting learned clauses.
+ * - if that's not enough, set s->memout and call stop_search.
+ */
+extern void smt_check_memory_limit(smt_core_t *s);
+
+/*
+ * Check whether the last search was stopped by the memory budget
+ */
+static inline bool smt_memout(smt_core_t *s) {
+  return s->memout;
+}
+
+/*
+ * Enforce the conflict budget: call stop_search if the current
+ * search has reached s->conflict_limit conflicts.
+ */
+extern void smt_check_conflict_limit(smt_core_t *s);
+
+
 /*
  * Perform a (branching) decision: assign l to true
  * - s->status must be SEARCHING
@@ -6322,7 +6322,7 @@ fcheck_code_t _o_egraph_final_check(egraph_t *egraph) {
 }
 
 fcheck_code_t egraph_final_check(egraph_t *egraph) {
-  MT_PROTECT(fcheck_code_t, __yices_globals.lock, _o_egraph_final_check(egraph));
+  MT_PROTECT(fcheck_code_t, *egraph->lock, _o_egraph_final_check(egraph));
 }
 
 
@@ -6912,6 +6912,10 @@ void init_egraph(egraph_t *egraph, type_table_t *ttbl) {
 
   // model-construction object
   init_egraph_model(&egraph->mdl);
+
+#ifdef THREAD_SAFE
+  egraph->lock = &__yices_globals.lock;
+#endif
 }
 
 
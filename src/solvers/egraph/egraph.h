@@ -403,6 +403,16 @@ extern void egraph_backtrack(egraph_t *egraph, uint32_t back_level);
 extern bool egraph_propagate(egraph_t *egraph);
 extern fcheck_code_t egraph_final_check(egraph_t *egraph);
 
+#ifdef THREAD_SAFE
+/*
+ * Replace the lock taken by final check: this is used for contexts
+ * that are checked while the global lock is held (cf. quant_mbqi.c)
+ */
+static inline void egraph_set_lock(egraph_t *egraph, yices_lock_t *lock) {
+  egraph->lock = lock;
+}
+#endif
+
 extern bool egraph_assert_atom(egraph_t *egraph, void *atom, literal_t l);
 extern void egraph_expand_explanation(egraph_t *egraph, literal_t l, void *expl, ivector_t *v);
 
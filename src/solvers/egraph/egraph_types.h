@@ -246,6 +246,7 @@
 #include "model/concrete_values.h"
 #include "model/fresh_value_maker.h"
 #include "model/fun_maps.h"
+#include "mt/yices_locks.h"
 #include "solvers/cdcl/smt_core.h"
 #include "solvers/egraph/egraph_base_types.h"
 #include "utils/arena.h"
@@ -1488,6 +1489,14 @@ struct egraph_s {
    * Model structure
    */
   egraph_model_t mdl;
+
+#ifdef THREAD_SAFE
+  /*
+   * Lock held during final check, which may create terms
+   * (the global lock by default)
+   */
+  yices_lock_t *lock;
+#endif
 };
 
 
@@ -31,7 +31,9 @@ void init_ef_params(ef_param_t *p) {
 
   p->max_iters = DEF_MBQI_MAX_ITERS;
   p->max_numlearnt_per_round = DEF_MBQI_MAX_LEMMAS_PER_ROUND;
+  p->num_threads = DEF_EF_NUM_THREADS;
   p->ematching = DEF_EMATCH_EN;
+  p->ematch_mbqi = DEF_EMATCH_MBQI;
 
   p->ematch_inst_per_round = DEFAULT_MAX_INSTANCES_PER_ROUND;
   p->ematch_inst_per_search = DEFAULT_MAX_INSTANCES_PER_SEARCH;
@@ -31,6 +31,8 @@
 #define DEF_MBQI_MAX_ITERS              10000
 #define DEF_MBQI_MAX_LEMMAS_PER_ROUND   5
 #define DEF_EMATCH_EN   true
+#define DEF_EMATCH_MBQI false
+#define DEF_EF_NUM_THREADS              0
 
 typedef enum ef_gen_option {
   EF_NOGEN_OPTION,        // option 1 above
@@ -46,6 +48,8 @@ typedef enum ef_gen_option {
  * - gen_mode = generalization method
  * - max_samples = number of samples (max) used in start (0 means no presampling)
  * - max_iters = bound on the outher iteration in efsolver
+ * - num_threads = number of threads for checking the universal constraints
+ *   (0 means check them one at a time in a single forall context)
  */
 typedef struct ef_param_s {
   bool flatten_iff;
@@ -54,13 +58,17 @@ typedef struct ef_param_s {
   uint32_t max_samples;
   uint32_t max_iters;
   uint32_t max_numlearnt_per_round;
+  uint32_t num_threads;
 
   bool ematching;
 
   /*
    * QUANT SOLVER PARAMETERS
    * - ematch_mode: mode for ematching
+   * - ematch_mbqi: use model-based instantiation when ematching
+   *   finds no new instances
    */
+  bool ematch_mbqi;
 
   uint32_t ematch_inst_per_round;
   uint32_t ematch_inst_per_search;
@@ -28,6 +28,7 @@
 #include "yices.h"
 #include "solvers/egraph/composites.h"
 #include "context/internalization_printer.h"
+#include "utils/index_vectors.h"
 #include "utils/prng.h"
 
 
@@ -58,6 +59,13 @@ void init_ematch_exec(ematch_exec_t *exec, ematch_compile_t *comp, instance_tabl
   init_ivector(&exec->aux_vector2, 4);
   init_int_hmap(&exec->aux_map, 0);
 
+  exec->done = NULL;
+  init_int_hmap(&exec->dirty, 0);
+  exec->stamp = 0;
+  init_ivector(&exec->roots, 0);
+  exec->complete = true;
+  exec->at_root = false;
+
   exec->comp = comp;
   exec->itbl = comp->itbl;
   exec->terms = comp->terms;
@@ -86,6 +94,13 @@ void reset_ematch_exec(ematch_exec_t *exec) {
   ivector_reset(&exec->aux_vector2);
   int_hmap_reset(&exec->aux_map);
 
+  exec->done = NULL;
+  int_hmap_reset(&exec->dirty);
+  exec->stamp = 0;
+  ivector_reset(&exec->roots);
+  exec->complete = true;
+  exec->at_root = false;
+
   exec->comp = NULL;
   exec->itbl = NULL;
   exec->terms = NULL;
@@ -105,6 +120,10 @@ void delete_ematch_exec(ematch_exec_t *exec) {
   delete_ivector(&exec->aux_vector2);
   delete_int_hmap(&exec->aux_map);
 
+  exec->done = NULL;
+  delete_int_hmap(&exec->dirty);
+  delete_ivector(&exec->roots);
+
   exec->comp = NULL;
   exec->itbl = NULL;
   exec->terms = NULL;
@@ -119,6 +138,27 @@ void delete_ematch_exec(ematch_exec_t *exec) {
  *   EGRAPH COMMANDS  *
  *********************/
 
+/*
+ * Check whether fapp t can be skipped when collecting the root fapps
+ * of an incremental pattern: all its matches are learnt and it's not
+ * been touched since then.
+ */
+static bool ematch_exec_skip_root(ematch_exec_t *exec, eterm_t t) {
+  int_hmap_pair_t *d, *r;
+
+  if (!exec->at_root) {
+    return false;
+  }
+  assert(exec->done != NULL);
+
+  d = int_hmap_find(exec->done, t);
+  if (d == NULL) {
+    return false;
+  }
+  r = int_hmap_find(&exec->dirty, t);
+  return r == NULL || d->val > r->val;
+}
+
 /*
  * Collect function applications for function f in the class of occ, and push in aux vector
  */
@@ -151,7 +191,8 @@ static void egraph_get_all_fapps_in_class(ematch_exec_t *exec, eterm_t f, occ_t
         x = term_of_occ(composite_child(p, 0));
         if (x == f) {
           // check if following if is redundant
-          if (congruence_table_is_root(&egraph->ctable, p, egraph->terms.label)) {
+          if (congruence_table_is_root(&egraph->ctable, p, egraph->terms.label) &&
+              !ematch_exec_skip_root(exec, ti)) {
             if (composite_depth(egraph, p) < exec->fdepth) {
               occp = pos_occ(ti);
               ivector_push(aux, occp);
@@ -215,6 +256,7 @@ static void egraph_get_fapps_in_class_all(ematch_exec_t *exec, eterm_t f, occ_t
 #if TRACE
       printf("    reached fapps limit of %d\n", exec->max_fapps);
 #endif
+      exec->complete = false;
       break;
     }
     ivector_push(out, aux->data[i]);
@@ -254,6 +296,7 @@ static void egraph_get_fapps_in_class_random(ematch_exec_t *exec, eterm_t f, occ
 #if TRACE
         printf("    reached fapps limit of %d\n", exec->max_fapps);
 #endif
+        exec->complete = false;
         break;
       }
 
@@ -313,7 +356,8 @@ static void egraph_get_fapps_in_class_greedy(ematch_exec_t *exec, eterm_t f, occ
           // check if present in main heap
           if (generic_heap_member(main_heap, ti)) {
             // check if following if is redundant
-            if (congruence_table_is_root(&egraph->ctable, p, egraph->terms.label)) {
+            if (congruence_table_is_root(&egraph->ctable, p, egraph->terms.label) &&
+                !ematch_exec_skip_root(exec, ti)) {
               if (composite_depth(egraph, p) < exec->fdepth) {
                 generic_heap_add(aux_heap, ti);
               } else {
@@ -332,6 +376,7 @@ static void egraph_get_fapps_in_class_greedy(ematch_exec_t *exec, eterm_t f, occ
               }
             }
           } else {
+            exec->complete = false;
 #if TRACE
             fputs("    (filtered: not in heap) ", stdout);
             ti = term_of_occ(occi);
@@ -358,6 +403,7 @@ static void egraph_get_fapps_in_class_greedy(ematch_exec_t *exec, eterm_t f, occ
 #if TRACE
       printf("    reached fapps limit of %d\n", exec->max_fapps);
 #endif
+      exec->complete = false;
       break;
     }
 
@@ -517,6 +563,7 @@ static void egraph_get_all_fapps(ematch_exec_t *exec, eterm_t f, ivector_t *out)
 #if TRACE
           printf("    reached fapps limit of %d\n", exec->max_fapps);
 #endif
+          exec->complete = false;
           break;
         }
       }
@@ -778,6 +825,9 @@ static void ematch_exec_all_chooseapps(ematch_exec_t *exec, ematch_instr_t *inst
 #if TRACE
         printf("    chooseapp exit\n");
 #endif
+        if (j < n) {
+          exec->complete = false;
+        }
         break;
       }
     }
@@ -1055,6 +1105,7 @@ static void ematch_exec_yield(ematch_exec_t *exec, ematch_instr_t *instr) {
 #if TRACE_LIGHT
         printf("    early exit\n");
 #endif
+        exec->complete = false;
         reset_ematch_stack(&exec->bstack);
       }
     } else {
@@ -1154,11 +1205,45 @@ void ematch_exec_instr(ematch_exec_t *exec, int32_t idx) {
  *   PATTERN EXECUTER  *
  **********************/
 
+/*
+ * Check whether the matches of pat can be computed incrementally
+ * - pat must be a single pattern: the roots of a multi-pattern
+ *   depend on all the fapps of its other functions
+ * - all the functions and constants of pat must be internalized:
+ *   if one of them is not yet, the matches may depend on its
+ *   internalization rather than on new terms and merges
+ */
+static bool ematch_exec_is_incremental(ematch_exec_t *exec, pattern_t *pat) {
+  uint32_t i, n;
+
+  if (term_kind(exec->terms, pat->p) != APP_TERM) {
+    return false;
+  }
+
+  n = iv_len(pat->fun);
+  for(i=0; i<n; i++) {
+    if (term2occ(exec->intern, pat->fun[i]) == null_occurrence) {
+      return false;
+    }
+  }
+  n = iv_len(pat->consts);
+  for(i=0; i<n; i++) {
+    if (term2occ(exec->intern, pat->consts[i]) == null_occurrence) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 /*
  * Execute the code sequence for a pattern
+ * - filter = matches to ignore (or NULL)
+ * - done = map of done roots for incremental matching (or NULL)
  * - returns number of matches found
  */
-uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *filter, uint32_t nmatches) {
+uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *filter,
+                             int_hmap_t *done, uint32_t nmatches) {
   uint32_t count;
   term_table_t *terms;
   term_kind_t kind;
@@ -1182,6 +1267,11 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
     exec->max_matches = nmatches;
 
   exec->filter = filter;
+  exec->done = NULL;
+  if (done != NULL && ematch_exec_is_incremental(exec, pat)) {
+    exec->done = done;
+  }
+  ivector_reset(&exec->roots);
   terms = exec->terms;
   kind = term_kind(terms, pat->p);
   count = 0;
@@ -1208,7 +1298,11 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
 
     init_ivector(&fapps, 4);
 
+    // collect the roots: skip the done ones if the pattern is incremental
+    exec->at_root = (exec->done != NULL);
     egraph_get_all_fapps(exec, term_of_occ(occ), &fapps);
+    exec->at_root = false;
+
     n = fapps.size;
     for(i=0; i<n; i++) {
       tf = term_of_occ(fapps.data[i]);
@@ -1226,6 +1320,7 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
       ematch_exec_set_reg(exec, fapps.data[i], 0);
       assert(exec->bstack.top == 0);
 
+      exec->complete = true;
       ematch_exec_instr(exec, pat->code);
 
       ivector_remove_duplicates(aux);
@@ -1243,6 +1338,10 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
         for(j=0; j!=m; j++) {
           ivector_push(matches, aux->data[j]);
         }
+        if (exec->complete) {
+          ivector_push(&exec->roots, tf);
+          ivector_push(&exec->roots, matches->size);
+        }
 
         term_learner_add_latest(term_learner, tf);
         term_learner_update_match_reward(term_learner, tf);
@@ -1250,6 +1349,10 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
         if (matches->size >= nmatches)
           break;
       } else {
+        if (exec->complete) {
+          ivector_push(&exec->roots, tf);
+          ivector_push(&exec->roots, matches->size);
+        }
         term_learner_update_unmatch_reward(term_learner, tf);
       }
     }
@@ -1260,6 +1363,20 @@ uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *fi
   return count;
 }
 
-
-
-
+/*
+ * Mark the roots whose matches are among the first n matches of the
+ * last pattern executed as done
+ */
+void ematch_exec_commit_roots(ematch_exec_t *exec, uint32_t n) {
+  ivector_t *v;
+  uint32_t i;
+
+  if (exec->done != NULL) {
+    v = &exec->roots;
+    for(i=0; i<v->size; i += 2) {
+      if ((uint32_t) v->data[i+1] > n) break;
+      int_hmap_get(exec->done, v->data[i])->val = exec->stamp;
+    }
+  }
+  ivector_reset(&exec->roots);
+}
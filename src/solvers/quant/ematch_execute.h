@@ -50,6 +50,29 @@ typedef struct ematch_exec_s {
 
   int_hset_t *filter;           // instance indices to filter out (since already learnt)
 
+  /*
+   * Incremental matching:
+   * - done = roots of the current pattern whose matches are all learnt
+   *   (root -> stamp when this was established), or NULL
+   * - dirty = egraph terms that may have new matches (term -> stamp when
+   *   this was detected)
+   * - a root r is skipped if done[r] > dirty[r] (or r is not in dirty)
+   * - stamp = current stamp (for new entries in done)
+   * - roots = pairs <root, end of its matches in pat->matches> for the
+   *   roots completely explored by the last ematch_exec_pattern
+   * - complete = false if the exploration of the current root was cut
+   *   short (by a limit or by the learner's selection of fapps)
+   * - at_root = true while the root fapps are collected (the done
+   *   roots are skipped then, so that the limit on fapps is spent on
+   *   roots that can have new matches)
+   */
+  int_hmap_t *done;
+  int_hmap_t dirty;
+  int32_t stamp;
+  ivector_t roots;
+  bool complete;
+  bool at_root;
+
   uint32_t fdepth;              // function composition depth allowed for the fapps during matching
   uint32_t vdepth;              // function composition depth allowed for the variable matches
 
@@ -86,9 +109,19 @@ extern void ematch_exec_instr(ematch_exec_t *exec, int32_t idx);
 
 /*
  * Execute the code sequence for a pattern
+ * - filter = matches to ignore (or NULL)
+ * - done = map of done roots for incremental matching (or NULL)
  * - returns number of matches found
  */
-extern uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *filter, uint32_t nmatches);
+extern uint32_t ematch_exec_pattern(ematch_exec_t *exec, pattern_t *pat, int_hset_t *filter,
+                                    int_hmap_t *done, uint32_t nmatches);
+
+/*
+ * Record that the first n matches of the last ematch_exec_pattern
+ * are learnt: the roots all of whose matches are among them are marked
+ * as done in the map given to ematch_exec_pattern.
+ */
+extern void ematch_exec_commit_roots(ematch_exec_t *exec, uint32_t n);
 
 
 #endif /* __EMATCH_EXECUTE_H */
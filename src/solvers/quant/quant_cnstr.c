@@ -58,6 +58,23 @@ void extend_quant_table(quant_table_t *table) {
 }
 
 
+/*
+ * Free the maps of done roots
+ */
+static void delete_done_maps(quant_cnstr_t *cnstr) {
+  uint32_t i;
+
+  if (cnstr->done != NULL) {
+    for(i=0; i<cnstr->ndone; i++) {
+      delete_int_hmap(cnstr->done + i);
+    }
+    safe_free(cnstr->done);
+    cnstr->done = NULL;
+    cnstr->ndone = 0;
+  }
+}
+
+
 /*
  * Remove all quantifiers of index >= n
  */
@@ -71,6 +88,7 @@ void shrink_quant_table(quant_table_t *table, uint32_t n) {
     cnstr = &table->data[i];
     delete_index_vector(cnstr->patterns);
     delete_int_hset(&cnstr->instances);
+    delete_done_maps(cnstr);
 
     delete_index_vector(cnstr->uvars);
     delete_index_vector(cnstr->fun);
@@ -132,12 +150,52 @@ int32_t quant_table_add_cnstr(quant_table_t *qtbl, term_t t, int32_t *pv, uint32
   qcnstr->t = t;
   qcnstr->patterns = make_index_vector(pv, npv);
   init_int_hset(&qcnstr->instances, 0);
+  qcnstr->done = NULL;
+  qcnstr->ndone = 0;
   qcnstr->enable = NULL_TERM;
   qcnstr->enable_lit = null_literal;
 
   return i;
 }
 
+/*
+ * Map of done roots for the j-th pattern of cnstr
+ * - the maps are allocated when first needed since the pattern
+ *   vector can still change after the constraint is created
+ */
+int_hmap_t *quant_cnstr_done_map(quant_cnstr_t *cnstr, uint32_t j) {
+  uint32_t i, n;
+
+  n = iv_len(cnstr->patterns);
+  assert(j < n);
+
+  if (cnstr->done == NULL) {
+    cnstr->done = (int_hmap_t *) safe_malloc(n * sizeof(int_hmap_t));
+    cnstr->ndone = n;
+    for(i=0; i<n; i++) {
+      init_int_hmap(cnstr->done + i, 0);
+    }
+  }
+  assert(cnstr->ndone == n);
+
+  return cnstr->done + j;
+}
+
+
+/*
+ * Empty all the maps of done roots
+ */
+void quant_cnstr_reset_done_maps(quant_cnstr_t *cnstr) {
+  uint32_t i;
+
+  if (cnstr->done != NULL) {
+    for(i=0; i<cnstr->ndone; i++) {
+      int_hmap_reset(cnstr->done + i);
+    }
+  }
+}
+
+
 /*
  * Check constraint at index idx
  * - if assertion has more variables than variables in patterns, return false
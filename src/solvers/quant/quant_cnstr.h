@@ -25,6 +25,7 @@
 
 
 #include "solvers/quant/quant_pattern.h"
+#include "utils/int_hash_map.h"
 
 
 /*
@@ -35,6 +36,15 @@ typedef struct quant_cnstr_s {
   int32_t *patterns;  // pattern indices in pattern table
   int_hset_t instances; // match indices in instance table for whom instances are learnt
 
+  /*
+   * Incremental matching: done[j] maps the root fapps of pattern j
+   * whose matches are all learnt to the round stamp when this was
+   * established (cf. quant_ematching.h). The array is allocated on
+   * first use, ndone is its size.
+   */
+  int_hmap_t *done;
+  uint32_t ndone;
+
   term_t *uvars;    // universal variables
   term_t *fun;      // functions that appear in the constraint
   term_t *fapps;    // function applications that appear in the constraint
@@ -103,6 +113,16 @@ extern int32_t quant_table_add_cnstr(quant_table_t *qtbl, term_t t, int32_t *pv,
  * Check constraint at index idx
  * - if assertion has more variables than variables in patterns, return false
  */
+/*
+ * Map of done roots for the j-th pattern of cnstr (allocated if needed)
+ */
+extern int_hmap_t *quant_cnstr_done_map(quant_cnstr_t *cnstr, uint32_t j);
+
+/*
+ * Empty all the maps of done roots of cnstr
+ */
+extern void quant_cnstr_reset_done_maps(quant_cnstr_t *cnstr);
+
 extern bool quant_table_check_cnstr(quant_table_t *qtbl, pattern_table_t *ptbl, uint32_t idx);
 
 /*
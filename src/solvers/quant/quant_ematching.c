@@ -22,6 +22,8 @@
 
 
 #include "solvers/quant/quant_ematching.h"
+#include "solvers/egraph/egraph_utils.h"
+#include "terms/term_explorer.h"
 
 
 #define TRACE 0
@@ -58,6 +60,12 @@ void init_ematch(ematch_globals_t *em) {
   init_ematch_exec(&em->exec, &em->comp, &em->instbl);
   init_int_hmap(&em->pattern2code, 0);
   init_instance_table(&em->instbl);
+  em->nterms = 0;
+  em->undo_top = 0;
+  em->fdepth = 0;
+  em->vdepth = 0;
+  em->max_depth = 0;
+  em->synced = false;
 }
 
 /*
@@ -73,6 +81,12 @@ void reset_ematch(ematch_globals_t *em) {
   reset_ematch_exec(&em->exec);
   int_hmap_reset(&em->pattern2code);
   reset_instance_table(&em->instbl);
+  em->nterms = 0;
+  em->undo_top = 0;
+  em->fdepth = 0;
+  em->vdepth = 0;
+  em->max_depth = 0;
+  em->synced = false;
 }
 
 /*
@@ -119,6 +133,25 @@ void ematch_attach_egraph(ematch_globals_t *em, egraph_t *egraph) {
   em->exec.term_learner->egraph = egraph;
 }
 
+/*
+ * Nesting depth of function applications in pattern t
+ */
+static uint32_t pattern_depth(term_table_t *terms, term_t t) {
+  uint32_t i, n, d, k;
+
+  d = 0;
+  n = term_num_children(terms, t);
+  for(i=0; i<n; i++) {
+    k = pattern_depth(terms, term_child(terms, t, i));
+    if (k > d) d = k;
+  }
+  if (term_kind(terms, t) == APP_TERM) {
+    d ++;
+  }
+
+  return d;
+}
+
 /*
  * Compile all patterns and fill in the pattern2code map
  */
@@ -127,7 +160,7 @@ void ematch_compile_all_patterns(ematch_globals_t *em) {
   pattern_table_t *ptbl;
   int_hmap_t *pc;
   pattern_t *pat;
-  uint32_t i;
+  uint32_t i, d;
   term_t t;
   int_hmap_pair_t *ip;
 
@@ -151,6 +184,11 @@ void ematch_compile_all_patterns(ematch_globals_t *em) {
       ip->val = ematch_compile_pattern(comp, t);
       pat->code = ip->val;
     }
+
+    d = pattern_depth(comp->terms, t);
+    if (d > em->max_depth) {
+      em->max_depth = d;
+    }
   }
 }
 
@@ -168,7 +206,133 @@ void ematch_execute_all_patterns(ematch_globals_t *em) {
 
   for(i=0; i<ptbl->npatterns; i++) {
     pat = &ptbl->data[i];
-    ematch_exec_pattern(exec, pat, NULL, 10);
+    ematch_exec_pattern(exec, pat, NULL, NULL, 10);
+  }
+}
+
+
+/**************************
+ *  INCREMENTAL MATCHING  *
+ *************************/
+
+/*
+ * Mark t as dirty in the current round. Push t into v if it was not marked yet.
+ */
+static void ematch_mark_dirty(ematch_globals_t *em, eterm_t t, ivector_t *v) {
+  int_hmap_pair_t *p;
+
+  p = int_hmap_get(&em->exec.dirty, t);
+  if (p->val != em->exec.stamp) {
+    p->val = em->exec.stamp;
+    ivector_push(v, t);
   }
 }
 
+/*
+ * Mark all the parents of class c as dirty
+ */
+static void ematch_mark_parents(ematch_globals_t *em, class_t c, ivector_t *v) {
+  use_vector_t *u;
+  composite_t *p;
+  uint32_t i, n;
+
+  u = egraph_class_parents(em->egraph, c);
+  n = u->last;
+  for(i=0; i<n; i++) {
+    p = u->data[i];
+    if (valid_entry(p)) {
+      ematch_mark_dirty(em, p->id, v);
+    }
+  }
+}
+
+/*
+ * Collect the terms that may have new matches since the last round
+ * - new terms are dirty
+ * - for each merge on the undo stack above the low-water mark, the roots
+ *   of depth at most max_depth above the merged class are dirty
+ */
+static void ematch_collect_dirty_terms(ematch_globals_t *em) {
+  egraph_t *egraph;
+  undo_stack_t *undo;
+  ivector_t v, w, aux;
+  uint32_t i, k, n;
+  eterm_t t;
+
+  egraph = em->egraph;
+  init_ivector(&v, 10);
+  init_ivector(&w, 10);
+
+  n = egraph->terms.nterms;
+  for(t=em->nterms; t<n; t++) {
+    int_hmap_get(&em->exec.dirty, t)->val = em->exec.stamp;
+  }
+
+  undo = &egraph->undo;
+  assert(em->undo_top <= undo->top);
+  for(i=em->undo_top; i<undo->top; i++) {
+    if (undo->tag[i] == UNDO_MERGE) {
+      t = term_of_occ(undo->data[i].merge.saved_occ);
+      ematch_mark_parents(em, egraph_term_class(egraph, t), &v);
+    }
+  }
+
+  // v = terms at distance k from a merged class
+  for(k=1; k<em->max_depth && v.size > 0; k++) {
+    ivector_reset(&w);
+    for(i=0; i<v.size; i++) {
+      ematch_mark_parents(em, egraph_term_class(egraph, v.data[i]), &w);
+    }
+    aux = v; v = w; w = aux;
+  }
+
+  delete_ivector(&v);
+  delete_ivector(&w);
+}
+
+/*
+ * Start a matching round
+ */
+void ematch_start_round(ematch_globals_t *em) {
+  ematch_exec_t *exec;
+  quant_table_t *qtbl;
+  egraph_t *egraph;
+  uint32_t i;
+
+  exec = &em->exec;
+  egraph = em->egraph;
+  assert(egraph != NULL);
+
+  // roots done with lower depth limits may have more matches now
+  if (exec->fdepth > em->fdepth || exec->vdepth > em->vdepth) {
+    em->synced = false;
+  }
+  em->fdepth = exec->fdepth;
+  em->vdepth = exec->vdepth;
+
+  // dirty terms get the odd stamp, new done roots the next one
+  exec->stamp ++;
+  if (em->synced) {
+    ematch_collect_dirty_terms(em);
+  } else {
+    qtbl = em->qtbl;
+    for(i=0; i<qtbl->nquant; i++) {
+      quant_cnstr_reset_done_maps(qtbl->data + i);
+    }
+    int_hmap_reset(&exec->dirty);
+  }
+  exec->stamp ++;
+
+  em->nterms = egraph->terms.nterms;
+  em->undo_top = egraph->undo.top;
+  em->synced = true;
+}
+
+/*
+ * Update the low-water mark after the egraph has backtracked
+ */
+void ematch_backtrack(ematch_globals_t *em) {
+  if (em->egraph != NULL && em->egraph->undo.top < em->undo_top) {
+    em->undo_top = em->egraph->undo.top;
+  }
+}
@@ -42,6 +42,21 @@ typedef struct ematch_globals_s {
   quant_table_t *qtbl;         // link to quant cnstr table
   egraph_t *egraph;            // link to egraph
   context_t *ctx;              // link to context
+
+  /*
+   * Incremental matching:
+   * - nterms = number of egraph terms at the start of the last round
+   * - undo_top = low-water mark of the egraph undo stack since then
+   * - fdepth, vdepth = depth limits for which the done roots are valid
+   * - max_depth = max nesting of function applications in a pattern
+   * - synced = false if the done roots must be discarded at the next round
+   */
+  uint32_t nterms;
+  uint32_t undo_top;
+  uint32_t fdepth;
+  uint32_t vdepth;
+  uint32_t max_depth;
+  bool synced;
 } ematch_globals_t;
 
 
@@ -88,4 +103,36 @@ extern void ematch_compile_all_patterns(ematch_globals_t *em);
 extern void ematch_execute_all_patterns(ematch_globals_t *em);
 
 
+/*
+ * INCREMENTAL MATCHING
+ *
+ * Each quantifier constraint keeps, for each of its patterns, the root
+ * fapps whose matches are all learnt. A root can have new matches only if
+ * it's a new egraph term or if a class reachable from it (through at most
+ * max_depth levels of arguments) was merged with another class. All such
+ * merges are on the egraph undo stack above the low-water mark reached
+ * since the previous round, so the roots they affect are found by going up
+ * through the class parents. These roots are marked as dirty and
+ * matched again; the others are skipped.
+ */
+
+/*
+ * Start a matching round: compute the dirty terms (or discard all the
+ * done roots if they can't be trusted) and save the egraph state.
+ */
+extern void ematch_start_round(ematch_globals_t *em);
+
+/*
+ * Update the low-water mark after the egraph has backtracked
+ */
+extern void ematch_backtrack(ematch_globals_t *em);
+
+/*
+ * Discard all the done roots at the next round (e.g., after pop)
+ */
+static inline void ematch_desync(ematch_globals_t *em) {
+  em->synced = false;
+}
+
+
 #endif /* __QUANT_EMATCHING_H */
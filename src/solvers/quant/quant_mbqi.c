@@ -0,0 +1,790 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MODEL-BASED QUANTIFIER INSTANTIATION
+ */
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+#include <pthread.h>
+#endif
+
+#include <assert.h>
+
+#include "api/yices_globals.h"
+#include "api/yices_api_lock_free.h"
+#include "context/context.h"
+#include "model/concrete_values.h"
+#include "model/model_queries.h"
+#include "model/val_to_term.h"
+#include "solvers/egraph/egraph_utils.h"
+#include "solvers/quant/quant_mbqi.h"
+#include "terms/term_substitution.h"
+#include "utils/index_vectors.h"
+#include "utils/memalloc.h"
+
+#ifdef THREAD_SAFE
+#include "mt/yices_locks.h"
+#endif
+
+
+#define TRACE 0
+
+#if TRACE
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "yices.h"
+
+#endif
+
+
+/*
+ * Initialize: nothing attached, MBQI disabled
+ */
+void init_mbqi(mbqi_globals_t *mbqi) {
+  mbqi->ctx = NULL;
+  mbqi->qtbl = NULL;
+  mbqi->mngr = NULL;
+  mbqi->terms = NULL;
+  mbqi->model = NULL;
+
+  init_int_hmap(&mbqi->var_map, 0);
+  init_int_hmap(&mbqi->fun_map, 0);
+  init_int_hmap(&mbqi->rep_map, 0);
+  init_ivector(&mbqi->universe, 10);
+  init_int_hset(&mbqi->instances, 0);
+
+  mbqi->num_threads = 0;
+  mbqi->enabled = false;
+
+  mbqi->check = NULL;
+  mbqi->nchecks = 0;
+#ifdef THREAD_SAFE
+  create_yices_lock(&mbqi->lock);
+  create_yices_lock(&mbqi->check_lock);
+#endif
+
+  mbqi->num_rounds = 0;
+  mbqi->num_checks = 0;
+  mbqi->num_instances = 0;
+
+  init_ivector(&mbqi->aux, 10);
+  init_ivector(&mbqi->aux2, 10);
+}
+
+
+/*
+ * Free the candidate model if any
+ */
+static void mbqi_free_model(mbqi_globals_t *mbqi) {
+  if (mbqi->model != NULL) {
+    delete_model(mbqi->model);
+    safe_free(mbqi->model);
+    mbqi->model = NULL;
+  }
+}
+
+
+/*
+ * Reset
+ */
+void reset_mbqi(mbqi_globals_t *mbqi) {
+  mbqi_free_model(mbqi);
+  mbqi->ctx = NULL;
+  mbqi->qtbl = NULL;
+  mbqi->mngr = NULL;
+  mbqi->terms = NULL;
+
+  int_hmap_reset(&mbqi->var_map);
+  int_hmap_reset(&mbqi->fun_map);
+  int_hmap_reset(&mbqi->rep_map);
+  ivector_reset(&mbqi->universe);
+  int_hset_reset(&mbqi->instances);
+
+  mbqi->num_threads = 0;
+  mbqi->enabled = false;
+
+  mbqi->num_rounds = 0;
+  mbqi->num_checks = 0;
+  mbqi->num_instances = 0;
+
+  ivector_reset(&mbqi->aux);
+  ivector_reset(&mbqi->aux2);
+}
+
+
+/*
+ * Delete
+ */
+void delete_mbqi(mbqi_globals_t *mbqi) {
+  mbqi_free_model(mbqi);
+
+  delete_int_hmap(&mbqi->var_map);
+  delete_int_hmap(&mbqi->fun_map);
+  delete_int_hmap(&mbqi->rep_map);
+  delete_ivector(&mbqi->universe);
+  delete_int_hset(&mbqi->instances);
+
+  delete_ivector(&mbqi->aux);
+  delete_ivector(&mbqi->aux2);
+
+#ifdef THREAD_SAFE
+  destroy_yices_lock(&mbqi->lock);
+  destroy_yices_lock(&mbqi->check_lock);
+#endif
+}
+
+
+/*
+ * Attach context, quant table, and term manager
+ */
+void mbqi_attach(mbqi_globals_t *mbqi, context_t *ctx, quant_table_t *qtbl, term_manager_t *mngr) {
+  mbqi->ctx = ctx;
+  mbqi->qtbl = qtbl;
+  mbqi->mngr = mngr;
+  mbqi->terms = term_manager_get_terms(mngr);
+}
+
+
+
+/*********************
+ *  CANDIDATE MODEL  *
+ ********************/
+
+/*
+ * Collect the universe: for every egraph term t of uninterpreted sort,
+ * map the constant that represents t's value to t (unless that value
+ * has a representative already).
+ */
+static void mbqi_collect_universe(mbqi_globals_t *mbqi) {
+  egraph_t *egraph;
+  intern_tbl_t *intern;
+  value_table_t *vtbl;
+  int_hmap_pair_t *p;
+  uint32_t i, n;
+  term_t t, u;
+  value_t v;
+
+  egraph = mbqi->ctx->egraph;
+  intern = &mbqi->ctx->intern;
+  vtbl = model_get_vtbl(mbqi->model);
+
+  n = egraph_num_terms(egraph);
+  for (i=0; i<n; i++) {
+    t = intern_tbl_reverse_map(intern, pos_occ(i));
+    if (t == NULL_TERM || !is_uninterpreted_type(mbqi->terms->types, term_type(mbqi->terms, t))) continue;
+
+    v = model_get_term_value(mbqi->model, t);
+    if (v < 0) continue;
+    u = convert_simple_value(mbqi->terms, vtbl, v);
+    if (u < 0) continue;
+
+    p = int_hmap_get(&mbqi->rep_map, u);
+    if (p->val < 0) {
+      p->val = t;
+      ivector_push(&mbqi->universe, u);
+    }
+  }
+}
+
+
+/*
+ * Build the candidate model from the main context
+ */
+static void mbqi_build_model(mbqi_globals_t *mbqi) {
+  model_t *mdl;
+
+  assert(mbqi->model == NULL);
+
+  mdl = (model_t *) safe_malloc(sizeof(model_t));
+  init_model(mdl, mbqi->terms, true);
+  build_search_model(mdl, mbqi->ctx);
+  clean_solver_models(mbqi->ctx);
+  mbqi->model = mdl;
+
+  int_hmap_reset(&mbqi->fun_map);
+  int_hmap_reset(&mbqi->rep_map);
+  ivector_reset(&mbqi->universe);
+  mbqi_collect_universe(mbqi);
+}
+
+
+/*
+ * Convert a function value f to a lambda term
+ * - tau = type of f
+ * - map = array of n mapping objects, def = default value
+ * - return NULL_TERM if some of the values are not primitive
+ */
+static term_t mbqi_lambda_term(mbqi_globals_t *mbqi, type_t tau, uint32_t n, value_t *map, value_t def) {
+  term_table_t *terms;
+  value_table_t *vtbl;
+  function_type_t *ftype;
+  value_map_t *m;
+  ivector_t *var, *eq;
+  term_t body, a, b;
+  uint32_t i, j, arity;
+
+  terms = mbqi->terms;
+  vtbl = model_get_vtbl(mbqi->model);
+  ftype = function_type_desc(terms->types, tau);
+  arity = ftype->ndom;
+
+  /*
+   * The default value may be unknown: we use the last
+   * mapping instead.
+   */
+  body = convert_simple_value(terms, vtbl, def);
+  if (body < 0) {
+    if (n == 0) return NULL_TERM;
+    n --;
+    body = convert_simple_value(terms, vtbl, vtbl_map_result(vtbl, map[n]));
+    if (body < 0) return NULL_TERM;
+  }
+
+  var = &mbqi->aux;
+  eq = &mbqi->aux2;
+  ivector_reset(var);
+  for (j=0; j<arity; j++) {
+    ivector_push(var, new_variable(terms, ftype->domain[j]));
+  }
+
+  i = n;
+  while (i > 0) {
+    i --;
+    m = vtbl_map(vtbl, map[i]);
+    assert(m->arity == arity);
+
+    b = convert_simple_value(terms, vtbl, m->val);
+    if (b < 0) return NULL_TERM;
+
+    ivector_reset(eq);
+    for (j=0; j<arity; j++) {
+      a = convert_simple_value(terms, vtbl, m->arg[j]);
+      if (a < 0) return NULL_TERM;
+      ivector_push(eq, mk_eq(mbqi->mngr, var->data[j], a));
+    }
+    a = mk_and(mbqi->mngr, eq->size, eq->data);
+    body = mk_ite(mbqi->mngr, a, b, body, ftype->range);
+  }
+
+  return mk_lambda(mbqi->mngr, arity, var->data, body);
+}
+
+
+/*
+ * Value of function f in the candidate model as a lambda term
+ * - return NULL_TERM if that's not possible
+ */
+static term_t mbqi_fun_value(mbqi_globals_t *mbqi, term_t f) {
+  value_table_t *vtbl;
+  value_fun_t *fun;
+  int_hmap_pair_t *p;
+  ivector_t v;
+  type_t tau;
+  value_t x, def;
+  term_t t;
+
+  p = int_hmap_find(&mbqi->fun_map, f);
+  if (p == NULL) {
+    vtbl = model_get_vtbl(mbqi->model);
+    x = model_get_term_value(mbqi->model, f);
+    t = NULL_TERM;
+    if (x >= 0) {
+      if (object_is_function(vtbl, x)) {
+        fun = vtbl_function(vtbl, x);
+        t = mbqi_lambda_term(mbqi, fun->type, fun->map_size, fun->map, fun->def);
+      } else if (object_is_update(vtbl, x)) {
+        // the mappings are in vtbl->hset1: copy them
+        vtbl_expand_update(vtbl, x, &def, &tau);
+        init_ivector(&v, vtbl->hset1->nelems);
+        ivector_add(&v, (int32_t *) vtbl->hset1->data, vtbl->hset1->nelems);
+        t = mbqi_lambda_term(mbqi, tau, v.size, v.data, def);
+        delete_ivector(&v);
+      }
+    }
+
+    int_hmap_add(&mbqi->fun_map, f, t);
+    return t;
+  }
+
+  return p->val;
+}
+
+
+
+/**********************
+ *  SECONDARY CHECKS  *
+ *********************/
+
+/*
+ * Constant that replaces variable x in the secondary contexts
+ */
+static term_t mbqi_var_constant(mbqi_globals_t *mbqi, term_t x) {
+  int_hmap_pair_t *p;
+
+  p = int_hmap_get(&mbqi->var_map, x);
+  if (p->val < 0) {
+    p->val = new_uninterpreted_term(mbqi->terms, term_type(mbqi->terms, x));
+  }
+  return p->val;
+}
+
+
+/*
+ * Check whether variables of type tau can be handled
+ * - tuple and function types are not supported
+ */
+static bool mbqi_good_var_type(type_table_t *types, type_t tau) {
+  return is_boolean_type(tau) || is_arithmetic_type(tau) || is_bv_type(types, tau) ||
+    is_scalar_type(types, tau) || is_uninterpreted_type(types, tau);
+}
+
+
+/*
+ * Domain constraint for constant c of uninterpreted type tau:
+ * - c must be equal to one of the universe constants of type tau
+ * - return NULL_TERM if there are none
+ */
+static term_t mbqi_domain_constraint(mbqi_globals_t *mbqi, term_t c, type_t tau) {
+  ivector_t *v;
+  uint32_t i, n;
+  term_t u;
+
+  v = &mbqi->aux;
+  ivector_reset(v);
+  n = mbqi->universe.size;
+  for (i=0; i<n; i++) {
+    u = mbqi->universe.data[i];
+    if (term_type(mbqi->terms, u) == tau) {
+      ivector_push(v, mk_eq(mbqi->mngr, c, u));
+    }
+  }
+
+  if (v->size == 0) return NULL_TERM;
+
+  return mk_or(mbqi->mngr, v->size, v->data);
+}
+
+
+/*
+ * Build the formula to check for constraint cnstr:
+ * - NOT B(c) where B is the constraint body, the uninterpreted functions
+ *   and constants of B are replaced by their value in the candidate model,
+ *   and the variables of B by the constants c.
+ * - conjoined with the domain constraints for the variables of
+ *   uninterpreted sorts.
+ * - return NULL_TERM if the constraint can't be checked
+ */
+static term_t mbqi_cnstr_formula(mbqi_globals_t *mbqi, quant_cnstr_t *cnstr) {
+  term_table_t *terms;
+  value_table_t *vtbl;
+  term_subst_t subst;
+  ivector_t keys, values, conj;
+  uint32_t i, n;
+  type_t tau;
+  term_t x, t;
+  value_t v;
+
+  terms = mbqi->terms;
+  vtbl = model_get_vtbl(mbqi->model);
+
+  init_ivector(&keys, 10);
+  init_ivector(&values, 10);
+  init_ivector(&conj, 10);
+  t = NULL_TERM;
+
+  n = iv_len(cnstr->uvars);
+  for (i=0; i<n; i++) {
+    x = cnstr->uvars[i];
+    if (!mbqi_good_var_type(terms->types, term_type(terms, x))) goto done;
+    ivector_push(&keys, x);
+    ivector_push(&values, mbqi_var_constant(mbqi, x));
+  }
+
+  n = iv_len(cnstr->fun);
+  for (i=0; i<n; i++) {
+    x = mbqi_fun_value(mbqi, cnstr->fun[i]);
+    if (x == NULL_TERM) goto done;
+    ivector_push(&keys, cnstr->fun[i]);
+    ivector_push(&values, x);
+  }
+
+  n = iv_len(cnstr->consts);
+  for (i=0; i<n; i++) {
+    v = model_get_term_value(mbqi->model, cnstr->consts[i]);
+    if (v < 0) goto done;
+    x = convert_simple_value(terms, vtbl, v);
+    if (x < 0) goto done;
+    ivector_push(&keys, cnstr->consts[i]);
+    ivector_push(&values, x);
+  }
+
+  init_term_subst(&subst, mbqi->mngr, keys.size, keys.data, values.data);
+  x = apply_term_subst(&subst, cnstr->t);
+  delete_term_subst(&subst);
+  if (x < 0 || x == true_term) goto done;
+  ivector_push(&conj, opposite_term(x));
+
+  n = iv_len(cnstr->uvars);
+  for (i=0; i<n; i++) {
+    tau = term_type(terms, cnstr->uvars[i]);
+    if (is_uninterpreted_type(terms->types, tau)) {
+      x = mbqi_domain_constraint(mbqi, mbqi_var_constant(mbqi, cnstr->uvars[i]), tau);
+      if (x == NULL_TERM) goto done;
+      ivector_push(&conj, x);
+    }
+  }
+
+  t = mk_and(mbqi->mngr, conj.size, conj.data);
+
+ done:
+  delete_ivector(&keys);
+  delete_ivector(&values);
+  delete_ivector(&conj);
+
+  return t;
+}
+
+
+/*
+ * Check whether the main context was interrupted
+ */
+static inline bool mbqi_interrupted(mbqi_globals_t *mbqi) {
+  return smt_status(mbqi->ctx->core) == STATUS_INTERRUPTED;
+}
+
+
+/*
+ * Worker for the secondary checks:
+ * - check = array of n checks
+ * - the worker processes check[start], check[start + step], ...
+ * - it stops if the main context is interrupted
+ */
+typedef struct mbqi_worker_s {
+  mbqi_globals_t *mbqi;
+  mbqi_check_t *check;
+  uint32_t n;
+  uint32_t start;
+  uint32_t step;
+} mbqi_worker_t;
+
+static void run_mbqi_worker(mbqi_worker_t *w) {
+  mbqi_check_t *c;
+  uint32_t j;
+
+  for (j=w->start; j<w->n; j += w->step) {
+    if (mbqi_interrupted(w->mbqi)) break;
+    c = w->check + j;
+    if (c->status == STATUS_IDLE) {
+      c->status = check_context(c->ctx, NULL);
+    }
+  }
+}
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+static void *mbqi_worker_main(void *arg) {
+  run_mbqi_worker(arg);
+  return NULL;
+}
+
+/*
+ * Run the n checks in array check
+ * - use up to mbqi->num_threads threads (including the current thread)
+ */
+static void mbqi_run_checks(mbqi_globals_t *mbqi, mbqi_check_t *check, uint32_t n) {
+  mbqi_worker_t *worker;
+  pthread_t *thread;
+  bool *started;
+  uint32_t k, p;
+
+  p = mbqi->num_threads;
+  if (p > n) p = n;
+  if (p == 0) p = 1;
+
+  worker = (mbqi_worker_t *) safe_malloc(p * sizeof(mbqi_worker_t));
+  thread = (pthread_t *) safe_malloc(p * sizeof(pthread_t));
+  started = (bool *) safe_malloc(p * sizeof(bool));
+
+  for (k=0; k<p; k++) {
+    worker[k].mbqi = mbqi;
+    worker[k].check = check;
+    worker[k].n = n;
+    worker[k].start = k;
+    worker[k].step = p;
+    started[k] = false;
+  }
+
+  // worker 0 runs in this thread
+  for (k=1; k<p; k++) {
+    started[k] = (pthread_create(thread + k, NULL, mbqi_worker_main, worker + k) == 0);
+  }
+  run_mbqi_worker(worker);
+  for (k=1; k<p; k++) {
+    if (started[k]) {
+      pthread_join(thread[k], NULL);
+    } else {
+      run_mbqi_worker(worker + k);
+    }
+  }
+
+  safe_free(started);
+  safe_free(thread);
+  safe_free(worker);
+}
+
+#else
+
+/*
+ * No thread support: run the checks one after the other
+ */
+static void mbqi_run_checks(mbqi_globals_t *mbqi, mbqi_check_t *check, uint32_t n) {
+  mbqi_worker_t worker;
+
+  worker.mbqi = mbqi;
+  worker.check = check;
+  worker.n = n;
+  worker.start = 0;
+  worker.step = 1;
+  run_mbqi_worker(&worker);
+}
+
+#endif
+
+
+/*
+ * Prepare the secondary context for check c:
+ * - f = formula to check
+ * - the context status is IDLE if a check is needed
+ * - we hold the global lock so the lock-free assert is used, and
+ *   the context's final check takes the private lock
+ */
+static void mbqi_prepare_check(mbqi_globals_t *mbqi, mbqi_check_t *c, term_t f) {
+  context_t *ctx;
+  int32_t code;
+
+  ctx = (context_t *) safe_malloc(sizeof(context_t));
+  init_context(ctx, mbqi->terms, mbqi->ctx->logic, CTX_MODE_ONECHECK, mbqi->ctx->arch, false);
+#ifdef THREAD_SAFE
+  if (ctx->egraph != NULL) {
+    egraph_set_lock(ctx->egraph, &mbqi->lock);
+  }
+#endif
+  c->ctx = ctx;
+
+  code = _o_assert_formulas(ctx, 1, &f);
+  if (code < 0) {
+    c->status = STATUS_ERROR;
+  } else {
+    c->status = context_status(ctx);
+  }
+}
+
+
+/*
+ * Build the instance of constraint cidx for the counterexample
+ * found by a satisfiable check c.
+ * - return NULL_TERM if that fails
+ */
+static term_t mbqi_instance(mbqi_globals_t *mbqi, mbqi_check_t *c) {
+  term_table_t *terms;
+  quant_cnstr_t *cnstr;
+  model_t mdl;
+  value_table_t *vtbl;
+  term_subst_t subst;
+  ivector_t values;
+  uint32_t i, j, n, m;
+  type_t tau;
+  term_t x, u, t;
+  value_t v;
+
+  terms = mbqi->terms;
+  cnstr = mbqi->qtbl->data + c->cidx;
+  n = iv_len(cnstr->uvars);
+
+  init_model(&mdl, terms, true);
+  context_build_model(&mdl, c->ctx);
+  vtbl = model_get_vtbl(&mdl);
+
+  init_ivector(&values, n);
+  t = NULL_TERM;
+
+  for (i=0; i<n; i++) {
+    x = mbqi_var_constant(mbqi, cnstr->uvars[i]);
+    v = model_get_term_value(&mdl, x);
+    if (v < 0) goto done;
+
+    tau = term_type(terms, x);
+    if (is_uninterpreted_type(terms->types, tau)) {
+      // find the representative of the universe constant of the same value
+      x = NULL_TERM;
+      m = mbqi->universe.size;
+      for (j=0; j<m; j++) {
+        u = mbqi->universe.data[j];
+        if (term_type(terms, u) == tau && model_get_term_value(&mdl, u) == v) {
+          x = int_hmap_find(&mbqi->rep_map, u)->val;
+          break;
+        }
+      }
+    } else {
+      x = convert_simple_value(terms, vtbl, v);
+    }
+    if (x < 0) goto done;
+    ivector_push(&values, x);
+  }
+
+  init_term_subst(&subst, mbqi->mngr, n, cnstr->uvars, values.data);
+  t = apply_term_subst(&subst, cnstr->t);
+  delete_term_subst(&subst);
+  if (t < 0) t = NULL_TERM;
+
+ done:
+  delete_ivector(&values);
+  delete_model(&mdl);
+
+  return t;
+}
+
+
+/*
+ * Make the checks check[0 ... n-1] visible to mbqi_stop_search
+ * - check = NULL and n = 0 removes them
+ */
+static void mbqi_set_checks(mbqi_globals_t *mbqi, mbqi_check_t *check, uint32_t n) {
+#ifdef THREAD_SAFE
+  get_yices_lock(&mbqi->check_lock);
+#endif
+  mbqi->check = check;
+  mbqi->nchecks = n;
+#ifdef THREAD_SAFE
+  release_yices_lock(&mbqi->check_lock);
+#endif
+}
+
+
+/*
+ * Run a round of MBQI
+ */
+uint32_t mbqi_process_all_cnstr(mbqi_globals_t *mbqi, uint32_t max_instances, ivector_t *cnstrs, ivector_t *instances) {
+  quant_table_t *qtbl;
+  mbqi_check_t *check;
+  ivector_t formulas;
+  uint32_t i, n, nchecks, ninst;
+  term_t f;
+
+  assert(mbqi->ctx != NULL && mbqi->enabled);
+
+  mbqi->num_rounds ++;
+  ninst = 0;
+  if (max_instances == 0 || mbqi->qtbl->nquant == 0) return ninst;
+  // the search model can't be built after an interrupt
+  if (mbqi_interrupted(mbqi)) return ninst;
+
+  mbqi_build_model(mbqi);
+
+  qtbl = mbqi->qtbl;
+  n = qtbl->nquant;
+  check = (mbqi_check_t *) safe_malloc(n * sizeof(mbqi_check_t));
+  init_ivector(&formulas, n);
+  nchecks = 0;
+
+  for (i=0; i<n; i++) {
+    f = mbqi_cnstr_formula(mbqi, qtbl->data + i);
+    if (f != NULL_TERM && f != false_term) {
+      check[nchecks].cidx = i;
+      check[nchecks].ctx = NULL;
+      check[nchecks].status = STATUS_IDLE;
+      ivector_push(&formulas, f);
+      nchecks ++;
+    }
+  }
+
+  /*
+   * We're called from the egraph's final check that holds the global
+   * lock. We keep it so that the candidate model and the formulas can't
+   * be garbage collected. The secondary contexts don't take it.
+   */
+  for (i=0; i<nchecks; i++) {
+    mbqi_prepare_check(mbqi, check + i, formulas.data[i]);
+  }
+
+  mbqi_set_checks(mbqi, check, nchecks);
+  mbqi_run_checks(mbqi, check, nchecks);
+  mbqi_set_checks(mbqi, NULL, 0);
+
+  mbqi->num_checks += nchecks;
+
+  for (i=0; i<nchecks; i++) {
+    if (check[i].status == STATUS_SAT && ninst < max_instances && !mbqi_interrupted(mbqi)) {
+      f = mbqi_instance(mbqi, check + i);
+#if TRACE
+      printf("MBQI: instance of cnstr #%"PRIu32": ", check[i].cidx);
+      yices_pp_term(stdout, f, 120, 1, 0);
+#endif
+      if (f != NULL_TERM && f != true_term && int_hset_add(&mbqi->instances, f)) {
+        ivector_push(cnstrs, check[i].cidx);
+        ivector_push(instances, f);
+        ninst ++;
+      }
+    }
+    delete_context(check[i].ctx);
+    safe_free(check[i].ctx);
+  }
+
+  safe_free(check);
+  delete_ivector(&formulas);
+  mbqi_free_model(mbqi);
+
+  mbqi->num_instances += ninst;
+
+  return ninst;
+}
+
+
+/*
+ * Interrupt the secondary checks
+ * - this may be called from another thread or from a signal handler
+ *   while the checks run
+ * - if check_lock is taken, the checks are being added or removed
+ *   so none of them is running. We don't wait for the lock (the
+ *   caller may be a signal handler in the thread that holds it):
+ *   the main context is already marked as interrupted, so the
+ *   workers won't start any check.
+ */
+void mbqi_stop_search(mbqi_globals_t *mbqi) {
+  mbqi_check_t *check;
+  uint32_t i, n;
+
+#ifdef THREAD_SAFE
+  if (try_yices_lock(&mbqi->check_lock) != 0) return;
+#endif
+  n = mbqi->nchecks;
+  check = mbqi->check;
+  if (check != NULL) {
+    for (i=0; i<n; i++) {
+      if (check[i].ctx != NULL) {
+        context_stop_search(check[i].ctx);
+      }
+    }
+  }
+#ifdef THREAD_SAFE
+  release_yices_lock(&mbqi->check_lock);
+#endif
+}
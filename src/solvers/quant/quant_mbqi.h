@@ -0,0 +1,175 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MODEL-BASED QUANTIFIER INSTANTIATION
+ *
+ * This is used by the quantifier solver when e-matching does not produce
+ * new instances. A round of MBQI works as follows:
+ * - build a candidate model M from the current assignment of the main
+ *   context (egraph + satellite solvers).
+ * - for every quantifier constraint (FORALL x: B(x)), replace the
+ *   uninterpreted functions and constants of B by their value in M
+ *   (functions become lambda terms), and check (NOT B(c)) in a secondary
+ *   context, where c are fresh constants. Variables of uninterpreted
+ *   sorts range over the values of their sort in M that are the value
+ *   of some ground term of the egraph.
+ * - if the secondary context is satisfiable, B is false in M for the
+ *   counterexample c = v. The instance B(t) is generated, where t is v
+ *   for arithmetic, bitvector, Boolean, and scalar variables, or a
+ *   ground term of value v for variables of uninterpreted sorts.
+ *
+ * The secondary checks are independent. If the library is compiled
+ * with thread support, they can be run in parallel.
+ *
+ * MBQI runs in the egraph's final check, which holds the global lock.
+ * The lock is kept during the round, and the secondary contexts take
+ * a private lock instead in their own final checks. Interrupting the
+ * main context also interrupts the secondary checks.
+ */
+
+#ifndef __QUANT_MBQI_H
+#define __QUANT_MBQI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "context/context_types.h"
+#include "model/models.h"
+#include "mt/yices_locks.h"
+#include "solvers/quant/quant_cnstr.h"
+#include "terms/term_manager.h"
+#include "utils/int_hash_map.h"
+#include "utils/int_hash_sets.h"
+#include "utils/int_vectors.h"
+
+
+/*
+ * Check of a single constraint:
+ * - cidx = index of the constraint in the quant table
+ * - ctx = secondary context (NULL if there's nothing to check)
+ * - status = status returned by check_context
+ */
+typedef struct mbqi_check_s {
+  uint32_t cidx;
+  context_t *ctx;
+  smt_status_t status;
+} mbqi_check_t;
+
+
+/*
+ * MBQI globals:
+ * - ctx = main context (that includes the quantifier solver)
+ * - qtbl = link to the quant table
+ * - mngr = term manager, terms = term table
+ * - model = candidate model during a round (NULL otherwise)
+ * - var_map = maps each universal variable to the uninterpreted term
+ *   that replaces it in the secondary contexts
+ * - fun_map = maps uninterpreted functions to their value in the
+ *   candidate model as a lambda term (emptied at every round)
+ * - rep_map = maps constants of uninterpreted sorts (that represent
+ *   values in the candidate model) to a ground term of that value
+ *   (emptied at every round)
+ * - universe = constants in the domain of rep_map
+ * - instances = instances generated so far
+ * - num_threads = number of threads for the secondary checks
+ *   (0 or 1 means that they are done in the calling thread)
+ * - enabled = true if MBQI is used
+ * - check[0 ... nchecks-1] = secondary checks of the current round
+ *   (nchecks is 0 outside a round)
+ * - lock = lock taken by the secondary contexts' final checks
+ * - check_lock = protects check and nchecks, which mbqi_stop_search
+ *   reads from another thread
+ *
+ * Statistics:
+ * - num_rounds = number of rounds
+ * - num_checks = number of secondary checks
+ * - num_instances = number of instances generated
+ */
+typedef struct mbqi_globals_s {
+  context_t *ctx;
+  quant_table_t *qtbl;
+  term_manager_t *mngr;
+  term_table_t *terms;
+  model_t *model;
+
+  int_hmap_t var_map;
+  int_hmap_t fun_map;
+  int_hmap_t rep_map;
+  ivector_t universe;
+  int_hset_t instances;
+
+  uint32_t num_threads;
+  bool enabled;
+
+  mbqi_check_t *check;
+  uint32_t nchecks;
+#ifdef THREAD_SAFE
+  yices_lock_t lock;
+  yices_lock_t check_lock;
+#endif
+
+  uint32_t num_rounds;
+  uint32_t num_checks;
+  uint32_t num_instances;
+
+  ivector_t aux;
+  ivector_t aux2;
+} mbqi_globals_t;
+
+
+
+/*
+ * Initialize: MBQI is disabled until mbqi_attach is called.
+ */
+extern void init_mbqi(mbqi_globals_t *mbqi);
+
+/*
+ * Reset: detach the context and empty all tables
+ */
+extern void reset_mbqi(mbqi_globals_t *mbqi);
+
+/*
+ * Delete
+ */
+extern void delete_mbqi(mbqi_globals_t *mbqi);
+
+/*
+ * Attach the main context, the quant table, and the term manager
+ */
+extern void mbqi_attach(mbqi_globals_t *mbqi, context_t *ctx, quant_table_t *qtbl, term_manager_t *mngr);
+
+/*
+ * Run a round of MBQI
+ * - this must be called in final check, after all the other solvers
+ *   have accepted the current assignment
+ * - for every constraint that's false in the candidate model, the
+ *   constraint index is added to cnstrs and the instance to instances
+ * - at most max_instances are generated
+ * - return the number of instances generated
+ */
+extern uint32_t mbqi_process_all_cnstr(mbqi_globals_t *mbqi, uint32_t max_instances, ivector_t *cnstrs, ivector_t *instances);
+
+/*
+ * Interrupt the secondary checks of the current round if any
+ * - this is called when the main context's search is interrupted
+ */
+extern void mbqi_stop_search(mbqi_globals_t *mbqi);
+
+
+#endif /* __QUANT_MBQI_H */
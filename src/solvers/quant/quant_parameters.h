@@ -54,6 +54,14 @@ typedef enum {
 #define DEFAULT_EMATCH_MODE              ITERATE_EPSILONGREEDY
 
 
+/*
+ * Default bounds for model-based instantiation (separate from the
+ * ematching bounds: MBQI instances feed new terms to ematching)
+ */
+#define DEFAULT_MAX_MBQI_INSTANCES_PER_ROUND  4
+#define DEFAULT_MAX_MBQI_ROUNDS_PER_SEARCH    2
+
+
 /*
  * Default bounds ematching execution/trial
  */
@@ -403,6 +403,9 @@ static void quant_solver_attach_parameters(quant_solver_t *solver, ef_prob_t *pr
   uint_learner_set_alpha(&solver->cnstr_learner.learner, prob->parameters->ematch_cnstr_alpha);
   uint_learner_set_alpha(&solver->term_learner.learner, prob->parameters->ematch_term_alpha);
 
+  solver->mbqi.enabled = prob->parameters->ematch_mbqi;
+  solver->mbqi.num_threads = prob->parameters->num_threads;
+
 #if EM_VERBOSE
   printf("EMATCH CNSTR mode: %d (%s)\n", solver->cnstr_learner.iter_mode, ematchmode2string[solver->cnstr_learner.iter_mode]);
   printf("EMATCH TERM mode: %d (%s)\n", solver->term_learner.iter_mode, ematchmode2string[solver->term_learner.iter_mode]);
@@ -426,6 +429,8 @@ void quant_solver_attach_prob(quant_solver_t *solver, ef_prob_t *prob, context_t
 
   ematch_compile_all_patterns(&solver->em);
 
+  mbqi_attach(&solver->mbqi, ctx, &solver->qtbl, prob->manager);
+
   ematch_assert_all_enables(solver);
 }
 
@@ -447,12 +452,21 @@ static void init_quant_solver_statistics(quant_solver_stats_t *stat) {
 
   stat->num_rounds = 0;
 
+  stat->num_redundant = 0;
+  stat->num_true = 0;
+  stat->num_delayed = 0;
+
+  stat->num_mbqi_rounds_per_search = 0;
+
   stat->max_instances = DEFAULT_MAX_INSTANCES;
   stat->max_instances_per_search = DEFAULT_MAX_INSTANCES_PER_SEARCH;
   stat->max_instances_per_round = DEFAULT_MAX_INSTANCES_PER_ROUND;
 
   stat->max_rounds_per_search = DEFAULT_MAX_ROUNDS_PER_SEARCH;
   stat->max_search = DEFAULT_MAX_SEARCH;
+
+  stat->max_mbqi_instances_per_round = DEFAULT_MAX_MBQI_INSTANCES_PER_ROUND;
+  stat->max_mbqi_rounds_per_search = DEFAULT_MAX_MBQI_ROUNDS_PER_SEARCH;
 }
 
 
@@ -479,6 +493,7 @@ static inline void ematch_reset_start_stats(quant_solver_t *solver) {
     solver->stats.num_search++;
   solver->stats.num_instances_per_search = 0;
   solver->stats.num_rounds_per_search = 0;
+  solver->stats.num_mbqi_rounds_per_search = 0;
 
   term_learner_reset_round(&solver->term_learner, true);
   cnstr_learner_reset_round(&solver->cnstr_learner, true);
@@ -488,6 +503,27 @@ static inline void ematch_reset_round_stats(quant_solver_t *solver) {
   solver->stats.num_instances_per_round = 0;
 }
 
+/*
+ * Number of instances that can still be generated in this round
+ */
+static uint32_t ematch_instance_budget(quant_solver_t *solver) {
+  quant_solver_stats_t *stats;
+  uint32_t n;
+
+  stats = &solver->stats;
+  if (ematch_reached_instance_limit(solver)) return 0;
+
+  n = stats->max_instances - stats->num_instances;
+  if (n > stats->max_instances_per_search - stats->num_instances_per_search) {
+    n = stats->max_instances_per_search - stats->num_instances_per_search;
+  }
+  if (n > stats->max_instances_per_round - stats->num_instances_per_round) {
+    n = stats->max_instances_per_round - stats->num_instances_per_round;
+  }
+
+  return n;
+}
+
 
 
 /***********************
@@ -567,8 +603,212 @@ static term_t find_intern_mapping(intern_tbl_t *tbl, occ_t rhs) {
 }
 
 
+/*********************
+ *  INSTANCE FILTER  *
+ ********************/
+
+/*
+ * Bound on the recursion depth of quant_term_value
+ */
+#define QUANT_EVAL_DEPTH 8
+
+/*
+ * Egraph occurrence mapped to term t or null_occurrence if t is not
+ * internalized to an egraph term
+ */
+static occ_t quant_term_occ(quant_solver_t *solver, term_t t) {
+  intern_tbl_t *intern;
+  int32_t code;
+  term_t r;
+
+  intern = &solver->em.ctx->intern;
+  r = intern_tbl_find_root(intern, t);
+  if (intern_tbl_root_is_mapped(intern, unsigned_term(r))) {
+    code = intern_tbl_map_of_root(intern, unsigned_term(r));
+    if (code_is_eterm(code)) {
+      return is_neg_term(r) ? opposite_occ(code2occ(code)) : code2occ(code);
+    }
+  }
+
+  return null_occurrence;
+}
+
+/*
+ * Truth value of the ground Boolean term t in the current assignment
+ * - t is evaluated from the values of its internalized subterms, looking
+ *   through not, or, ite, and equalities between egraph terms
+ * - return VAL_TRUE or VAL_FALSE if that's enough to decide t,
+ *   VAL_UNDEF_FALSE otherwise
+ */
+static bval_t quant_term_value(quant_solver_t *solver, term_t t, uint32_t depth) {
+  term_table_t *terms;
+  intern_tbl_t *intern;
+  composite_term_t *d;
+  int32_t code;
+  occ_t x, y;
+  bval_t v, c;
+  uint32_t i;
+  term_t r;
+
+  intern = &solver->em.ctx->intern;
+  terms = intern->terms;
+
+  r = intern_tbl_find_root(intern, t);
+  if (r == true_term) return VAL_TRUE;
+  if (r == false_term) return VAL_FALSE;
+
+  if (intern_tbl_root_is_mapped(intern, unsigned_term(r))) {
+    code = intern_tbl_map_of_root(intern, unsigned_term(r));
+    if (code_is_eterm(code)) {
+      x = code2occ(code);
+      if (egraph_occ_is_true(solver->egraph, x)) {
+        v = VAL_TRUE;
+      } else if (egraph_occ_is_false(solver->egraph, x)) {
+        v = VAL_FALSE;
+      } else {
+        return VAL_UNDEF_FALSE;
+      }
+    } else {
+      v = literal_value(solver->core, code2literal(code));
+      if (bval_is_undef(v)) return VAL_UNDEF_FALSE;
+    }
+    return is_neg_term(r) ? opposite_val(v) : v;
+  }
+
+  if (depth == 0) return VAL_UNDEF_FALSE;
+
+  v = VAL_UNDEF_FALSE;
+  switch (term_kind(terms, r)) {
+  case OR_TERM:
+    d = or_term_desc(terms, r);
+    v = VAL_FALSE;
+    for (i=0; i<d->arity; i++) {
+      c = quant_term_value(solver, d->arg[i], depth - 1);
+      if (c == VAL_TRUE) {
+        v = VAL_TRUE;
+        break;
+      }
+      if (c != VAL_FALSE) {
+        v = VAL_UNDEF_FALSE;
+      }
+    }
+    break;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    d = ite_term_desc(terms, r);
+    c = quant_term_value(solver, d->arg[0], depth - 1);
+    if (c == VAL_TRUE) {
+      v = quant_term_value(solver, d->arg[1], depth - 1);
+    } else if (c == VAL_FALSE) {
+      v = quant_term_value(solver, d->arg[2], depth - 1);
+    } else {
+      v = quant_term_value(solver, d->arg[1], depth - 1);
+      if (v != quant_term_value(solver, d->arg[2], depth - 1)) {
+        v = VAL_UNDEF_FALSE;
+      }
+    }
+    break;
+
+  case EQ_TERM:
+    d = eq_term_desc(terms, r);
+    if (is_boolean_term(terms, d->arg[0])) {
+      v = quant_term_value(solver, d->arg[0], depth - 1);
+      c = quant_term_value(solver, d->arg[1], depth - 1);
+      if (bval_is_undef(v) || bval_is_undef(c)) {
+        v = VAL_UNDEF_FALSE;
+      } else {
+        v = (v == c) ? VAL_TRUE : VAL_FALSE;
+      }
+    } else {
+      x = quant_term_occ(solver, d->arg[0]);
+      y = quant_term_occ(solver, d->arg[1]);
+      if (x != null_occurrence && y != null_occurrence) {
+        if (egraph_equal_occ(solver->egraph, x, y)) {
+          v = VAL_TRUE;
+        } else if (egraph_check_diseq(solver->egraph, x, y)) {
+          v = VAL_FALSE;
+        }
+      }
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  return (is_neg_term(r) && bval_is_def(v)) ? opposite_val(v) : v;
+}
+
+/*
+ * Check whether match inst of constraint cidx is a duplicate, modulo the
+ * egraph classes, of a match instantiated earlier in this round
+ * - if not, the match is recorded in solver->rep_instances
+ */
+static bool ematch_instance_is_redundant(quant_solver_t *solver, uint32_t cidx, instance_t *inst) {
+  instance_table_t *tbl;
+  ivector_t *v;
+  uint32_t i, n;
+  int32_t k;
+
+  tbl = &solver->rep_instances;
+  v = &solver->aux_vector2;
+  ivector_reset(v);
+  for (i=0; i<inst->nelems; i++) {
+    ivector_push(v, egraph_label(solver->egraph, inst->odata[i]));
+  }
+
+  n = tbl->ninstances;
+  k = mk_instance(tbl, cidx, inst->nelems, inst->vdata, v->data);
+  ivector_reset(v);
+
+  return k < n && tbl->data[k].compile_idx == cidx;
+}
+
+/*
+ * Move delayed instances to the current round
+ * - at most as many as the instance limits allow
+ * - return the number of instances moved
+ */
+static uint32_t ematch_flush_delayed_instances(quant_solver_t *solver) {
+  ivector_t *c, *t;
+  uint32_t i, n, k;
+
+  c = &solver->delayed_cnstrs;
+  t = &solver->delayed_instances;
+  assert(c->size == t->size);
+
+  n = c->size;
+  k = ematch_instance_budget(solver);
+  if (k > n) k = n;
+
+  for (i=0; i<k; i++) {
+    ivector_push(&solver->round_cnstrs, c->data[i]);
+    ivector_push(&solver->round_instances, t->data[i]);
+  }
+  for (i=k; i<n; i++) {
+    c->data[i - k] = c->data[i];
+    t->data[i - k] = t->data[i];
+  }
+  ivector_shrink(c, n - k);
+  ivector_shrink(t, n - k);
+
+  solver->stats.num_instances_per_round += k;
+  solver->stats.num_instances_per_search += k;
+  solver->stats.num_instances += k;
+
+  return k;
+}
+
+
 /*
  * Instantiate constraint cnstr with match at index idx
+ * - duplicates modulo the egraph classes are skipped
+ * - instances that are false in the current assignment are added to
+ *   the current round. The others (true or undecided) are delayed.
+ *   Instances true in the current assignment are not dropped since
+ *   they can be needed after backtracking.
+ * - return true if the instance is added to the current round
  */
 static bool ematch_cnstr_instantiate(quant_solver_t *solver, uint32_t cidx, pattern_t *pat, uint32_t midx) {
   quant_cnstr_t *cnstr;
@@ -583,6 +823,7 @@ static bool ematch_cnstr_instantiate(quant_solver_t *solver, uint32_t cidx, patt
   term_t rhst;
   occ_t rhs;
   uint32_t term_cost;
+  bval_t v;
 
   assert(cidx < solver->qtbl.nquant);
   cnstr = solver->qtbl.data + cidx;
@@ -606,6 +847,11 @@ static bool ematch_cnstr_instantiate(quant_solver_t *solver, uint32_t cidx, patt
   assert(midx < instbl->ninstances);
   inst = instbl->data + midx;
 
+  if (ematch_instance_is_redundant(solver, cidx, inst)) {
+    solver->stats.num_redundant ++;
+    return false;
+  }
+
 #if TRACE
   printf("S%d:R%d EMATCHED: #%d cnstr%d::match%d\n",
       solver->stats.num_search,
@@ -660,12 +906,23 @@ static bool ematch_cnstr_instantiate(quant_solver_t *solver, uint32_t cidx, patt
     printf("\n");
 #endif
 
-  ivector_push(&solver->round_cnstrs, cidx);
-  ivector_push(&solver->round_instances, t);
-
   int_hset_add(instances, midx);
 
-  return true;
+  v = quant_term_value(solver, t, QUANT_EVAL_DEPTH);
+  if (v == VAL_FALSE) {
+    ivector_push(&solver->round_cnstrs, cidx);
+    ivector_push(&solver->round_instances, t);
+    return true;
+  }
+
+  if (v == VAL_TRUE) {
+    solver->stats.num_true ++;
+  }
+  solver->stats.num_delayed ++;
+  ivector_push(&solver->delayed_cnstrs, cidx);
+  ivector_push(&solver->delayed_instances, t);
+
+  return false;
 }
 
 /*
@@ -790,7 +1047,8 @@ static void ematch_process_cnstr(quant_solver_t *solver, uint32_t cidx) {
       yices_pp_term(stdout, pat->p, 120, 1, 0);
 #endif
 
-      ematch_exec_pattern(exec, pat, &cnstr->instances, solver->stats.max_instances_per_round);
+      ematch_exec_pattern(exec, pat, &cnstr->instances, quant_cnstr_done_map(cnstr, j),
+                          solver->stats.max_instances_per_round);
 
       matches = &pat->matches;
       n = matches->size;
@@ -801,13 +1059,13 @@ static void ematch_process_cnstr(quant_solver_t *solver, uint32_t cidx) {
 #if TRACE
           printf("\nSMT status: %d\n", status);
 #endif
-          assert(status == STATUS_UNSAT);
-          goto done;
+          assert(status == STATUS_UNSAT || status == STATUS_INTERRUPTED);
+          break;
         } else if(ematch_reached_instance_limit(solver)) {
 #if TRACE
           printf("\nReached max round limit after learning #%d instances\n", solver->stats.num_instances_per_round);
 #endif
-          goto done;
+          break;
         } else {
           if (ematch_cnstr_instantiate(solver, cidx, pat, matches->data[i])) {
             solver->stats.num_instances_per_round++;
@@ -816,6 +1074,12 @@ static void ematch_process_cnstr(quant_solver_t *solver, uint32_t cidx) {
           }
         }
       }
+
+      // the roots whose matches are all learnt don't need to be matched again
+      ematch_exec_commit_roots(exec, i);
+      if (i < n) {
+        goto done;
+      }
     }
   }
 
@@ -962,12 +1226,33 @@ static void ematch_process_cnstr_epsilon_greedy(quant_solver_t *solver) {
 }
 
 /*
- * Match and learn instances
+ * Add all the instances of the current round to the context
+ * - stop if the core becomes UNSAT
  */
-static void ematch_process_all_cnstr(quant_solver_t *solver) {
+static void ematch_add_round_instances(quant_solver_t *solver) {
   uint32_t i, n;
   smt_status_t status;
 
+  n = solver->round_cnstrs.size;
+  assert(n == solver->round_instances.size);
+  for(i=0; i<n; i++) {
+    status = smt_status(solver->core);
+    if (status != STATUS_SEARCHING) {
+#if TRACE
+      printf("\nSMT status: %d\n", status);
+#endif
+      assert(status == STATUS_UNSAT || status == STATUS_INTERRUPTED);
+      break;
+    }
+    ematch_add_quant_cnstr(solver, solver->round_cnstrs.data[i], solver->round_instances.data[i]);
+  }
+}
+
+/*
+ * Match and learn instances
+ */
+static void ematch_process_all_cnstr(quant_solver_t *solver) {
+
   term_learner_update_last_round(&solver->term_learner, true);
   term_learner_reset_latest(&solver->term_learner);
   term_learner_setup_extend(&solver->term_learner);
@@ -981,9 +1266,11 @@ static void ematch_process_all_cnstr(quant_solver_t *solver) {
 
   ivector_reset(&solver->round_cnstrs);
   ivector_reset(&solver->round_instances);
+  reset_instance_table(&solver->rep_instances);
 
   context_enable_quant(solver->em.ctx);
   ematch_reset_round_stats(solver);
+  ematch_start_round(&solver->em);
 
   switch(solver->cnstr_learner.iter_mode) {
   case ITERATE_RANDOM:
@@ -999,19 +1286,10 @@ static void ematch_process_all_cnstr(quant_solver_t *solver) {
     ematch_process_cnstr_all(solver);
   }
 
-  n = solver->round_cnstrs.size;
-  assert(n == solver->round_instances.size);
-  for(i=0; i<n; i++) {
-    status = smt_status(solver->core);
-    if (status != STATUS_SEARCHING) {
-#if TRACE
-      printf("\nSMT status: %d\n", status);
-#endif
-      assert(status == STATUS_UNSAT);
-      break;
-    }
-    ematch_add_quant_cnstr(solver, solver->round_cnstrs.data[i], solver->round_instances.data[i]);
+  if (solver->round_instances.size == 0) {
+    ematch_flush_delayed_instances(solver);
   }
+  ematch_add_round_instances(solver);
 
   context_disable_quant(solver->em.ctx);
 
@@ -1033,6 +1311,51 @@ static void ematch_process_all_cnstr(quant_solver_t *solver) {
 }
 
 
+/*
+ * MBQI has its own round budget: its checks are expensive and each
+ * round adds new terms that make the next ematching rounds slower.
+ */
+static inline bool mbqi_reached_round_limit(quant_solver_t *solver) {
+  return (solver->stats.num_mbqi_rounds_per_search >= solver->stats.max_mbqi_rounds_per_search);
+}
+
+/*
+ * Model-based instantiation: used when ematching does not produce
+ * any new instance.
+ * - at most max_mbqi_instances_per_round instances
+ */
+static void mbqi_process_round(quant_solver_t *solver) {
+  uint32_t n;
+
+  ivector_reset(&solver->round_cnstrs);
+  ivector_reset(&solver->round_instances);
+
+  n = ematch_instance_budget(solver);
+  if (n > solver->stats.max_mbqi_instances_per_round) {
+    n = solver->stats.max_mbqi_instances_per_round;
+  }
+  n = mbqi_process_all_cnstr(&solver->mbqi, n, &solver->round_cnstrs, &solver->round_instances);
+  solver->stats.num_mbqi_rounds_per_search ++;
+
+#if EM_VERBOSE
+  printf("S%d:R%d MBQI: learnt %d instances\n",
+      solver->stats.num_search,
+      solver->stats.num_rounds_per_search,
+      n);
+#endif
+
+  if (n > 0) {
+    context_enable_quant(solver->em.ctx);
+    ematch_add_round_instances(solver);
+    context_disable_quant(solver->em.ctx);
+
+    solver->stats.num_instances_per_round += n;
+    solver->stats.num_instances_per_search += n;
+    solver->stats.num_instances += n;
+  }
+}
+
+
 /*****************
  *  FULL SOLVER  *
  ****************/
@@ -1061,6 +1384,7 @@ void init_quant_solver(quant_solver_t *solver, smt_core_t *core,
   init_pattern_table(&solver->ptbl);
   init_quant_table(&solver->qtbl);
   init_ematch(&solver->em);
+  init_mbqi(&solver->mbqi);
 
   init_cnstr_learner(&solver->cnstr_learner, &solver->qtbl);
   init_term_learner(&solver->term_learner);
@@ -1071,6 +1395,10 @@ void init_quant_solver(quant_solver_t *solver, smt_core_t *core,
   init_ivector(&solver->round_cnstrs, 10);
   init_ivector(&solver->round_instances, 10);
 
+  init_instance_table(&solver->rep_instances);
+  init_ivector(&solver->delayed_cnstrs, 10);
+  init_ivector(&solver->delayed_instances, 10);
+
   init_ivector(&solver->aux_vector, 10);
   init_ivector(&solver->aux_vector2, 10);
   init_int_hmap(&solver->aux_map, 0);
@@ -1084,6 +1412,7 @@ void delete_quant_solver(quant_solver_t *solver) {
   delete_pattern_table(&solver->ptbl);
   delete_quant_table(&solver->qtbl);
   delete_ematch(&solver->em);
+  delete_mbqi(&solver->mbqi);
 
   delete_cnstr_learner(&solver->cnstr_learner);
   delete_term_learner(&solver->term_learner);
@@ -1094,12 +1423,24 @@ void delete_quant_solver(quant_solver_t *solver) {
   delete_ivector(&solver->round_cnstrs);
   delete_ivector(&solver->round_instances);
 
+  delete_instance_table(&solver->rep_instances);
+  delete_ivector(&solver->delayed_cnstrs);
+  delete_ivector(&solver->delayed_instances);
+
   delete_ivector(&solver->aux_vector);
   delete_ivector(&solver->aux_vector2);
   delete_int_hmap(&solver->aux_map);
 }
 
 
+/*
+ * Stop the secondary checks
+ */
+void quant_solver_stop_search(quant_solver_t *solver) {
+  mbqi_stop_search(&solver->mbqi);
+}
+
+
 /*
  * Reset
  */
@@ -1112,6 +1453,7 @@ void quant_solver_reset(quant_solver_t *solver) {
   reset_pattern_table(&solver->ptbl);
   reset_quant_table(&solver->qtbl);
   reset_ematch(&solver->em);
+  reset_mbqi(&solver->mbqi);
 
   reset_cnstr_learner(&solver->cnstr_learner);
   reset_term_learner(&solver->term_learner);
@@ -1122,6 +1464,10 @@ void quant_solver_reset(quant_solver_t *solver) {
   ivector_reset(&solver->round_cnstrs);
   ivector_reset(&solver->round_instances);
 
+  reset_instance_table(&solver->rep_instances);
+  ivector_reset(&solver->delayed_cnstrs);
+  ivector_reset(&solver->delayed_instances);
+
   ivector_reset(&solver->aux_vector);
   ivector_reset(&solver->aux_vector2);
   int_hmap_reset(&solver->aux_map);
@@ -1155,6 +1501,7 @@ void quant_solver_backtrack(quant_solver_t *solver, uint32_t back_level) {
   cnstr_learner_update_backtrack_reward(&solver->cnstr_learner, (solver->decision_level - back_level));
   term_learner_update_backtrack_reward(&solver->term_learner, (solver->decision_level - back_level));
   solver->decision_level = back_level;
+  ematch_backtrack(&solver->em);
 
 #if TRACE_LIGHT
   printf("---> QUANTSOLVER:   Backtracking to level %d\n", back_level);
@@ -1185,6 +1532,8 @@ void quant_solver_pop(quant_solver_t *solver) {
   solver->base_level --;
 
   quant_solver_backtrack(solver, solver->base_level);
+  // egraph terms may have been deleted
+  ematch_desync(&solver->em);
 }
 
 
@@ -1401,6 +1750,10 @@ fcheck_code_t quant_solver_final_check(quant_solver_t *solver) {
     }
   }
 
+  if (solver->stats.num_instances_per_round == 0 && solver->mbqi.enabled && !mbqi_reached_round_limit(solver)) {
+    mbqi_process_round(solver);
+  }
+
   solver->stats.num_rounds_per_search++;
   solver->stats.num_rounds++;
 
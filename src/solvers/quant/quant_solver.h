@@ -37,6 +37,7 @@
 #include "utils/ptr_vectors.h"
 #include "solvers/quant/ef_problem.h"
 #include "solvers/quant/quant_ematching.h"
+#include "solvers/quant/quant_mbqi.h"
 #include "solvers/quant/cnstr_learner.h"
 
 
@@ -57,12 +58,21 @@ typedef struct quant_solver_stats_s {
 
   uint32_t num_rounds;                // total number of rounds
 
+  uint32_t num_redundant;             // number of matches skipped as duplicates modulo the egraph
+  uint32_t num_true;                  // number of instances true in the current assignment
+  uint32_t num_delayed;               // number of instances delayed (including the true ones)
+
+  uint32_t num_mbqi_rounds_per_search; // number of MBQI rounds run per search
+
   uint32_t max_instances;             // max number of instances generated (total)
   uint32_t max_instances_per_search;  // max number of instances generated per search
   uint32_t max_instances_per_round;   // max number of instanced generated in each call to final_check
 
   uint32_t max_rounds_per_search;     // max number of rounds of ematching run per search
   uint32_t max_search;                // max number of searches
+
+  uint32_t max_mbqi_instances_per_round; // max number of MBQI instances generated per round
+  uint32_t max_mbqi_rounds_per_search;   // max number of MBQI rounds per search
 } quant_solver_stats_t;
 
 
@@ -96,6 +106,7 @@ typedef struct quant_solver_s {
   pattern_table_t ptbl;   // pattern table
   quant_table_t qtbl;     // quant table
   ematch_globals_t em;    // ematching
+  mbqi_globals_t mbqi;    // model-based instantiation
 
   cnstr_learner_t cnstr_learner;    // Reinforce learner for quant constraints
   term_learner_t term_learner;      // Reinforce learner for terms
@@ -106,6 +117,19 @@ typedef struct quant_solver_s {
   ivector_t round_cnstrs;
   ivector_t round_instances;
 
+  /*
+   * Instance filter:
+   * - rep_instances = matches instantiated in the current round, with
+   *   each occurrence replaced by its egraph label
+   * - instances that are not false in the current assignment are
+   *   delayed: the constraint indices and instances are stored in
+   *   delayed_cnstrs and delayed_instances. They are added in the
+   *   first round that finds no false instance.
+   */
+  instance_table_t rep_instances;
+  ivector_t delayed_cnstrs;
+  ivector_t delayed_instances;
+
 // TODO
 
   /*
@@ -211,6 +235,11 @@ extern void quant_solver_push(quant_solver_t *solver);
 extern void quant_solver_pop(quant_solver_t *solver);
 extern void quant_solver_reset(quant_solver_t *solver);
 
+/*
+ * Interrupt the secondary checks of MBQI if any
+ */
+extern void quant_solver_stop_search(quant_solver_t *solver);
+
 
 
 /********************************
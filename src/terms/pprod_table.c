@@ -390,3 +390,11 @@ void pprod_table_gc(pprod_table_t *table) {
   // clear all the marks
   clear_bitvector(table->mark, table->size);
 }
+
+
+/*
+ * Clear all the marks
+ */
+void pprod_table_clear_gc_marks(pprod_table_t *table) {
+  clear_bitvector(table->mark, table->size);
+}
@@ -154,5 +154,10 @@ extern void pprod_table_set_gc_mark(pprod_table_t *table, pprod_t *p);
  */
 extern void pprod_table_gc(pprod_table_t *table);
 
+/*
+ * Clear all the marks without deleting anything
+ */
+extern void pprod_table_clear_gc_marks(pprod_table_t *table);
+
 
 #endif /* __PPROD_TABLE_H */
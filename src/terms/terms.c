@@ -130,18 +130,20 @@ static void term_table_init(term_table_t *table, uint32_t n, type_table_t *ttbl,
   table->type = (type_t *) safe_malloc(n * sizeof(type_t));
   table->desc = (term_desc_t *) safe_malloc(n * sizeof(term_desc_t));
   table->mark = allocate_bitvector(n);
+  table->young = allocate_bitvector0(n);
 
   table->size = n;
   table->nelems = 0;
   table->free_idx = -1; // empty free list
   table->live_terms = 0;
+  table->young_terms = 0;
 
   table->types = ttbl;
   table->pprods = ptbl;
   table->finalize = default_special_finalizer;
 
   // initialize tables with default initial size
-  init_int_htbl(&table->htbl, 0);
+  init_fp_htbl(&table->htbl, 0);
   init_stbl(&table->stbl, 0);
   init_ptr_hmap(&table->ntbl, 0);
   init_int_hmap(&table->utbl, 0);
@@ -153,6 +155,12 @@ static void term_table_init(term_table_t *table, uint32_t n, type_table_t *ttbl,
   init_ivector(&table->ibuffer, 20);
   init_pvector(&table->pbuffer, 20);
 
+  // statistics
+  table->gc_stats.full_collections = 0;
+  table->gc_stats.young_collections = 0;
+  table->gc_stats.terms_reclaimed = 0;
+  table->gc_stats.types_reclaimed = 0;
+  table->gc_stats.bytes_reclaimed = 0;
 }
 
 
@@ -174,6 +182,7 @@ static void term_table_extend(term_table_t *table) {
   table->type = (type_t *) safe_realloc(table->type, n * sizeof(type_t));
   table->desc = (term_desc_t *) safe_realloc(table->desc, n * sizeof(term_desc_t));
   table->mark = extend_bitvector(table->mark, n);
+  table->young = extend_bitvector0(table->young, n, table->size);
   table->size = n;
 }
 
@@ -185,7 +194,7 @@ static void term_table_extend(term_table_t *table) {
 
 /*
  * Allocate a new term id
- * - clear its mark. Nothing else is initialized.
+ * - clear its mark and record it as young. Nothing else is initialized.
  */
 static int32_t allocate_term_id(term_table_t *table) {
   int32_t i;
@@ -202,7 +211,9 @@ static int32_t allocate_term_id(term_table_t *table) {
     assert(i < table->size);
   }
   clr_bit(table->mark, i);
+  set_bit(table->young, i);
   table->live_terms ++;
+  table->young_terms ++;
 
   return i;
 }
@@ -1522,25 +1533,29 @@ void clear_term_name(term_table_t *table, term_t t) {
  * - free the descriptor if needed
  * - remove i from the hash table
  * - then add i to the free list
+ * - return an estimate of the number of bytes freed
  *
  * IMPORTANT: i must not be accessible via the symbol table.
  * No name in the symbol table must refer to pos_term(i)
  * or neg_term(i).
  */
-static void delete_term(term_table_t *table, int32_t i) {
+static uint32_t delete_term(term_table_t *table, int32_t i) {
   composite_term_t *d;
   select_term_t *s;
   root_atom_t* r;
   bvconst_term_t *c;
   bvconst64_term_t *c64;
-  uint32_t h, n;
+  polynomial_t *p;
+  bvpoly64_t *p64;
+  bvpoly_t *bp;
+  uint32_t h, n, bytes;
   type_t tau;
 
   assert(good_term_idx(table, i));
 
   // make sure the reserved and primitive terms are
   // never deleted
-  if (i <= zero_const) return;
+  if (i <= zero_const) return 0;
 
   // deal with unit types
   tau = table->type[i];
@@ -1557,6 +1572,7 @@ static void delete_term(term_table_t *table, int32_t i) {
   }
 
   h = 0;   // stops GCC warning
+  bytes = 0;
 
   // compute hash and free descriptor
   switch (table->kind[i]) {
@@ -1602,6 +1618,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     // Generic composite
     d = table->desc[i].ptr;
     h = hash_composite_term(table->kind[i], d->arity, d->arg);
+    bytes = sizeof(composite_term_t) + d->arity * sizeof(term_t);
     safe_free(d);
     break;
 
@@ -1610,6 +1627,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     // call the finalizer before deleting the descriptor
     d = table->desc[i].ptr;
     h = hash_composite_term(table->kind[i], d->arity, d->arg);
+    bytes = sizeof(special_term_t) + d->arity * sizeof(term_t);
     table->finalize(special_desc(d), ITE_SPECIAL);
     safe_free(special_desc(d));
     break;
@@ -1619,6 +1637,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     n = d->arity;
     assert(n >= 2);
     h = hash_app_term(d->arg[0], n-1, d->arg + 1);
+    bytes = sizeof(composite_term_t) + n * sizeof(term_t);
     safe_free(d);
     break;
 
@@ -1627,6 +1646,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     n = d->arity;
     assert(n >= 3);
     h = hash_update_term(d->arg[0], n-2, d->arg + 1, d->arg[n-1]);
+    bytes = sizeof(composite_term_t) + n * sizeof(term_t);
     safe_free(d);
     break;
 
@@ -1635,6 +1655,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     n = d->arity;
     assert(n >= 2);
     h = hash_forall_term(n-1, d->arg, d->arg[n-1]);
+    bytes = sizeof(composite_term_t) + n * sizeof(term_t);
     safe_free(d);
     break;
 
@@ -1643,6 +1664,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     n = d->arity;
     assert(n >= 2);
     h = hash_lambda_term(n-1, d->arg, d->arg[n-1]);
+    bytes = sizeof(composite_term_t) + n * sizeof(term_t);
     safe_free(d);
     break;
 
@@ -1657,6 +1679,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     // Root atoms
     r = table->desc[i].ptr;
     h = hash_root_atom(r->k, r->x, r->p, r->r);
+    bytes = sizeof(root_atom_t);
     safe_free(r);
     break;
 
@@ -1672,30 +1695,39 @@ static void delete_term(term_table_t *table, int32_t i) {
     break;
 
   case ARITH_POLY:
-    h = hash_polynomial(table->desc[i].ptr);
-    free_polynomial(table->desc[i].ptr);
+    p = table->desc[i].ptr;
+    h = hash_polynomial(p);
+    bytes = sizeof(polynomial_t) + (p->nterms + 1) * sizeof(monomial_t);
+    free_polynomial(p);
     break;
 
   case BV64_CONSTANT:
     c64 = table->desc[i].ptr;
     h = hash_bvconst64_term(c64->bitsize, c64->value);
+    bytes = sizeof(bvconst64_term_t);
     safe_free(c64);
     break;
 
   case BV_CONSTANT:
     c = table->desc[i].ptr;
     h = hash_bvconst_term(c->bitsize, c->data);
+    bytes = sizeof(bvconst_term_t) + ((c->bitsize + 31) >> 5) * sizeof(uint32_t);
     safe_free(c);
     break;
 
   case BV64_POLY:
-    h = hash_bvpoly64(table->desc[i].ptr);
-    free_bvpoly64(table->desc[i].ptr);
+    p64 = table->desc[i].ptr;
+    h = hash_bvpoly64(p64);
+    bytes = sizeof(bvpoly64_t) + (p64->nterms + 1) * sizeof(bvmono64_t);
+    free_bvpoly64(p64);
     break;
 
   case BV_POLY:
-    h = hash_bvpoly(table->desc[i].ptr);
-    free_bvpoly(table->desc[i].ptr);
+    bp = table->desc[i].ptr;
+    h = hash_bvpoly(bp);
+    // the coefficients are allocated separately
+    bytes = sizeof(bvpoly_t) + (bp->nterms + 1) * sizeof(bvmono_t) + bp->nterms * bp->width * sizeof(uint32_t);
+    free_bvpoly(bp);
     break;
 
   case UNUSED_TERM:
@@ -1706,7 +1738,7 @@ static void delete_term(term_table_t *table, int32_t i) {
   }
 
   // Remove the record [h, i] from the hash-consing table
-  int_htbl_erase_record(&table->htbl, h, i);
+  fp_htbl_erase_record(&table->htbl, h, i);
 
   // Put i in the free list
  recycle:
@@ -1716,6 +1748,8 @@ static void delete_term(term_table_t *table, int32_t i) {
 
   assert(table->live_terms > 0);
   table->live_terms --;
+
+  return bytes;
 }
 
 
@@ -1884,7 +1918,7 @@ void delete_term_table(term_table_t *table) {
   delete_name_table(&table->ntbl);
   delete_term_descriptors(table);
   delete_int_hmap(&table->utbl);
-  delete_int_htbl(&table->htbl);
+  delete_fp_htbl(&table->htbl);
   delete_stbl(&table->stbl);
 
   delete_ivector(&table->ibuffer);
@@ -1894,11 +1928,13 @@ void delete_term_table(term_table_t *table) {
   safe_free(table->type);
   safe_free(table->desc);
   delete_bitvector(table->mark);
+  delete_bitvector(table->young);
 
   table->kind = NULL;
   table->type = NULL;
   table->desc = NULL;
   table->mark = NULL;
+  table->young = NULL;
 
 
 }
@@ -1932,7 +1968,7 @@ void reset_term_table(term_table_t *table) {
   reset_name_table(&table->ntbl);
   delete_term_descriptors(table);
   int_hmap_reset(&table->utbl);
-  reset_int_htbl(&table->htbl);
+  reset_fp_htbl(&table->htbl);
   reset_stbl(&table->stbl);
 
   ivector_reset(&table->ibuffer);
@@ -1941,6 +1977,8 @@ void reset_term_table(term_table_t *table) {
   table->nelems = 0;
   table->free_idx = -1;
   table->live_terms = 0;
+  table->young_terms = 0;
+  clear_bitvector(table->young, table->size);
 
   add_primitive_terms(table);
 }
@@ -2048,7 +2086,7 @@ term_t constant_term(term_table_t *table, type_t tau, int32_t index) {
   integer_hobj.tau = tau;
   integer_hobj.id = index;
 
-  i = int_htbl_get_obj(&table->htbl, &integer_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &integer_hobj.m);
 
   return pos_term(i);
 }
@@ -2136,7 +2174,7 @@ term_t ite_term(term_table_t *table, type_t tau, term_t cond, term_t left, term_
     special_hobj.arity = 3;
     special_hobj.arg = aux;
 
-    i = int_htbl_get_obj(&table->htbl, &special_hobj.m);
+    i = fp_htbl_get_obj(&table->htbl, &special_hobj.m);
 
   } else {
     composite_term_hobj_t composite_hobj;
@@ -2150,7 +2188,7 @@ term_t ite_term(term_table_t *table, type_t tau, term_t cond, term_t left, term_
     composite_hobj.arity = 3;
     composite_hobj.arg = aux;
 
-    i = int_htbl_get_obj(&table->htbl, &composite_hobj.m);
+    i = fp_htbl_get_obj(&table->htbl, &composite_hobj.m);
   }
 
   return pos_term(i);
@@ -2176,7 +2214,7 @@ term_t app_term(term_table_t *table, term_t fun, uint32_t n, const term_t arg[])
   app_hobj.n = n;
   app_hobj.arg = arg;
 
-  i = int_htbl_get_obj(&table->htbl, &app_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &app_hobj.m);
 
   return pos_term(i);
 }
@@ -2204,7 +2242,7 @@ term_t update_term(term_table_t *table, term_t fun, uint32_t n, const term_t arg
   update_hobj.n = n;
   update_hobj.arg = arg;
 
-  i = int_htbl_get_obj(&table->htbl, &update_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &update_hobj.m);
 
   return pos_term(i);
 }
@@ -2226,7 +2264,7 @@ term_t tuple_term(term_table_t *table, uint32_t n, const term_t arg[]) {
   composite_hobj.arity = n;
   composite_hobj.arg = arg;
 
-  i = int_htbl_get_obj(&table->htbl, &composite_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &composite_hobj.m);
 
   return pos_term(i);
 }
@@ -2251,7 +2289,7 @@ term_t select_term(term_table_t *table, uint32_t index, term_t tuple) {
   select_hobj.k = index;
   select_hobj.arg = tuple;
 
-  i = int_htbl_get_obj(&table->htbl, &select_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &select_hobj.m);
 
   return pos_term(i);
 }
@@ -2277,7 +2315,7 @@ static term_t binary_term(term_table_t *table, term_kind_t tag, type_t tau, term
   composite_hobj.arity = 2;
   composite_hobj.arg = aux;
 
-  i = int_htbl_get_obj(&table->htbl, &composite_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &composite_hobj.m);
 
   return pos_term(i);
 }
@@ -2298,7 +2336,7 @@ static term_t unary_term(term_table_t *table, term_kind_t tag, type_t tau, term_
   integer_hobj.tau = tau;
   integer_hobj.id = t;
 
-  i = int_htbl_get_obj(&table->htbl, &integer_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &integer_hobj.m);
 
   return pos_term(i);
 }
@@ -2328,7 +2366,7 @@ term_t distinct_term(term_table_t *table, uint32_t n, const term_t arg[]) {
   composite_hobj.arity = n;
   composite_hobj.arg = arg;
 
-  i = int_htbl_get_obj(&table->htbl, &composite_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &composite_hobj.m);
 
   return pos_term(i);
 }
@@ -2349,7 +2387,7 @@ term_t forall_term(term_table_t *table, uint32_t n, const term_t var[], term_t b
   forall_hobj.n = n;
   forall_hobj.v = var;
 
-  i = int_htbl_get_obj(&table->htbl, &forall_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &forall_hobj.m);
 
   return pos_term(i);
 }
@@ -2371,7 +2409,7 @@ term_t lambda_term(term_table_t *table, uint32_t n, const term_t var[], term_t b
   lambda_hobj.n = n;
   lambda_hobj.v = var;
 
-  i = int_htbl_get_obj(&table->htbl, &lambda_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &lambda_hobj.m);
 
   return pos_term(i);
 }
@@ -2393,7 +2431,7 @@ term_t or_term(term_table_t *table, uint32_t n, const term_t arg[]) {
   composite_hobj.arity = n;
   composite_hobj.arg = arg;
 
-  i = int_htbl_get_obj(&table->htbl, &composite_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &composite_hobj.m);
 
   return pos_term(i);
 }
@@ -2415,7 +2453,7 @@ term_t xor_term(term_table_t *table, uint32_t n, const term_t arg[]) {
   composite_hobj.arity = n;
   composite_hobj.arg = arg;
 
-  i = int_htbl_get_obj(&table->htbl, &composite_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &composite_hobj.m);
 
   return pos_term(i);
 }
@@ -2437,7 +2475,7 @@ term_t bit_term(term_table_t *table, uint32_t k, term_t bv) {
   select_hobj.k = k;
   select_hobj.arg = bv;
 
-  i = int_htbl_get_obj(&table->htbl, &select_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &select_hobj.m);
 
   return pos_term(i);
 }
@@ -2466,7 +2504,7 @@ term_t pprod_term(term_table_t *table, pprod_t *r) {
   pprod_hobj.tau = type_of_pprod(table, r);
   pprod_hobj.r = r;
 
-  i = int_htbl_get_obj(&table->htbl, &pprod_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &pprod_hobj.m);
 
   return pos_term(i);
 }
@@ -2493,7 +2531,7 @@ term_t arith_constant(term_table_t *table, rational_t *a) {
   rational_hobj.tau = tau;
   rational_hobj.a = a;
 
-  i = int_htbl_get_obj(&table->htbl, &rational_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &rational_hobj.m);
 
   return pos_term(i);
 }
@@ -2594,7 +2632,7 @@ term_t arith_root_atom(term_table_t *table, uint32_t k, term_t x, term_t p, root
   root_atom_hobj.p = p;
   root_atom_hobj.r = r;
 
-  i = int_htbl_get_obj(&table->htbl, &root_atom_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &root_atom_hobj.m);
 
   return pos_term(i);
 }
@@ -2625,7 +2663,7 @@ term_t bv64_constant(term_table_t *table, uint32_t n, uint64_t bv) {
   bvconst64_hobj.bitsize = n;
   bvconst64_hobj.v = bv;
 
-  i = int_htbl_get_obj(&table->htbl, &bvconst64_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &bvconst64_hobj.m);
 
   return pos_term(i);
 }
@@ -2650,7 +2688,7 @@ term_t bvconst_term(term_table_t *table, uint32_t n, const uint32_t *bv) {
   bvconst_hobj.bitsize = n;
   bvconst_hobj.v = bv;
 
-  i = int_htbl_get_obj(&table->htbl, &bvconst_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &bvconst_hobj.m);
 
   return pos_term(i);
 }
@@ -2674,7 +2712,7 @@ term_t bvarray_term(term_table_t *table, uint32_t n, const term_t arg[]) {
   composite_hobj.arity = n;
   composite_hobj.arg = arg;
 
-  i = int_htbl_get_obj(&table->htbl, &composite_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &composite_hobj.m);
 
   return pos_term(i);
 }
@@ -2896,7 +2934,7 @@ term_t arith_poly(term_table_t *table, rba_buffer_t *b) {
   poly_hobj.b = b;
   poly_hobj.v = v;
 
-  i = int_htbl_get_obj(&table->htbl, &poly_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &poly_hobj.m);
 
   // cleanup ibuffer
   ivector_reset(&table->ibuffer);
@@ -2952,7 +2990,7 @@ term_t bv64_poly(term_table_t *table, bvarith64_buffer_t *b) {
   bvpoly64_hobj.b = b;
   bvpoly64_hobj.v = v;
 
-  i = int_htbl_get_obj(&table->htbl, &bvpoly64_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &bvpoly64_hobj.m);
 
   // cleanup ibuffer
   ivector_reset(&table->ibuffer);
@@ -2998,7 +3036,7 @@ term_t bv_poly(term_table_t *table, bvarith_buffer_t *b) {
   bvpoly_hobj.b = b;
   bvpoly_hobj.v = v;
 
-  i = int_htbl_get_obj(&table->htbl, &bvpoly_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &bvpoly_hobj.m);
 
   // cleanup ibuffer
   ivector_reset(&table->ibuffer);
@@ -3025,7 +3063,7 @@ term_t bv_poly_from_buffer(term_table_t *table, bvpoly_buffer_t *b) {
   bvbuffer_hobj.tau = bv_type(table->types, b->bitsize);
   bvbuffer_hobj.b = b;
 
-  i = int_htbl_get_obj(&table->htbl, &bvbuffer_hobj.m);
+  i = fp_htbl_get_obj(&table->htbl, &bvbuffer_hobj.m);
 
   return pos_term(i);
 }
@@ -3406,7 +3444,7 @@ term_t find_constant_term(term_table_t *table, type_t tau, int32_t index) {
   integer_hobj.tau = tau;
   integer_hobj.id = index;
 
-  i = int_htbl_find_obj(&table->htbl, &integer_hobj.m);
+  i = fp_htbl_find_obj(&table->htbl, &integer_hobj.m);
   if (i >= 0) {
     i = pos_term(i);
   }
@@ -3653,6 +3691,39 @@ static void mark_live_terms(term_table_t *table) {
 }
 
 
+/*
+ * Young-generation marking: every old term is marked
+ * - on entry: the root terms must be marked
+ * - on exit: every young term reachable from a root term is marked
+ *   and every old term is marked. Types are not marked.
+ *
+ * Since old terms are marked before propagation, the exploration
+ * stops at old terms.
+ */
+static void mark_old_terms(term_table_t *table) {
+  uint32_t k, n;
+
+  n = (table->nelems + 7) >> 3;
+  for (k=0; k<n; k++) {
+    table->mark[k] |= (byte_t) ~table->young[k];
+  }
+}
+
+static void mark_live_young_terms(term_table_t *table) {
+  uint32_t i, n;
+
+  n = table->nelems;
+  for (i=0; i<n; i++) {
+    if (table->young[i >> 3] == 0) {
+      // skip 8 old terms
+      i |= 7;
+    } else if (tst_bit(table->young, i) && term_idx_is_marked(table, i)) {
+      mark_reachable_terms(table, i, i);
+    }
+  }
+}
+
+
 /*
  * Iterator to mark the terms accessible from the symbol table
  * - aux must be a pointer to the term table
@@ -3684,7 +3755,7 @@ static bool dead_term_symbol(void *aux, const stbl_rec_t *r) {
  * - clear all the marks
  */
 void term_table_gc(term_table_t *table, bool keep_named) {
-  uint32_t i, n;
+  uint32_t i, n, ntypes;
 
   // mark the terms present in the symbol table
   if (keep_named) {
@@ -3705,17 +3776,73 @@ void term_table_gc(term_table_t *table, bool keep_named) {
   }
 
   // force garbage collection in the type and power-product tables
+  ntypes = table->types->live_types;
   type_table_gc(table->types, keep_named);
   pprod_table_gc(table->pprods);
+  table->gc_stats.types_reclaimed += ntypes - table->types->live_types;
 
   // delete the unmarked terms
   n = table->nelems;
   for (i=0; i<n; i++) {
     if (! term_idx_is_marked(table, i) && table->kind[i] != UNUSED_TERM) {
-      delete_term(table, i);
+      table->gc_stats.bytes_reclaimed += delete_term(table, i);
+      table->gc_stats.terms_reclaimed ++;
+    }
+  }
+
+  // clear the marks: all surviving terms are now old
+  clear_bitvector(table->mark, table->size);
+  clear_bitvector(table->young, table->size);
+  table->young_terms = 0;
+  table->gc_stats.full_collections ++;
+}
+
+
+/*
+ * Young-generation collector
+ * - the type and power-product tables are not collected but
+ *   we must clear the marks set by the caller or by the propagation.
+ */
+void term_table_young_gc(term_table_t *table, bool keep_named) {
+  uint32_t i, n;
+
+  // mark the terms present in the symbol table
+  if (keep_named) {
+    stbl_iterate(&table->stbl, table, mark_symbol);
+  }
+
+  // mark the primitive terms
+  set_bit(table->mark, const_idx);
+  set_bit(table->mark, bool_const);
+  set_bit(table->mark, zero_const);
+
+  // the old terms are live
+  mark_old_terms(table);
+
+  // propagate the marks to the young terms
+  mark_live_young_terms(table);
+
+  // remove the dead young terms from the symbol table
+  if (!keep_named) {
+    stbl_remove_records(&table->stbl, table, dead_term_symbol);
+  }
+
+  // delete the unmarked young terms
+  n = table->nelems;
+  for (i=0; i<n; i++) {
+    if (table->young[i >> 3] == 0) {
+      i |= 7;
+    } else if (tst_bit(table->young, i) && !term_idx_is_marked(table, i) && table->kind[i] != UNUSED_TERM) {
+      table->gc_stats.bytes_reclaimed += delete_term(table, i);
+      table->gc_stats.terms_reclaimed ++;
     }
   }
 
   // clear the marks
   clear_bitvector(table->mark, table->size);
+  clear_bitvector(table->young, table->size);
+  type_table_clear_gc_marks(table->types);
+  pprod_table_clear_gc_marks(table->pprods);
+  table->young_terms = 0;
+  table->gc_stats.young_collections ++;
 }
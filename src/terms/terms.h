@@ -191,7 +191,7 @@
 #include "terms/types.h"
 #include "utils/bitvectors.h"
 #include "utils/int_hash_map.h"
-#include "utils/int_hash_tables.h"
+#include "utils/fingerprint_hash_tables.h"
 #include "utils/int_vectors.h"
 #include "utils/ptr_hash_map.h"
 #include "utils/ptr_vectors.h"
@@ -450,6 +450,24 @@ typedef union {
 typedef void (*special_finalizer_t)(special_term_t *spec, term_kind_t tag);
 
 
+/*
+ * Garbage-collection statistics
+ * - full_collections = number of calls to term_table_gc
+ * - young_collections = number of calls to term_table_young_gc
+ * - terms_reclaimed = total number of terms deleted
+ * - types_reclaimed = total number of types deleted
+ * - bytes_reclaimed = estimate of the memory freed by deleting
+ *   term descriptors (the table slots are recycled, not freed)
+ */
+typedef struct term_gc_stats_s {
+  uint32_t full_collections;
+  uint32_t young_collections;
+  uint64_t terms_reclaimed;
+  uint64_t types_reclaimed;
+  uint64_t bytes_reclaimed;
+} term_gc_stats_t;
+
+
 /*
  * Term table: valid terms have indices between 0 and nelems - 1
  *
@@ -458,6 +476,8 @@ typedef void (*special_finalizer_t)(special_term_t *spec, term_kind_t tag);
  * - type[i] = type
  * - desc[i] = term descriptor
  * - mark[i] = one bit used during garbage collection
+ * - young[i] = one bit: set if i was created after the last
+ *   garbage collection
  * - size = size of these arrays.
  *
  * After deletion, term indices are recycled into a free list.
@@ -467,6 +487,7 @@ typedef void (*special_finalizer_t)(special_term_t *spec, term_kind_t tag);
  *   (or -1 if i is the last element in the free list).
  *
  * - live_terms = number of actual terms = nelems - size of the free list
+ * - young_terms = number of terms created since the last garbage collection
  *
  * Symbol table and name table:
  * - stbl is a symbol table that maps names (strings) to term occurrences.
@@ -485,29 +506,35 @@ typedef void (*special_finalizer_t)(special_term_t *spec, term_kind_t tag);
  * Auxiliary vectors
  * - ibuffer: to store an array of integers
  * - pbuffer: to store an array of pprods
+ *
+ * - gc_stats: garbage-collection statistics
  */
 typedef struct term_table_s {
   uint8_t *kind;
   term_desc_t *desc;
   type_t *type;
   byte_t *mark;
+  byte_t *young;
 
   uint32_t size;
   uint32_t nelems;
   int32_t free_idx;
   uint32_t live_terms;
+  uint32_t young_terms;
 
   type_table_t *types;
   pprod_table_t *pprods;
   special_finalizer_t finalize;
 
-  int_htbl_t htbl;
+  fp_htbl_t htbl;
   stbl_t stbl;
   ptr_hmap_t ntbl;
   int_hmap_t utbl;
 
   ivector_t ibuffer;
   pvector_t pbuffer;
+
+  term_gc_stats_t gc_stats;
 } term_table_t;
 
 
@@ -1744,4 +1771,20 @@ static inline bool term_idx_is_marked(const term_table_t *table, int32_t i) {
 extern void term_table_gc(term_table_t *table, bool keep_named);
 
 
+/*
+ * Young-generation garbage collector:
+ * - only the terms created since the last garbage collection (full or
+ *   young) are candidates for deletion. All older terms are kept.
+ * - the roots are the same as for term_table_gc
+ * - types and power products are not collected.
+ * - all marks are cleared and the surviving terms become old.
+ *
+ * Terms are immutable and their subterms are created before them, so
+ * an old term can't refer to a young term. Marking starts from the
+ * young roots and stops at old terms. The cost is then proportional
+ * to the number of young terms rather than the size of the table.
+ */
+extern void term_table_young_gc(term_table_t *table, bool keep_named);
+
+
 #endif /* __TERMS_H */
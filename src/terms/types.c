@@ -3065,3 +3065,16 @@ void type_table_gc(type_table_t *table, bool keep_named)  {
   }
 
 }
+
+
+/*
+ * Clear all marks
+ */
+void type_table_clear_gc_marks(type_table_t *table) {
+  uint32_t i, n;
+
+  n = table->nelems;
+  for (i=0; i<n; i++) {
+    type_table_clr_gc_mark(table, i);
+  }
+}
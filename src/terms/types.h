@@ -1180,5 +1180,13 @@ static inline bool type_is_marked(type_table_t *tbl, type_t i) {
 extern void type_table_gc(type_table_t *tbl, bool keep_named);
 
 
+/*
+ * Clear all marks without deleting anything
+ * - this is used by the young-generation term collector,
+ *   which does not collect types.
+ */
+extern void type_table_clear_gc_marks(type_table_t *tbl);
+
+
 
 #endif /* __TYPES_H */
@@ -0,0 +1,391 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * HASH TABLES FOR HASH CONSING WITH FINGERPRINTS
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "utils/bit_tricks.h"
+#include "utils/fingerprint_hash_tables.h"
+#include "utils/memalloc.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+/*
+ * For debugging: check whether n is a power of two
+ */
+#ifndef NDEBUG
+static bool is_power_of_two(uint32_t n) {
+  return (n & (n - 1)) == 0;
+}
+#endif
+
+
+/*
+ * Fingerprint of hash code k: 7 high-order bits
+ * (the low-order bits are used to select the group).
+ */
+static inline uint8_t fingerprint(uint32_t k) {
+  return (uint8_t) (k >> 25);
+}
+
+
+/*
+ * GROUP OPERATIONS
+ *
+ * g = pointer to the FP_HTBL_GROUP_SIZE control bytes of a group.
+ * The functions return a bitmask: bit i is set if slot i of the group
+ * satisfies the condition.
+ */
+#if defined(__SSE2__)
+
+// slots whose control byte is equal to b
+static inline uint32_t group_match(const uint8_t *g, uint8_t b) {
+  __m128i ctrl;
+
+  ctrl = _mm_loadu_si128((const __m128i *) g);
+  return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char) b)));
+}
+
+// slots that are empty or deleted
+static inline uint32_t group_match_available(const uint8_t *g) {
+  return (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) g));
+}
+
+#else
+
+static inline uint32_t group_match(const uint8_t *g, uint8_t b) {
+  uint32_t i, mask;
+
+  mask = 0;
+  for (i=0; i<FP_HTBL_GROUP_SIZE; i++) {
+    if (g[i] == b) {
+      mask |= ((uint32_t) 1) << i;
+    }
+  }
+  return mask;
+}
+
+static inline uint32_t group_match_available(const uint8_t *g) {
+  uint32_t i, mask;
+
+  mask = 0;
+  for (i=0; i<FP_HTBL_GROUP_SIZE; i++) {
+    if (g[i] & 0x80) {
+      mask |= ((uint32_t) 1) << i;
+    }
+  }
+  return mask;
+}
+
+#endif
+
+static inline bool group_has_empty(const uint8_t *g) {
+  return group_match(g, FP_EMPTY) != 0;
+}
+
+
+/*
+ * Allocate arrays for a table of size n and mark all slots as empty
+ */
+static void fp_htbl_alloc(fp_htbl_t *table, uint32_t n) {
+  assert(is_power_of_two(n) && n >= FP_HTBL_GROUP_SIZE);
+
+  if (n >= FP_HTBL_MAX_SIZE) {
+    out_of_memory();
+  }
+
+  table->ctrl = (uint8_t *) safe_malloc(n * sizeof(uint8_t));
+  table->records = (int_hrec_t *) safe_malloc(n * sizeof(int_hrec_t));
+  memset(table->ctrl, FP_EMPTY, n);
+  table->size = n;
+  table->nelems = 0;
+  table->ndeleted = 0;
+  table->resize_threshold = (uint32_t) (n * FP_HTBL_RESIZE_RATIO);
+}
+
+
+/*
+ * Initialize table: n = initial size (must be a power of 2)
+ */
+void init_fp_htbl(fp_htbl_t *table, uint32_t n) {
+  if (n == 0) {
+    n = FP_HTBL_DEFAULT_SIZE;
+  }
+  if (n < FP_HTBL_GROUP_SIZE) {
+    n = FP_HTBL_GROUP_SIZE;
+  }
+  fp_htbl_alloc(table, n);
+}
+
+
+/*
+ * Delete table
+ */
+void delete_fp_htbl(fp_htbl_t *table) {
+  safe_free(table->ctrl);
+  safe_free(table->records);
+  table->ctrl = NULL;
+  table->records = NULL;
+}
+
+
+/*
+ * Reset table: remove all elements
+ */
+void reset_fp_htbl(fp_htbl_t *table) {
+  memset(table->ctrl, FP_EMPTY, table->size);
+  table->nelems = 0;
+  table->ndeleted = 0;
+}
+
+
+
+/*
+ * PROBING
+ *
+ * Groups are visited in the order g, g+1, g+3, g+6, ... (modulo the
+ * number of groups). Since the number of groups is a power of two,
+ * this visits all groups.
+ */
+static inline uint32_t group_mask(fp_htbl_t *table) {
+  return (table->size / FP_HTBL_GROUP_SIZE) - 1;
+}
+
+
+/*
+ * Find an available slot for key k (empty or deleted): return its index
+ * - there must be one
+ */
+static uint32_t fp_htbl_find_slot(fp_htbl_t *table, uint32_t k) {
+  uint32_t gmask, g, stride, m, base;
+
+  gmask = group_mask(table);
+  g = k & gmask;
+  stride = 0;
+  for (;;) {
+    base = g * FP_HTBL_GROUP_SIZE;
+    m = group_match_available(table->ctrl + base);
+    if (m != 0) {
+      return base + ctz(m);
+    }
+    stride ++;
+    g = (g + stride) & gmask;
+  }
+}
+
+
+/*
+ * Store <k, v> in slot i
+ */
+static inline void fp_htbl_store(fp_htbl_t *table, uint32_t i, uint32_t k, int32_t v) {
+  assert(i < table->size && (table->ctrl[i] & 0x80));
+
+  if (table->ctrl[i] == FP_DELETED) {
+    assert(table->ndeleted > 0);
+    table->ndeleted --;
+  }
+  table->ctrl[i] = fingerprint(k);
+  table->records[i].key = k;
+  table->records[i].value = v;
+  table->nelems ++;
+}
+
+
+/*
+ * Rebuild table: remove the deleted slots and double the size
+ * if the table is more than half full.
+ */
+static void fp_htbl_rebuild(fp_htbl_t *table) {
+  uint8_t *ctrl;
+  int_hrec_t *records;
+  uint32_t i, n, n2;
+
+  ctrl = table->ctrl;
+  records = table->records;
+  n = table->size;
+
+  n2 = n;
+  if (table->nelems > table->ndeleted) {
+    n2 = n << 1;
+    if (n2 == 0) {
+      out_of_memory();
+    }
+  }
+
+  fp_htbl_alloc(table, n2);
+  for (i=0; i<n; i++) {
+    if ((ctrl[i] & 0x80) == 0) {
+      fp_htbl_store(table, fp_htbl_find_slot(table, records[i].key), records[i].key, records[i].value);
+    }
+  }
+
+  safe_free(ctrl);
+  safe_free(records);
+}
+
+
+/*
+ * Check the fill ratio after an addition
+ */
+static inline void fp_htbl_check_size(fp_htbl_t *table) {
+  if (table->nelems + table->ndeleted > table->resize_threshold) {
+    fp_htbl_rebuild(table);
+  }
+}
+
+
+/*
+ * Erase <k, v>
+ */
+void fp_htbl_erase_record(fp_htbl_t *table, uint32_t k, int32_t v) {
+  uint32_t gmask, g, stride, m, base, i;
+  uint8_t h;
+
+  h = fingerprint(k);
+  gmask = group_mask(table);
+  g = k & gmask;
+  stride = 0;
+  for (;;) {
+    base = g * FP_HTBL_GROUP_SIZE;
+    m = group_match(table->ctrl + base, h);
+    while (m != 0) {
+      i = base + ctz(m);
+      if (table->records[i].value == v) {
+        assert(table->records[i].key == k);
+        table->nelems --;
+        /*
+         * If the group has an empty slot, no search goes past it
+         * so the slot can be marked empty.
+         */
+        if (group_has_empty(table->ctrl + base)) {
+          table->ctrl[i] = FP_EMPTY;
+        } else {
+          table->ctrl[i] = FP_DELETED;
+          table->ndeleted ++;
+        }
+        return;
+      }
+      m &= m - 1;
+    }
+    if (group_has_empty(table->ctrl + base)) return;
+    stride ++;
+    g = (g + stride) & gmask;
+  }
+}
+
+
+/*
+ * Add record <k, v> to the table
+ * - the record must not be present in the table
+ */
+void fp_htbl_add_record(fp_htbl_t *table, uint32_t k, int32_t v) {
+  fp_htbl_store(table, fp_htbl_find_slot(table, k), k, v);
+  fp_htbl_check_size(table);
+}
+
+
+/*
+ * Find index of object equal to o or return NULL_VALUE
+ */
+int32_t fp_htbl_find_obj(fp_htbl_t *table, int_hobj_t *o) {
+  uint32_t gmask, g, stride, m, base, k;
+  int_hrec_t *r;
+  uint8_t h;
+
+  k = o->hash(o);
+  h = fingerprint(k);
+  gmask = group_mask(table);
+  g = k & gmask;
+  stride = 0;
+  for (;;) {
+    base = g * FP_HTBL_GROUP_SIZE;
+    m = group_match(table->ctrl + base, h);
+    while (m != 0) {
+      r = table->records + base + ctz(m);
+      if (r->key == k && o->eq(o, r->value)) {
+        return r->value;
+      }
+      m &= m - 1;
+    }
+    if (group_has_empty(table->ctrl + base)) {
+      return NULL_VALUE;
+    }
+    stride ++;
+    g = (g + stride) & gmask;
+  }
+}
+
+
+/*
+ * Get index of an object equal to o if such an index is in the table.
+ * Otherwise, allocate an index by calling o->build(o) then store that index
+ * in the table.
+ */
+int32_t fp_htbl_get_obj(fp_htbl_t *table, int_hobj_t *o) {
+  uint32_t gmask, g, stride, m, base, k, slot;
+  int_hrec_t *r;
+  int32_t v;
+  uint8_t h;
+
+  k = o->hash(o);
+  h = fingerprint(k);
+  gmask = group_mask(table);
+  g = k & gmask;
+  stride = 0;
+  slot = UINT32_MAX; // first available slot
+
+  for (;;) {
+    base = g * FP_HTBL_GROUP_SIZE;
+    m = group_match(table->ctrl + base, h);
+    while (m != 0) {
+      r = table->records + base + ctz(m);
+      if (r->key == k && o->eq(o, r->value)) {
+        return r->value;
+      }
+      m &= m - 1;
+    }
+    if (slot == UINT32_MAX) {
+      m = group_match_available(table->ctrl + base);
+      if (m != 0) {
+        slot = base + ctz(m);
+      }
+    }
+    if (group_has_empty(table->ctrl + base)) break;
+    stride ++;
+    g = (g + stride) & gmask;
+  }
+
+  assert(slot < table->size);
+
+  v = o->build(o);
+  // error in build is signaled by returning v < 0
+  if (v >= 0) {
+    fp_htbl_store(table, slot, k, v);
+    fp_htbl_check_size(table);
+  }
+
+  return v;
+}
@@ -0,0 +1,135 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * HASH TABLES FOR HASH CONSING WITH FINGERPRINTS
+ *
+ * Same interface as int_hash_tables but with a different layout
+ * (similar to Swiss tables):
+ * - the slots are divided into groups of FP_HTBL_GROUP_SIZE
+ * - each slot has a control byte that's either EMPTY, DELETED, or
+ *   a 7bit fingerprint of the key stored in the slot.
+ * - a lookup scans a whole group at once: it compares the control
+ *   bytes of the group with the fingerprint (using SSE2 if available).
+ *   The record (and the object) are examined only for slots whose
+ *   fingerprint matches.
+ * - groups are probed in triangular order: g, g+1, g+3, g+6, ...
+ *   and the search stops at the first group that contains an empty slot.
+ *
+ * As in int_hash_tables, the table stores records <k, v> where v is
+ * a non-negative index and k is its hash code. There must not be
+ * duplicate values.
+ */
+
+#ifndef __FINGERPRINT_HASH_TABLES_H
+#define __FINGERPRINT_HASH_TABLES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "utils/int_hash_tables.h"
+
+
+/*
+ * Group size and control bytes
+ */
+#define FP_HTBL_GROUP_SIZE 16
+
+enum {
+  FP_EMPTY = 0x80,
+  FP_DELETED = 0xFE,
+};
+
+
+/*
+ * Table:
+ * - ctrl = array of control bytes
+ * - records = array of records <key, value>
+ * - size = number of slots (a power of two, multiple of FP_HTBL_GROUP_SIZE)
+ * - nelems = number of elements stored
+ * - ndeleted = number of deleted slots
+ * - resize_threshold: the table is resized or cleaned up when
+ *   nelems + ndeleted > resize_threshold
+ */
+typedef struct fp_htbl_s {
+  uint8_t *ctrl;
+  int_hrec_t *records;
+  uint32_t size;
+  uint32_t nelems;
+  uint32_t ndeleted;
+  uint32_t resize_threshold;
+} fp_htbl_t;
+
+
+/*
+ * Default and maximal size
+ */
+#define FP_HTBL_DEFAULT_SIZE 64
+#define FP_HTBL_MAX_SIZE (UINT32_MAX/sizeof(int_hrec_t))
+
+/*
+ * Resize ratio: resize_threshold = size * FP_HTBL_RESIZE_RATIO
+ * - when the threshold is reached, the table is rebuilt in place
+ *   if at least half the used slots are deleted. Otherwise, its
+ *   size is doubled.
+ */
+#define FP_HTBL_RESIZE_RATIO 0.875
+
+
+/*
+ * Initialize: empty table of size n (n must be a power of 2)
+ * If n = 0, the default initial size is used. If n is less
+ * than FP_HTBL_GROUP_SIZE, it's rounded up.
+ */
+extern void init_fp_htbl(fp_htbl_t *table, uint32_t n);
+
+/*
+ * Delete: free the allocated memory
+ */
+extern void delete_fp_htbl(fp_htbl_t *table);
+
+/*
+ * Reset: empty the table
+ */
+extern void reset_fp_htbl(fp_htbl_t *table);
+
+/*
+ * Delete record <k, v>. No effect if <k, v> is not present in table.
+ */
+extern void fp_htbl_erase_record(fp_htbl_t *table, uint32_t k, int32_t v);
+
+/*
+ * Add record <k, v> to table. The record must not be present in table.
+ */
+extern void fp_htbl_add_record(fp_htbl_t *table, uint32_t k, int32_t v);
+
+/*
+ * Get index of object equal to o if present in the hash table,
+ * return NULL_VALUE (-1) if no such object is present.
+ */
+extern int32_t fp_htbl_find_obj(fp_htbl_t *table, int_hobj_t *o);
+
+/*
+ * Get index of object equal to o if present, otherwise, build o and return
+ * the new index. If o->build(o) returns a negative number, nothing
+ * is added to the table and that number is returned.
+ */
+extern int32_t fp_htbl_get_obj(fp_htbl_t *table, int_hobj_t *o);
+
+
+#endif /* __FINGERPRINT_HASH_TABLES_H */
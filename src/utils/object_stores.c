@@ -206,7 +206,7 @@ void objstore_delete_finalize(object_store_t *s, void (*f)(void *)) {
 
 /*
  * Reset store s: remove all objects
- * - keep only one bank
+ * - keep only one bank and reuse it for the next allocations
  */
 static void _o_reset_objstore(object_store_t *s) {
   object_bank_t *b, *next;
@@ -223,8 +223,160 @@ static void _o_reset_objstore(object_store_t *s) {
 
   s->bnk = b;
   s->free_list = NULL;
-  s->free_index = 0;
+  s->free_index = (b == NULL) ? 0 : s->blocksize;
 }
 void reset_objstore(object_store_t *s) {
   MT_PROTECT_VOID(s->lock, _o_reset_objstore(s));
 }
+
+
+
+/*
+ * REGIONS
+ */
+
+/*
+ * Header of a small object
+ */
+typedef struct small_header_s {
+  uint64_t size;
+} small_header_t;
+
+
+/*
+ * Initialize r
+ */
+void init_objregion(object_region_t *r) {
+  uint32_t i, size;
+
+  for (i=0; i<REGION_NUM_CLASSES; i++) {
+    size = (i + 1) << 3;
+    init_objstore(r->store + i, size, REGION_BLOCK_SIZE/size);
+  }
+  r->large = NULL;
+  r->in_use = 0;
+  r->reserved = 0;
+}
+
+
+/*
+ * Free all the large objects
+ */
+static void free_large_objects(object_region_t *r) {
+  large_object_t *o, *next;
+
+  o = r->large;
+  while (o != NULL) {
+    next = o->next;
+    safe_free(o);
+    o = next;
+  }
+  r->large = NULL;
+}
+
+
+/*
+ * Delete r
+ */
+void delete_objregion(object_region_t *r) {
+  uint32_t i;
+
+  for (i=0; i<REGION_NUM_CLASSES; i++) {
+    delete_objstore(r->store + i);
+  }
+  free_large_objects(r);
+  r->in_use = 0;
+  r->reserved = 0;
+}
+
+
+/*
+ * Reset r
+ */
+void reset_objregion(object_region_t *r) {
+  object_store_t *s;
+  uint32_t i;
+
+  r->reserved = 0;
+  for (i=0; i<REGION_NUM_CLASSES; i++) {
+    s = r->store + i;
+    reset_objstore(s);
+    if (s->bnk != NULL) {
+      r->reserved += sizeof(object_bank_t) + s->blocksize;
+    }
+  }
+  free_large_objects(r);
+  r->in_use = 0;
+}
+
+
+/*
+ * Allocate an object of n bytes
+ */
+void *objregion_alloc(object_region_t *r, size_t n) {
+  object_store_t *s;
+  small_header_t *h;
+  large_object_t *o;
+  uint64_t size;
+
+  size = (n + sizeof(small_header_t) + 7) & ~((uint64_t) 7);
+  r->in_use += size;
+
+  if (size <= MAX_OBJ_SIZE) {
+    s = r->store + (size >> 3) - 1;
+    if (s->free_list == NULL && s->free_index == 0) {
+      // the store will allocate a new bank
+      r->reserved += sizeof(object_bank_t) + s->blocksize;
+    }
+    h = objstore_alloc(s);
+    h->size = size;
+    return h + 1;
+  }
+
+  // the data part is size - sizeof(small_header_t) bytes
+  o = (large_object_t *) safe_malloc(sizeof(large_object_t) + size - sizeof(small_header_t));
+  o->size = size;
+  o->prev = NULL;
+  o->next = r->large;
+  if (r->large != NULL) {
+    r->large->prev = o;
+  }
+  r->large = o;
+  r->reserved += sizeof(large_object_t) + size - sizeof(small_header_t);
+
+  assert(((uintptr_t) o->data & (uintptr_t) 7) == 0);
+
+  return o->data;
+}
+
+
+/*
+ * Free object p
+ */
+void objregion_free(object_region_t *r, void *p) {
+  small_header_t *h;
+  large_object_t *o;
+  uint64_t size;
+
+  h = ((small_header_t *) p) - 1;
+  size = h->size;
+  assert(size >= 16 && (size & 7) == 0 && r->in_use >= size);
+  r->in_use -= size;
+
+  if (size <= MAX_OBJ_SIZE) {
+    objstore_free(r->store + (size >> 3) - 1, h);
+  } else {
+    o = (large_object_t *) (((char *) p) - offsetof(large_object_t, data));
+    if (o->prev == NULL) {
+      assert(r->large == o);
+      r->large = o->next;
+    } else {
+      o->prev->next = o->next;
+    }
+    if (o->next != NULL) {
+      o->next->prev = o->prev;
+    }
+    r->reserved -= sizeof(large_object_t) + (size - sizeof(small_header_t));
+    safe_free(o);
+  }
+}
@@ -111,4 +111,85 @@ extern void *objstore_alloc(object_store_t *s);
 extern void objstore_free(object_store_t *s, void *object);
 
 
+
+/*
+ * REGIONS FOR OBJECTS OF VARIABLE SIZE
+ */
+
+/*
+ * A region allocates objects of arbitrary size. Objects can be freed
+ * one by one or all at once:
+ * - each object is preceded by an 8-byte header that stores its size
+ *   (header included).
+ * - small objects (size at most MAX_OBJ_SIZE) are allocated in object
+ *   stores: one store per size class (multiple of 8 bytes).
+ * - large objects are allocated with safe_malloc and kept in a
+ *   doubly-linked list.
+ *
+ * Deleting or resetting the region frees the store banks and the large
+ * objects without visiting the small objects.
+ *
+ * Accounting:
+ * - in_use = total size of the live objects (headers included)
+ * - reserved = memory obtained from safe_malloc (banks + large objects)
+ */
+#define REGION_NUM_CLASSES (MAX_OBJ_SIZE >> 3)
+#define REGION_BLOCK_SIZE 8192
+
+typedef struct large_object_s large_object_t;
+
+struct large_object_s {
+  large_object_t *next;
+  large_object_t *prev;
+  uint64_t size;  // must be last (same position as a small object's header)
+  char data[0];
+};
+
+typedef struct object_region_s {
+  object_store_t store[REGION_NUM_CLASSES];  // store[i] for objects of size 8 * (i+1)
+  large_object_t *large;                     // list of large objects
+  size_t in_use;
+  size_t reserved;
+} object_region_t;
+
+
+/*
+ * Initialize region r: nothing is allocated yet
+ */
+extern void init_objregion(object_region_t *r);
+
+/*
+ * Delete r: free all objects
+ */
+extern void delete_objregion(object_region_t *r);
+
+/*
+ * Reset r: remove all objects
+ * - each store keeps one bank
+ */
+extern void reset_objregion(object_region_t *r);
+
+/*
+ * Allocate an object of n bytes in r
+ * - the object is aligned on a multiple of 8
+ */
+extern void *objregion_alloc(object_region_t *r, size_t n);
+
+/*
+ * Free object p: p must have been allocated in r
+ */
+extern void objregion_free(object_region_t *r, void *p);
+
+/*
+ * Memory used and reserved by r (in bytes)
+ */
+static inline size_t objregion_in_use(const object_region_t *r) {
+  return r->in_use;
+}
+
+static inline size_t objregion_reserved(const object_region_t *r) {
+  return r->reserved;
+}
+
+
 #endif /* __OBJECT_STORES_H */
@@ -128,6 +128,13 @@ void string_buffer_append_string(string_buffer_t *s, const char *s1) {
   s->index += n;
 }
 
+// copy the n characters s1[0 ... n-1] in s
+void string_buffer_append_chars(string_buffer_t *s, const char *s1, uint32_t n) {
+  string_buffer_extend(s, n);
+  memcpy(s->data + s->index, s1, n);
+  s->index += n;
+}
+
 void string_buffer_append_buffer(string_buffer_t *s, string_buffer_t *s1) {
   uint32_t n;
 
@@ -0,0 +1,14 @@
+(set-logic UF)
+(set-option :yices-ef-max-samples 0)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun p (U) Bool)
+(declare-fun q (U) Bool)
+(declare-fun a () U)
+(declare-fun b () U)
+(assert (forall ((x U)) (! (=> (q x) (p (f x))) :pattern ((f x)))))
+(assert (q a))
+(assert (not (q b)))
+(assert (or (p (f a)) (not (p (f b)))))
+(check-sat)
+(exit)
@@ -0,0 +1,16 @@
+(set-info :smt-lib-version 2.6)
+(set-logic UF)
+(set-option :yices-ematch-mbqi true)
+(set-info :source | Buggy list theorem |)
+(set-info :category "crafted")
+(set-info :status sat)
+(declare-sort List 0)
+(declare-sort Elem 0)
+(declare-fun cons (Elem List) List)
+(declare-fun nil () List)
+(declare-fun car (List) Elem)
+(declare-fun cdr (List) List)
+(assert (forall ((?x Elem) (?y List)) (= (car (cons ?x ?y)) ?x)))
+(assert (not (forall ((?x1 Elem) (?y1 List) (?x2 Elem) (?y2 List)) (=> (= (cons ?x1 ?y1) (cons ?x2 ?y2)) (and (= ?x1 ?x2) (= ?y1 ?y2))))))
+(check-sat)
+(exit)
@@ -0,0 +1,15 @@
+(set-logic UF)
+(set-option :yices-ef-max-samples 0)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun g (U) U)
+(declare-fun p (U) Bool)
+(declare-fun a () U)
+(declare-fun b () U)
+(assert (forall ((x U)) (! (=> (p x) (p (f x))) :pattern ((p x)))))
+(assert (forall ((x U)) (! (= (g (f x)) (f (g x))) :pattern ((g (f x))))))
+(assert (p a))
+(assert (= (g a) b))
+(assert (or (not (p (f (f (f (f a)))))) (not (= (g (f (f a))) (f (f b))))))
+(check-sat)
+(exit)
@@ -0,0 +1,18 @@
+(set-logic UF)
+(set-option :yices-ef-max-samples 0)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun p (U) Bool)
+(declare-fun q (U) Bool)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(declare-fun d () U)
+(assert (forall ((x U)) (! (=> (q x) (p (f x))) :pattern ((f x)) :pattern ((q x)))))
+(assert (or (= a b) (= a d)))
+(assert (or (= c b) (= c d)))
+(assert (q b))
+(assert (q d))
+(assert (or (not (p (f a))) (not (p (f c)))))
+(check-sat)
+(exit)
@@ -0,0 +1,11 @@
+(set-logic LIA)
+(set-option :yices-ef-max-samples 0)
+(declare-const a Int)
+(declare-const b Int)
+(declare-const c Int)
+(assert (forall ((x Int)) (=> (and (<= 0 x) (<= x 10)) (<= x a))))
+(assert (forall ((y Int)) (=> (and (<= 0 y) (<= y 5)) (>= (- b y) 0))))
+(assert (forall ((z Int)) (=> (and (<= 0 z) (<= z 3)) (< (+ a z) (+ b 9)))))
+(assert (forall ((x Int) (y Int)) (=> (and (<= 0 x) (<= x 4) (<= 0 y) (<= y 4)) (<= (+ x y) (- c a)))))
+(check-sat)
+(exit)
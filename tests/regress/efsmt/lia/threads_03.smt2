@@ -0,0 +1,9 @@
+(set-logic LIA)
+(set-option :yices-ef-max-samples 0)
+(declare-const a Int)
+(declare-const b Int)
+(assert (forall ((x Int)) (=> (and (<= 0 x) (<= x 10)) (<= x a))))
+(assert (forall ((y Int)) (=> (and (<= 0 y) (<= y 5)) (>= (- b y) 0))))
+(assert (forall ((z Int)) (=> (and (<= 0 z) (<= z 3)) (<= (+ a b z) 17))))
+(check-sat)
+(exit)
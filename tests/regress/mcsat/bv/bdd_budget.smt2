@@ -0,0 +1,9 @@
+(set-logic QF_BV)
+(set-option :yices-mcsat-bv-bdd-budget 1)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(assert (bvult y #x10))
+(assert (bvult x y))
+(assert (= (bvmul x y) #x0c))
+(check-sat)
+(exit)
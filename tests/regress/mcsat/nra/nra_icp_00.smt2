@@ -0,0 +1,15 @@
+(set-logic QF_NRA)
+(set-option :yices-mcsat-nra-icp true)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+
+;; the bounds on x and y are narrowed from the base-level constraints
+(assert (<= (+ (* x x) (* y y)) 4))
+(assert (>= x 1))
+(assert (= (* x y) 1))
+(assert (= z (+ x y)))
+(assert (> z 2))
+
+(check-sat)
+(exit)
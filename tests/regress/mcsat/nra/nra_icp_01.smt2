@@ -0,0 +1,12 @@
+(set-logic QF_NRA)
+(set-option :yices-mcsat-nra-icp true)
+(declare-fun x () Real)
+(declare-fun y () Real)
+
+;; propagation alone shows x <= 1, which contradicts x >= 2
+(assert (<= (+ (* x x) (* y y)) 1))
+(assert (>= x 2))
+(assert (< (* x y) 3))
+
+(check-sat)
+(exit)
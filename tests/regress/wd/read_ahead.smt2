@@ -0,0 +1,6011 @@
+; input larger than several read-ahead chunks (64KB each)
+(set-logic QF_LRA)
+(declare-fun x_0000 () Real)
+(declare-fun x_0001 () Real)
+(declare-fun x_0002 () Real)
+(declare-fun x_0003 () Real)
+(declare-fun x_0004 () Real)
+(declare-fun x_0005 () Real)
+(declare-fun x_0006 () Real)
+(declare-fun x_0007 () Real)
+(declare-fun x_0008 () Real)
+(declare-fun x_0009 () Real)
+(declare-fun x_0010 () Real)
+(declare-fun x_0011 () Real)
+(declare-fun x_0012 () Real)
+(declare-fun x_0013 () Real)
+(declare-fun x_0014 () Real)
+(declare-fun x_0015 () Real)
+(declare-fun x_0016 () Real)
+(declare-fun x_0017 () Real)
+(declare-fun x_0018 () Real)
+(declare-fun x_0019 () Real)
+(declare-fun x_0020 () Real)
+(declare-fun x_0021 () Real)
+(declare-fun x_0022 () Real)
+(declare-fun x_0023 () Real)
+(declare-fun x_0024 () Real)
+(declare-fun x_0025 () Real)
+(declare-fun x_0026 () Real)
+(declare-fun x_0027 () Real)
+(declare-fun x_0028 () Real)
+(declare-fun x_0029 () Real)
+(declare-fun x_0030 () Real)
+(declare-fun x_0031 () Real)
+(declare-fun x_0032 () Real)
+(declare-fun x_0033 () Real)
+(declare-fun x_0034 () Real)
+(declare-fun x_0035 () Real)
+(declare-fun x_0036 () Real)
+(declare-fun x_0037 () Real)
+(declare-fun x_0038 () Real)
+(declare-fun x_0039 () Real)
+(declare-fun x_0040 () Real)
+(declare-fun x_0041 () Real)
+(declare-fun x_0042 () Real)
+(declare-fun x_0043 () Real)
+(declare-fun x_0044 () Real)
+(declare-fun x_0045 () Real)
+(declare-fun x_0046 () Real)
+(declare-fun x_0047 () Real)
+(declare-fun x_0048 () Real)
+(declare-fun x_0049 () Real)
+(declare-fun x_0050 () Real)
+(declare-fun x_0051 () Real)
+(declare-fun x_0052 () Real)
+(declare-fun x_0053 () Real)
+(declare-fun x_0054 () Real)
+(declare-fun x_0055 () Real)
+(declare-fun x_0056 () Real)
+(declare-fun x_0057 () Real)
+(declare-fun x_0058 () Real)
+(declare-fun x_0059 () Real)
+(declare-fun x_0060 () Real)
+(declare-fun x_0061 () Real)
+(declare-fun x_0062 () Real)
+(declare-fun x_0063 () Real)
+(declare-fun x_0064 () Real)
+(declare-fun x_0065 () Real)
+(declare-fun x_0066 () Real)
+(declare-fun x_0067 () Real)
+(declare-fun x_0068 () Real)
+(declare-fun x_0069 () Real)
+(declare-fun x_0070 () Real)
+(declare-fun x_0071 () Real)
+(declare-fun x_0072 () Real)
+(declare-fun x_0073 () Real)
+(declare-fun x_0074 () Real)
+(declare-fun x_0075 () Real)
+(declare-fun x_0076 () Real)
+(declare-fun x_0077 () Real)
+(declare-fun x_0078 () Real)
+(declare-fun x_0079 () Real)
+(declare-fun x_0080 () Real)
+(declare-fun x_0081 () Real)
+(declare-fun x_0082 () Real)
+(declare-fun x_0083 () Real)
+(declare-fun x_0084 () Real)
+(declare-fun x_0085 () Real)
+(declare-fun x_0086 () Real)
+(declare-fun x_0087 () Real)
+(declare-fun x_0088 () Real)
+(declare-fun x_0089 () Real)
+(declare-fun x_0090 () Real)
+(declare-fun x_0091 () Real)
+(declare-fun x_0092 () Real)
+(declare-fun x_0093 () Real)
+(declare-fun x_0094 () Real)
+(declare-fun x_0095 () Real)
+(declare-fun x_0096 () Real)
+(declare-fun x_0097 () Real)
+(declare-fun x_0098 () Real)
+(declare-fun x_0099 () Real)
+(declare-fun x_0100 () Real)
+(declare-fun x_0101 () Real)
+(declare-fun x_0102 () Real)
+(declare-fun x_0103 () Real)
+(declare-fun x_0104 () Real)
+(declare-fun x_0105 () Real)
+(declare-fun x_0106 () Real)
+(declare-fun x_0107 () Real)
+(declare-fun x_0108 () Real)
+(declare-fun x_0109 () Real)
+(declare-fun x_0110 () Real)
+(declare-fun x_0111 () Real)
+(declare-fun x_0112 () Real)
+(declare-fun x_0113 () Real)
+(declare-fun x_0114 () Real)
+(declare-fun x_0115 () Real)
+(declare-fun x_0116 () Real)
+(declare-fun x_0117 () Real)
+(declare-fun x_0118 () Real)
+(declare-fun x_0119 () Real)
+(declare-fun x_0120 () Real)
+(declare-fun x_0121 () Real)
+(declare-fun x_0122 () Real)
+(declare-fun x_0123 () Real)
+(declare-fun x_0124 () Real)
+(declare-fun x_0125 () Real)
+(declare-fun x_0126 () Real)
+(declare-fun x_0127 () Real)
+(declare-fun x_0128 () Real)
+(declare-fun x_0129 () Real)
+(declare-fun x_0130 () Real)
+(declare-fun x_0131 () Real)
+(declare-fun x_0132 () Real)
+(declare-fun x_0133 () Real)
+(declare-fun x_0134 () Real)
+(declare-fun x_0135 () Real)
+(declare-fun x_0136 () Real)
+(declare-fun x_0137 () Real)
+(declare-fun x_0138 () Real)
+(declare-fun x_0139 () Real)
+(declare-fun x_0140 () Real)
+(declare-fun x_0141 () Real)
+(declare-fun x_0142 () Real)
+(declare-fun x_0143 () Real)
+(declare-fun x_0144 () Real)
+(declare-fun x_0145 () Real)
+(declare-fun x_0146 () Real)
+(declare-fun x_0147 () Real)
+(declare-fun x_0148 () Real)
+(declare-fun x_0149 () Real)
+(declare-fun x_0150 () Real)
+(declare-fun x_0151 () Real)
+(declare-fun x_0152 () Real)
+(declare-fun x_0153 () Real)
+(declare-fun x_0154 () Real)
+(declare-fun x_0155 () Real)
+(declare-fun x_0156 () Real)
+(declare-fun x_0157 () Real)
+(declare-fun x_0158 () Real)
+(declare-fun x_0159 () Real)
+(declare-fun x_0160 () Real)
+(declare-fun x_0161 () Real)
+(declare-fun x_0162 () Real)
+(declare-fun x_0163 () Real)
+(declare-fun x_0164 () Real)
+(declare-fun x_0165 () Real)
+(declare-fun x_0166 () Real)
+(declare-fun x_0167 () Real)
+(declare-fun x_0168 () Real)
+(declare-fun x_0169 () Real)
+(declare-fun x_0170 () Real)
+(declare-fun x_0171 () Real)
+(declare-fun x_0172 () Real)
+(declare-fun x_0173 () Real)
+(declare-fun x_0174 () Real)
+(declare-fun x_0175 () Real)
+(declare-fun x_0176 () Real)
+(declare-fun x_0177 () Real)
+(declare-fun x_0178 () Real)
+(declare-fun x_0179 () Real)
+(declare-fun x_0180 () Real)
+(declare-fun x_0181 () Real)
+(declare-fun x_0182 () Real)
+(declare-fun x_0183 () Real)
+(declare-fun x_0184 () Real)
+(declare-fun x_0185 () Real)
+(declare-fun x_0186 () Real)
+(declare-fun x_0187 () Real)
+(declare-fun x_0188 () Real)
+(declare-fun x_0189 () Real)
+(declare-fun x_0190 () Real)
+(declare-fun x_0191 () Real)
+(declare-fun x_0192 () Real)
+(declare-fun x_0193 () Real)
+(declare-fun x_0194 () Real)
+(declare-fun x_0195 () Real)
+(declare-fun x_0196 () Real)
+(declare-fun x_0197 () Real)
+(declare-fun x_0198 () Real)
+(declare-fun x_0199 () Real)
+(declare-fun x_0200 () Real)
+(declare-fun x_0201 () Real)
+(declare-fun x_0202 () Real)
+(declare-fun x_0203 () Real)
+(declare-fun x_0204 () Real)
+(declare-fun x_0205 () Real)
+(declare-fun x_0206 () Real)
+(declare-fun x_0207 () Real)
+(declare-fun x_0208 () Real)
+(declare-fun x_0209 () Real)
+(declare-fun x_0210 () Real)
+(declare-fun x_0211 () Real)
+(declare-fun x_0212 () Real)
+(declare-fun x_0213 () Real)
+(declare-fun x_0214 () Real)
+(declare-fun x_0215 () Real)
+(declare-fun x_0216 () Real)
+(declare-fun x_0217 () Real)
+(declare-fun x_0218 () Real)
+(declare-fun x_0219 () Real)
+(declare-fun x_0220 () Real)
+(declare-fun x_0221 () Real)
+(declare-fun x_0222 () Real)
+(declare-fun x_0223 () Real)
+(declare-fun x_0224 () Real)
+(declare-fun x_0225 () Real)
+(declare-fun x_0226 () Real)
+(declare-fun x_0227 () Real)
+(declare-fun x_0228 () Real)
+(declare-fun x_0229 () Real)
+(declare-fun x_0230 () Real)
+(declare-fun x_0231 () Real)
+(declare-fun x_0232 () Real)
+(declare-fun x_0233 () Real)
+(declare-fun x_0234 () Real)
+(declare-fun x_0235 () Real)
+(declare-fun x_0236 () Real)
+(declare-fun x_0237 () Real)
+(declare-fun x_0238 () Real)
+(declare-fun x_0239 () Real)
+(declare-fun x_0240 () Real)
+(declare-fun x_0241 () Real)
+(declare-fun x_0242 () Real)
+(declare-fun x_0243 () Real)
+(declare-fun x_0244 () Real)
+(declare-fun x_0245 () Real)
+(declare-fun x_0246 () Real)
+(declare-fun x_0247 () Real)
+(declare-fun x_0248 () Real)
+(declare-fun x_0249 () Real)
+(declare-fun x_0250 () Real)
+(declare-fun x_0251 () Real)
+(declare-fun x_0252 () Real)
+(declare-fun x_0253 () Real)
+(declare-fun x_0254 () Real)
+(declare-fun x_0255 () Real)
+(declare-fun x_0256 () Real)
+(declare-fun x_0257 () Real)
+(declare-fun x_0258 () Real)
+(declare-fun x_0259 () Real)
+(declare-fun x_0260 () Real)
+(declare-fun x_0261 () Real)
+(declare-fun x_0262 () Real)
+(declare-fun x_0263 () Real)
+(declare-fun x_0264 () Real)
+(declare-fun x_0265 () Real)
+(declare-fun x_0266 () Real)
+(declare-fun x_0267 () Real)
+(declare-fun x_0268 () Real)
+(declare-fun x_0269 () Real)
+(declare-fun x_0270 () Real)
+(declare-fun x_0271 () Real)
+(declare-fun x_0272 () Real)
+(declare-fun x_0273 () Real)
+(declare-fun x_0274 () Real)
+(declare-fun x_0275 () Real)
+(declare-fun x_0276 () Real)
+(declare-fun x_0277 () Real)
+(declare-fun x_0278 () Real)
+(declare-fun x_0279 () Real)
+(declare-fun x_0280 () Real)
+(declare-fun x_0281 () Real)
+(declare-fun x_0282 () Real)
+(declare-fun x_0283 () Real)
+(declare-fun x_0284 () Real)
+(declare-fun x_0285 () Real)
+(declare-fun x_0286 () Real)
+(declare-fun x_0287 () Real)
+(declare-fun x_0288 () Real)
+(declare-fun x_0289 () Real)
+(declare-fun x_0290 () Real)
+(declare-fun x_0291 () Real)
+(declare-fun x_0292 () Real)
+(declare-fun x_0293 () Real)
+(declare-fun x_0294 () Real)
+(declare-fun x_0295 () Real)
+(declare-fun x_0296 () Real)
+(declare-fun x_0297 () Real)
+(declare-fun x_0298 () Real)
+(declare-fun x_0299 () Real)
+(declare-fun x_0300 () Real)
+(declare-fun x_0301 () Real)
+(declare-fun x_0302 () Real)
+(declare-fun x_0303 () Real)
+(declare-fun x_0304 () Real)
+(declare-fun x_0305 () Real)
+(declare-fun x_0306 () Real)
+(declare-fun x_0307 () Real)
+(declare-fun x_0308 () Real)
+(declare-fun x_0309 () Real)
+(declare-fun x_0310 () Real)
+(declare-fun x_0311 () Real)
+(declare-fun x_0312 () Real)
+(declare-fun x_0313 () Real)
+(declare-fun x_0314 () Real)
+(declare-fun x_0315 () Real)
+(declare-fun x_0316 () Real)
+(declare-fun x_0317 () Real)
+(declare-fun x_0318 () Real)
+(declare-fun x_0319 () Real)
+(declare-fun x_0320 () Real)
+(declare-fun x_0321 () Real)
+(declare-fun x_0322 () Real)
+(declare-fun x_0323 () Real)
+(declare-fun x_0324 () Real)
+(declare-fun x_0325 () Real)
+(declare-fun x_0326 () Real)
+(declare-fun x_0327 () Real)
+(declare-fun x_0328 () Real)
+(declare-fun x_0329 () Real)
+(declare-fun x_0330 () Real)
+(declare-fun x_0331 () Real)
+(declare-fun x_0332 () Real)
+(declare-fun x_0333 () Real)
+(declare-fun x_0334 () Real)
+(declare-fun x_0335 () Real)
+(declare-fun x_0336 () Real)
+(declare-fun x_0337 () Real)
+(declare-fun x_0338 () Real)
+(declare-fun x_0339 () Real)
+(declare-fun x_0340 () Real)
+(declare-fun x_0341 () Real)
+(declare-fun x_0342 () Real)
+(declare-fun x_0343 () Real)
+(declare-fun x_0344 () Real)
+(declare-fun x_0345 () Real)
+(declare-fun x_0346 () Real)
+(declare-fun x_0347 () Real)
+(declare-fun x_0348 () Real)
+(declare-fun x_0349 () Real)
+(declare-fun x_0350 () Real)
+(declare-fun x_0351 () Real)
+(declare-fun x_0352 () Real)
+(declare-fun x_0353 () Real)
+(declare-fun x_0354 () Real)
+(declare-fun x_0355 () Real)
+(declare-fun x_0356 () Real)
+(declare-fun x_0357 () Real)
+(declare-fun x_0358 () Real)
+(declare-fun x_0359 () Real)
+(declare-fun x_0360 () Real)
+(declare-fun x_0361 () Real)
+(declare-fun x_0362 () Real)
+(declare-fun x_0363 () Real)
+(declare-fun x_0364 () Real)
+(declare-fun x_0365 () Real)
+(declare-fun x_0366 () Real)
+(declare-fun x_0367 () Real)
+(declare-fun x_0368 () Real)
+(declare-fun x_0369 () Real)
+(declare-fun x_0370 () Real)
+(declare-fun x_0371 () Real)
+(declare-fun x_0372 () Real)
+(declare-fun x_0373 () Real)
+(declare-fun x_0374 () Real)
+(declare-fun x_0375 () Real)
+(declare-fun x_0376 () Real)
+(declare-fun x_0377 () Real)
+(declare-fun x_0378 () Real)
+(declare-fun x_0379 () Real)
+(declare-fun x_0380 () Real)
+(declare-fun x_0381 () Real)
+(declare-fun x_0382 () Real)
+(declare-fun x_0383 () Real)
+(declare-fun x_0384 () Real)
+(declare-fun x_0385 () Real)
+(declare-fun x_0386 () Real)
+(declare-fun x_0387 () Real)
+(declare-fun x_0388 () Real)
+(declare-fun x_0389 () Real)
+(declare-fun x_0390 () Real)
+(declare-fun x_0391 () Real)
+(declare-fun x_0392 () Real)
+(declare-fun x_0393 () Real)
+(declare-fun x_0394 () Real)
+(declare-fun x_0395 () Real)
+(declare-fun x_0396 () Real)
+(declare-fun x_0397 () Real)
+(declare-fun x_0398 () Real)
+(declare-fun x_0399 () Real)
+(declare-fun x_0400 () Real)
+(declare-fun x_0401 () Real)
+(declare-fun x_0402 () Real)
+(declare-fun x_0403 () Real)
+(declare-fun x_0404 () Real)
+(declare-fun x_0405 () Real)
+(declare-fun x_0406 () Real)
+(declare-fun x_0407 () Real)
+(declare-fun x_0408 () Real)
+(declare-fun x_0409 () Real)
+(declare-fun x_0410 () Real)
+(declare-fun x_0411 () Real)
+(declare-fun x_0412 () Real)
+(declare-fun x_0413 () Real)
+(declare-fun x_0414 () Real)
+(declare-fun x_0415 () Real)
+(declare-fun x_0416 () Real)
+(declare-fun x_0417 () Real)
+(declare-fun x_0418 () Real)
+(declare-fun x_0419 () Real)
+(declare-fun x_0420 () Real)
+(declare-fun x_0421 () Real)
+(declare-fun x_0422 () Real)
+(declare-fun x_0423 () Real)
+(declare-fun x_0424 () Real)
+(declare-fun x_0425 () Real)
+(declare-fun x_0426 () Real)
+(declare-fun x_0427 () Real)
+(declare-fun x_0428 () Real)
+(declare-fun x_0429 () Real)
+(declare-fun x_0430 () Real)
+(declare-fun x_0431 () Real)
+(declare-fun x_0432 () Real)
+(declare-fun x_0433 () Real)
+(declare-fun x_0434 () Real)
+(declare-fun x_0435 () Real)
+(declare-fun x_0436 () Real)
+(declare-fun x_0437 () Real)
+(declare-fun x_0438 () Real)
+(declare-fun x_0439 () Real)
+(declare-fun x_0440 () Real)
+(declare-fun x_0441 () Real)
+(declare-fun x_0442 () Real)
+(declare-fun x_0443 () Real)
+(declare-fun x_0444 () Real)
+(declare-fun x_0445 () Real)
+(declare-fun x_0446 () Real)
+(declare-fun x_0447 () Real)
+(declare-fun x_0448 () Real)
+(declare-fun x_0449 () Real)
+(declare-fun x_0450 () Real)
+(declare-fun x_0451 () Real)
+(declare-fun x_0452 () Real)
+(declare-fun x_0453 () Real)
+(declare-fun x_0454 () Real)
+(declare-fun x_0455 () Real)
+(declare-fun x_0456 () Real)
+(declare-fun x_0457 () Real)
+(declare-fun x_0458 () Real)
+(declare-fun x_0459 () Real)
+(declare-fun x_0460 () Real)
+(declare-fun x_0461 () Real)
+(declare-fun x_0462 () Real)
+(declare-fun x_0463 () Real)
+(declare-fun x_0464 () Real)
+(declare-fun x_0465 () Real)
+(declare-fun x_0466 () Real)
+(declare-fun x_0467 () Real)
+(declare-fun x_0468 () Real)
+(declare-fun x_0469 () Real)
+(declare-fun x_0470 () Real)
+(declare-fun x_0471 () Real)
+(declare-fun x_0472 () Real)
+(declare-fun x_0473 () Real)
+(declare-fun x_0474 () Real)
+(declare-fun x_0475 () Real)
+(declare-fun x_0476 () Real)
+(declare-fun x_0477 () Real)
+(declare-fun x_0478 () Real)
+(declare-fun x_0479 () Real)
+(declare-fun x_0480 () Real)
+(declare-fun x_0481 () Real)
+(declare-fun x_0482 () Real)
+(declare-fun x_0483 () Real)
+(declare-fun x_0484 () Real)
+(declare-fun x_0485 () Real)
+(declare-fun x_0486 () Real)
+(declare-fun x_0487 () Real)
+(declare-fun x_0488 () Real)
+(declare-fun x_0489 () Real)
+(declare-fun x_0490 () Real)
+(declare-fun x_0491 () Real)
+(declare-fun x_0492 () Real)
+(declare-fun x_0493 () Real)
+(declare-fun x_0494 () Real)
+(declare-fun x_0495 () Real)
+(declare-fun x_0496 () Real)
+(declare-fun x_0497 () Real)
+(declare-fun x_0498 () Real)
+(declare-fun x_0499 () Real)
+(declare-fun x_0500 () Real)
+(declare-fun x_0501 () Real)
+(declare-fun x_0502 () Real)
+(declare-fun x_0503 () Real)
+(declare-fun x_0504 () Real)
+(declare-fun x_0505 () Real)
+(declare-fun x_0506 () Real)
+(declare-fun x_0507 () Real)
+(declare-fun x_0508 () Real)
+(declare-fun x_0509 () Real)
+(declare-fun x_0510 () Real)
+(declare-fun x_0511 () Real)
+(declare-fun x_0512 () Real)
+(declare-fun x_0513 () Real)
+(declare-fun x_0514 () Real)
+(declare-fun x_0515 () Real)
+(declare-fun x_0516 () Real)
+(declare-fun x_0517 () Real)
+(declare-fun x_0518 () Real)
+(declare-fun x_0519 () Real)
+(declare-fun x_0520 () Real)
+(declare-fun x_0521 () Real)
+(declare-fun x_0522 () Real)
+(declare-fun x_0523 () Real)
+(declare-fun x_0524 () Real)
+(declare-fun x_0525 () Real)
+(declare-fun x_0526 () Real)
+(declare-fun x_0527 () Real)
+(declare-fun x_0528 () Real)
+(declare-fun x_0529 () Real)
+(declare-fun x_0530 () Real)
+(declare-fun x_0531 () Real)
+(declare-fun x_0532 () Real)
+(declare-fun x_0533 () Real)
+(declare-fun x_0534 () Real)
+(declare-fun x_0535 () Real)
+(declare-fun x_0536 () Real)
+(declare-fun x_0537 () Real)
+(declare-fun x_0538 () Real)
+(declare-fun x_0539 () Real)
+(declare-fun x_0540 () Real)
+(declare-fun x_0541 () Real)
+(declare-fun x_0542 () Real)
+(declare-fun x_0543 () Real)
+(declare-fun x_0544 () Real)
+(declare-fun x_0545 () Real)
+(declare-fun x_0546 () Real)
+(declare-fun x_0547 () Real)
+(declare-fun x_0548 () Real)
+(declare-fun x_0549 () Real)
+(declare-fun x_0550 () Real)
+(declare-fun x_0551 () Real)
+(declare-fun x_0552 () Real)
+(declare-fun x_0553 () Real)
+(declare-fun x_0554 () Real)
+(declare-fun x_0555 () Real)
+(declare-fun x_0556 () Real)
+(declare-fun x_0557 () Real)
+(declare-fun x_0558 () Real)
+(declare-fun x_0559 () Real)
+(declare-fun x_0560 () Real)
+(declare-fun x_0561 () Real)
+(declare-fun x_0562 () Real)
+(declare-fun x_0563 () Real)
+(declare-fun x_0564 () Real)
+(declare-fun x_0565 () Real)
+(declare-fun x_0566 () Real)
+(declare-fun x_0567 () Real)
+(declare-fun x_0568 () Real)
+(declare-fun x_0569 () Real)
+(declare-fun x_0570 () Real)
+(declare-fun x_0571 () Real)
+(declare-fun x_0572 () Real)
+(declare-fun x_0573 () Real)
+(declare-fun x_0574 () Real)
+(declare-fun x_0575 () Real)
+(declare-fun x_0576 () Real)
+(declare-fun x_0577 () Real)
+(declare-fun x_0578 () Real)
+(declare-fun x_0579 () Real)
+(declare-fun x_0580 () Real)
+(declare-fun x_0581 () Real)
+(declare-fun x_0582 () Real)
+(declare-fun x_0583 () Real)
+(declare-fun x_0584 () Real)
+(declare-fun x_0585 () Real)
+(declare-fun x_0586 () Real)
+(declare-fun x_0587 () Real)
+(declare-fun x_0588 () Real)
+(declare-fun x_0589 () Real)
+(declare-fun x_0590 () Real)
+(declare-fun x_0591 () Real)
+(declare-fun x_0592 () Real)
+(declare-fun x_0593 () Real)
+(declare-fun x_0594 () Real)
+(declare-fun x_0595 () Real)
+(declare-fun x_0596 () Real)
+(declare-fun x_0597 () Real)
+(declare-fun x_0598 () Real)
+(declare-fun x_0599 () Real)
+(declare-fun x_0600 () Real)
+(declare-fun x_0601 () Real)
+(declare-fun x_0602 () Real)
+(declare-fun x_0603 () Real)
+(declare-fun x_0604 () Real)
+(declare-fun x_0605 () Real)
+(declare-fun x_0606 () Real)
+(declare-fun x_0607 () Real)
+(declare-fun x_0608 () Real)
+(declare-fun x_0609 () Real)
+(declare-fun x_0610 () Real)
+(declare-fun x_0611 () Real)
+(declare-fun x_0612 () Real)
+(declare-fun x_0613 () Real)
+(declare-fun x_0614 () Real)
+(declare-fun x_0615 () Real)
+(declare-fun x_0616 () Real)
+(declare-fun x_0617 () Real)
+(declare-fun x_0618 () Real)
+(declare-fun x_0619 () Real)
+(declare-fun x_0620 () Real)
+(declare-fun x_0621 () Real)
+(declare-fun x_0622 () Real)
+(declare-fun x_0623 () Real)
+(declare-fun x_0624 () Real)
+(declare-fun x_0625 () Real)
+(declare-fun x_0626 () Real)
+(declare-fun x_0627 () Real)
+(declare-fun x_0628 () Real)
+(declare-fun x_0629 () Real)
+(declare-fun x_0630 () Real)
+(declare-fun x_0631 () Real)
+(declare-fun x_0632 () Real)
+(declare-fun x_0633 () Real)
+(declare-fun x_0634 () Real)
+(declare-fun x_0635 () Real)
+(declare-fun x_0636 () Real)
+(declare-fun x_0637 () Real)
+(declare-fun x_0638 () Real)
+(declare-fun x_0639 () Real)
+(declare-fun x_0640 () Real)
+(declare-fun x_0641 () Real)
+(declare-fun x_0642 () Real)
+(declare-fun x_0643 () Real)
+(declare-fun x_0644 () Real)
+(declare-fun x_0645 () Real)
+(declare-fun x_0646 () Real)
+(declare-fun x_0647 () Real)
+(declare-fun x_0648 () Real)
+(declare-fun x_0649 () Real)
+(declare-fun x_0650 () Real)
+(declare-fun x_0651 () Real)
+(declare-fun x_0652 () Real)
+(declare-fun x_0653 () Real)
+(declare-fun x_0654 () Real)
+(declare-fun x_0655 () Real)
+(declare-fun x_0656 () Real)
+(declare-fun x_0657 () Real)
+(declare-fun x_0658 () Real)
+(declare-fun x_0659 () Real)
+(declare-fun x_0660 () Real)
+(declare-fun x_0661 () Real)
+(declare-fun x_0662 () Real)
+(declare-fun x_0663 () Real)
+(declare-fun x_0664 () Real)
+(declare-fun x_0665 () Real)
+(declare-fun x_0666 () Real)
+(declare-fun x_0667 () Real)
+(declare-fun x_0668 () Real)
+(declare-fun x_0669 () Real)
+(declare-fun x_0670 () Real)
+(declare-fun x_0671 () Real)
+(declare-fun x_0672 () Real)
+(declare-fun x_0673 () Real)
+(declare-fun x_0674 () Real)
+(declare-fun x_0675 () Real)
+(declare-fun x_0676 () Real)
+(declare-fun x_0677 () Real)
+(declare-fun x_0678 () Real)
+(declare-fun x_0679 () Real)
+(declare-fun x_0680 () Real)
+(declare-fun x_0681 () Real)
+(declare-fun x_0682 () Real)
+(declare-fun x_0683 () Real)
+(declare-fun x_0684 () Real)
+(declare-fun x_0685 () Real)
+(declare-fun x_0686 () Real)
+(declare-fun x_0687 () Real)
+(declare-fun x_0688 () Real)
+(declare-fun x_0689 () Real)
+(declare-fun x_0690 () Real)
+(declare-fun x_0691 () Real)
+(declare-fun x_0692 () Real)
+(declare-fun x_0693 () Real)
+(declare-fun x_0694 () Real)
+(declare-fun x_0695 () Real)
+(declare-fun x_0696 () Real)
+(declare-fun x_0697 () Real)
+(declare-fun x_0698 () Real)
+(declare-fun x_0699 () Real)
+(declare-fun x_0700 () Real)
+(declare-fun x_0701 () Real)
+(declare-fun x_0702 () Real)
+(declare-fun x_0703 () Real)
+(declare-fun x_0704 () Real)
+(declare-fun x_0705 () Real)
+(declare-fun x_0706 () Real)
+(declare-fun x_0707 () Real)
+(declare-fun x_0708 () Real)
+(declare-fun x_0709 () Real)
+(declare-fun x_0710 () Real)
+(declare-fun x_0711 () Real)
+(declare-fun x_0712 () Real)
+(declare-fun x_0713 () Real)
+(declare-fun x_0714 () Real)
+(declare-fun x_0715 () Real)
+(declare-fun x_0716 () Real)
+(declare-fun x_0717 () Real)
+(declare-fun x_0718 () Real)
+(declare-fun x_0719 () Real)
+(declare-fun x_0720 () Real)
+(declare-fun x_0721 () Real)
+(declare-fun x_0722 () Real)
+(declare-fun x_0723 () Real)
+(declare-fun x_0724 () Real)
+(declare-fun x_0725 () Real)
+(declare-fun x_0726 () Real)
+(declare-fun x_0727 () Real)
+(declare-fun x_0728 () Real)
+(declare-fun x_0729 () Real)
+(declare-fun x_0730 () Real)
+(declare-fun x_0731 () Real)
+(declare-fun x_0732 () Real)
+(declare-fun x_0733 () Real)
+(declare-fun x_0734 () Real)
+(declare-fun x_0735 () Real)
+(declare-fun x_0736 () Real)
+(declare-fun x_0737 () Real)
+(declare-fun x_0738 () Real)
+(declare-fun x_0739 () Real)
+(declare-fun x_0740 () Real)
+(declare-fun x_0741 () Real)
+(declare-fun x_0742 () Real)
+(declare-fun x_0743 () Real)
+(declare-fun x_0744 () Real)
+(declare-fun x_0745 () Real)
+(declare-fun x_0746 () Real)
+(declare-fun x_0747 () Real)
+(declare-fun x_0748 () Real)
+(declare-fun x_0749 () Real)
+(declare-fun x_0750 () Real)
+(declare-fun x_0751 () Real)
+(declare-fun x_0752 () Real)
+(declare-fun x_0753 () Real)
+(declare-fun x_0754 () Real)
+(declare-fun x_0755 () Real)
+(declare-fun x_0756 () Real)
+(declare-fun x_0757 () Real)
+(declare-fun x_0758 () Real)
+(declare-fun x_0759 () Real)
+(declare-fun x_0760 () Real)
+(declare-fun x_0761 () Real)
+(declare-fun x_0762 () Real)
+(declare-fun x_0763 () Real)
+(declare-fun x_0764 () Real)
+(declare-fun x_0765 () Real)
+(declare-fun x_0766 () Real)
+(declare-fun x_0767 () Real)
+(declare-fun x_0768 () Real)
+(declare-fun x_0769 () Real)
+(declare-fun x_0770 () Real)
+(declare-fun x_0771 () Real)
+(declare-fun x_0772 () Real)
+(declare-fun x_0773 () Real)
+(declare-fun x_0774 () Real)
+(declare-fun x_0775 () Real)
+(declare-fun x_0776 () Real)
+(declare-fun x_0777 () Real)
+(declare-fun x_0778 () Real)
+(declare-fun x_0779 () Real)
+(declare-fun x_0780 () Real)
+(declare-fun x_0781 () Real)
+(declare-fun x_0782 () Real)
+(declare-fun x_0783 () Real)
+(declare-fun x_0784 () Real)
+(declare-fun x_0785 () Real)
+(declare-fun x_0786 () Real)
+(declare-fun x_0787 () Real)
+(declare-fun x_0788 () Real)
+(declare-fun x_0789 () Real)
+(declare-fun x_0790 () Real)
+(declare-fun x_0791 () Real)
+(declare-fun x_0792 () Real)
+(declare-fun x_0793 () Real)
+(declare-fun x_0794 () Real)
+(declare-fun x_0795 () Real)
+(declare-fun x_0796 () Real)
+(declare-fun x_0797 () Real)
+(declare-fun x_0798 () Real)
+(declare-fun x_0799 () Real)
+(declare-fun x_0800 () Real)
+(declare-fun x_0801 () Real)
+(declare-fun x_0802 () Real)
+(declare-fun x_0803 () Real)
+(declare-fun x_0804 () Real)
+(declare-fun x_0805 () Real)
+(declare-fun x_0806 () Real)
+(declare-fun x_0807 () Real)
+(declare-fun x_0808 () Real)
+(declare-fun x_0809 () Real)
+(declare-fun x_0810 () Real)
+(declare-fun x_0811 () Real)
+(declare-fun x_0812 () Real)
+(declare-fun x_0813 () Real)
+(declare-fun x_0814 () Real)
+(declare-fun x_0815 () Real)
+(declare-fun x_0816 () Real)
+(declare-fun x_0817 () Real)
+(declare-fun x_0818 () Real)
+(declare-fun x_0819 () Real)
+(declare-fun x_0820 () Real)
+(declare-fun x_0821 () Real)
+(declare-fun x_0822 () Real)
+(declare-fun x_0823 () Real)
+(declare-fun x_0824 () Real)
+(declare-fun x_0825 () Real)
+(declare-fun x_0826 () Real)
+(declare-fun x_0827 () Real)
+(declare-fun x_0828 () Real)
+(declare-fun x_0829 () Real)
+(declare-fun x_0830 () Real)
+(declare-fun x_0831 () Real)
+(declare-fun x_0832 () Real)
+(declare-fun x_0833 () Real)
+(declare-fun x_0834 () Real)
+(declare-fun x_0835 () Real)
+(declare-fun x_0836 () Real)
+(declare-fun x_0837 () Real)
+(declare-fun x_0838 () Real)
+(declare-fun x_0839 () Real)
+(declare-fun x_0840 () Real)
+(declare-fun x_0841 () Real)
+(declare-fun x_0842 () Real)
+(declare-fun x_0843 () Real)
+(declare-fun x_0844 () Real)
+(declare-fun x_0845 () Real)
+(declare-fun x_0846 () Real)
+(declare-fun x_0847 () Real)
+(declare-fun x_0848 () Real)
+(declare-fun x_0849 () Real)
+(declare-fun x_0850 () Real)
+(declare-fun x_0851 () Real)
+(declare-fun x_0852 () Real)
+(declare-fun x_0853 () Real)
+(declare-fun x_0854 () Real)
+(declare-fun x_0855 () Real)
+(declare-fun x_0856 () Real)
+(declare-fun x_0857 () Real)
+(declare-fun x_0858 () Real)
+(declare-fun x_0859 () Real)
+(declare-fun x_0860 () Real)
+(declare-fun x_0861 () Real)
+(declare-fun x_0862 () Real)
+(declare-fun x_0863 () Real)
+(declare-fun x_0864 () Real)
+(declare-fun x_0865 () Real)
+(declare-fun x_0866 () Real)
+(declare-fun x_0867 () Real)
+(declare-fun x_0868 () Real)
+(declare-fun x_0869 () Real)
+(declare-fun x_0870 () Real)
+(declare-fun x_0871 () Real)
+(declare-fun x_0872 () Real)
+(declare-fun x_0873 () Real)
+(declare-fun x_0874 () Real)
+(declare-fun x_0875 () Real)
+(declare-fun x_0876 () Real)
+(declare-fun x_0877 () Real)
+(declare-fun x_0878 () Real)
+(declare-fun x_0879 () Real)
+(declare-fun x_0880 () Real)
+(declare-fun x_0881 () Real)
+(declare-fun x_0882 () Real)
+(declare-fun x_0883 () Real)
+(declare-fun x_0884 () Real)
+(declare-fun x_0885 () Real)
+(declare-fun x_0886 () Real)
+(declare-fun x_0887 () Real)
+(declare-fun x_0888 () Real)
+(declare-fun x_0889 () Real)
+(declare-fun x_0890 () Real)
+(declare-fun x_0891 () Real)
+(declare-fun x_0892 () Real)
+(declare-fun x_0893 () Real)
+(declare-fun x_0894 () Real)
+(declare-fun x_0895 () Real)
+(declare-fun x_0896 () Real)
+(declare-fun x_0897 () Real)
+(declare-fun x_0898 () Real)
+(declare-fun x_0899 () Real)
+(declare-fun x_0900 () Real)
+(declare-fun x_0901 () Real)
+(declare-fun x_0902 () Real)
+(declare-fun x_0903 () Real)
+(declare-fun x_0904 () Real)
+(declare-fun x_0905 () Real)
+(declare-fun x_0906 () Real)
+(declare-fun x_0907 () Real)
+(declare-fun x_0908 () Real)
+(declare-fun x_0909 () Real)
+(declare-fun x_0910 () Real)
+(declare-fun x_0911 () Real)
+(declare-fun x_0912 () Real)
+(declare-fun x_0913 () Real)
+(declare-fun x_0914 () Real)
+(declare-fun x_0915 () Real)
+(declare-fun x_0916 () Real)
+(declare-fun x_0917 () Real)
+(declare-fun x_0918 () Real)
+(declare-fun x_0919 () Real)
+(declare-fun x_0920 () Real)
+(declare-fun x_0921 () Real)
+(declare-fun x_0922 () Real)
+(declare-fun x_0923 () Real)
+(declare-fun x_0924 () Real)
+(declare-fun x_0925 () Real)
+(declare-fun x_0926 () Real)
+(declare-fun x_0927 () Real)
+(declare-fun x_0928 () Real)
+(declare-fun x_0929 () Real)
+(declare-fun x_0930 () Real)
+(declare-fun x_0931 () Real)
+(declare-fun x_0932 () Real)
+(declare-fun x_0933 () Real)
+(declare-fun x_0934 () Real)
+(declare-fun x_0935 () Real)
+(declare-fun x_0936 () Real)
+(declare-fun x_0937 () Real)
+(declare-fun x_0938 () Real)
+(declare-fun x_0939 () Real)
+(declare-fun x_0940 () Real)
+(declare-fun x_0941 () Real)
+(declare-fun x_0942 () Real)
+(declare-fun x_0943 () Real)
+(declare-fun x_0944 () Real)
+(declare-fun x_0945 () Real)
+(declare-fun x_0946 () Real)
+(declare-fun x_0947 () Real)
+(declare-fun x_0948 () Real)
+(declare-fun x_0949 () Real)
+(declare-fun x_0950 () Real)
+(declare-fun x_0951 () Real)
+(declare-fun x_0952 () Real)
+(declare-fun x_0953 () Real)
+(declare-fun x_0954 () Real)
+(declare-fun x_0955 () Real)
+(declare-fun x_0956 () Real)
+(declare-fun x_0957 () Real)
+(declare-fun x_0958 () Real)
+(declare-fun x_0959 () Real)
+(declare-fun x_0960 () Real)
+(declare-fun x_0961 () Real)
+(declare-fun x_0962 () Real)
+(declare-fun x_0963 () Real)
+(declare-fun x_0964 () Real)
+(declare-fun x_0965 () Real)
+(declare-fun x_0966 () Real)
+(declare-fun x_0967 () Real)
+(declare-fun x_0968 () Real)
+(declare-fun x_0969 () Real)
+(declare-fun x_0970 () Real)
+(declare-fun x_0971 () Real)
+(declare-fun x_0972 () Real)
+(declare-fun x_0973 () Real)
+(declare-fun x_0974 () Real)
+(declare-fun x_0975 () Real)
+(declare-fun x_0976 () Real)
+(declare-fun x_0977 () Real)
+(declare-fun x_0978 () Real)
+(declare-fun x_0979 () Real)
+(declare-fun x_0980 () Real)
+(declare-fun x_0981 () Real)
+(declare-fun x_0982 () Real)
+(declare-fun x_0983 () Real)
+(declare-fun x_0984 () Real)
+(declare-fun x_0985 () Real)
+(declare-fun x_0986 () Real)
+(declare-fun x_0987 () Real)
+(declare-fun x_0988 () Real)
+(declare-fun x_0989 () Real)
+(declare-fun x_0990 () Real)
+(declare-fun x_0991 () Real)
+(declare-fun x_0992 () Real)
+(declare-fun x_0993 () Real)
+(declare-fun x_0994 () Real)
+(declare-fun x_0995 () Real)
+(declare-fun x_0996 () Real)
+(declare-fun x_0997 () Real)
+(declare-fun x_0998 () Real)
+(declare-fun x_0999 () Real)
+(declare-fun x_1000 () Real)
+(declare-fun x_1001 () Real)
+(declare-fun x_1002 () Real)
+(declare-fun x_1003 () Real)
+(declare-fun x_1004 () Real)
+(declare-fun x_1005 () Real)
+(declare-fun x_1006 () Real)
+(declare-fun x_1007 () Real)
+(declare-fun x_1008 () Real)
+(declare-fun x_1009 () Real)
+(declare-fun x_1010 () Real)
+(declare-fun x_1011 () Real)
+(declare-fun x_1012 () Real)
+(declare-fun x_1013 () Real)
+(declare-fun x_1014 () Real)
+(declare-fun x_1015 () Real)
+(declare-fun x_1016 () Real)
+(declare-fun x_1017 () Real)
+(declare-fun x_1018 () Real)
+(declare-fun x_1019 () Real)
+(declare-fun x_1020 () Real)
+(declare-fun x_1021 () Real)
+(declare-fun x_1022 () Real)
+(declare-fun x_1023 () Real)
+(declare-fun x_1024 () Real)
+(declare-fun x_1025 () Real)
+(declare-fun x_1026 () Real)
+(declare-fun x_1027 () Real)
+(declare-fun x_1028 () Real)
+(declare-fun x_1029 () Real)
+(declare-fun x_1030 () Real)
+(declare-fun x_1031 () Real)
+(declare-fun x_1032 () Real)
+(declare-fun x_1033 () Real)
+(declare-fun x_1034 () Real)
+(declare-fun x_1035 () Real)
+(declare-fun x_1036 () Real)
+(declare-fun x_1037 () Real)
+(declare-fun x_1038 () Real)
+(declare-fun x_1039 () Real)
+(declare-fun x_1040 () Real)
+(declare-fun x_1041 () Real)
+(declare-fun x_1042 () Real)
+(declare-fun x_1043 () Real)
+(declare-fun x_1044 () Real)
+(declare-fun x_1045 () Real)
+(declare-fun x_1046 () Real)
+(declare-fun x_1047 () Real)
+(declare-fun x_1048 () Real)
+(declare-fun x_1049 () Real)
+(declare-fun x_1050 () Real)
+(declare-fun x_1051 () Real)
+(declare-fun x_1052 () Real)
+(declare-fun x_1053 () Real)
+(declare-fun x_1054 () Real)
+(declare-fun x_1055 () Real)
+(declare-fun x_1056 () Real)
+(declare-fun x_1057 () Real)
+(declare-fun x_1058 () Real)
+(declare-fun x_1059 () Real)
+(declare-fun x_1060 () Real)
+(declare-fun x_1061 () Real)
+(declare-fun x_1062 () Real)
+(declare-fun x_1063 () Real)
+(declare-fun x_1064 () Real)
+(declare-fun x_1065 () Real)
+(declare-fun x_1066 () Real)
+(declare-fun x_1067 () Real)
+(declare-fun x_1068 () Real)
+(declare-fun x_1069 () Real)
+(declare-fun x_1070 () Real)
+(declare-fun x_1071 () Real)
+(declare-fun x_1072 () Real)
+(declare-fun x_1073 () Real)
+(declare-fun x_1074 () Real)
+(declare-fun x_1075 () Real)
+(declare-fun x_1076 () Real)
+(declare-fun x_1077 () Real)
+(declare-fun x_1078 () Real)
+(declare-fun x_1079 () Real)
+(declare-fun x_1080 () Real)
+(declare-fun x_1081 () Real)
+(declare-fun x_1082 () Real)
+(declare-fun x_1083 () Real)
+(declare-fun x_1084 () Real)
+(declare-fun x_1085 () Real)
+(declare-fun x_1086 () Real)
+(declare-fun x_1087 () Real)
+(declare-fun x_1088 () Real)
+(declare-fun x_1089 () Real)
+(declare-fun x_1090 () Real)
+(declare-fun x_1091 () Real)
+(declare-fun x_1092 () Real)
+(declare-fun x_1093 () Real)
+(declare-fun x_1094 () Real)
+(declare-fun x_1095 () Real)
+(declare-fun x_1096 () Real)
+(declare-fun x_1097 () Real)
+(declare-fun x_1098 () Real)
+(declare-fun x_1099 () Real)
+(declare-fun x_1100 () Real)
+(declare-fun x_1101 () Real)
+(declare-fun x_1102 () Real)
+(declare-fun x_1103 () Real)
+(declare-fun x_1104 () Real)
+(declare-fun x_1105 () Real)
+(declare-fun x_1106 () Real)
+(declare-fun x_1107 () Real)
+(declare-fun x_1108 () Real)
+(declare-fun x_1109 () Real)
+(declare-fun x_1110 () Real)
+(declare-fun x_1111 () Real)
+(declare-fun x_1112 () Real)
+(declare-fun x_1113 () Real)
+(declare-fun x_1114 () Real)
+(declare-fun x_1115 () Real)
+(declare-fun x_1116 () Real)
+(declare-fun x_1117 () Real)
+(declare-fun x_1118 () Real)
+(declare-fun x_1119 () Real)
+(declare-fun x_1120 () Real)
+(declare-fun x_1121 () Real)
+(declare-fun x_1122 () Real)
+(declare-fun x_1123 () Real)
+(declare-fun x_1124 () Real)
+(declare-fun x_1125 () Real)
+(declare-fun x_1126 () Real)
+(declare-fun x_1127 () Real)
+(declare-fun x_1128 () Real)
+(declare-fun x_1129 () Real)
+(declare-fun x_1130 () Real)
+(declare-fun x_1131 () Real)
+(declare-fun x_1132 () Real)
+(declare-fun x_1133 () Real)
+(declare-fun x_1134 () Real)
+(declare-fun x_1135 () Real)
+(declare-fun x_1136 () Real)
+(declare-fun x_1137 () Real)
+(declare-fun x_1138 () Real)
+(declare-fun x_1139 () Real)
+(declare-fun x_1140 () Real)
+(declare-fun x_1141 () Real)
+(declare-fun x_1142 () Real)
+(declare-fun x_1143 () Real)
+(declare-fun x_1144 () Real)
+(declare-fun x_1145 () Real)
+(declare-fun x_1146 () Real)
+(declare-fun x_1147 () Real)
+(declare-fun x_1148 () Real)
+(declare-fun x_1149 () Real)
+(declare-fun x_1150 () Real)
+(declare-fun x_1151 () Real)
+(declare-fun x_1152 () Real)
+(declare-fun x_1153 () Real)
+(declare-fun x_1154 () Real)
+(declare-fun x_1155 () Real)
+(declare-fun x_1156 () Real)
+(declare-fun x_1157 () Real)
+(declare-fun x_1158 () Real)
+(declare-fun x_1159 () Real)
+(declare-fun x_1160 () Real)
+(declare-fun x_1161 () Real)
+(declare-fun x_1162 () Real)
+(declare-fun x_1163 () Real)
+(declare-fun x_1164 () Real)
+(declare-fun x_1165 () Real)
+(declare-fun x_1166 () Real)
+(declare-fun x_1167 () Real)
+(declare-fun x_1168 () Real)
+(declare-fun x_1169 () Real)
+(declare-fun x_1170 () Real)
+(declare-fun x_1171 () Real)
+(declare-fun x_1172 () Real)
+(declare-fun x_1173 () Real)
+(declare-fun x_1174 () Real)
+(declare-fun x_1175 () Real)
+(declare-fun x_1176 () Real)
+(declare-fun x_1177 () Real)
+(declare-fun x_1178 () Real)
+(declare-fun x_1179 () Real)
+(declare-fun x_1180 () Real)
+(declare-fun x_1181 () Real)
+(declare-fun x_1182 () Real)
+(declare-fun x_1183 () Real)
+(declare-fun x_1184 () Real)
+(declare-fun x_1185 () Real)
+(declare-fun x_1186 () Real)
+(declare-fun x_1187 () Real)
+(declare-fun x_1188 () Real)
+(declare-fun x_1189 () Real)
+(declare-fun x_1190 () Real)
+(declare-fun x_1191 () Real)
+(declare-fun x_1192 () Real)
+(declare-fun x_1193 () Real)
+(declare-fun x_1194 () Real)
+(declare-fun x_1195 () Real)
+(declare-fun x_1196 () Real)
+(declare-fun x_1197 () Real)
+(declare-fun x_1198 () Real)
+(declare-fun x_1199 () Real)
+(declare-fun x_1200 () Real)
+(declare-fun x_1201 () Real)
+(declare-fun x_1202 () Real)
+(declare-fun x_1203 () Real)
+(declare-fun x_1204 () Real)
+(declare-fun x_1205 () Real)
+(declare-fun x_1206 () Real)
+(declare-fun x_1207 () Real)
+(declare-fun x_1208 () Real)
+(declare-fun x_1209 () Real)
+(declare-fun x_1210 () Real)
+(declare-fun x_1211 () Real)
+(declare-fun x_1212 () Real)
+(declare-fun x_1213 () Real)
+(declare-fun x_1214 () Real)
+(declare-fun x_1215 () Real)
+(declare-fun x_1216 () Real)
+(declare-fun x_1217 () Real)
+(declare-fun x_1218 () Real)
+(declare-fun x_1219 () Real)
+(declare-fun x_1220 () Real)
+(declare-fun x_1221 () Real)
+(declare-fun x_1222 () Real)
+(declare-fun x_1223 () Real)
+(declare-fun x_1224 () Real)
+(declare-fun x_1225 () Real)
+(declare-fun x_1226 () Real)
+(declare-fun x_1227 () Real)
+(declare-fun x_1228 () Real)
+(declare-fun x_1229 () Real)
+(declare-fun x_1230 () Real)
+(declare-fun x_1231 () Real)
+(declare-fun x_1232 () Real)
+(declare-fun x_1233 () Real)
+(declare-fun x_1234 () Real)
+(declare-fun x_1235 () Real)
+(declare-fun x_1236 () Real)
+(declare-fun x_1237 () Real)
+(declare-fun x_1238 () Real)
+(declare-fun x_1239 () Real)
+(declare-fun x_1240 () Real)
+(declare-fun x_1241 () Real)
+(declare-fun x_1242 () Real)
+(declare-fun x_1243 () Real)
+(declare-fun x_1244 () Real)
+(declare-fun x_1245 () Real)
+(declare-fun x_1246 () Real)
+(declare-fun x_1247 () Real)
+(declare-fun x_1248 () Real)
+(declare-fun x_1249 () Real)
+(declare-fun x_1250 () Real)
+(declare-fun x_1251 () Real)
+(declare-fun x_1252 () Real)
+(declare-fun x_1253 () Real)
+(declare-fun x_1254 () Real)
+(declare-fun x_1255 () Real)
+(declare-fun x_1256 () Real)
+(declare-fun x_1257 () Real)
+(declare-fun x_1258 () Real)
+(declare-fun x_1259 () Real)
+(declare-fun x_1260 () Real)
+(declare-fun x_1261 () Real)
+(declare-fun x_1262 () Real)
+(declare-fun x_1263 () Real)
+(declare-fun x_1264 () Real)
+(declare-fun x_1265 () Real)
+(declare-fun x_1266 () Real)
+(declare-fun x_1267 () Real)
+(declare-fun x_1268 () Real)
+(declare-fun x_1269 () Real)
+(declare-fun x_1270 () Real)
+(declare-fun x_1271 () Real)
+(declare-fun x_1272 () Real)
+(declare-fun x_1273 () Real)
+(declare-fun x_1274 () Real)
+(declare-fun x_1275 () Real)
+(declare-fun x_1276 () Real)
+(declare-fun x_1277 () Real)
+(declare-fun x_1278 () Real)
+(declare-fun x_1279 () Real)
+(declare-fun x_1280 () Real)
+(declare-fun x_1281 () Real)
+(declare-fun x_1282 () Real)
+(declare-fun x_1283 () Real)
+(declare-fun x_1284 () Real)
+(declare-fun x_1285 () Real)
+(declare-fun x_1286 () Real)
+(declare-fun x_1287 () Real)
+(declare-fun x_1288 () Real)
+(declare-fun x_1289 () Real)
+(declare-fun x_1290 () Real)
+(declare-fun x_1291 () Real)
+(declare-fun x_1292 () Real)
+(declare-fun x_1293 () Real)
+(declare-fun x_1294 () Real)
+(declare-fun x_1295 () Real)
+(declare-fun x_1296 () Real)
+(declare-fun x_1297 () Real)
+(declare-fun x_1298 () Real)
+(declare-fun x_1299 () Real)
+(declare-fun x_1300 () Real)
+(declare-fun x_1301 () Real)
+(declare-fun x_1302 () Real)
+(declare-fun x_1303 () Real)
+(declare-fun x_1304 () Real)
+(declare-fun x_1305 () Real)
+(declare-fun x_1306 () Real)
+(declare-fun x_1307 () Real)
+(declare-fun x_1308 () Real)
+(declare-fun x_1309 () Real)
+(declare-fun x_1310 () Real)
+(declare-fun x_1311 () Real)
+(declare-fun x_1312 () Real)
+(declare-fun x_1313 () Real)
+(declare-fun x_1314 () Real)
+(declare-fun x_1315 () Real)
+(declare-fun x_1316 () Real)
+(declare-fun x_1317 () Real)
+(declare-fun x_1318 () Real)
+(declare-fun x_1319 () Real)
+(declare-fun x_1320 () Real)
+(declare-fun x_1321 () Real)
+(declare-fun x_1322 () Real)
+(declare-fun x_1323 () Real)
+(declare-fun x_1324 () Real)
+(declare-fun x_1325 () Real)
+(declare-fun x_1326 () Real)
+(declare-fun x_1327 () Real)
+(declare-fun x_1328 () Real)
+(declare-fun x_1329 () Real)
+(declare-fun x_1330 () Real)
+(declare-fun x_1331 () Real)
+(declare-fun x_1332 () Real)
+(declare-fun x_1333 () Real)
+(declare-fun x_1334 () Real)
+(declare-fun x_1335 () Real)
+(declare-fun x_1336 () Real)
+(declare-fun x_1337 () Real)
+(declare-fun x_1338 () Real)
+(declare-fun x_1339 () Real)
+(declare-fun x_1340 () Real)
+(declare-fun x_1341 () Real)
+(declare-fun x_1342 () Real)
+(declare-fun x_1343 () Real)
+(declare-fun x_1344 () Real)
+(declare-fun x_1345 () Real)
+(declare-fun x_1346 () Real)
+(declare-fun x_1347 () Real)
+(declare-fun x_1348 () Real)
+(declare-fun x_1349 () Real)
+(declare-fun x_1350 () Real)
+(declare-fun x_1351 () Real)
+(declare-fun x_1352 () Real)
+(declare-fun x_1353 () Real)
+(declare-fun x_1354 () Real)
+(declare-fun x_1355 () Real)
+(declare-fun x_1356 () Real)
+(declare-fun x_1357 () Real)
+(declare-fun x_1358 () Real)
+(declare-fun x_1359 () Real)
+(declare-fun x_1360 () Real)
+(declare-fun x_1361 () Real)
+(declare-fun x_1362 () Real)
+(declare-fun x_1363 () Real)
+(declare-fun x_1364 () Real)
+(declare-fun x_1365 () Real)
+(declare-fun x_1366 () Real)
+(declare-fun x_1367 () Real)
+(declare-fun x_1368 () Real)
+(declare-fun x_1369 () Real)
+(declare-fun x_1370 () Real)
+(declare-fun x_1371 () Real)
+(declare-fun x_1372 () Real)
+(declare-fun x_1373 () Real)
+(declare-fun x_1374 () Real)
+(declare-fun x_1375 () Real)
+(declare-fun x_1376 () Real)
+(declare-fun x_1377 () Real)
+(declare-fun x_1378 () Real)
+(declare-fun x_1379 () Real)
+(declare-fun x_1380 () Real)
+(declare-fun x_1381 () Real)
+(declare-fun x_1382 () Real)
+(declare-fun x_1383 () Real)
+(declare-fun x_1384 () Real)
+(declare-fun x_1385 () Real)
+(declare-fun x_1386 () Real)
+(declare-fun x_1387 () Real)
+(declare-fun x_1388 () Real)
+(declare-fun x_1389 () Real)
+(declare-fun x_1390 () Real)
+(declare-fun x_1391 () Real)
+(declare-fun x_1392 () Real)
+(declare-fun x_1393 () Real)
+(declare-fun x_1394 () Real)
+(declare-fun x_1395 () Real)
+(declare-fun x_1396 () Real)
+(declare-fun x_1397 () Real)
+(declare-fun x_1398 () Real)
+(declare-fun x_1399 () Real)
+(declare-fun x_1400 () Real)
+(declare-fun x_1401 () Real)
+(declare-fun x_1402 () Real)
+(declare-fun x_1403 () Real)
+(declare-fun x_1404 () Real)
+(declare-fun x_1405 () Real)
+(declare-fun x_1406 () Real)
+(declare-fun x_1407 () Real)
+(declare-fun x_1408 () Real)
+(declare-fun x_1409 () Real)
+(declare-fun x_1410 () Real)
+(declare-fun x_1411 () Real)
+(declare-fun x_1412 () Real)
+(declare-fun x_1413 () Real)
+(declare-fun x_1414 () Real)
+(declare-fun x_1415 () Real)
+(declare-fun x_1416 () Real)
+(declare-fun x_1417 () Real)
+(declare-fun x_1418 () Real)
+(declare-fun x_1419 () Real)
+(declare-fun x_1420 () Real)
+(declare-fun x_1421 () Real)
+(declare-fun x_1422 () Real)
+(declare-fun x_1423 () Real)
+(declare-fun x_1424 () Real)
+(declare-fun x_1425 () Real)
+(declare-fun x_1426 () Real)
+(declare-fun x_1427 () Real)
+(declare-fun x_1428 () Real)
+(declare-fun x_1429 () Real)
+(declare-fun x_1430 () Real)
+(declare-fun x_1431 () Real)
+(declare-fun x_1432 () Real)
+(declare-fun x_1433 () Real)
+(declare-fun x_1434 () Real)
+(declare-fun x_1435 () Real)
+(declare-fun x_1436 () Real)
+(declare-fun x_1437 () Real)
+(declare-fun x_1438 () Real)
+(declare-fun x_1439 () Real)
+(declare-fun x_1440 () Real)
+(declare-fun x_1441 () Real)
+(declare-fun x_1442 () Real)
+(declare-fun x_1443 () Real)
+(declare-fun x_1444 () Real)
+(declare-fun x_1445 () Real)
+(declare-fun x_1446 () Real)
+(declare-fun x_1447 () Real)
+(declare-fun x_1448 () Real)
+(declare-fun x_1449 () Real)
+(declare-fun x_1450 () Real)
+(declare-fun x_1451 () Real)
+(declare-fun x_1452 () Real)
+(declare-fun x_1453 () Real)
+(declare-fun x_1454 () Real)
+(declare-fun x_1455 () Real)
+(declare-fun x_1456 () Real)
+(declare-fun x_1457 () Real)
+(declare-fun x_1458 () Real)
+(declare-fun x_1459 () Real)
+(declare-fun x_1460 () Real)
+(declare-fun x_1461 () Real)
+(declare-fun x_1462 () Real)
+(declare-fun x_1463 () Real)
+(declare-fun x_1464 () Real)
+(declare-fun x_1465 () Real)
+(declare-fun x_1466 () Real)
+(declare-fun x_1467 () Real)
+(declare-fun x_1468 () Real)
+(declare-fun x_1469 () Real)
+(declare-fun x_1470 () Real)
+(declare-fun x_1471 () Real)
+(declare-fun x_1472 () Real)
+(declare-fun x_1473 () Real)
+(declare-fun x_1474 () Real)
+(declare-fun x_1475 () Real)
+(declare-fun x_1476 () Real)
+(declare-fun x_1477 () Real)
+(declare-fun x_1478 () Real)
+(declare-fun x_1479 () Real)
+(declare-fun x_1480 () Real)
+(declare-fun x_1481 () Real)
+(declare-fun x_1482 () Real)
+(declare-fun x_1483 () Real)
+(declare-fun x_1484 () Real)
+(declare-fun x_1485 () Real)
+(declare-fun x_1486 () Real)
+(declare-fun x_1487 () Real)
+(declare-fun x_1488 () Real)
+(declare-fun x_1489 () Real)
+(declare-fun x_1490 () Real)
+(declare-fun x_1491 () Real)
+(declare-fun x_1492 () Real)
+(declare-fun x_1493 () Real)
+(declare-fun x_1494 () Real)
+(declare-fun x_1495 () Real)
+(declare-fun x_1496 () Real)
+(declare-fun x_1497 () Real)
+(declare-fun x_1498 () Real)
+(declare-fun x_1499 () Real)
+(declare-fun x_1500 () Real)
+(declare-fun x_1501 () Real)
+(declare-fun x_1502 () Real)
+(declare-fun x_1503 () Real)
+(declare-fun x_1504 () Real)
+(declare-fun x_1505 () Real)
+(declare-fun x_1506 () Real)
+(declare-fun x_1507 () Real)
+(declare-fun x_1508 () Real)
+(declare-fun x_1509 () Real)
+(declare-fun x_1510 () Real)
+(declare-fun x_1511 () Real)
+(declare-fun x_1512 () Real)
+(declare-fun x_1513 () Real)
+(declare-fun x_1514 () Real)
+(declare-fun x_1515 () Real)
+(declare-fun x_1516 () Real)
+(declare-fun x_1517 () Real)
+(declare-fun x_1518 () Real)
+(declare-fun x_1519 () Real)
+(declare-fun x_1520 () Real)
+(declare-fun x_1521 () Real)
+(declare-fun x_1522 () Real)
+(declare-fun x_1523 () Real)
+(declare-fun x_1524 () Real)
+(declare-fun x_1525 () Real)
+(declare-fun x_1526 () Real)
+(declare-fun x_1527 () Real)
+(declare-fun x_1528 () Real)
+(declare-fun x_1529 () Real)
+(declare-fun x_1530 () Real)
+(declare-fun x_1531 () Real)
+(declare-fun x_1532 () Real)
+(declare-fun x_1533 () Real)
+(declare-fun x_1534 () Real)
+(declare-fun x_1535 () Real)
+(declare-fun x_1536 () Real)
+(declare-fun x_1537 () Real)
+(declare-fun x_1538 () Real)
+(declare-fun x_1539 () Real)
+(declare-fun x_1540 () Real)
+(declare-fun x_1541 () Real)
+(declare-fun x_1542 () Real)
+(declare-fun x_1543 () Real)
+(declare-fun x_1544 () Real)
+(declare-fun x_1545 () Real)
+(declare-fun x_1546 () Real)
+(declare-fun x_1547 () Real)
+(declare-fun x_1548 () Real)
+(declare-fun x_1549 () Real)
+(declare-fun x_1550 () Real)
+(declare-fun x_1551 () Real)
+(declare-fun x_1552 () Real)
+(declare-fun x_1553 () Real)
+(declare-fun x_1554 () Real)
+(declare-fun x_1555 () Real)
+(declare-fun x_1556 () Real)
+(declare-fun x_1557 () Real)
+(declare-fun x_1558 () Real)
+(declare-fun x_1559 () Real)
+(declare-fun x_1560 () Real)
+(declare-fun x_1561 () Real)
+(declare-fun x_1562 () Real)
+(declare-fun x_1563 () Real)
+(declare-fun x_1564 () Real)
+(declare-fun x_1565 () Real)
+(declare-fun x_1566 () Real)
+(declare-fun x_1567 () Real)
+(declare-fun x_1568 () Real)
+(declare-fun x_1569 () Real)
+(declare-fun x_1570 () Real)
+(declare-fun x_1571 () Real)
+(declare-fun x_1572 () Real)
+(declare-fun x_1573 () Real)
+(declare-fun x_1574 () Real)
+(declare-fun x_1575 () Real)
+(declare-fun x_1576 () Real)
+(declare-fun x_1577 () Real)
+(declare-fun x_1578 () Real)
+(declare-fun x_1579 () Real)
+(declare-fun x_1580 () Real)
+(declare-fun x_1581 () Real)
+(declare-fun x_1582 () Real)
+(declare-fun x_1583 () Real)
+(declare-fun x_1584 () Real)
+(declare-fun x_1585 () Real)
+(declare-fun x_1586 () Real)
+(declare-fun x_1587 () Real)
+(declare-fun x_1588 () Real)
+(declare-fun x_1589 () Real)
+(declare-fun x_1590 () Real)
+(declare-fun x_1591 () Real)
+(declare-fun x_1592 () Real)
+(declare-fun x_1593 () Real)
+(declare-fun x_1594 () Real)
+(declare-fun x_1595 () Real)
+(declare-fun x_1596 () Real)
+(declare-fun x_1597 () Real)
+(declare-fun x_1598 () Real)
+(declare-fun x_1599 () Real)
+(declare-fun x_1600 () Real)
+(declare-fun x_1601 () Real)
+(declare-fun x_1602 () Real)
+(declare-fun x_1603 () Real)
+(declare-fun x_1604 () Real)
+(declare-fun x_1605 () Real)
+(declare-fun x_1606 () Real)
+(declare-fun x_1607 () Real)
+(declare-fun x_1608 () Real)
+(declare-fun x_1609 () Real)
+(declare-fun x_1610 () Real)
+(declare-fun x_1611 () Real)
+(declare-fun x_1612 () Real)
+(declare-fun x_1613 () Real)
+(declare-fun x_1614 () Real)
+(declare-fun x_1615 () Real)
+(declare-fun x_1616 () Real)
+(declare-fun x_1617 () Real)
+(declare-fun x_1618 () Real)
+(declare-fun x_1619 () Real)
+(declare-fun x_1620 () Real)
+(declare-fun x_1621 () Real)
+(declare-fun x_1622 () Real)
+(declare-fun x_1623 () Real)
+(declare-fun x_1624 () Real)
+(declare-fun x_1625 () Real)
+(declare-fun x_1626 () Real)
+(declare-fun x_1627 () Real)
+(declare-fun x_1628 () Real)
+(declare-fun x_1629 () Real)
+(declare-fun x_1630 () Real)
+(declare-fun x_1631 () Real)
+(declare-fun x_1632 () Real)
+(declare-fun x_1633 () Real)
+(declare-fun x_1634 () Real)
+(declare-fun x_1635 () Real)
+(declare-fun x_1636 () Real)
+(declare-fun x_1637 () Real)
+(declare-fun x_1638 () Real)
+(declare-fun x_1639 () Real)
+(declare-fun x_1640 () Real)
+(declare-fun x_1641 () Real)
+(declare-fun x_1642 () Real)
+(declare-fun x_1643 () Real)
+(declare-fun x_1644 () Real)
+(declare-fun x_1645 () Real)
+(declare-fun x_1646 () Real)
+(declare-fun x_1647 () Real)
+(declare-fun x_1648 () Real)
+(declare-fun x_1649 () Real)
+(declare-fun x_1650 () Real)
+(declare-fun x_1651 () Real)
+(declare-fun x_1652 () Real)
+(declare-fun x_1653 () Real)
+(declare-fun x_1654 () Real)
+(declare-fun x_1655 () Real)
+(declare-fun x_1656 () Real)
+(declare-fun x_1657 () Real)
+(declare-fun x_1658 () Real)
+(declare-fun x_1659 () Real)
+(declare-fun x_1660 () Real)
+(declare-fun x_1661 () Real)
+(declare-fun x_1662 () Real)
+(declare-fun x_1663 () Real)
+(declare-fun x_1664 () Real)
+(declare-fun x_1665 () Real)
+(declare-fun x_1666 () Real)
+(declare-fun x_1667 () Real)
+(declare-fun x_1668 () Real)
+(declare-fun x_1669 () Real)
+(declare-fun x_1670 () Real)
+(declare-fun x_1671 () Real)
+(declare-fun x_1672 () Real)
+(declare-fun x_1673 () Real)
+(declare-fun x_1674 () Real)
+(declare-fun x_1675 () Real)
+(declare-fun x_1676 () Real)
+(declare-fun x_1677 () Real)
+(declare-fun x_1678 () Real)
+(declare-fun x_1679 () Real)
+(declare-fun x_1680 () Real)
+(declare-fun x_1681 () Real)
+(declare-fun x_1682 () Real)
+(declare-fun x_1683 () Real)
+(declare-fun x_1684 () Real)
+(declare-fun x_1685 () Real)
+(declare-fun x_1686 () Real)
+(declare-fun x_1687 () Real)
+(declare-fun x_1688 () Real)
+(declare-fun x_1689 () Real)
+(declare-fun x_1690 () Real)
+(declare-fun x_1691 () Real)
+(declare-fun x_1692 () Real)
+(declare-fun x_1693 () Real)
+(declare-fun x_1694 () Real)
+(declare-fun x_1695 () Real)
+(declare-fun x_1696 () Real)
+(declare-fun x_1697 () Real)
+(declare-fun x_1698 () Real)
+(declare-fun x_1699 () Real)
+(declare-fun x_1700 () Real)
+(declare-fun x_1701 () Real)
+(declare-fun x_1702 () Real)
+(declare-fun x_1703 () Real)
+(declare-fun x_1704 () Real)
+(declare-fun x_1705 () Real)
+(declare-fun x_1706 () Real)
+(declare-fun x_1707 () Real)
+(declare-fun x_1708 () Real)
+(declare-fun x_1709 () Real)
+(declare-fun x_1710 () Real)
+(declare-fun x_1711 () Real)
+(declare-fun x_1712 () Real)
+(declare-fun x_1713 () Real)
+(declare-fun x_1714 () Real)
+(declare-fun x_1715 () Real)
+(declare-fun x_1716 () Real)
+(declare-fun x_1717 () Real)
+(declare-fun x_1718 () Real)
+(declare-fun x_1719 () Real)
+(declare-fun x_1720 () Real)
+(declare-fun x_1721 () Real)
+(declare-fun x_1722 () Real)
+(declare-fun x_1723 () Real)
+(declare-fun x_1724 () Real)
+(declare-fun x_1725 () Real)
+(declare-fun x_1726 () Real)
+(declare-fun x_1727 () Real)
+(declare-fun x_1728 () Real)
+(declare-fun x_1729 () Real)
+(declare-fun x_1730 () Real)
+(declare-fun x_1731 () Real)
+(declare-fun x_1732 () Real)
+(declare-fun x_1733 () Real)
+(declare-fun x_1734 () Real)
+(declare-fun x_1735 () Real)
+(declare-fun x_1736 () Real)
+(declare-fun x_1737 () Real)
+(declare-fun x_1738 () Real)
+(declare-fun x_1739 () Real)
+(declare-fun x_1740 () Real)
+(declare-fun x_1741 () Real)
+(declare-fun x_1742 () Real)
+(declare-fun x_1743 () Real)
+(declare-fun x_1744 () Real)
+(declare-fun x_1745 () Real)
+(declare-fun x_1746 () Real)
+(declare-fun x_1747 () Real)
+(declare-fun x_1748 () Real)
+(declare-fun x_1749 () Real)
+(declare-fun x_1750 () Real)
+(declare-fun x_1751 () Real)
+(declare-fun x_1752 () Real)
+(declare-fun x_1753 () Real)
+(declare-fun x_1754 () Real)
+(declare-fun x_1755 () Real)
+(declare-fun x_1756 () Real)
+(declare-fun x_1757 () Real)
+(declare-fun x_1758 () Real)
+(declare-fun x_1759 () Real)
+(declare-fun x_1760 () Real)
+(declare-fun x_1761 () Real)
+(declare-fun x_1762 () Real)
+(declare-fun x_1763 () Real)
+(declare-fun x_1764 () Real)
+(declare-fun x_1765 () Real)
+(declare-fun x_1766 () Real)
+(declare-fun x_1767 () Real)
+(declare-fun x_1768 () Real)
+(declare-fun x_1769 () Real)
+(declare-fun x_1770 () Real)
+(declare-fun x_1771 () Real)
+(declare-fun x_1772 () Real)
+(declare-fun x_1773 () Real)
+(declare-fun x_1774 () Real)
+(declare-fun x_1775 () Real)
+(declare-fun x_1776 () Real)
+(declare-fun x_1777 () Real)
+(declare-fun x_1778 () Real)
+(declare-fun x_1779 () Real)
+(declare-fun x_1780 () Real)
+(declare-fun x_1781 () Real)
+(declare-fun x_1782 () Real)
+(declare-fun x_1783 () Real)
+(declare-fun x_1784 () Real)
+(declare-fun x_1785 () Real)
+(declare-fun x_1786 () Real)
+(declare-fun x_1787 () Real)
+(declare-fun x_1788 () Real)
+(declare-fun x_1789 () Real)
+(declare-fun x_1790 () Real)
+(declare-fun x_1791 () Real)
+(declare-fun x_1792 () Real)
+(declare-fun x_1793 () Real)
+(declare-fun x_1794 () Real)
+(declare-fun x_1795 () Real)
+(declare-fun x_1796 () Real)
+(declare-fun x_1797 () Real)
+(declare-fun x_1798 () Real)
+(declare-fun x_1799 () Real)
+(declare-fun x_1800 () Real)
+(declare-fun x_1801 () Real)
+(declare-fun x_1802 () Real)
+(declare-fun x_1803 () Real)
+(declare-fun x_1804 () Real)
+(declare-fun x_1805 () Real)
+(declare-fun x_1806 () Real)
+(declare-fun x_1807 () Real)
+(declare-fun x_1808 () Real)
+(declare-fun x_1809 () Real)
+(declare-fun x_1810 () Real)
+(declare-fun x_1811 () Real)
+(declare-fun x_1812 () Real)
+(declare-fun x_1813 () Real)
+(declare-fun x_1814 () Real)
+(declare-fun x_1815 () Real)
+(declare-fun x_1816 () Real)
+(declare-fun x_1817 () Real)
+(declare-fun x_1818 () Real)
+(declare-fun x_1819 () Real)
+(declare-fun x_1820 () Real)
+(declare-fun x_1821 () Real)
+(declare-fun x_1822 () Real)
+(declare-fun x_1823 () Real)
+(declare-fun x_1824 () Real)
+(declare-fun x_1825 () Real)
+(declare-fun x_1826 () Real)
+(declare-fun x_1827 () Real)
+(declare-fun x_1828 () Real)
+(declare-fun x_1829 () Real)
+(declare-fun x_1830 () Real)
+(declare-fun x_1831 () Real)
+(declare-fun x_1832 () Real)
+(declare-fun x_1833 () Real)
+(declare-fun x_1834 () Real)
+(declare-fun x_1835 () Real)
+(declare-fun x_1836 () Real)
+(declare-fun x_1837 () Real)
+(declare-fun x_1838 () Real)
+(declare-fun x_1839 () Real)
+(declare-fun x_1840 () Real)
+(declare-fun x_1841 () Real)
+(declare-fun x_1842 () Real)
+(declare-fun x_1843 () Real)
+(declare-fun x_1844 () Real)
+(declare-fun x_1845 () Real)
+(declare-fun x_1846 () Real)
+(declare-fun x_1847 () Real)
+(declare-fun x_1848 () Real)
+(declare-fun x_1849 () Real)
+(declare-fun x_1850 () Real)
+(declare-fun x_1851 () Real)
+(declare-fun x_1852 () Real)
+(declare-fun x_1853 () Real)
+(declare-fun x_1854 () Real)
+(declare-fun x_1855 () Real)
+(declare-fun x_1856 () Real)
+(declare-fun x_1857 () Real)
+(declare-fun x_1858 () Real)
+(declare-fun x_1859 () Real)
+(declare-fun x_1860 () Real)
+(declare-fun x_1861 () Real)
+(declare-fun x_1862 () Real)
+(declare-fun x_1863 () Real)
+(declare-fun x_1864 () Real)
+(declare-fun x_1865 () Real)
+(declare-fun x_1866 () Real)
+(declare-fun x_1867 () Real)
+(declare-fun x_1868 () Real)
+(declare-fun x_1869 () Real)
+(declare-fun x_1870 () Real)
+(declare-fun x_1871 () Real)
+(declare-fun x_1872 () Real)
+(declare-fun x_1873 () Real)
+(declare-fun x_1874 () Real)
+(declare-fun x_1875 () Real)
+(declare-fun x_1876 () Real)
+(declare-fun x_1877 () Real)
+(declare-fun x_1878 () Real)
+(declare-fun x_1879 () Real)
+(declare-fun x_1880 () Real)
+(declare-fun x_1881 () Real)
+(declare-fun x_1882 () Real)
+(declare-fun x_1883 () Real)
+(declare-fun x_1884 () Real)
+(declare-fun x_1885 () Real)
+(declare-fun x_1886 () Real)
+(declare-fun x_1887 () Real)
+(declare-fun x_1888 () Real)
+(declare-fun x_1889 () Real)
+(declare-fun x_1890 () Real)
+(declare-fun x_1891 () Real)
+(declare-fun x_1892 () Real)
+(declare-fun x_1893 () Real)
+(declare-fun x_1894 () Real)
+(declare-fun x_1895 () Real)
+(declare-fun x_1896 () Real)
+(declare-fun x_1897 () Real)
+(declare-fun x_1898 () Real)
+(declare-fun x_1899 () Real)
+(declare-fun x_1900 () Real)
+(declare-fun x_1901 () Real)
+(declare-fun x_1902 () Real)
+(declare-fun x_1903 () Real)
+(declare-fun x_1904 () Real)
+(declare-fun x_1905 () Real)
+(declare-fun x_1906 () Real)
+(declare-fun x_1907 () Real)
+(declare-fun x_1908 () Real)
+(declare-fun x_1909 () Real)
+(declare-fun x_1910 () Real)
+(declare-fun x_1911 () Real)
+(declare-fun x_1912 () Real)
+(declare-fun x_1913 () Real)
+(declare-fun x_1914 () Real)
+(declare-fun x_1915 () Real)
+(declare-fun x_1916 () Real)
+(declare-fun x_1917 () Real)
+(declare-fun x_1918 () Real)
+(declare-fun x_1919 () Real)
+(declare-fun x_1920 () Real)
+(declare-fun x_1921 () Real)
+(declare-fun x_1922 () Real)
+(declare-fun x_1923 () Real)
+(declare-fun x_1924 () Real)
+(declare-fun x_1925 () Real)
+(declare-fun x_1926 () Real)
+(declare-fun x_1927 () Real)
+(declare-fun x_1928 () Real)
+(declare-fun x_1929 () Real)
+(declare-fun x_1930 () Real)
+(declare-fun x_1931 () Real)
+(declare-fun x_1932 () Real)
+(declare-fun x_1933 () Real)
+(declare-fun x_1934 () Real)
+(declare-fun x_1935 () Real)
+(declare-fun x_1936 () Real)
+(declare-fun x_1937 () Real)
+(declare-fun x_1938 () Real)
+(declare-fun x_1939 () Real)
+(declare-fun x_1940 () Real)
+(declare-fun x_1941 () Real)
+(declare-fun x_1942 () Real)
+(declare-fun x_1943 () Real)
+(declare-fun x_1944 () Real)
+(declare-fun x_1945 () Real)
+(declare-fun x_1946 () Real)
+(declare-fun x_1947 () Real)
+(declare-fun x_1948 () Real)
+(declare-fun x_1949 () Real)
+(declare-fun x_1950 () Real)
+(declare-fun x_1951 () Real)
+(declare-fun x_1952 () Real)
+(declare-fun x_1953 () Real)
+(declare-fun x_1954 () Real)
+(declare-fun x_1955 () Real)
+(declare-fun x_1956 () Real)
+(declare-fun x_1957 () Real)
+(declare-fun x_1958 () Real)
+(declare-fun x_1959 () Real)
+(declare-fun x_1960 () Real)
+(declare-fun x_1961 () Real)
+(declare-fun x_1962 () Real)
+(declare-fun x_1963 () Real)
+(declare-fun x_1964 () Real)
+(declare-fun x_1965 () Real)
+(declare-fun x_1966 () Real)
+(declare-fun x_1967 () Real)
+(declare-fun x_1968 () Real)
+(declare-fun x_1969 () Real)
+(declare-fun x_1970 () Real)
+(declare-fun x_1971 () Real)
+(declare-fun x_1972 () Real)
+(declare-fun x_1973 () Real)
+(declare-fun x_1974 () Real)
+(declare-fun x_1975 () Real)
+(declare-fun x_1976 () Real)
+(declare-fun x_1977 () Real)
+(declare-fun x_1978 () Real)
+(declare-fun x_1979 () Real)
+(declare-fun x_1980 () Real)
+(declare-fun x_1981 () Real)
+(declare-fun x_1982 () Real)
+(declare-fun x_1983 () Real)
+(declare-fun x_1984 () Real)
+(declare-fun x_1985 () Real)
+(declare-fun x_1986 () Real)
+(declare-fun x_1987 () Real)
+(declare-fun x_1988 () Real)
+(declare-fun x_1989 () Real)
+(declare-fun x_1990 () Real)
+(declare-fun x_1991 () Real)
+(declare-fun x_1992 () Real)
+(declare-fun x_1993 () Real)
+(declare-fun x_1994 () Real)
+(declare-fun x_1995 () Real)
+(declare-fun x_1996 () Real)
+(declare-fun x_1997 () Real)
+(declare-fun x_1998 () Real)
+(declare-fun x_1999 () Real)
+(declare-fun x_2000 () Real)
+(declare-fun x_2001 () Real)
+(declare-fun x_2002 () Real)
+(declare-fun x_2003 () Real)
+(declare-fun x_2004 () Real)
+(declare-fun x_2005 () Real)
+(declare-fun x_2006 () Real)
+(declare-fun x_2007 () Real)
+(declare-fun x_2008 () Real)
+(declare-fun x_2009 () Real)
+(declare-fun x_2010 () Real)
+(declare-fun x_2011 () Real)
+(declare-fun x_2012 () Real)
+(declare-fun x_2013 () Real)
+(declare-fun x_2014 () Real)
+(declare-fun x_2015 () Real)
+(declare-fun x_2016 () Real)
+(declare-fun x_2017 () Real)
+(declare-fun x_2018 () Real)
+(declare-fun x_2019 () Real)
+(declare-fun x_2020 () Real)
+(declare-fun x_2021 () Real)
+(declare-fun x_2022 () Real)
+(declare-fun x_2023 () Real)
+(declare-fun x_2024 () Real)
+(declare-fun x_2025 () Real)
+(declare-fun x_2026 () Real)
+(declare-fun x_2027 () Real)
+(declare-fun x_2028 () Real)
+(declare-fun x_2029 () Real)
+(declare-fun x_2030 () Real)
+(declare-fun x_2031 () Real)
+(declare-fun x_2032 () Real)
+(declare-fun x_2033 () Real)
+(declare-fun x_2034 () Real)
+(declare-fun x_2035 () Real)
+(declare-fun x_2036 () Real)
+(declare-fun x_2037 () Real)
+(declare-fun x_2038 () Real)
+(declare-fun x_2039 () Real)
+(declare-fun x_2040 () Real)
+(declare-fun x_2041 () Real)
+(declare-fun x_2042 () Real)
+(declare-fun x_2043 () Real)
+(declare-fun x_2044 () Real)
+(declare-fun x_2045 () Real)
+(declare-fun x_2046 () Real)
+(declare-fun x_2047 () Real)
+(declare-fun x_2048 () Real)
+(declare-fun x_2049 () Real)
+(declare-fun x_2050 () Real)
+(declare-fun x_2051 () Real)
+(declare-fun x_2052 () Real)
+(declare-fun x_2053 () Real)
+(declare-fun x_2054 () Real)
+(declare-fun x_2055 () Real)
+(declare-fun x_2056 () Real)
+(declare-fun x_2057 () Real)
+(declare-fun x_2058 () Real)
+(declare-fun x_2059 () Real)
+(declare-fun x_2060 () Real)
+(declare-fun x_2061 () Real)
+(declare-fun x_2062 () Real)
+(declare-fun x_2063 () Real)
+(declare-fun x_2064 () Real)
+(declare-fun x_2065 () Real)
+(declare-fun x_2066 () Real)
+(declare-fun x_2067 () Real)
+(declare-fun x_2068 () Real)
+(declare-fun x_2069 () Real)
+(declare-fun x_2070 () Real)
+(declare-fun x_2071 () Real)
+(declare-fun x_2072 () Real)
+(declare-fun x_2073 () Real)
+(declare-fun x_2074 () Real)
+(declare-fun x_2075 () Real)
+(declare-fun x_2076 () Real)
+(declare-fun x_2077 () Real)
+(declare-fun x_2078 () Real)
+(declare-fun x_2079 () Real)
+(declare-fun x_2080 () Real)
+(declare-fun x_2081 () Real)
+(declare-fun x_2082 () Real)
+(declare-fun x_2083 () Real)
+(declare-fun x_2084 () Real)
+(declare-fun x_2085 () Real)
+(declare-fun x_2086 () Real)
+(declare-fun x_2087 () Real)
+(declare-fun x_2088 () Real)
+(declare-fun x_2089 () Real)
+(declare-fun x_2090 () Real)
+(declare-fun x_2091 () Real)
+(declare-fun x_2092 () Real)
+(declare-fun x_2093 () Real)
+(declare-fun x_2094 () Real)
+(declare-fun x_2095 () Real)
+(declare-fun x_2096 () Real)
+(declare-fun x_2097 () Real)
+(declare-fun x_2098 () Real)
+(declare-fun x_2099 () Real)
+(declare-fun x_2100 () Real)
+(declare-fun x_2101 () Real)
+(declare-fun x_2102 () Real)
+(declare-fun x_2103 () Real)
+(declare-fun x_2104 () Real)
+(declare-fun x_2105 () Real)
+(declare-fun x_2106 () Real)
+(declare-fun x_2107 () Real)
+(declare-fun x_2108 () Real)
+(declare-fun x_2109 () Real)
+(declare-fun x_2110 () Real)
+(declare-fun x_2111 () Real)
+(declare-fun x_2112 () Real)
+(declare-fun x_2113 () Real)
+(declare-fun x_2114 () Real)
+(declare-fun x_2115 () Real)
+(declare-fun x_2116 () Real)
+(declare-fun x_2117 () Real)
+(declare-fun x_2118 () Real)
+(declare-fun x_2119 () Real)
+(declare-fun x_2120 () Real)
+(declare-fun x_2121 () Real)
+(declare-fun x_2122 () Real)
+(declare-fun x_2123 () Real)
+(declare-fun x_2124 () Real)
+(declare-fun x_2125 () Real)
+(declare-fun x_2126 () Real)
+(declare-fun x_2127 () Real)
+(declare-fun x_2128 () Real)
+(declare-fun x_2129 () Real)
+(declare-fun x_2130 () Real)
+(declare-fun x_2131 () Real)
+(declare-fun x_2132 () Real)
+(declare-fun x_2133 () Real)
+(declare-fun x_2134 () Real)
+(declare-fun x_2135 () Real)
+(declare-fun x_2136 () Real)
+(declare-fun x_2137 () Real)
+(declare-fun x_2138 () Real)
+(declare-fun x_2139 () Real)
+(declare-fun x_2140 () Real)
+(declare-fun x_2141 () Real)
+(declare-fun x_2142 () Real)
+(declare-fun x_2143 () Real)
+(declare-fun x_2144 () Real)
+(declare-fun x_2145 () Real)
+(declare-fun x_2146 () Real)
+(declare-fun x_2147 () Real)
+(declare-fun x_2148 () Real)
+(declare-fun x_2149 () Real)
+(declare-fun x_2150 () Real)
+(declare-fun x_2151 () Real)
+(declare-fun x_2152 () Real)
+(declare-fun x_2153 () Real)
+(declare-fun x_2154 () Real)
+(declare-fun x_2155 () Real)
+(declare-fun x_2156 () Real)
+(declare-fun x_2157 () Real)
+(declare-fun x_2158 () Real)
+(declare-fun x_2159 () Real)
+(declare-fun x_2160 () Real)
+(declare-fun x_2161 () Real)
+(declare-fun x_2162 () Real)
+(declare-fun x_2163 () Real)
+(declare-fun x_2164 () Real)
+(declare-fun x_2165 () Real)
+(declare-fun x_2166 () Real)
+(declare-fun x_2167 () Real)
+(declare-fun x_2168 () Real)
+(declare-fun x_2169 () Real)
+(declare-fun x_2170 () Real)
+(declare-fun x_2171 () Real)
+(declare-fun x_2172 () Real)
+(declare-fun x_2173 () Real)
+(declare-fun x_2174 () Real)
+(declare-fun x_2175 () Real)
+(declare-fun x_2176 () Real)
+(declare-fun x_2177 () Real)
+(declare-fun x_2178 () Real)
+(declare-fun x_2179 () Real)
+(declare-fun x_2180 () Real)
+(declare-fun x_2181 () Real)
+(declare-fun x_2182 () Real)
+(declare-fun x_2183 () Real)
+(declare-fun x_2184 () Real)
+(declare-fun x_2185 () Real)
+(declare-fun x_2186 () Real)
+(declare-fun x_2187 () Real)
+(declare-fun x_2188 () Real)
+(declare-fun x_2189 () Real)
+(declare-fun x_2190 () Real)
+(declare-fun x_2191 () Real)
+(declare-fun x_2192 () Real)
+(declare-fun x_2193 () Real)
+(declare-fun x_2194 () Real)
+(declare-fun x_2195 () Real)
+(declare-fun x_2196 () Real)
+(declare-fun x_2197 () Real)
+(declare-fun x_2198 () Real)
+(declare-fun x_2199 () Real)
+(declare-fun x_2200 () Real)
+(declare-fun x_2201 () Real)
+(declare-fun x_2202 () Real)
+(declare-fun x_2203 () Real)
+(declare-fun x_2204 () Real)
+(declare-fun x_2205 () Real)
+(declare-fun x_2206 () Real)
+(declare-fun x_2207 () Real)
+(declare-fun x_2208 () Real)
+(declare-fun x_2209 () Real)
+(declare-fun x_2210 () Real)
+(declare-fun x_2211 () Real)
+(declare-fun x_2212 () Real)
+(declare-fun x_2213 () Real)
+(declare-fun x_2214 () Real)
+(declare-fun x_2215 () Real)
+(declare-fun x_2216 () Real)
+(declare-fun x_2217 () Real)
+(declare-fun x_2218 () Real)
+(declare-fun x_2219 () Real)
+(declare-fun x_2220 () Real)
+(declare-fun x_2221 () Real)
+(declare-fun x_2222 () Real)
+(declare-fun x_2223 () Real)
+(declare-fun x_2224 () Real)
+(declare-fun x_2225 () Real)
+(declare-fun x_2226 () Real)
+(declare-fun x_2227 () Real)
+(declare-fun x_2228 () Real)
+(declare-fun x_2229 () Real)
+(declare-fun x_2230 () Real)
+(declare-fun x_2231 () Real)
+(declare-fun x_2232 () Real)
+(declare-fun x_2233 () Real)
+(declare-fun x_2234 () Real)
+(declare-fun x_2235 () Real)
+(declare-fun x_2236 () Real)
+(declare-fun x_2237 () Real)
+(declare-fun x_2238 () Real)
+(declare-fun x_2239 () Real)
+(declare-fun x_2240 () Real)
+(declare-fun x_2241 () Real)
+(declare-fun x_2242 () Real)
+(declare-fun x_2243 () Real)
+(declare-fun x_2244 () Real)
+(declare-fun x_2245 () Real)
+(declare-fun x_2246 () Real)
+(declare-fun x_2247 () Real)
+(declare-fun x_2248 () Real)
+(declare-fun x_2249 () Real)
+(declare-fun x_2250 () Real)
+(declare-fun x_2251 () Real)
+(declare-fun x_2252 () Real)
+(declare-fun x_2253 () Real)
+(declare-fun x_2254 () Real)
+(declare-fun x_2255 () Real)
+(declare-fun x_2256 () Real)
+(declare-fun x_2257 () Real)
+(declare-fun x_2258 () Real)
+(declare-fun x_2259 () Real)
+(declare-fun x_2260 () Real)
+(declare-fun x_2261 () Real)
+(declare-fun x_2262 () Real)
+(declare-fun x_2263 () Real)
+(declare-fun x_2264 () Real)
+(declare-fun x_2265 () Real)
+(declare-fun x_2266 () Real)
+(declare-fun x_2267 () Real)
+(declare-fun x_2268 () Real)
+(declare-fun x_2269 () Real)
+(declare-fun x_2270 () Real)
+(declare-fun x_2271 () Real)
+(declare-fun x_2272 () Real)
+(declare-fun x_2273 () Real)
+(declare-fun x_2274 () Real)
+(declare-fun x_2275 () Real)
+(declare-fun x_2276 () Real)
+(declare-fun x_2277 () Real)
+(declare-fun x_2278 () Real)
+(declare-fun x_2279 () Real)
+(declare-fun x_2280 () Real)
+(declare-fun x_2281 () Real)
+(declare-fun x_2282 () Real)
+(declare-fun x_2283 () Real)
+(declare-fun x_2284 () Real)
+(declare-fun x_2285 () Real)
+(declare-fun x_2286 () Real)
+(declare-fun x_2287 () Real)
+(declare-fun x_2288 () Real)
+(declare-fun x_2289 () Real)
+(declare-fun x_2290 () Real)
+(declare-fun x_2291 () Real)
+(declare-fun x_2292 () Real)
+(declare-fun x_2293 () Real)
+(declare-fun x_2294 () Real)
+(declare-fun x_2295 () Real)
+(declare-fun x_2296 () Real)
+(declare-fun x_2297 () Real)
+(declare-fun x_2298 () Real)
+(declare-fun x_2299 () Real)
+(declare-fun x_2300 () Real)
+(declare-fun x_2301 () Real)
+(declare-fun x_2302 () Real)
+(declare-fun x_2303 () Real)
+(declare-fun x_2304 () Real)
+(declare-fun x_2305 () Real)
+(declare-fun x_2306 () Real)
+(declare-fun x_2307 () Real)
+(declare-fun x_2308 () Real)
+(declare-fun x_2309 () Real)
+(declare-fun x_2310 () Real)
+(declare-fun x_2311 () Real)
+(declare-fun x_2312 () Real)
+(declare-fun x_2313 () Real)
+(declare-fun x_2314 () Real)
+(declare-fun x_2315 () Real)
+(declare-fun x_2316 () Real)
+(declare-fun x_2317 () Real)
+(declare-fun x_2318 () Real)
+(declare-fun x_2319 () Real)
+(declare-fun x_2320 () Real)
+(declare-fun x_2321 () Real)
+(declare-fun x_2322 () Real)
+(declare-fun x_2323 () Real)
+(declare-fun x_2324 () Real)
+(declare-fun x_2325 () Real)
+(declare-fun x_2326 () Real)
+(declare-fun x_2327 () Real)
+(declare-fun x_2328 () Real)
+(declare-fun x_2329 () Real)
+(declare-fun x_2330 () Real)
+(declare-fun x_2331 () Real)
+(declare-fun x_2332 () Real)
+(declare-fun x_2333 () Real)
+(declare-fun x_2334 () Real)
+(declare-fun x_2335 () Real)
+(declare-fun x_2336 () Real)
+(declare-fun x_2337 () Real)
+(declare-fun x_2338 () Real)
+(declare-fun x_2339 () Real)
+(declare-fun x_2340 () Real)
+(declare-fun x_2341 () Real)
+(declare-fun x_2342 () Real)
+(declare-fun x_2343 () Real)
+(declare-fun x_2344 () Real)
+(declare-fun x_2345 () Real)
+(declare-fun x_2346 () Real)
+(declare-fun x_2347 () Real)
+(declare-fun x_2348 () Real)
+(declare-fun x_2349 () Real)
+(declare-fun x_2350 () Real)
+(declare-fun x_2351 () Real)
+(declare-fun x_2352 () Real)
+(declare-fun x_2353 () Real)
+(declare-fun x_2354 () Real)
+(declare-fun x_2355 () Real)
+(declare-fun x_2356 () Real)
+(declare-fun x_2357 () Real)
+(declare-fun x_2358 () Real)
+(declare-fun x_2359 () Real)
+(declare-fun x_2360 () Real)
+(declare-fun x_2361 () Real)
+(declare-fun x_2362 () Real)
+(declare-fun x_2363 () Real)
+(declare-fun x_2364 () Real)
+(declare-fun x_2365 () Real)
+(declare-fun x_2366 () Real)
+(declare-fun x_2367 () Real)
+(declare-fun x_2368 () Real)
+(declare-fun x_2369 () Real)
+(declare-fun x_2370 () Real)
+(declare-fun x_2371 () Real)
+(declare-fun x_2372 () Real)
+(declare-fun x_2373 () Real)
+(declare-fun x_2374 () Real)
+(declare-fun x_2375 () Real)
+(declare-fun x_2376 () Real)
+(declare-fun x_2377 () Real)
+(declare-fun x_2378 () Real)
+(declare-fun x_2379 () Real)
+(declare-fun x_2380 () Real)
+(declare-fun x_2381 () Real)
+(declare-fun x_2382 () Real)
+(declare-fun x_2383 () Real)
+(declare-fun x_2384 () Real)
+(declare-fun x_2385 () Real)
+(declare-fun x_2386 () Real)
+(declare-fun x_2387 () Real)
+(declare-fun x_2388 () Real)
+(declare-fun x_2389 () Real)
+(declare-fun x_2390 () Real)
+(declare-fun x_2391 () Real)
+(declare-fun x_2392 () Real)
+(declare-fun x_2393 () Real)
+(declare-fun x_2394 () Real)
+(declare-fun x_2395 () Real)
+(declare-fun x_2396 () Real)
+(declare-fun x_2397 () Real)
+(declare-fun x_2398 () Real)
+(declare-fun x_2399 () Real)
+(declare-fun x_2400 () Real)
+(declare-fun x_2401 () Real)
+(declare-fun x_2402 () Real)
+(declare-fun x_2403 () Real)
+(declare-fun x_2404 () Real)
+(declare-fun x_2405 () Real)
+(declare-fun x_2406 () Real)
+(declare-fun x_2407 () Real)
+(declare-fun x_2408 () Real)
+(declare-fun x_2409 () Real)
+(declare-fun x_2410 () Real)
+(declare-fun x_2411 () Real)
+(declare-fun x_2412 () Real)
+(declare-fun x_2413 () Real)
+(declare-fun x_2414 () Real)
+(declare-fun x_2415 () Real)
+(declare-fun x_2416 () Real)
+(declare-fun x_2417 () Real)
+(declare-fun x_2418 () Real)
+(declare-fun x_2419 () Real)
+(declare-fun x_2420 () Real)
+(declare-fun x_2421 () Real)
+(declare-fun x_2422 () Real)
+(declare-fun x_2423 () Real)
+(declare-fun x_2424 () Real)
+(declare-fun x_2425 () Real)
+(declare-fun x_2426 () Real)
+(declare-fun x_2427 () Real)
+(declare-fun x_2428 () Real)
+(declare-fun x_2429 () Real)
+(declare-fun x_2430 () Real)
+(declare-fun x_2431 () Real)
+(declare-fun x_2432 () Real)
+(declare-fun x_2433 () Real)
+(declare-fun x_2434 () Real)
+(declare-fun x_2435 () Real)
+(declare-fun x_2436 () Real)
+(declare-fun x_2437 () Real)
+(declare-fun x_2438 () Real)
+(declare-fun x_2439 () Real)
+(declare-fun x_2440 () Real)
+(declare-fun x_2441 () Real)
+(declare-fun x_2442 () Real)
+(declare-fun x_2443 () Real)
+(declare-fun x_2444 () Real)
+(declare-fun x_2445 () Real)
+(declare-fun x_2446 () Real)
+(declare-fun x_2447 () Real)
+(declare-fun x_2448 () Real)
+(declare-fun x_2449 () Real)
+(declare-fun x_2450 () Real)
+(declare-fun x_2451 () Real)
+(declare-fun x_2452 () Real)
+(declare-fun x_2453 () Real)
+(declare-fun x_2454 () Real)
+(declare-fun x_2455 () Real)
+(declare-fun x_2456 () Real)
+(declare-fun x_2457 () Real)
+(declare-fun x_2458 () Real)
+(declare-fun x_2459 () Real)
+(declare-fun x_2460 () Real)
+(declare-fun x_2461 () Real)
+(declare-fun x_2462 () Real)
+(declare-fun x_2463 () Real)
+(declare-fun x_2464 () Real)
+(declare-fun x_2465 () Real)
+(declare-fun x_2466 () Real)
+(declare-fun x_2467 () Real)
+(declare-fun x_2468 () Real)
+(declare-fun x_2469 () Real)
+(declare-fun x_2470 () Real)
+(declare-fun x_2471 () Real)
+(declare-fun x_2472 () Real)
+(declare-fun x_2473 () Real)
+(declare-fun x_2474 () Real)
+(declare-fun x_2475 () Real)
+(declare-fun x_2476 () Real)
+(declare-fun x_2477 () Real)
+(declare-fun x_2478 () Real)
+(declare-fun x_2479 () Real)
+(declare-fun x_2480 () Real)
+(declare-fun x_2481 () Real)
+(declare-fun x_2482 () Real)
+(declare-fun x_2483 () Real)
+(declare-fun x_2484 () Real)
+(declare-fun x_2485 () Real)
+(declare-fun x_2486 () Real)
+(declare-fun x_2487 () Real)
+(declare-fun x_2488 () Real)
+(declare-fun x_2489 () Real)
+(declare-fun x_2490 () Real)
+(declare-fun x_2491 () Real)
+(declare-fun x_2492 () Real)
+(declare-fun x_2493 () Real)
+(declare-fun x_2494 () Real)
+(declare-fun x_2495 () Real)
+(declare-fun x_2496 () Real)
+(declare-fun x_2497 () Real)
+(declare-fun x_2498 () Real)
+(declare-fun x_2499 () Real)
+(declare-fun x_2500 () Real)
+(declare-fun x_2501 () Real)
+(declare-fun x_2502 () Real)
+(declare-fun x_2503 () Real)
+(declare-fun x_2504 () Real)
+(declare-fun x_2505 () Real)
+(declare-fun x_2506 () Real)
+(declare-fun x_2507 () Real)
+(declare-fun x_2508 () Real)
+(declare-fun x_2509 () Real)
+(declare-fun x_2510 () Real)
+(declare-fun x_2511 () Real)
+(declare-fun x_2512 () Real)
+(declare-fun x_2513 () Real)
+(declare-fun x_2514 () Real)
+(declare-fun x_2515 () Real)
+(declare-fun x_2516 () Real)
+(declare-fun x_2517 () Real)
+(declare-fun x_2518 () Real)
+(declare-fun x_2519 () Real)
+(declare-fun x_2520 () Real)
+(declare-fun x_2521 () Real)
+(declare-fun x_2522 () Real)
+(declare-fun x_2523 () Real)
+(declare-fun x_2524 () Real)
+(declare-fun x_2525 () Real)
+(declare-fun x_2526 () Real)
+(declare-fun x_2527 () Real)
+(declare-fun x_2528 () Real)
+(declare-fun x_2529 () Real)
+(declare-fun x_2530 () Real)
+(declare-fun x_2531 () Real)
+(declare-fun x_2532 () Real)
+(declare-fun x_2533 () Real)
+(declare-fun x_2534 () Real)
+(declare-fun x_2535 () Real)
+(declare-fun x_2536 () Real)
+(declare-fun x_2537 () Real)
+(declare-fun x_2538 () Real)
+(declare-fun x_2539 () Real)
+(declare-fun x_2540 () Real)
+(declare-fun x_2541 () Real)
+(declare-fun x_2542 () Real)
+(declare-fun x_2543 () Real)
+(declare-fun x_2544 () Real)
+(declare-fun x_2545 () Real)
+(declare-fun x_2546 () Real)
+(declare-fun x_2547 () Real)
+(declare-fun x_2548 () Real)
+(declare-fun x_2549 () Real)
+(declare-fun x_2550 () Real)
+(declare-fun x_2551 () Real)
+(declare-fun x_2552 () Real)
+(declare-fun x_2553 () Real)
+(declare-fun x_2554 () Real)
+(declare-fun x_2555 () Real)
+(declare-fun x_2556 () Real)
+(declare-fun x_2557 () Real)
+(declare-fun x_2558 () Real)
+(declare-fun x_2559 () Real)
+(declare-fun x_2560 () Real)
+(declare-fun x_2561 () Real)
+(declare-fun x_2562 () Real)
+(declare-fun x_2563 () Real)
+(declare-fun x_2564 () Real)
+(declare-fun x_2565 () Real)
+(declare-fun x_2566 () Real)
+(declare-fun x_2567 () Real)
+(declare-fun x_2568 () Real)
+(declare-fun x_2569 () Real)
+(declare-fun x_2570 () Real)
+(declare-fun x_2571 () Real)
+(declare-fun x_2572 () Real)
+(declare-fun x_2573 () Real)
+(declare-fun x_2574 () Real)
+(declare-fun x_2575 () Real)
+(declare-fun x_2576 () Real)
+(declare-fun x_2577 () Real)
+(declare-fun x_2578 () Real)
+(declare-fun x_2579 () Real)
+(declare-fun x_2580 () Real)
+(declare-fun x_2581 () Real)
+(declare-fun x_2582 () Real)
+(declare-fun x_2583 () Real)
+(declare-fun x_2584 () Real)
+(declare-fun x_2585 () Real)
+(declare-fun x_2586 () Real)
+(declare-fun x_2587 () Real)
+(declare-fun x_2588 () Real)
+(declare-fun x_2589 () Real)
+(declare-fun x_2590 () Real)
+(declare-fun x_2591 () Real)
+(declare-fun x_2592 () Real)
+(declare-fun x_2593 () Real)
+(declare-fun x_2594 () Real)
+(declare-fun x_2595 () Real)
+(declare-fun x_2596 () Real)
+(declare-fun x_2597 () Real)
+(declare-fun x_2598 () Real)
+(declare-fun x_2599 () Real)
+(declare-fun x_2600 () Real)
+(declare-fun x_2601 () Real)
+(declare-fun x_2602 () Real)
+(declare-fun x_2603 () Real)
+(declare-fun x_2604 () Real)
+(declare-fun x_2605 () Real)
+(declare-fun x_2606 () Real)
+(declare-fun x_2607 () Real)
+(declare-fun x_2608 () Real)
+(declare-fun x_2609 () Real)
+(declare-fun x_2610 () Real)
+(declare-fun x_2611 () Real)
+(declare-fun x_2612 () Real)
+(declare-fun x_2613 () Real)
+(declare-fun x_2614 () Real)
+(declare-fun x_2615 () Real)
+(declare-fun x_2616 () Real)
+(declare-fun x_2617 () Real)
+(declare-fun x_2618 () Real)
+(declare-fun x_2619 () Real)
+(declare-fun x_2620 () Real)
+(declare-fun x_2621 () Real)
+(declare-fun x_2622 () Real)
+(declare-fun x_2623 () Real)
+(declare-fun x_2624 () Real)
+(declare-fun x_2625 () Real)
+(declare-fun x_2626 () Real)
+(declare-fun x_2627 () Real)
+(declare-fun x_2628 () Real)
+(declare-fun x_2629 () Real)
+(declare-fun x_2630 () Real)
+(declare-fun x_2631 () Real)
+(declare-fun x_2632 () Real)
+(declare-fun x_2633 () Real)
+(declare-fun x_2634 () Real)
+(declare-fun x_2635 () Real)
+(declare-fun x_2636 () Real)
+(declare-fun x_2637 () Real)
+(declare-fun x_2638 () Real)
+(declare-fun x_2639 () Real)
+(declare-fun x_2640 () Real)
+(declare-fun x_2641 () Real)
+(declare-fun x_2642 () Real)
+(declare-fun x_2643 () Real)
+(declare-fun x_2644 () Real)
+(declare-fun x_2645 () Real)
+(declare-fun x_2646 () Real)
+(declare-fun x_2647 () Real)
+(declare-fun x_2648 () Real)
+(declare-fun x_2649 () Real)
+(declare-fun x_2650 () Real)
+(declare-fun x_2651 () Real)
+(declare-fun x_2652 () Real)
+(declare-fun x_2653 () Real)
+(declare-fun x_2654 () Real)
+(declare-fun x_2655 () Real)
+(declare-fun x_2656 () Real)
+(declare-fun x_2657 () Real)
+(declare-fun x_2658 () Real)
+(declare-fun x_2659 () Real)
+(declare-fun x_2660 () Real)
+(declare-fun x_2661 () Real)
+(declare-fun x_2662 () Real)
+(declare-fun x_2663 () Real)
+(declare-fun x_2664 () Real)
+(declare-fun x_2665 () Real)
+(declare-fun x_2666 () Real)
+(declare-fun x_2667 () Real)
+(declare-fun x_2668 () Real)
+(declare-fun x_2669 () Real)
+(declare-fun x_2670 () Real)
+(declare-fun x_2671 () Real)
+(declare-fun x_2672 () Real)
+(declare-fun x_2673 () Real)
+(declare-fun x_2674 () Real)
+(declare-fun x_2675 () Real)
+(declare-fun x_2676 () Real)
+(declare-fun x_2677 () Real)
+(declare-fun x_2678 () Real)
+(declare-fun x_2679 () Real)
+(declare-fun x_2680 () Real)
+(declare-fun x_2681 () Real)
+(declare-fun x_2682 () Real)
+(declare-fun x_2683 () Real)
+(declare-fun x_2684 () Real)
+(declare-fun x_2685 () Real)
+(declare-fun x_2686 () Real)
+(declare-fun x_2687 () Real)
+(declare-fun x_2688 () Real)
+(declare-fun x_2689 () Real)
+(declare-fun x_2690 () Real)
+(declare-fun x_2691 () Real)
+(declare-fun x_2692 () Real)
+(declare-fun x_2693 () Real)
+(declare-fun x_2694 () Real)
+(declare-fun x_2695 () Real)
+(declare-fun x_2696 () Real)
+(declare-fun x_2697 () Real)
+(declare-fun x_2698 () Real)
+(declare-fun x_2699 () Real)
+(declare-fun x_2700 () Real)
+(declare-fun x_2701 () Real)
+(declare-fun x_2702 () Real)
+(declare-fun x_2703 () Real)
+(declare-fun x_2704 () Real)
+(declare-fun x_2705 () Real)
+(declare-fun x_2706 () Real)
+(declare-fun x_2707 () Real)
+(declare-fun x_2708 () Real)
+(declare-fun x_2709 () Real)
+(declare-fun x_2710 () Real)
+(declare-fun x_2711 () Real)
+(declare-fun x_2712 () Real)
+(declare-fun x_2713 () Real)
+(declare-fun x_2714 () Real)
+(declare-fun x_2715 () Real)
+(declare-fun x_2716 () Real)
+(declare-fun x_2717 () Real)
+(declare-fun x_2718 () Real)
+(declare-fun x_2719 () Real)
+(declare-fun x_2720 () Real)
+(declare-fun x_2721 () Real)
+(declare-fun x_2722 () Real)
+(declare-fun x_2723 () Real)
+(declare-fun x_2724 () Real)
+(declare-fun x_2725 () Real)
+(declare-fun x_2726 () Real)
+(declare-fun x_2727 () Real)
+(declare-fun x_2728 () Real)
+(declare-fun x_2729 () Real)
+(declare-fun x_2730 () Real)
+(declare-fun x_2731 () Real)
+(declare-fun x_2732 () Real)
+(declare-fun x_2733 () Real)
+(declare-fun x_2734 () Real)
+(declare-fun x_2735 () Real)
+(declare-fun x_2736 () Real)
+(declare-fun x_2737 () Real)
+(declare-fun x_2738 () Real)
+(declare-fun x_2739 () Real)
+(declare-fun x_2740 () Real)
+(declare-fun x_2741 () Real)
+(declare-fun x_2742 () Real)
+(declare-fun x_2743 () Real)
+(declare-fun x_2744 () Real)
+(declare-fun x_2745 () Real)
+(declare-fun x_2746 () Real)
+(declare-fun x_2747 () Real)
+(declare-fun x_2748 () Real)
+(declare-fun x_2749 () Real)
+(declare-fun x_2750 () Real)
+(declare-fun x_2751 () Real)
+(declare-fun x_2752 () Real)
+(declare-fun x_2753 () Real)
+(declare-fun x_2754 () Real)
+(declare-fun x_2755 () Real)
+(declare-fun x_2756 () Real)
+(declare-fun x_2757 () Real)
+(declare-fun x_2758 () Real)
+(declare-fun x_2759 () Real)
+(declare-fun x_2760 () Real)
+(declare-fun x_2761 () Real)
+(declare-fun x_2762 () Real)
+(declare-fun x_2763 () Real)
+(declare-fun x_2764 () Real)
+(declare-fun x_2765 () Real)
+(declare-fun x_2766 () Real)
+(declare-fun x_2767 () Real)
+(declare-fun x_2768 () Real)
+(declare-fun x_2769 () Real)
+(declare-fun x_2770 () Real)
+(declare-fun x_2771 () Real)
+(declare-fun x_2772 () Real)
+(declare-fun x_2773 () Real)
+(declare-fun x_2774 () Real)
+(declare-fun x_2775 () Real)
+(declare-fun x_2776 () Real)
+(declare-fun x_2777 () Real)
+(declare-fun x_2778 () Real)
+(declare-fun x_2779 () Real)
+(declare-fun x_2780 () Real)
+(declare-fun x_2781 () Real)
+(declare-fun x_2782 () Real)
+(declare-fun x_2783 () Real)
+(declare-fun x_2784 () Real)
+(declare-fun x_2785 () Real)
+(declare-fun x_2786 () Real)
+(declare-fun x_2787 () Real)
+(declare-fun x_2788 () Real)
+(declare-fun x_2789 () Real)
+(declare-fun x_2790 () Real)
+(declare-fun x_2791 () Real)
+(declare-fun x_2792 () Real)
+(declare-fun x_2793 () Real)
+(declare-fun x_2794 () Real)
+(declare-fun x_2795 () Real)
+(declare-fun x_2796 () Real)
+(declare-fun x_2797 () Real)
+(declare-fun x_2798 () Real)
+(declare-fun x_2799 () Real)
+(declare-fun x_2800 () Real)
+(declare-fun x_2801 () Real)
+(declare-fun x_2802 () Real)
+(declare-fun x_2803 () Real)
+(declare-fun x_2804 () Real)
+(declare-fun x_2805 () Real)
+(declare-fun x_2806 () Real)
+(declare-fun x_2807 () Real)
+(declare-fun x_2808 () Real)
+(declare-fun x_2809 () Real)
+(declare-fun x_2810 () Real)
+(declare-fun x_2811 () Real)
+(declare-fun x_2812 () Real)
+(declare-fun x_2813 () Real)
+(declare-fun x_2814 () Real)
+(declare-fun x_2815 () Real)
+(declare-fun x_2816 () Real)
+(declare-fun x_2817 () Real)
+(declare-fun x_2818 () Real)
+(declare-fun x_2819 () Real)
+(declare-fun x_2820 () Real)
+(declare-fun x_2821 () Real)
+(declare-fun x_2822 () Real)
+(declare-fun x_2823 () Real)
+(declare-fun x_2824 () Real)
+(declare-fun x_2825 () Real)
+(declare-fun x_2826 () Real)
+(declare-fun x_2827 () Real)
+(declare-fun x_2828 () Real)
+(declare-fun x_2829 () Real)
+(declare-fun x_2830 () Real)
+(declare-fun x_2831 () Real)
+(declare-fun x_2832 () Real)
+(declare-fun x_2833 () Real)
+(declare-fun x_2834 () Real)
+(declare-fun x_2835 () Real)
+(declare-fun x_2836 () Real)
+(declare-fun x_2837 () Real)
+(declare-fun x_2838 () Real)
+(declare-fun x_2839 () Real)
+(declare-fun x_2840 () Real)
+(declare-fun x_2841 () Real)
+(declare-fun x_2842 () Real)
+(declare-fun x_2843 () Real)
+(declare-fun x_2844 () Real)
+(declare-fun x_2845 () Real)
+(declare-fun x_2846 () Real)
+(declare-fun x_2847 () Real)
+(declare-fun x_2848 () Real)
+(declare-fun x_2849 () Real)
+(declare-fun x_2850 () Real)
+(declare-fun x_2851 () Real)
+(declare-fun x_2852 () Real)
+(declare-fun x_2853 () Real)
+(declare-fun x_2854 () Real)
+(declare-fun x_2855 () Real)
+(declare-fun x_2856 () Real)
+(declare-fun x_2857 () Real)
+(declare-fun x_2858 () Real)
+(declare-fun x_2859 () Real)
+(declare-fun x_2860 () Real)
+(declare-fun x_2861 () Real)
+(declare-fun x_2862 () Real)
+(declare-fun x_2863 () Real)
+(declare-fun x_2864 () Real)
+(declare-fun x_2865 () Real)
+(declare-fun x_2866 () Real)
+(declare-fun x_2867 () Real)
+(declare-fun x_2868 () Real)
+(declare-fun x_2869 () Real)
+(declare-fun x_2870 () Real)
+(declare-fun x_2871 () Real)
+(declare-fun x_2872 () Real)
+(declare-fun x_2873 () Real)
+(declare-fun x_2874 () Real)
+(declare-fun x_2875 () Real)
+(declare-fun x_2876 () Real)
+(declare-fun x_2877 () Real)
+(declare-fun x_2878 () Real)
+(declare-fun x_2879 () Real)
+(declare-fun x_2880 () Real)
+(declare-fun x_2881 () Real)
+(declare-fun x_2882 () Real)
+(declare-fun x_2883 () Real)
+(declare-fun x_2884 () Real)
+(declare-fun x_2885 () Real)
+(declare-fun x_2886 () Real)
+(declare-fun x_2887 () Real)
+(declare-fun x_2888 () Real)
+(declare-fun x_2889 () Real)
+(declare-fun x_2890 () Real)
+(declare-fun x_2891 () Real)
+(declare-fun x_2892 () Real)
+(declare-fun x_2893 () Real)
+(declare-fun x_2894 () Real)
+(declare-fun x_2895 () Real)
+(declare-fun x_2896 () Real)
+(declare-fun x_2897 () Real)
+(declare-fun x_2898 () Real)
+(declare-fun x_2899 () Real)
+(declare-fun x_2900 () Real)
+(declare-fun x_2901 () Real)
+(declare-fun x_2902 () Real)
+(declare-fun x_2903 () Real)
+(declare-fun x_2904 () Real)
+(declare-fun x_2905 () Real)
+(declare-fun x_2906 () Real)
+(declare-fun x_2907 () Real)
+(declare-fun x_2908 () Real)
+(declare-fun x_2909 () Real)
+(declare-fun x_2910 () Real)
+(declare-fun x_2911 () Real)
+(declare-fun x_2912 () Real)
+(declare-fun x_2913 () Real)
+(declare-fun x_2914 () Real)
+(declare-fun x_2915 () Real)
+(declare-fun x_2916 () Real)
+(declare-fun x_2917 () Real)
+(declare-fun x_2918 () Real)
+(declare-fun x_2919 () Real)
+(declare-fun x_2920 () Real)
+(declare-fun x_2921 () Real)
+(declare-fun x_2922 () Real)
+(declare-fun x_2923 () Real)
+(declare-fun x_2924 () Real)
+(declare-fun x_2925 () Real)
+(declare-fun x_2926 () Real)
+(declare-fun x_2927 () Real)
+(declare-fun x_2928 () Real)
+(declare-fun x_2929 () Real)
+(declare-fun x_2930 () Real)
+(declare-fun x_2931 () Real)
+(declare-fun x_2932 () Real)
+(declare-fun x_2933 () Real)
+(declare-fun x_2934 () Real)
+(declare-fun x_2935 () Real)
+(declare-fun x_2936 () Real)
+(declare-fun x_2937 () Real)
+(declare-fun x_2938 () Real)
+(declare-fun x_2939 () Real)
+(declare-fun x_2940 () Real)
+(declare-fun x_2941 () Real)
+(declare-fun x_2942 () Real)
+(declare-fun x_2943 () Real)
+(declare-fun x_2944 () Real)
+(declare-fun x_2945 () Real)
+(declare-fun x_2946 () Real)
+(declare-fun x_2947 () Real)
+(declare-fun x_2948 () Real)
+(declare-fun x_2949 () Real)
+(declare-fun x_2950 () Real)
+(declare-fun x_2951 () Real)
+(declare-fun x_2952 () Real)
+(declare-fun x_2953 () Real)
+(declare-fun x_2954 () Real)
+(declare-fun x_2955 () Real)
+(declare-fun x_2956 () Real)
+(declare-fun x_2957 () Real)
+(declare-fun x_2958 () Real)
+(declare-fun x_2959 () Real)
+(declare-fun x_2960 () Real)
+(declare-fun x_2961 () Real)
+(declare-fun x_2962 () Real)
+(declare-fun x_2963 () Real)
+(declare-fun x_2964 () Real)
+(declare-fun x_2965 () Real)
+(declare-fun x_2966 () Real)
+(declare-fun x_2967 () Real)
+(declare-fun x_2968 () Real)
+(declare-fun x_2969 () Real)
+(declare-fun x_2970 () Real)
+(declare-fun x_2971 () Real)
+(declare-fun x_2972 () Real)
+(declare-fun x_2973 () Real)
+(declare-fun x_2974 () Real)
+(declare-fun x_2975 () Real)
+(declare-fun x_2976 () Real)
+(declare-fun x_2977 () Real)
+(declare-fun x_2978 () Real)
+(declare-fun x_2979 () Real)
+(declare-fun x_2980 () Real)
+(declare-fun x_2981 () Real)
+(declare-fun x_2982 () Real)
+(declare-fun x_2983 () Real)
+(declare-fun x_2984 () Real)
+(declare-fun x_2985 () Real)
+(declare-fun x_2986 () Real)
+(declare-fun x_2987 () Real)
+(declare-fun x_2988 () Real)
+(declare-fun x_2989 () Real)
+(declare-fun x_2990 () Real)
+(declare-fun x_2991 () Real)
+(declare-fun x_2992 () Real)
+(declare-fun x_2993 () Real)
+(declare-fun x_2994 () Real)
+(declare-fun x_2995 () Real)
+(declare-fun x_2996 () Real)
+(declare-fun x_2997 () Real)
+(declare-fun x_2998 () Real)
+(declare-fun x_2999 () Real)
+(assert (< x_0000 x_0001))
+(assert (< x_0001 x_0002))
+(assert (< x_0002 x_0003))
+(assert (< x_0003 x_0004))
+(assert (< x_0004 x_0005))
+(assert (< x_0005 x_0006))
+(assert (< x_0006 x_0007))
+(assert (< x_0007 x_0008))
+(assert (< x_0008 x_0009))
+(assert (< x_0009 x_0010))
+(assert (< x_0010 x_0011))
+(assert (< x_0011 x_0012))
+(assert (< x_0012 x_0013))
+(assert (< x_0013 x_0014))
+(assert (< x_0014 x_0015))
+(assert (< x_0015 x_0016))
+(assert (< x_0016 x_0017))
+(assert (< x_0017 x_0018))
+(assert (< x_0018 x_0019))
+(assert (< x_0019 x_0020))
+(assert (< x_0020 x_0021))
+(assert (< x_0021 x_0022))
+(assert (< x_0022 x_0023))
+(assert (< x_0023 x_0024))
+(assert (< x_0024 x_0025))
+(assert (< x_0025 x_0026))
+(assert (< x_0026 x_0027))
+(assert (< x_0027 x_0028))
+(assert (< x_0028 x_0029))
+(assert (< x_0029 x_0030))
+(assert (< x_0030 x_0031))
+(assert (< x_0031 x_0032))
+(assert (< x_0032 x_0033))
+(assert (< x_0033 x_0034))
+(assert (< x_0034 x_0035))
+(assert (< x_0035 x_0036))
+(assert (< x_0036 x_0037))
+(assert (< x_0037 x_0038))
+(assert (< x_0038 x_0039))
+(assert (< x_0039 x_0040))
+(assert (< x_0040 x_0041))
+(assert (< x_0041 x_0042))
+(assert (< x_0042 x_0043))
+(assert (< x_0043 x_0044))
+(assert (< x_0044 x_0045))
+(assert (< x_0045 x_0046))
+(assert (< x_0046 x_0047))
+(assert (< x_0047 x_0048))
+(assert (< x_0048 x_0049))
+(assert (< x_0049 x_0050))
+(assert (< x_0050 x_0051))
+(assert (< x_0051 x_0052))
+(assert (< x_0052 x_0053))
+(assert (< x_0053 x_0054))
+(assert (< x_0054 x_0055))
+(assert (< x_0055 x_0056))
+(assert (< x_0056 x_0057))
+(assert (< x_0057 x_0058))
+(assert (< x_0058 x_0059))
+(assert (< x_0059 x_0060))
+(assert (< x_0060 x_0061))
+(assert (< x_0061 x_0062))
+(assert (< x_0062 x_0063))
+(assert (< x_0063 x_0064))
+(assert (< x_0064 x_0065))
+(assert (< x_0065 x_0066))
+(assert (< x_0066 x_0067))
+(assert (< x_0067 x_0068))
+(assert (< x_0068 x_0069))
+(assert (< x_0069 x_0070))
+(assert (< x_0070 x_0071))
+(assert (< x_0071 x_0072))
+(assert (< x_0072 x_0073))
+(assert (< x_0073 x_0074))
+(assert (< x_0074 x_0075))
+(assert (< x_0075 x_0076))
+(assert (< x_0076 x_0077))
+(assert (< x_0077 x_0078))
+(assert (< x_0078 x_0079))
+(assert (< x_0079 x_0080))
+(assert (< x_0080 x_0081))
+(assert (< x_0081 x_0082))
+(assert (< x_0082 x_0083))
+(assert (< x_0083 x_0084))
+(assert (< x_0084 x_0085))
+(assert (< x_0085 x_0086))
+(assert (< x_0086 x_0087))
+(assert (< x_0087 x_0088))
+(assert (< x_0088 x_0089))
+(assert (< x_0089 x_0090))
+(assert (< x_0090 x_0091))
+(assert (< x_0091 x_0092))
+(assert (< x_0092 x_0093))
+(assert (< x_0093 x_0094))
+(assert (< x_0094 x_0095))
+(assert (< x_0095 x_0096))
+(assert (< x_0096 x_0097))
+(assert (< x_0097 x_0098))
+(assert (< x_0098 x_0099))
+(assert (< x_0099 x_0100))
+(assert (< x_0100 x_0101))
+(assert (< x_0101 x_0102))
+(assert (< x_0102 x_0103))
+(assert (< x_0103 x_0104))
+(assert (< x_0104 x_0105))
+(assert (< x_0105 x_0106))
+(assert (< x_0106 x_0107))
+(assert (< x_0107 x_0108))
+(assert (< x_0108 x_0109))
+(assert (< x_0109 x_0110))
+(assert (< x_0110 x_0111))
+(assert (< x_0111 x_0112))
+(assert (< x_0112 x_0113))
+(assert (< x_0113 x_0114))
+(assert (< x_0114 x_0115))
+(assert (< x_0115 x_0116))
+(assert (< x_0116 x_0117))
+(assert (< x_0117 x_0118))
+(assert (< x_0118 x_0119))
+(assert (< x_0119 x_0120))
+(assert (< x_0120 x_0121))
+(assert (< x_0121 x_0122))
+(assert (< x_0122 x_0123))
+(assert (< x_0123 x_0124))
+(assert (< x_0124 x_0125))
+(assert (< x_0125 x_0126))
+(assert (< x_0126 x_0127))
+(assert (< x_0127 x_0128))
+(assert (< x_0128 x_0129))
+(assert (< x_0129 x_0130))
+(assert (< x_0130 x_0131))
+(assert (< x_0131 x_0132))
+(assert (< x_0132 x_0133))
+(assert (< x_0133 x_0134))
+(assert (< x_0134 x_0135))
+(assert (< x_0135 x_0136))
+(assert (< x_0136 x_0137))
+(assert (< x_0137 x_0138))
+(assert (< x_0138 x_0139))
+(assert (< x_0139 x_0140))
+(assert (< x_0140 x_0141))
+(assert (< x_0141 x_0142))
+(assert (< x_0142 x_0143))
+(assert (< x_0143 x_0144))
+(assert (< x_0144 x_0145))
+(assert (< x_0145 x_0146))
+(assert (< x_0146 x_0147))
+(assert (< x_0147 x_0148))
+(assert (< x_0148 x_0149))
+(assert (< x_0149 x_0150))
+(assert (< x_0150 x_0151))
+(assert (< x_0151 x_0152))
+(assert (< x_0152 x_0153))
+(assert (< x_0153 x_0154))
+(assert (< x_0154 x_0155))
+(assert (< x_0155 x_0156))
+(assert (< x_0156 x_0157))
+(assert (< x_0157 x_0158))
+(assert (< x_0158 x_0159))
+(assert (< x_0159 x_0160))
+(assert (< x_0160 x_0161))
+(assert (< x_0161 x_0162))
+(assert (< x_0162 x_0163))
+(assert (< x_0163 x_0164))
+(assert (< x_0164 x_0165))
+(assert (< x_0165 x_0166))
+(assert (< x_0166 x_0167))
+(assert (< x_0167 x_0168))
+(assert (< x_0168 x_0169))
+(assert (< x_0169 x_0170))
+(assert (< x_0170 x_0171))
+(assert (< x_0171 x_0172))
+(assert (< x_0172 x_0173))
+(assert (< x_0173 x_0174))
+(assert (< x_0174 x_0175))
+(assert (< x_0175 x_0176))
+(assert (< x_0176 x_0177))
+(assert (< x_0177 x_0178))
+(assert (< x_0178 x_0179))
+(assert (< x_0179 x_0180))
+(assert (< x_0180 x_0181))
+(assert (< x_0181 x_0182))
+(assert (< x_0182 x_0183))
+(assert (< x_0183 x_0184))
+(assert (< x_0184 x_0185))
+(assert (< x_0185 x_0186))
+(assert (< x_0186 x_0187))
+(assert (< x_0187 x_0188))
+(assert (< x_0188 x_0189))
+(assert (< x_0189 x_0190))
+(assert (< x_0190 x_0191))
+(assert (< x_0191 x_0192))
+(assert (< x_0192 x_0193))
+(assert (< x_0193 x_0194))
+(assert (< x_0194 x_0195))
+(assert (< x_0195 x_0196))
+(assert (< x_0196 x_0197))
+(assert (< x_0197 x_0198))
+(assert (< x_0198 x_0199))
+(assert (< x_0199 x_0200))
+(assert (< x_0200 x_0201))
+(assert (< x_0201 x_0202))
+(assert (< x_0202 x_0203))
+(assert (< x_0203 x_0204))
+(assert (< x_0204 x_0205))
+(assert (< x_0205 x_0206))
+(assert (< x_0206 x_0207))
+(assert (< x_0207 x_0208))
+(assert (< x_0208 x_0209))
+(assert (< x_0209 x_0210))
+(assert (< x_0210 x_0211))
+(assert (< x_0211 x_0212))
+(assert (< x_0212 x_0213))
+(assert (< x_0213 x_0214))
+(assert (< x_0214 x_0215))
+(assert (< x_0215 x_0216))
+(assert (< x_0216 x_0217))
+(assert (< x_0217 x_0218))
+(assert (< x_0218 x_0219))
+(assert (< x_0219 x_0220))
+(assert (< x_0220 x_0221))
+(assert (< x_0221 x_0222))
+(assert (< x_0222 x_0223))
+(assert (< x_0223 x_0224))
+(assert (< x_0224 x_0225))
+(assert (< x_0225 x_0226))
+(assert (< x_0226 x_0227))
+(assert (< x_0227 x_0228))
+(assert (< x_0228 x_0229))
+(assert (< x_0229 x_0230))
+(assert (< x_0230 x_0231))
+(assert (< x_0231 x_0232))
+(assert (< x_0232 x_0233))
+(assert (< x_0233 x_0234))
+(assert (< x_0234 x_0235))
+(assert (< x_0235 x_0236))
+(assert (< x_0236 x_0237))
+(assert (< x_0237 x_0238))
+(assert (< x_0238 x_0239))
+(assert (< x_0239 x_0240))
+(assert (< x_0240 x_0241))
+(assert (< x_0241 x_0242))
+(assert (< x_0242 x_0243))
+(assert (< x_0243 x_0244))
+(assert (< x_0244 x_0245))
+(assert (< x_0245 x_0246))
+(assert (< x_0246 x_0247))
+(assert (< x_0247 x_0248))
+(assert (< x_0248 x_0249))
+(assert (< x_0249 x_0250))
+(assert (< x_0250 x_0251))
+(assert (< x_0251 x_0252))
+(assert (< x_0252 x_0253))
+(assert (< x_0253 x_0254))
+(assert (< x_0254 x_0255))
+(assert (< x_0255 x_0256))
+(assert (< x_0256 x_0257))
+(assert (< x_0257 x_0258))
+(assert (< x_0258 x_0259))
+(assert (< x_0259 x_0260))
+(assert (< x_0260 x_0261))
+(assert (< x_0261 x_0262))
+(assert (< x_0262 x_0263))
+(assert (< x_0263 x_0264))
+(assert (< x_0264 x_0265))
+(assert (< x_0265 x_0266))
+(assert (< x_0266 x_0267))
+(assert (< x_0267 x_0268))
+(assert (< x_0268 x_0269))
+(assert (< x_0269 x_0270))
+(assert (< x_0270 x_0271))
+(assert (< x_0271 x_0272))
+(assert (< x_0272 x_0273))
+(assert (< x_0273 x_0274))
+(assert (< x_0274 x_0275))
+(assert (< x_0275 x_0276))
+(assert (< x_0276 x_0277))
+(assert (< x_0277 x_0278))
+(assert (< x_0278 x_0279))
+(assert (< x_0279 x_0280))
+(assert (< x_0280 x_0281))
+(assert (< x_0281 x_0282))
+(assert (< x_0282 x_0283))
+(assert (< x_0283 x_0284))
+(assert (< x_0284 x_0285))
+(assert (< x_0285 x_0286))
+(assert (< x_0286 x_0287))
+(assert (< x_0287 x_0288))
+(assert (< x_0288 x_0289))
+(assert (< x_0289 x_0290))
+(assert (< x_0290 x_0291))
+(assert (< x_0291 x_0292))
+(assert (< x_0292 x_0293))
+(assert (< x_0293 x_0294))
+(assert (< x_0294 x_0295))
+(assert (< x_0295 x_0296))
+(assert (< x_0296 x_0297))
+(assert (< x_0297 x_0298))
+(assert (< x_0298 x_0299))
+(assert (< x_0299 x_0300))
+(assert (< x_0300 x_0301))
+(assert (< x_0301 x_0302))
+(assert (< x_0302 x_0303))
+(assert (< x_0303 x_0304))
+(assert (< x_0304 x_0305))
+(assert (< x_0305 x_0306))
+(assert (< x_0306 x_0307))
+(assert (< x_0307 x_0308))
+(assert (< x_0308 x_0309))
+(assert (< x_0309 x_0310))
+(assert (< x_0310 x_0311))
+(assert (< x_0311 x_0312))
+(assert (< x_0312 x_0313))
+(assert (< x_0313 x_0314))
+(assert (< x_0314 x_0315))
+(assert (< x_0315 x_0316))
+(assert (< x_0316 x_0317))
+(assert (< x_0317 x_0318))
+(assert (< x_0318 x_0319))
+(assert (< x_0319 x_0320))
+(assert (< x_0320 x_0321))
+(assert (< x_0321 x_0322))
+(assert (< x_0322 x_0323))
+(assert (< x_0323 x_0324))
+(assert (< x_0324 x_0325))
+(assert (< x_0325 x_0326))
+(assert (< x_0326 x_0327))
+(assert (< x_0327 x_0328))
+(assert (< x_0328 x_0329))
+(assert (< x_0329 x_0330))
+(assert (< x_0330 x_0331))
+(assert (< x_0331 x_0332))
+(assert (< x_0332 x_0333))
+(assert (< x_0333 x_0334))
+(assert (< x_0334 x_0335))
+(assert (< x_0335 x_0336))
+(assert (< x_0336 x_0337))
+(assert (< x_0337 x_0338))
+(assert (< x_0338 x_0339))
+(assert (< x_0339 x_0340))
+(assert (< x_0340 x_0341))
+(assert (< x_0341 x_0342))
+(assert (< x_0342 x_0343))
+(assert (< x_0343 x_0344))
+(assert (< x_0344 x_0345))
+(assert (< x_0345 x_0346))
+(assert (< x_0346 x_0347))
+(assert (< x_0347 x_0348))
+(assert (< x_0348 x_0349))
+(assert (< x_0349 x_0350))
+(assert (< x_0350 x_0351))
+(assert (< x_0351 x_0352))
+(assert (< x_0352 x_0353))
+(assert (< x_0353 x_0354))
+(assert (< x_0354 x_0355))
+(assert (< x_0355 x_0356))
+(assert (< x_0356 x_0357))
+(assert (< x_0357 x_0358))
+(assert (< x_0358 x_0359))
+(assert (< x_0359 x_0360))
+(assert (< x_0360 x_0361))
+(assert (< x_0361 x_0362))
+(assert (< x_0362 x_0363))
+(assert (< x_0363 x_0364))
+(assert (< x_0364 x_0365))
+(assert (< x_0365 x_0366))
+(assert (< x_0366 x_0367))
+(assert (< x_0367 x_0368))
+(assert (< x_0368 x_0369))
+(assert (< x_0369 x_0370))
+(assert (< x_0370 x_0371))
+(assert (< x_0371 x_0372))
+(assert (< x_0372 x_0373))
+(assert (< x_0373 x_0374))
+(assert (< x_0374 x_0375))
+(assert (< x_0375 x_0376))
+(assert (< x_0376 x_0377))
+(assert (< x_0377 x_0378))
+(assert (< x_0378 x_0379))
+(assert (< x_0379 x_0380))
+(assert (< x_0380 x_0381))
+(assert (< x_0381 x_0382))
+(assert (< x_0382 x_0383))
+(assert (< x_0383 x_0384))
+(assert (< x_0384 x_0385))
+(assert (< x_0385 x_0386))
+(assert (< x_0386 x_0387))
+(assert (< x_0387 x_0388))
+(assert (< x_0388 x_0389))
+(assert (< x_0389 x_0390))
+(assert (< x_0390 x_0391))
+(assert (< x_0391 x_0392))
+(assert (< x_0392 x_0393))
+(assert (< x_0393 x_0394))
+(assert (< x_0394 x_0395))
+(assert (< x_0395 x_0396))
+(assert (< x_0396 x_0397))
+(assert (< x_0397 x_0398))
+(assert (< x_0398 x_0399))
+(assert (< x_0399 x_0400))
+(assert (< x_0400 x_0401))
+(assert (< x_0401 x_0402))
+(assert (< x_0402 x_0403))
+(assert (< x_0403 x_0404))
+(assert (< x_0404 x_0405))
+(assert (< x_0405 x_0406))
+(assert (< x_0406 x_0407))
+(assert (< x_0407 x_0408))
+(assert (< x_0408 x_0409))
+(assert (< x_0409 x_0410))
+(assert (< x_0410 x_0411))
+(assert (< x_0411 x_0412))
+(assert (< x_0412 x_0413))
+(assert (< x_0413 x_0414))
+(assert (< x_0414 x_0415))
+(assert (< x_0415 x_0416))
+(assert (< x_0416 x_0417))
+(assert (< x_0417 x_0418))
+(assert (< x_0418 x_0419))
+(assert (< x_0419 x_0420))
+(assert (< x_0420 x_0421))
+(assert (< x_0421 x_0422))
+(assert (< x_0422 x_0423))
+(assert (< x_0423 x_0424))
+(assert (< x_0424 x_0425))
+(assert (< x_0425 x_0426))
+(assert (< x_0426 x_0427))
+(assert (< x_0427 x_0428))
+(assert (< x_0428 x_0429))
+(assert (< x_0429 x_0430))
+(assert (< x_0430 x_0431))
+(assert (< x_0431 x_0432))
+(assert (< x_0432 x_0433))
+(assert (< x_0433 x_0434))
+(assert (< x_0434 x_0435))
+(assert (< x_0435 x_0436))
+(assert (< x_0436 x_0437))
+(assert (< x_0437 x_0438))
+(assert (< x_0438 x_0439))
+(assert (< x_0439 x_0440))
+(assert (< x_0440 x_0441))
+(assert (< x_0441 x_0442))
+(assert (< x_0442 x_0443))
+(assert (< x_0443 x_0444))
+(assert (< x_0444 x_0445))
+(assert (< x_0445 x_0446))
+(assert (< x_0446 x_0447))
+(assert (< x_0447 x_0448))
+(assert (< x_0448 x_0449))
+(assert (< x_0449 x_0450))
+(assert (< x_0450 x_0451))
+(assert (< x_0451 x_0452))
+(assert (< x_0452 x_0453))
+(assert (< x_0453 x_0454))
+(assert (< x_0454 x_0455))
+(assert (< x_0455 x_0456))
+(assert (< x_0456 x_0457))
+(assert (< x_0457 x_0458))
+(assert (< x_0458 x_0459))
+(assert (< x_0459 x_0460))
+(assert (< x_0460 x_0461))
+(assert (< x_0461 x_0462))
+(assert (< x_0462 x_0463))
+(assert (< x_0463 x_0464))
+(assert (< x_0464 x_0465))
+(assert (< x_0465 x_0466))
+(assert (< x_0466 x_0467))
+(assert (< x_0467 x_0468))
+(assert (< x_0468 x_0469))
+(assert (< x_0469 x_0470))
+(assert (< x_0470 x_0471))
+(assert (< x_0471 x_0472))
+(assert (< x_0472 x_0473))
+(assert (< x_0473 x_0474))
+(assert (< x_0474 x_0475))
+(assert (< x_0475 x_0476))
+(assert (< x_0476 x_0477))
+(assert (< x_0477 x_0478))
+(assert (< x_0478 x_0479))
+(assert (< x_0479 x_0480))
+(assert (< x_0480 x_0481))
+(assert (< x_0481 x_0482))
+(assert (< x_0482 x_0483))
+(assert (< x_0483 x_0484))
+(assert (< x_0484 x_0485))
+(assert (< x_0485 x_0486))
+(assert (< x_0486 x_0487))
+(assert (< x_0487 x_0488))
+(assert (< x_0488 x_0489))
+(assert (< x_0489 x_0490))
+(assert (< x_0490 x_0491))
+(assert (< x_0491 x_0492))
+(assert (< x_0492 x_0493))
+(assert (< x_0493 x_0494))
+(assert (< x_0494 x_0495))
+(assert (< x_0495 x_0496))
+(assert (< x_0496 x_0497))
+(assert (< x_0497 x_0498))
+(assert (< x_0498 x_0499))
+(assert (< x_0499 x_0500))
+(assert (< x_0500 x_0501))
+(assert (< x_0501 x_0502))
+(assert (< x_0502 x_0503))
+(assert (< x_0503 x_0504))
+(assert (< x_0504 x_0505))
+(assert (< x_0505 x_0506))
+(assert (< x_0506 x_0507))
+(assert (< x_0507 x_0508))
+(assert (< x_0508 x_0509))
+(assert (< x_0509 x_0510))
+(assert (< x_0510 x_0511))
+(assert (< x_0511 x_0512))
+(assert (< x_0512 x_0513))
+(assert (< x_0513 x_0514))
+(assert (< x_0514 x_0515))
+(assert (< x_0515 x_0516))
+(assert (< x_0516 x_0517))
+(assert (< x_0517 x_0518))
+(assert (< x_0518 x_0519))
+(assert (< x_0519 x_0520))
+(assert (< x_0520 x_0521))
+(assert (< x_0521 x_0522))
+(assert (< x_0522 x_0523))
+(assert (< x_0523 x_0524))
+(assert (< x_0524 x_0525))
+(assert (< x_0525 x_0526))
+(assert (< x_0526 x_0527))
+(assert (< x_0527 x_0528))
+(assert (< x_0528 x_0529))
+(assert (< x_0529 x_0530))
+(assert (< x_0530 x_0531))
+(assert (< x_0531 x_0532))
+(assert (< x_0532 x_0533))
+(assert (< x_0533 x_0534))
+(assert (< x_0534 x_0535))
+(assert (< x_0535 x_0536))
+(assert (< x_0536 x_0537))
+(assert (< x_0537 x_0538))
+(assert (< x_0538 x_0539))
+(assert (< x_0539 x_0540))
+(assert (< x_0540 x_0541))
+(assert (< x_0541 x_0542))
+(assert (< x_0542 x_0543))
+(assert (< x_0543 x_0544))
+(assert (< x_0544 x_0545))
+(assert (< x_0545 x_0546))
+(assert (< x_0546 x_0547))
+(assert (< x_0547 x_0548))
+(assert (< x_0548 x_0549))
+(assert (< x_0549 x_0550))
+(assert (< x_0550 x_0551))
+(assert (< x_0551 x_0552))
+(assert (< x_0552 x_0553))
+(assert (< x_0553 x_0554))
+(assert (< x_0554 x_0555))
+(assert (< x_0555 x_0556))
+(assert (< x_0556 x_0557))
+(assert (< x_0557 x_0558))
+(assert (< x_0558 x_0559))
+(assert (< x_0559 x_0560))
+(assert (< x_0560 x_0561))
+(assert (< x_0561 x_0562))
+(assert (< x_0562 x_0563))
+(assert (< x_0563 x_0564))
+(assert (< x_0564 x_0565))
+(assert (< x_0565 x_0566))
+(assert (< x_0566 x_0567))
+(assert (< x_0567 x_0568))
+(assert (< x_0568 x_0569))
+(assert (< x_0569 x_0570))
+(assert (< x_0570 x_0571))
+(assert (< x_0571 x_0572))
+(assert (< x_0572 x_0573))
+(assert (< x_0573 x_0574))
+(assert (< x_0574 x_0575))
+(assert (< x_0575 x_0576))
+(assert (< x_0576 x_0577))
+(assert (< x_0577 x_0578))
+(assert (< x_0578 x_0579))
+(assert (< x_0579 x_0580))
+(assert (< x_0580 x_0581))
+(assert (< x_0581 x_0582))
+(assert (< x_0582 x_0583))
+(assert (< x_0583 x_0584))
+(assert (< x_0584 x_0585))
+(assert (< x_0585 x_0586))
+(assert (< x_0586 x_0587))
+(assert (< x_0587 x_0588))
+(assert (< x_0588 x_0589))
+(assert (< x_0589 x_0590))
+(assert (< x_0590 x_0591))
+(assert (< x_0591 x_0592))
+(assert (< x_0592 x_0593))
+(assert (< x_0593 x_0594))
+(assert (< x_0594 x_0595))
+(assert (< x_0595 x_0596))
+(assert (< x_0596 x_0597))
+(assert (< x_0597 x_0598))
+(assert (< x_0598 x_0599))
+(assert (< x_0599 x_0600))
+(assert (< x_0600 x_0601))
+(assert (< x_0601 x_0602))
+(assert (< x_0602 x_0603))
+(assert (< x_0603 x_0604))
+(assert (< x_0604 x_0605))
+(assert (< x_0605 x_0606))
+(assert (< x_0606 x_0607))
+(assert (< x_0607 x_0608))
+(assert (< x_0608 x_0609))
+(assert (< x_0609 x_0610))
+(assert (< x_0610 x_0611))
+(assert (< x_0611 x_0612))
+(assert (< x_0612 x_0613))
+(assert (< x_0613 x_0614))
+(assert (< x_0614 x_0615))
+(assert (< x_0615 x_0616))
+(assert (< x_0616 x_0617))
+(assert (< x_0617 x_0618))
+(assert (< x_0618 x_0619))
+(assert (< x_0619 x_0620))
+(assert (< x_0620 x_0621))
+(assert (< x_0621 x_0622))
+(assert (< x_0622 x_0623))
+(assert (< x_0623 x_0624))
+(assert (< x_0624 x_0625))
+(assert (< x_0625 x_0626))
+(assert (< x_0626 x_0627))
+(assert (< x_0627 x_0628))
+(assert (< x_0628 x_0629))
+(assert (< x_0629 x_0630))
+(assert (< x_0630 x_0631))
+(assert (< x_0631 x_0632))
+(assert (< x_0632 x_0633))
+(assert (< x_0633 x_0634))
+(assert (< x_0634 x_0635))
+(assert (< x_0635 x_0636))
+(assert (< x_0636 x_0637))
+(assert (< x_0637 x_0638))
+(assert (< x_0638 x_0639))
+(assert (< x_0639 x_0640))
+(assert (< x_0640 x_0641))
+(assert (< x_0641 x_0642))
+(assert (< x_0642 x_0643))
+(assert (< x_0643 x_0644))
+(assert (< x_0644 x_0645))
+(assert (< x_0645 x_0646))
+(assert (< x_0646 x_0647))
+(assert (< x_0647 x_0648))
+(assert (< x_0648 x_0649))
+(assert (< x_0649 x_0650))
+(assert (< x_0650 x_0651))
+(assert (< x_0651 x_0652))
+(assert (< x_0652 x_0653))
+(assert (< x_0653 x_0654))
+(assert (< x_0654 x_0655))
+(assert (< x_0655 x_0656))
+(assert (< x_0656 x_0657))
+(assert (< x_0657 x_0658))
+(assert (< x_0658 x_0659))
+(assert (< x_0659 x_0660))
+(assert (< x_0660 x_0661))
+(assert (< x_0661 x_0662))
+(assert (< x_0662 x_0663))
+(assert (< x_0663 x_0664))
+(assert (< x_0664 x_0665))
+(assert (< x_0665 x_0666))
+(assert (< x_0666 x_0667))
+(assert (< x_0667 x_0668))
+(assert (< x_0668 x_0669))
+(assert (< x_0669 x_0670))
+(assert (< x_0670 x_0671))
+(assert (< x_0671 x_0672))
+(assert (< x_0672 x_0673))
+(assert (< x_0673 x_0674))
+(assert (< x_0674 x_0675))
+(assert (< x_0675 x_0676))
+(assert (< x_0676 x_0677))
+(assert (< x_0677 x_0678))
+(assert (< x_0678 x_0679))
+(assert (< x_0679 x_0680))
+(assert (< x_0680 x_0681))
+(assert (< x_0681 x_0682))
+(assert (< x_0682 x_0683))
+(assert (< x_0683 x_0684))
+(assert (< x_0684 x_0685))
+(assert (< x_0685 x_0686))
+(assert (< x_0686 x_0687))
+(assert (< x_0687 x_0688))
+(assert (< x_0688 x_0689))
+(assert (< x_0689 x_0690))
+(assert (< x_0690 x_0691))
+(assert (< x_0691 x_0692))
+(assert (< x_0692 x_0693))
+(assert (< x_0693 x_0694))
+(assert (< x_0694 x_0695))
+(assert (< x_0695 x_0696))
+(assert (< x_0696 x_0697))
+(assert (< x_0697 x_0698))
+(assert (< x_0698 x_0699))
+(assert (< x_0699 x_0700))
+(assert (< x_0700 x_0701))
+(assert (< x_0701 x_0702))
+(assert (< x_0702 x_0703))
+(assert (< x_0703 x_0704))
+(assert (< x_0704 x_0705))
+(assert (< x_0705 x_0706))
+(assert (< x_0706 x_0707))
+(assert (< x_0707 x_0708))
+(assert (< x_0708 x_0709))
+(assert (< x_0709 x_0710))
+(assert (< x_0710 x_0711))
+(assert (< x_0711 x_0712))
+(assert (< x_0712 x_0713))
+(assert (< x_0713 x_0714))
+(assert (< x_0714 x_0715))
+(assert (< x_0715 x_0716))
+(assert (< x_0716 x_0717))
+(assert (< x_0717 x_0718))
+(assert (< x_0718 x_0719))
+(assert (< x_0719 x_0720))
+(assert (< x_0720 x_0721))
+(assert (< x_0721 x_0722))
+(assert (< x_0722 x_0723))
+(assert (< x_0723 x_0724))
+(assert (< x_0724 x_0725))
+(assert (< x_0725 x_0726))
+(assert (< x_0726 x_0727))
+(assert (< x_0727 x_0728))
+(assert (< x_0728 x_0729))
+(assert (< x_0729 x_0730))
+(assert (< x_0730 x_0731))
+(assert (< x_0731 x_0732))
+(assert (< x_0732 x_0733))
+(assert (< x_0733 x_0734))
+(assert (< x_0734 x_0735))
+(assert (< x_0735 x_0736))
+(assert (< x_0736 x_0737))
+(assert (< x_0737 x_0738))
+(assert (< x_0738 x_0739))
+(assert (< x_0739 x_0740))
+(assert (< x_0740 x_0741))
+(assert (< x_0741 x_0742))
+(assert (< x_0742 x_0743))
+(assert (< x_0743 x_0744))
+(assert (< x_0744 x_0745))
+(assert (< x_0745 x_0746))
+(assert (< x_0746 x_0747))
+(assert (< x_0747 x_0748))
+(assert (< x_0748 x_0749))
+(assert (< x_0749 x_0750))
+(assert (< x_0750 x_0751))
+(assert (< x_0751 x_0752))
+(assert (< x_0752 x_0753))
+(assert (< x_0753 x_0754))
+(assert (< x_0754 x_0755))
+(assert (< x_0755 x_0756))
+(assert (< x_0756 x_0757))
+(assert (< x_0757 x_0758))
+(assert (< x_0758 x_0759))
+(assert (< x_0759 x_0760))
+(assert (< x_0760 x_0761))
+(assert (< x_0761 x_0762))
+(assert (< x_0762 x_0763))
+(assert (< x_0763 x_0764))
+(assert (< x_0764 x_0765))
+(assert (< x_0765 x_0766))
+(assert (< x_0766 x_0767))
+(assert (< x_0767 x_0768))
+(assert (< x_0768 x_0769))
+(assert (< x_0769 x_0770))
+(assert (< x_0770 x_0771))
+(assert (< x_0771 x_0772))
+(assert (< x_0772 x_0773))
+(assert (< x_0773 x_0774))
+(assert (< x_0774 x_0775))
+(assert (< x_0775 x_0776))
+(assert (< x_0776 x_0777))
+(assert (< x_0777 x_0778))
+(assert (< x_0778 x_0779))
+(assert (< x_0779 x_0780))
+(assert (< x_0780 x_0781))
+(assert (< x_0781 x_0782))
+(assert (< x_0782 x_0783))
+(assert (< x_0783 x_0784))
+(assert (< x_0784 x_0785))
+(assert (< x_0785 x_0786))
+(assert (< x_0786 x_0787))
+(assert (< x_0787 x_0788))
+(assert (< x_0788 x_0789))
+(assert (< x_0789 x_0790))
+(assert (< x_0790 x_0791))
+(assert (< x_0791 x_0792))
+(assert (< x_0792 x_0793))
+(assert (< x_0793 x_0794))
+(assert (< x_0794 x_0795))
+(assert (< x_0795 x_0796))
+(assert (< x_0796 x_0797))
+(assert (< x_0797 x_0798))
+(assert (< x_0798 x_0799))
+(assert (< x_0799 x_0800))
+(assert (< x_0800 x_0801))
+(assert (< x_0801 x_0802))
+(assert (< x_0802 x_0803))
+(assert (< x_0803 x_0804))
+(assert (< x_0804 x_0805))
+(assert (< x_0805 x_0806))
+(assert (< x_0806 x_0807))
+(assert (< x_0807 x_0808))
+(assert (< x_0808 x_0809))
+(assert (< x_0809 x_0810))
+(assert (< x_0810 x_0811))
+(assert (< x_0811 x_0812))
+(assert (< x_0812 x_0813))
+(assert (< x_0813 x_0814))
+(assert (< x_0814 x_0815))
+(assert (< x_0815 x_0816))
+(assert (< x_0816 x_0817))
+(assert (< x_0817 x_0818))
+(assert (< x_0818 x_0819))
+(assert (< x_0819 x_0820))
+(assert (< x_0820 x_0821))
+(assert (< x_0821 x_0822))
+(assert (< x_0822 x_0823))
+(assert (< x_0823 x_0824))
+(assert (< x_0824 x_0825))
+(assert (< x_0825 x_0826))
+(assert (< x_0826 x_0827))
+(assert (< x_0827 x_0828))
+(assert (< x_0828 x_0829))
+(assert (< x_0829 x_0830))
+(assert (< x_0830 x_0831))
+(assert (< x_0831 x_0832))
+(assert (< x_0832 x_0833))
+(assert (< x_0833 x_0834))
+(assert (< x_0834 x_0835))
+(assert (< x_0835 x_0836))
+(assert (< x_0836 x_0837))
+(assert (< x_0837 x_0838))
+(assert (< x_0838 x_0839))
+(assert (< x_0839 x_0840))
+(assert (< x_0840 x_0841))
+(assert (< x_0841 x_0842))
+(assert (< x_0842 x_0843))
+(assert (< x_0843 x_0844))
+(assert (< x_0844 x_0845))
+(assert (< x_0845 x_0846))
+(assert (< x_0846 x_0847))
+(assert (< x_0847 x_0848))
+(assert (< x_0848 x_0849))
+(assert (< x_0849 x_0850))
+(assert (< x_0850 x_0851))
+(assert (< x_0851 x_0852))
+(assert (< x_0852 x_0853))
+(assert (< x_0853 x_0854))
+(assert (< x_0854 x_0855))
+(assert (< x_0855 x_0856))
+(assert (< x_0856 x_0857))
+(assert (< x_0857 x_0858))
+(assert (< x_0858 x_0859))
+(assert (< x_0859 x_0860))
+(assert (< x_0860 x_0861))
+(assert (< x_0861 x_0862))
+(assert (< x_0862 x_0863))
+(assert (< x_0863 x_0864))
+(assert (< x_0864 x_0865))
+(assert (< x_0865 x_0866))
+(assert (< x_0866 x_0867))
+(assert (< x_0867 x_0868))
+(assert (< x_0868 x_0869))
+(assert (< x_0869 x_0870))
+(assert (< x_0870 x_0871))
+(assert (< x_0871 x_0872))
+(assert (< x_0872 x_0873))
+(assert (< x_0873 x_0874))
+(assert (< x_0874 x_0875))
+(assert (< x_0875 x_0876))
+(assert (< x_0876 x_0877))
+(assert (< x_0877 x_0878))
+(assert (< x_0878 x_0879))
+(assert (< x_0879 x_0880))
+(assert (< x_0880 x_0881))
+(assert (< x_0881 x_0882))
+(assert (< x_0882 x_0883))
+(assert (< x_0883 x_0884))
+(assert (< x_0884 x_0885))
+(assert (< x_0885 x_0886))
+(assert (< x_0886 x_0887))
+(assert (< x_0887 x_0888))
+(assert (< x_0888 x_0889))
+(assert (< x_0889 x_0890))
+(assert (< x_0890 x_0891))
+(assert (< x_0891 x_0892))
+(assert (< x_0892 x_0893))
+(assert (< x_0893 x_0894))
+(assert (< x_0894 x_0895))
+(assert (< x_0895 x_0896))
+(assert (< x_0896 x_0897))
+(assert (< x_0897 x_0898))
+(assert (< x_0898 x_0899))
+(assert (< x_0899 x_0900))
+(assert (< x_0900 x_0901))
+(assert (< x_0901 x_0902))
+(assert (< x_0902 x_0903))
+(assert (< x_0903 x_0904))
+(assert (< x_0904 x_0905))
+(assert (< x_0905 x_0906))
+(assert (< x_0906 x_0907))
+(assert (< x_0907 x_0908))
+(assert (< x_0908 x_0909))
+(assert (< x_0909 x_0910))
+(assert (< x_0910 x_0911))
+(assert (< x_0911 x_0912))
+(assert (< x_0912 x_0913))
+(assert (< x_0913 x_0914))
+(assert (< x_0914 x_0915))
+(assert (< x_0915 x_0916))
+(assert (< x_0916 x_0917))
+(assert (< x_0917 x_0918))
+(assert (< x_0918 x_0919))
+(assert (< x_0919 x_0920))
+(assert (< x_0920 x_0921))
+(assert (< x_0921 x_0922))
+(assert (< x_0922 x_0923))
+(assert (< x_0923 x_0924))
+(assert (< x_0924 x_0925))
+(assert (< x_0925 x_0926))
+(assert (< x_0926 x_0927))
+(assert (< x_0927 x_0928))
+(assert (< x_0928 x_0929))
+(assert (< x_0929 x_0930))
+(assert (< x_0930 x_0931))
+(assert (< x_0931 x_0932))
+(assert (< x_0932 x_0933))
+(assert (< x_0933 x_0934))
+(assert (< x_0934 x_0935))
+(assert (< x_0935 x_0936))
+(assert (< x_0936 x_0937))
+(assert (< x_0937 x_0938))
+(assert (< x_0938 x_0939))
+(assert (< x_0939 x_0940))
+(assert (< x_0940 x_0941))
+(assert (< x_0941 x_0942))
+(assert (< x_0942 x_0943))
+(assert (< x_0943 x_0944))
+(assert (< x_0944 x_0945))
+(assert (< x_0945 x_0946))
+(assert (< x_0946 x_0947))
+(assert (< x_0947 x_0948))
+(assert (< x_0948 x_0949))
+(assert (< x_0949 x_0950))
+(assert (< x_0950 x_0951))
+(assert (< x_0951 x_0952))
+(assert (< x_0952 x_0953))
+(assert (< x_0953 x_0954))
+(assert (< x_0954 x_0955))
+(assert (< x_0955 x_0956))
+(assert (< x_0956 x_0957))
+(assert (< x_0957 x_0958))
+(assert (< x_0958 x_0959))
+(assert (< x_0959 x_0960))
+(assert (< x_0960 x_0961))
+(assert (< x_0961 x_0962))
+(assert (< x_0962 x_0963))
+(assert (< x_0963 x_0964))
+(assert (< x_0964 x_0965))
+(assert (< x_0965 x_0966))
+(assert (< x_0966 x_0967))
+(assert (< x_0967 x_0968))
+(assert (< x_0968 x_0969))
+(assert (< x_0969 x_0970))
+(assert (< x_0970 x_0971))
+(assert (< x_0971 x_0972))
+(assert (< x_0972 x_0973))
+(assert (< x_0973 x_0974))
+(assert (< x_0974 x_0975))
+(assert (< x_0975 x_0976))
+(assert (< x_0976 x_0977))
+(assert (< x_0977 x_0978))
+(assert (< x_0978 x_0979))
+(assert (< x_0979 x_0980))
+(assert (< x_0980 x_0981))
+(assert (< x_0981 x_0982))
+(assert (< x_0982 x_0983))
+(assert (< x_0983 x_0984))
+(assert (< x_0984 x_0985))
+(assert (< x_0985 x_0986))
+(assert (< x_0986 x_0987))
+(assert (< x_0987 x_0988))
+(assert (< x_0988 x_0989))
+(assert (< x_0989 x_0990))
+(assert (< x_0990 x_0991))
+(assert (< x_0991 x_0992))
+(assert (< x_0992 x_0993))
+(assert (< x_0993 x_0994))
+(assert (< x_0994 x_0995))
+(assert (< x_0995 x_0996))
+(assert (< x_0996 x_0997))
+(assert (< x_0997 x_0998))
+(assert (< x_0998 x_0999))
+(assert (< x_0999 x_1000))
+(assert (< x_1000 x_1001))
+(assert (< x_1001 x_1002))
+(assert (< x_1002 x_1003))
+(assert (< x_1003 x_1004))
+(assert (< x_1004 x_1005))
+(assert (< x_1005 x_1006))
+(assert (< x_1006 x_1007))
+(assert (< x_1007 x_1008))
+(assert (< x_1008 x_1009))
+(assert (< x_1009 x_1010))
+(assert (< x_1010 x_1011))
+(assert (< x_1011 x_1012))
+(assert (< x_1012 x_1013))
+(assert (< x_1013 x_1014))
+(assert (< x_1014 x_1015))
+(assert (< x_1015 x_1016))
+(assert (< x_1016 x_1017))
+(assert (< x_1017 x_1018))
+(assert (< x_1018 x_1019))
+(assert (< x_1019 x_1020))
+(assert (< x_1020 x_1021))
+(assert (< x_1021 x_1022))
+(assert (< x_1022 x_1023))
+(assert (< x_1023 x_1024))
+(assert (< x_1024 x_1025))
+(assert (< x_1025 x_1026))
+(assert (< x_1026 x_1027))
+(assert (< x_1027 x_1028))
+(assert (< x_1028 x_1029))
+(assert (< x_1029 x_1030))
+(assert (< x_1030 x_1031))
+(assert (< x_1031 x_1032))
+(assert (< x_1032 x_1033))
+(assert (< x_1033 x_1034))
+(assert (< x_1034 x_1035))
+(assert (< x_1035 x_1036))
+(assert (< x_1036 x_1037))
+(assert (< x_1037 x_1038))
+(assert (< x_1038 x_1039))
+(assert (< x_1039 x_1040))
+(assert (< x_1040 x_1041))
+(assert (< x_1041 x_1042))
+(assert (< x_1042 x_1043))
+(assert (< x_1043 x_1044))
+(assert (< x_1044 x_1045))
+(assert (< x_1045 x_1046))
+(assert (< x_1046 x_1047))
+(assert (< x_1047 x_1048))
+(assert (< x_1048 x_1049))
+(assert (< x_1049 x_1050))
+(assert (< x_1050 x_1051))
+(assert (< x_1051 x_1052))
+(assert (< x_1052 x_1053))
+(assert (< x_1053 x_1054))
+(assert (< x_1054 x_1055))
+(assert (< x_1055 x_1056))
+(assert (< x_1056 x_1057))
+(assert (< x_1057 x_1058))
+(assert (< x_1058 x_1059))
+(assert (< x_1059 x_1060))
+(assert (< x_1060 x_1061))
+(assert (< x_1061 x_1062))
+(assert (< x_1062 x_1063))
+(assert (< x_1063 x_1064))
+(assert (< x_1064 x_1065))
+(assert (< x_1065 x_1066))
+(assert (< x_1066 x_1067))
+(assert (< x_1067 x_1068))
+(assert (< x_1068 x_1069))
+(assert (< x_1069 x_1070))
+(assert (< x_1070 x_1071))
+(assert (< x_1071 x_1072))
+(assert (< x_1072 x_1073))
+(assert (< x_1073 x_1074))
+(assert (< x_1074 x_1075))
+(assert (< x_1075 x_1076))
+(assert (< x_1076 x_1077))
+(assert (< x_1077 x_1078))
+(assert (< x_1078 x_1079))
+(assert (< x_1079 x_1080))
+(assert (< x_1080 x_1081))
+(assert (< x_1081 x_1082))
+(assert (< x_1082 x_1083))
+(assert (< x_1083 x_1084))
+(assert (< x_1084 x_1085))
+(assert (< x_1085 x_1086))
+(assert (< x_1086 x_1087))
+(assert (< x_1087 x_1088))
+(assert (< x_1088 x_1089))
+(assert (< x_1089 x_1090))
+(assert (< x_1090 x_1091))
+(assert (< x_1091 x_1092))
+(assert (< x_1092 x_1093))
+(assert (< x_1093 x_1094))
+(assert (< x_1094 x_1095))
+(assert (< x_1095 x_1096))
+(assert (< x_1096 x_1097))
+(assert (< x_1097 x_1098))
+(assert (< x_1098 x_1099))
+(assert (< x_1099 x_1100))
+(assert (< x_1100 x_1101))
+(assert (< x_1101 x_1102))
+(assert (< x_1102 x_1103))
+(assert (< x_1103 x_1104))
+(assert (< x_1104 x_1105))
+(assert (< x_1105 x_1106))
+(assert (< x_1106 x_1107))
+(assert (< x_1107 x_1108))
+(assert (< x_1108 x_1109))
+(assert (< x_1109 x_1110))
+(assert (< x_1110 x_1111))
+(assert (< x_1111 x_1112))
+(assert (< x_1112 x_1113))
+(assert (< x_1113 x_1114))
+(assert (< x_1114 x_1115))
+(assert (< x_1115 x_1116))
+(assert (< x_1116 x_1117))
+(assert (< x_1117 x_1118))
+(assert (< x_1118 x_1119))
+(assert (< x_1119 x_1120))
+(assert (< x_1120 x_1121))
+(assert (< x_1121 x_1122))
+(assert (< x_1122 x_1123))
+(assert (< x_1123 x_1124))
+(assert (< x_1124 x_1125))
+(assert (< x_1125 x_1126))
+(assert (< x_1126 x_1127))
+(assert (< x_1127 x_1128))
+(assert (< x_1128 x_1129))
+(assert (< x_1129 x_1130))
+(assert (< x_1130 x_1131))
+(assert (< x_1131 x_1132))
+(assert (< x_1132 x_1133))
+(assert (< x_1133 x_1134))
+(assert (< x_1134 x_1135))
+(assert (< x_1135 x_1136))
+(assert (< x_1136 x_1137))
+(assert (< x_1137 x_1138))
+(assert (< x_1138 x_1139))
+(assert (< x_1139 x_1140))
+(assert (< x_1140 x_1141))
+(assert (< x_1141 x_1142))
+(assert (< x_1142 x_1143))
+(assert (< x_1143 x_1144))
+(assert (< x_1144 x_1145))
+(assert (< x_1145 x_1146))
+(assert (< x_1146 x_1147))
+(assert (< x_1147 x_1148))
+(assert (< x_1148 x_1149))
+(assert (< x_1149 x_1150))
+(assert (< x_1150 x_1151))
+(assert (< x_1151 x_1152))
+(assert (< x_1152 x_1153))
+(assert (< x_1153 x_1154))
+(assert (< x_1154 x_1155))
+(assert (< x_1155 x_1156))
+(assert (< x_1156 x_1157))
+(assert (< x_1157 x_1158))
+(assert (< x_1158 x_1159))
+(assert (< x_1159 x_1160))
+(assert (< x_1160 x_1161))
+(assert (< x_1161 x_1162))
+(assert (< x_1162 x_1163))
+(assert (< x_1163 x_1164))
+(assert (< x_1164 x_1165))
+(assert (< x_1165 x_1166))
+(assert (< x_1166 x_1167))
+(assert (< x_1167 x_1168))
+(assert (< x_1168 x_1169))
+(assert (< x_1169 x_1170))
+(assert (< x_1170 x_1171))
+(assert (< x_1171 x_1172))
+(assert (< x_1172 x_1173))
+(assert (< x_1173 x_1174))
+(assert (< x_1174 x_1175))
+(assert (< x_1175 x_1176))
+(assert (< x_1176 x_1177))
+(assert (< x_1177 x_1178))
+(assert (< x_1178 x_1179))
+(assert (< x_1179 x_1180))
+(assert (< x_1180 x_1181))
+(assert (< x_1181 x_1182))
+(assert (< x_1182 x_1183))
+(assert (< x_1183 x_1184))
+(assert (< x_1184 x_1185))
+(assert (< x_1185 x_1186))
+(assert (< x_1186 x_1187))
+(assert (< x_1187 x_1188))
+(assert (< x_1188 x_1189))
+(assert (< x_1189 x_1190))
+(assert (< x_1190 x_1191))
+(assert (< x_1191 x_1192))
+(assert (< x_1192 x_1193))
+(assert (< x_1193 x_1194))
+(assert (< x_1194 x_1195))
+(assert (< x_1195 x_1196))
+(assert (< x_1196 x_1197))
+(assert (< x_1197 x_1198))
+(assert (< x_1198 x_1199))
+(assert (< x_1199 x_1200))
+(assert (< x_1200 x_1201))
+(assert (< x_1201 x_1202))
+(assert (< x_1202 x_1203))
+(assert (< x_1203 x_1204))
+(assert (< x_1204 x_1205))
+(assert (< x_1205 x_1206))
+(assert (< x_1206 x_1207))
+(assert (< x_1207 x_1208))
+(assert (< x_1208 x_1209))
+(assert (< x_1209 x_1210))
+(assert (< x_1210 x_1211))
+(assert (< x_1211 x_1212))
+(assert (< x_1212 x_1213))
+(assert (< x_1213 x_1214))
+(assert (< x_1214 x_1215))
+(assert (< x_1215 x_1216))
+(assert (< x_1216 x_1217))
+(assert (< x_1217 x_1218))
+(assert (< x_1218 x_1219))
+(assert (< x_1219 x_1220))
+(assert (< x_1220 x_1221))
+(assert (< x_1221 x_1222))
+(assert (< x_1222 x_1223))
+(assert (< x_1223 x_1224))
+(assert (< x_1224 x_1225))
+(assert (< x_1225 x_1226))
+(assert (< x_1226 x_1227))
+(assert (< x_1227 x_1228))
+(assert (< x_1228 x_1229))
+(assert (< x_1229 x_1230))
+(assert (< x_1230 x_1231))
+(assert (< x_1231 x_1232))
+(assert (< x_1232 x_1233))
+(assert (< x_1233 x_1234))
+(assert (< x_1234 x_1235))
+(assert (< x_1235 x_1236))
+(assert (< x_1236 x_1237))
+(assert (< x_1237 x_1238))
+(assert (< x_1238 x_1239))
+(assert (< x_1239 x_1240))
+(assert (< x_1240 x_1241))
+(assert (< x_1241 x_1242))
+(assert (< x_1242 x_1243))
+(assert (< x_1243 x_1244))
+(assert (< x_1244 x_1245))
+(assert (< x_1245 x_1246))
+(assert (< x_1246 x_1247))
+(assert (< x_1247 x_1248))
+(assert (< x_1248 x_1249))
+(assert (< x_1249 x_1250))
+(assert (< x_1250 x_1251))
+(assert (< x_1251 x_1252))
+(assert (< x_1252 x_1253))
+(assert (< x_1253 x_1254))
+(assert (< x_1254 x_1255))
+(assert (< x_1255 x_1256))
+(assert (< x_1256 x_1257))
+(assert (< x_1257 x_1258))
+(assert (< x_1258 x_1259))
+(assert (< x_1259 x_1260))
+(assert (< x_1260 x_1261))
+(assert (< x_1261 x_1262))
+(assert (< x_1262 x_1263))
+(assert (< x_1263 x_1264))
+(assert (< x_1264 x_1265))
+(assert (< x_1265 x_1266))
+(assert (< x_1266 x_1267))
+(assert (< x_1267 x_1268))
+(assert (< x_1268 x_1269))
+(assert (< x_1269 x_1270))
+(assert (< x_1270 x_1271))
+(assert (< x_1271 x_1272))
+(assert (< x_1272 x_1273))
+(assert (< x_1273 x_1274))
+(assert (< x_1274 x_1275))
+(assert (< x_1275 x_1276))
+(assert (< x_1276 x_1277))
+(assert (< x_1277 x_1278))
+(assert (< x_1278 x_1279))
+(assert (< x_1279 x_1280))
+(assert (< x_1280 x_1281))
+(assert (< x_1281 x_1282))
+(assert (< x_1282 x_1283))
+(assert (< x_1283 x_1284))
+(assert (< x_1284 x_1285))
+(assert (< x_1285 x_1286))
+(assert (< x_1286 x_1287))
+(assert (< x_1287 x_1288))
+(assert (< x_1288 x_1289))
+(assert (< x_1289 x_1290))
+(assert (< x_1290 x_1291))
+(assert (< x_1291 x_1292))
+(assert (< x_1292 x_1293))
+(assert (< x_1293 x_1294))
+(assert (< x_1294 x_1295))
+(assert (< x_1295 x_1296))
+(assert (< x_1296 x_1297))
+(assert (< x_1297 x_1298))
+(assert (< x_1298 x_1299))
+(assert (< x_1299 x_1300))
+(assert (< x_1300 x_1301))
+(assert (< x_1301 x_1302))
+(assert (< x_1302 x_1303))
+(assert (< x_1303 x_1304))
+(assert (< x_1304 x_1305))
+(assert (< x_1305 x_1306))
+(assert (< x_1306 x_1307))
+(assert (< x_1307 x_1308))
+(assert (< x_1308 x_1309))
+(assert (< x_1309 x_1310))
+(assert (< x_1310 x_1311))
+(assert (< x_1311 x_1312))
+(assert (< x_1312 x_1313))
+(assert (< x_1313 x_1314))
+(assert (< x_1314 x_1315))
+(assert (< x_1315 x_1316))
+(assert (< x_1316 x_1317))
+(assert (< x_1317 x_1318))
+(assert (< x_1318 x_1319))
+(assert (< x_1319 x_1320))
+(assert (< x_1320 x_1321))
+(assert (< x_1321 x_1322))
+(assert (< x_1322 x_1323))
+(assert (< x_1323 x_1324))
+(assert (< x_1324 x_1325))
+(assert (< x_1325 x_1326))
+(assert (< x_1326 x_1327))
+(assert (< x_1327 x_1328))
+(assert (< x_1328 x_1329))
+(assert (< x_1329 x_1330))
+(assert (< x_1330 x_1331))
+(assert (< x_1331 x_1332))
+(assert (< x_1332 x_1333))
+(assert (< x_1333 x_1334))
+(assert (< x_1334 x_1335))
+(assert (< x_1335 x_1336))
+(assert (< x_1336 x_1337))
+(assert (< x_1337 x_1338))
+(assert (< x_1338 x_1339))
+(assert (< x_1339 x_1340))
+(assert (< x_1340 x_1341))
+(assert (< x_1341 x_1342))
+(assert (< x_1342 x_1343))
+(assert (< x_1343 x_1344))
+(assert (< x_1344 x_1345))
+(assert (< x_1345 x_1346))
+(assert (< x_1346 x_1347))
+(assert (< x_1347 x_1348))
+(assert (< x_1348 x_1349))
+(assert (< x_1349 x_1350))
+(assert (< x_1350 x_1351))
+(assert (< x_1351 x_1352))
+(assert (< x_1352 x_1353))
+(assert (< x_1353 x_1354))
+(assert (< x_1354 x_1355))
+(assert (< x_1355 x_1356))
+(assert (< x_1356 x_1357))
+(assert (< x_1357 x_1358))
+(assert (< x_1358 x_1359))
+(assert (< x_1359 x_1360))
+(assert (< x_1360 x_1361))
+(assert (< x_1361 x_1362))
+(assert (< x_1362 x_1363))
+(assert (< x_1363 x_1364))
+(assert (< x_1364 x_1365))
+(assert (< x_1365 x_1366))
+(assert (< x_1366 x_1367))
+(assert (< x_1367 x_1368))
+(assert (< x_1368 x_1369))
+(assert (< x_1369 x_1370))
+(assert (< x_1370 x_1371))
+(assert (< x_1371 x_1372))
+(assert (< x_1372 x_1373))
+(assert (< x_1373 x_1374))
+(assert (< x_1374 x_1375))
+(assert (< x_1375 x_1376))
+(assert (< x_1376 x_1377))
+(assert (< x_1377 x_1378))
+(assert (< x_1378 x_1379))
+(assert (< x_1379 x_1380))
+(assert (< x_1380 x_1381))
+(assert (< x_1381 x_1382))
+(assert (< x_1382 x_1383))
+(assert (< x_1383 x_1384))
+(assert (< x_1384 x_1385))
+(assert (< x_1385 x_1386))
+(assert (< x_1386 x_1387))
+(assert (< x_1387 x_1388))
+(assert (< x_1388 x_1389))
+(assert (< x_1389 x_1390))
+(assert (< x_1390 x_1391))
+(assert (< x_1391 x_1392))
+(assert (< x_1392 x_1393))
+(assert (< x_1393 x_1394))
+(assert (< x_1394 x_1395))
+(assert (< x_1395 x_1396))
+(assert (< x_1396 x_1397))
+(assert (< x_1397 x_1398))
+(assert (< x_1398 x_1399))
+(assert (< x_1399 x_1400))
+(assert (< x_1400 x_1401))
+(assert (< x_1401 x_1402))
+(assert (< x_1402 x_1403))
+(assert (< x_1403 x_1404))
+(assert (< x_1404 x_1405))
+(assert (< x_1405 x_1406))
+(assert (< x_1406 x_1407))
+(assert (< x_1407 x_1408))
+(assert (< x_1408 x_1409))
+(assert (< x_1409 x_1410))
+(assert (< x_1410 x_1411))
+(assert (< x_1411 x_1412))
+(assert (< x_1412 x_1413))
+(assert (< x_1413 x_1414))
+(assert (< x_1414 x_1415))
+(assert (< x_1415 x_1416))
+(assert (< x_1416 x_1417))
+(assert (< x_1417 x_1418))
+(assert (< x_1418 x_1419))
+(assert (< x_1419 x_1420))
+(assert (< x_1420 x_1421))
+(assert (< x_1421 x_1422))
+(assert (< x_1422 x_1423))
+(assert (< x_1423 x_1424))
+(assert (< x_1424 x_1425))
+(assert (< x_1425 x_1426))
+(assert (< x_1426 x_1427))
+(assert (< x_1427 x_1428))
+(assert (< x_1428 x_1429))
+(assert (< x_1429 x_1430))
+(assert (< x_1430 x_1431))
+(assert (< x_1431 x_1432))
+(assert (< x_1432 x_1433))
+(assert (< x_1433 x_1434))
+(assert (< x_1434 x_1435))
+(assert (< x_1435 x_1436))
+(assert (< x_1436 x_1437))
+(assert (< x_1437 x_1438))
+(assert (< x_1438 x_1439))
+(assert (< x_1439 x_1440))
+(assert (< x_1440 x_1441))
+(assert (< x_1441 x_1442))
+(assert (< x_1442 x_1443))
+(assert (< x_1443 x_1444))
+(assert (< x_1444 x_1445))
+(assert (< x_1445 x_1446))
+(assert (< x_1446 x_1447))
+(assert (< x_1447 x_1448))
+(assert (< x_1448 x_1449))
+(assert (< x_1449 x_1450))
+(assert (< x_1450 x_1451))
+(assert (< x_1451 x_1452))
+(assert (< x_1452 x_1453))
+(assert (< x_1453 x_1454))
+(assert (< x_1454 x_1455))
+(assert (< x_1455 x_1456))
+(assert (< x_1456 x_1457))
+(assert (< x_1457 x_1458))
+(assert (< x_1458 x_1459))
+(assert (< x_1459 x_1460))
+(assert (< x_1460 x_1461))
+(assert (< x_1461 x_1462))
+(assert (< x_1462 x_1463))
+(assert (< x_1463 x_1464))
+(assert (< x_1464 x_1465))
+(assert (< x_1465 x_1466))
+(assert (< x_1466 x_1467))
+(assert (< x_1467 x_1468))
+(assert (< x_1468 x_1469))
+(assert (< x_1469 x_1470))
+(assert (< x_1470 x_1471))
+(assert (< x_1471 x_1472))
+(assert (< x_1472 x_1473))
+(assert (< x_1473 x_1474))
+(assert (< x_1474 x_1475))
+(assert (< x_1475 x_1476))
+(assert (< x_1476 x_1477))
+(assert (< x_1477 x_1478))
+(assert (< x_1478 x_1479))
+(assert (< x_1479 x_1480))
+(assert (< x_1480 x_1481))
+(assert (< x_1481 x_1482))
+(assert (< x_1482 x_1483))
+(assert (< x_1483 x_1484))
+(assert (< x_1484 x_1485))
+(assert (< x_1485 x_1486))
+(assert (< x_1486 x_1487))
+(assert (< x_1487 x_1488))
+(assert (< x_1488 x_1489))
+(assert (< x_1489 x_1490))
+(assert (< x_1490 x_1491))
+(assert (< x_1491 x_1492))
+(assert (< x_1492 x_1493))
+(assert (< x_1493 x_1494))
+(assert (< x_1494 x_1495))
+(assert (< x_1495 x_1496))
+(assert (< x_1496 x_1497))
+(assert (< x_1497 x_1498))
+(assert (< x_1498 x_1499))
+(assert (< x_1499 x_1500))
+(assert (< x_1500 x_1501))
+(assert (< x_1501 x_1502))
+(assert (< x_1502 x_1503))
+(assert (< x_1503 x_1504))
+(assert (< x_1504 x_1505))
+(assert (< x_1505 x_1506))
+(assert (< x_1506 x_1507))
+(assert (< x_1507 x_1508))
+(assert (< x_1508 x_1509))
+(assert (< x_1509 x_1510))
+(assert (< x_1510 x_1511))
+(assert (< x_1511 x_1512))
+(assert (< x_1512 x_1513))
+(assert (< x_1513 x_1514))
+(assert (< x_1514 x_1515))
+(assert (< x_1515 x_1516))
+(assert (< x_1516 x_1517))
+(assert (< x_1517 x_1518))
+(assert (< x_1518 x_1519))
+(assert (< x_1519 x_1520))
+(assert (< x_1520 x_1521))
+(assert (< x_1521 x_1522))
+(assert (< x_1522 x_1523))
+(assert (< x_1523 x_1524))
+(assert (< x_1524 x_1525))
+(assert (< x_1525 x_1526))
+(assert (< x_1526 x_1527))
+(assert (< x_1527 x_1528))
+(assert (< x_1528 x_1529))
+(assert (< x_1529 x_1530))
+(assert (< x_1530 x_1531))
+(assert (< x_1531 x_1532))
+(assert (< x_1532 x_1533))
+(assert (< x_1533 x_1534))
+(assert (< x_1534 x_1535))
+(assert (< x_1535 x_1536))
+(assert (< x_1536 x_1537))
+(assert (< x_1537 x_1538))
+(assert (< x_1538 x_1539))
+(assert (< x_1539 x_1540))
+(assert (< x_1540 x_1541))
+(assert (< x_1541 x_1542))
+(assert (< x_1542 x_1543))
+(assert (< x_1543 x_1544))
+(assert (< x_1544 x_1545))
+(assert (< x_1545 x_1546))
+(assert (< x_1546 x_1547))
+(assert (< x_1547 x_1548))
+(assert (< x_1548 x_1549))
+(assert (< x_1549 x_1550))
+(assert (< x_1550 x_1551))
+(assert (< x_1551 x_1552))
+(assert (< x_1552 x_1553))
+(assert (< x_1553 x_1554))
+(assert (< x_1554 x_1555))
+(assert (< x_1555 x_1556))
+(assert (< x_1556 x_1557))
+(assert (< x_1557 x_1558))
+(assert (< x_1558 x_1559))
+(assert (< x_1559 x_1560))
+(assert (< x_1560 x_1561))
+(assert (< x_1561 x_1562))
+(assert (< x_1562 x_1563))
+(assert (< x_1563 x_1564))
+(assert (< x_1564 x_1565))
+(assert (< x_1565 x_1566))
+(assert (< x_1566 x_1567))
+(assert (< x_1567 x_1568))
+(assert (< x_1568 x_1569))
+(assert (< x_1569 x_1570))
+(assert (< x_1570 x_1571))
+(assert (< x_1571 x_1572))
+(assert (< x_1572 x_1573))
+(assert (< x_1573 x_1574))
+(assert (< x_1574 x_1575))
+(assert (< x_1575 x_1576))
+(assert (< x_1576 x_1577))
+(assert (< x_1577 x_1578))
+(assert (< x_1578 x_1579))
+(assert (< x_1579 x_1580))
+(assert (< x_1580 x_1581))
+(assert (< x_1581 x_1582))
+(assert (< x_1582 x_1583))
+(assert (< x_1583 x_1584))
+(assert (< x_1584 x_1585))
+(assert (< x_1585 x_1586))
+(assert (< x_1586 x_1587))
+(assert (< x_1587 x_1588))
+(assert (< x_1588 x_1589))
+(assert (< x_1589 x_1590))
+(assert (< x_1590 x_1591))
+(assert (< x_1591 x_1592))
+(assert (< x_1592 x_1593))
+(assert (< x_1593 x_1594))
+(assert (< x_1594 x_1595))
+(assert (< x_1595 x_1596))
+(assert (< x_1596 x_1597))
+(assert (< x_1597 x_1598))
+(assert (< x_1598 x_1599))
+(assert (< x_1599 x_1600))
+(assert (< x_1600 x_1601))
+(assert (< x_1601 x_1602))
+(assert (< x_1602 x_1603))
+(assert (< x_1603 x_1604))
+(assert (< x_1604 x_1605))
+(assert (< x_1605 x_1606))
+(assert (< x_1606 x_1607))
+(assert (< x_1607 x_1608))
+(assert (< x_1608 x_1609))
+(assert (< x_1609 x_1610))
+(assert (< x_1610 x_1611))
+(assert (< x_1611 x_1612))
+(assert (< x_1612 x_1613))
+(assert (< x_1613 x_1614))
+(assert (< x_1614 x_1615))
+(assert (< x_1615 x_1616))
+(assert (< x_1616 x_1617))
+(assert (< x_1617 x_1618))
+(assert (< x_1618 x_1619))
+(assert (< x_1619 x_1620))
+(assert (< x_1620 x_1621))
+(assert (< x_1621 x_1622))
+(assert (< x_1622 x_1623))
+(assert (< x_1623 x_1624))
+(assert (< x_1624 x_1625))
+(assert (< x_1625 x_1626))
+(assert (< x_1626 x_1627))
+(assert (< x_1627 x_1628))
+(assert (< x_1628 x_1629))
+(assert (< x_1629 x_1630))
+(assert (< x_1630 x_1631))
+(assert (< x_1631 x_1632))
+(assert (< x_1632 x_1633))
+(assert (< x_1633 x_1634))
+(assert (< x_1634 x_1635))
+(assert (< x_1635 x_1636))
+(assert (< x_1636 x_1637))
+(assert (< x_1637 x_1638))
+(assert (< x_1638 x_1639))
+(assert (< x_1639 x_1640))
+(assert (< x_1640 x_1641))
+(assert (< x_1641 x_1642))
+(assert (< x_1642 x_1643))
+(assert (< x_1643 x_1644))
+(assert (< x_1644 x_1645))
+(assert (< x_1645 x_1646))
+(assert (< x_1646 x_1647))
+(assert (< x_1647 x_1648))
+(assert (< x_1648 x_1649))
+(assert (< x_1649 x_1650))
+(assert (< x_1650 x_1651))
+(assert (< x_1651 x_1652))
+(assert (< x_1652 x_1653))
+(assert (< x_1653 x_1654))
+(assert (< x_1654 x_1655))
+(assert (< x_1655 x_1656))
+(assert (< x_1656 x_1657))
+(assert (< x_1657 x_1658))
+(assert (< x_1658 x_1659))
+(assert (< x_1659 x_1660))
+(assert (< x_1660 x_1661))
+(assert (< x_1661 x_1662))
+(assert (< x_1662 x_1663))
+(assert (< x_1663 x_1664))
+(assert (< x_1664 x_1665))
+(assert (< x_1665 x_1666))
+(assert (< x_1666 x_1667))
+(assert (< x_1667 x_1668))
+(assert (< x_1668 x_1669))
+(assert (< x_1669 x_1670))
+(assert (< x_1670 x_1671))
+(assert (< x_1671 x_1672))
+(assert (< x_1672 x_1673))
+(assert (< x_1673 x_1674))
+(assert (< x_1674 x_1675))
+(assert (< x_1675 x_1676))
+(assert (< x_1676 x_1677))
+(assert (< x_1677 x_1678))
+(assert (< x_1678 x_1679))
+(assert (< x_1679 x_1680))
+(assert (< x_1680 x_1681))
+(assert (< x_1681 x_1682))
+(assert (< x_1682 x_1683))
+(assert (< x_1683 x_1684))
+(assert (< x_1684 x_1685))
+(assert (< x_1685 x_1686))
+(assert (< x_1686 x_1687))
+(assert (< x_1687 x_1688))
+(assert (< x_1688 x_1689))
+(assert (< x_1689 x_1690))
+(assert (< x_1690 x_1691))
+(assert (< x_1691 x_1692))
+(assert (< x_1692 x_1693))
+(assert (< x_1693 x_1694))
+(assert (< x_1694 x_1695))
+(assert (< x_1695 x_1696))
+(assert (< x_1696 x_1697))
+(assert (< x_1697 x_1698))
+(assert (< x_1698 x_1699))
+(assert (< x_1699 x_1700))
+(assert (< x_1700 x_1701))
+(assert (< x_1701 x_1702))
+(assert (< x_1702 x_1703))
+(assert (< x_1703 x_1704))
+(assert (< x_1704 x_1705))
+(assert (< x_1705 x_1706))
+(assert (< x_1706 x_1707))
+(assert (< x_1707 x_1708))
+(assert (< x_1708 x_1709))
+(assert (< x_1709 x_1710))
+(assert (< x_1710 x_1711))
+(assert (< x_1711 x_1712))
+(assert (< x_1712 x_1713))
+(assert (< x_1713 x_1714))
+(assert (< x_1714 x_1715))
+(assert (< x_1715 x_1716))
+(assert (< x_1716 x_1717))
+(assert (< x_1717 x_1718))
+(assert (< x_1718 x_1719))
+(assert (< x_1719 x_1720))
+(assert (< x_1720 x_1721))
+(assert (< x_1721 x_1722))
+(assert (< x_1722 x_1723))
+(assert (< x_1723 x_1724))
+(assert (< x_1724 x_1725))
+(assert (< x_1725 x_1726))
+(assert (< x_1726 x_1727))
+(assert (< x_1727 x_1728))
+(assert (< x_1728 x_1729))
+(assert (< x_1729 x_1730))
+(assert (< x_1730 x_1731))
+(assert (< x_1731 x_1732))
+(assert (< x_1732 x_1733))
+(assert (< x_1733 x_1734))
+(assert (< x_1734 x_1735))
+(assert (< x_1735 x_1736))
+(assert (< x_1736 x_1737))
+(assert (< x_1737 x_1738))
+(assert (< x_1738 x_1739))
+(assert (< x_1739 x_1740))
+(assert (< x_1740 x_1741))
+(assert (< x_1741 x_1742))
+(assert (< x_1742 x_1743))
+(assert (< x_1743 x_1744))
+(assert (< x_1744 x_1745))
+(assert (< x_1745 x_1746))
+(assert (< x_1746 x_1747))
+(assert (< x_1747 x_1748))
+(assert (< x_1748 x_1749))
+(assert (< x_1749 x_1750))
+(assert (< x_1750 x_1751))
+(assert (< x_1751 x_1752))
+(assert (< x_1752 x_1753))
+(assert (< x_1753 x_1754))
+(assert (< x_1754 x_1755))
+(assert (< x_1755 x_1756))
+(assert (< x_1756 x_1757))
+(assert (< x_1757 x_1758))
+(assert (< x_1758 x_1759))
+(assert (< x_1759 x_1760))
+(assert (< x_1760 x_1761))
+(assert (< x_1761 x_1762))
+(assert (< x_1762 x_1763))
+(assert (< x_1763 x_1764))
+(assert (< x_1764 x_1765))
+(assert (< x_1765 x_1766))
+(assert (< x_1766 x_1767))
+(assert (< x_1767 x_1768))
+(assert (< x_1768 x_1769))
+(assert (< x_1769 x_1770))
+(assert (< x_1770 x_1771))
+(assert (< x_1771 x_1772))
+(assert (< x_1772 x_1773))
+(assert (< x_1773 x_1774))
+(assert (< x_1774 x_1775))
+(assert (< x_1775 x_1776))
+(assert (< x_1776 x_1777))
+(assert (< x_1777 x_1778))
+(assert (< x_1778 x_1779))
+(assert (< x_1779 x_1780))
+(assert (< x_1780 x_1781))
+(assert (< x_1781 x_1782))
+(assert (< x_1782 x_1783))
+(assert (< x_1783 x_1784))
+(assert (< x_1784 x_1785))
+(assert (< x_1785 x_1786))
+(assert (< x_1786 x_1787))
+(assert (< x_1787 x_1788))
+(assert (< x_1788 x_1789))
+(assert (< x_1789 x_1790))
+(assert (< x_1790 x_1791))
+(assert (< x_1791 x_1792))
+(assert (< x_1792 x_1793))
+(assert (< x_1793 x_1794))
+(assert (< x_1794 x_1795))
+(assert (< x_1795 x_1796))
+(assert (< x_1796 x_1797))
+(assert (< x_1797 x_1798))
+(assert (< x_1798 x_1799))
+(assert (< x_1799 x_1800))
+(assert (< x_1800 x_1801))
+(assert (< x_1801 x_1802))
+(assert (< x_1802 x_1803))
+(assert (< x_1803 x_1804))
+(assert (< x_1804 x_1805))
+(assert (< x_1805 x_1806))
+(assert (< x_1806 x_1807))
+(assert (< x_1807 x_1808))
+(assert (< x_1808 x_1809))
+(assert (< x_1809 x_1810))
+(assert (< x_1810 x_1811))
+(assert (< x_1811 x_1812))
+(assert (< x_1812 x_1813))
+(assert (< x_1813 x_1814))
+(assert (< x_1814 x_1815))
+(assert (< x_1815 x_1816))
+(assert (< x_1816 x_1817))
+(assert (< x_1817 x_1818))
+(assert (< x_1818 x_1819))
+(assert (< x_1819 x_1820))
+(assert (< x_1820 x_1821))
+(assert (< x_1821 x_1822))
+(assert (< x_1822 x_1823))
+(assert (< x_1823 x_1824))
+(assert (< x_1824 x_1825))
+(assert (< x_1825 x_1826))
+(assert (< x_1826 x_1827))
+(assert (< x_1827 x_1828))
+(assert (< x_1828 x_1829))
+(assert (< x_1829 x_1830))
+(assert (< x_1830 x_1831))
+(assert (< x_1831 x_1832))
+(assert (< x_1832 x_1833))
+(assert (< x_1833 x_1834))
+(assert (< x_1834 x_1835))
+(assert (< x_1835 x_1836))
+(assert (< x_1836 x_1837))
+(assert (< x_1837 x_1838))
+(assert (< x_1838 x_1839))
+(assert (< x_1839 x_1840))
+(assert (< x_1840 x_1841))
+(assert (< x_1841 x_1842))
+(assert (< x_1842 x_1843))
+(assert (< x_1843 x_1844))
+(assert (< x_1844 x_1845))
+(assert (< x_1845 x_1846))
+(assert (< x_1846 x_1847))
+(assert (< x_1847 x_1848))
+(assert (< x_1848 x_1849))
+(assert (< x_1849 x_1850))
+(assert (< x_1850 x_1851))
+(assert (< x_1851 x_1852))
+(assert (< x_1852 x_1853))
+(assert (< x_1853 x_1854))
+(assert (< x_1854 x_1855))
+(assert (< x_1855 x_1856))
+(assert (< x_1856 x_1857))
+(assert (< x_1857 x_1858))
+(assert (< x_1858 x_1859))
+(assert (< x_1859 x_1860))
+(assert (< x_1860 x_1861))
+(assert (< x_1861 x_1862))
+(assert (< x_1862 x_1863))
+(assert (< x_1863 x_1864))
+(assert (< x_1864 x_1865))
+(assert (< x_1865 x_1866))
+(assert (< x_1866 x_1867))
+(assert (< x_1867 x_1868))
+(assert (< x_1868 x_1869))
+(assert (< x_1869 x_1870))
+(assert (< x_1870 x_1871))
+(assert (< x_1871 x_1872))
+(assert (< x_1872 x_1873))
+(assert (< x_1873 x_1874))
+(assert (< x_1874 x_1875))
+(assert (< x_1875 x_1876))
+(assert (< x_1876 x_1877))
+(assert (< x_1877 x_1878))
+(assert (< x_1878 x_1879))
+(assert (< x_1879 x_1880))
+(assert (< x_1880 x_1881))
+(assert (< x_1881 x_1882))
+(assert (< x_1882 x_1883))
+(assert (< x_1883 x_1884))
+(assert (< x_1884 x_1885))
+(assert (< x_1885 x_1886))
+(assert (< x_1886 x_1887))
+(assert (< x_1887 x_1888))
+(assert (< x_1888 x_1889))
+(assert (< x_1889 x_1890))
+(assert (< x_1890 x_1891))
+(assert (< x_1891 x_1892))
+(assert (< x_1892 x_1893))
+(assert (< x_1893 x_1894))
+(assert (< x_1894 x_1895))
+(assert (< x_1895 x_1896))
+(assert (< x_1896 x_1897))
+(assert (< x_1897 x_1898))
+(assert (< x_1898 x_1899))
+(assert (< x_1899 x_1900))
+(assert (< x_1900 x_1901))
+(assert (< x_1901 x_1902))
+(assert (< x_1902 x_1903))
+(assert (< x_1903 x_1904))
+(assert (< x_1904 x_1905))
+(assert (< x_1905 x_1906))
+(assert (< x_1906 x_1907))
+(assert (< x_1907 x_1908))
+(assert (< x_1908 x_1909))
+(assert (< x_1909 x_1910))
+(assert (< x_1910 x_1911))
+(assert (< x_1911 x_1912))
+(assert (< x_1912 x_1913))
+(assert (< x_1913 x_1914))
+(assert (< x_1914 x_1915))
+(assert (< x_1915 x_1916))
+(assert (< x_1916 x_1917))
+(assert (< x_1917 x_1918))
+(assert (< x_1918 x_1919))
+(assert (< x_1919 x_1920))
+(assert (< x_1920 x_1921))
+(assert (< x_1921 x_1922))
+(assert (< x_1922 x_1923))
+(assert (< x_1923 x_1924))
+(assert (< x_1924 x_1925))
+(assert (< x_1925 x_1926))
+(assert (< x_1926 x_1927))
+(assert (< x_1927 x_1928))
+(assert (< x_1928 x_1929))
+(assert (< x_1929 x_1930))
+(assert (< x_1930 x_1931))
+(assert (< x_1931 x_1932))
+(assert (< x_1932 x_1933))
+(assert (< x_1933 x_1934))
+(assert (< x_1934 x_1935))
+(assert (< x_1935 x_1936))
+(assert (< x_1936 x_1937))
+(assert (< x_1937 x_1938))
+(assert (< x_1938 x_1939))
+(assert (< x_1939 x_1940))
+(assert (< x_1940 x_1941))
+(assert (< x_1941 x_1942))
+(assert (< x_1942 x_1943))
+(assert (< x_1943 x_1944))
+(assert (< x_1944 x_1945))
+(assert (< x_1945 x_1946))
+(assert (< x_1946 x_1947))
+(assert (< x_1947 x_1948))
+(assert (< x_1948 x_1949))
+(assert (< x_1949 x_1950))
+(assert (< x_1950 x_1951))
+(assert (< x_1951 x_1952))
+(assert (< x_1952 x_1953))
+(assert (< x_1953 x_1954))
+(assert (< x_1954 x_1955))
+(assert (< x_1955 x_1956))
+(assert (< x_1956 x_1957))
+(assert (< x_1957 x_1958))
+(assert (< x_1958 x_1959))
+(assert (< x_1959 x_1960))
+(assert (< x_1960 x_1961))
+(assert (< x_1961 x_1962))
+(assert (< x_1962 x_1963))
+(assert (< x_1963 x_1964))
+(assert (< x_1964 x_1965))
+(assert (< x_1965 x_1966))
+(assert (< x_1966 x_1967))
+(assert (< x_1967 x_1968))
+(assert (< x_1968 x_1969))
+(assert (< x_1969 x_1970))
+(assert (< x_1970 x_1971))
+(assert (< x_1971 x_1972))
+(assert (< x_1972 x_1973))
+(assert (< x_1973 x_1974))
+(assert (< x_1974 x_1975))
+(assert (< x_1975 x_1976))
+(assert (< x_1976 x_1977))
+(assert (< x_1977 x_1978))
+(assert (< x_1978 x_1979))
+(assert (< x_1979 x_1980))
+(assert (< x_1980 x_1981))
+(assert (< x_1981 x_1982))
+(assert (< x_1982 x_1983))
+(assert (< x_1983 x_1984))
+(assert (< x_1984 x_1985))
+(assert (< x_1985 x_1986))
+(assert (< x_1986 x_1987))
+(assert (< x_1987 x_1988))
+(assert (< x_1988 x_1989))
+(assert (< x_1989 x_1990))
+(assert (< x_1990 x_1991))
+(assert (< x_1991 x_1992))
+(assert (< x_1992 x_1993))
+(assert (< x_1993 x_1994))
+(assert (< x_1994 x_1995))
+(assert (< x_1995 x_1996))
+(assert (< x_1996 x_1997))
+(assert (< x_1997 x_1998))
+(assert (< x_1998 x_1999))
+(assert (< x_1999 x_2000))
+(assert (< x_2000 x_2001))
+(assert (< x_2001 x_2002))
+(assert (< x_2002 x_2003))
+(assert (< x_2003 x_2004))
+(assert (< x_2004 x_2005))
+(assert (< x_2005 x_2006))
+(assert (< x_2006 x_2007))
+(assert (< x_2007 x_2008))
+(assert (< x_2008 x_2009))
+(assert (< x_2009 x_2010))
+(assert (< x_2010 x_2011))
+(assert (< x_2011 x_2012))
+(assert (< x_2012 x_2013))
+(assert (< x_2013 x_2014))
+(assert (< x_2014 x_2015))
+(assert (< x_2015 x_2016))
+(assert (< x_2016 x_2017))
+(assert (< x_2017 x_2018))
+(assert (< x_2018 x_2019))
+(assert (< x_2019 x_2020))
+(assert (< x_2020 x_2021))
+(assert (< x_2021 x_2022))
+(assert (< x_2022 x_2023))
+(assert (< x_2023 x_2024))
+(assert (< x_2024 x_2025))
+(assert (< x_2025 x_2026))
+(assert (< x_2026 x_2027))
+(assert (< x_2027 x_2028))
+(assert (< x_2028 x_2029))
+(assert (< x_2029 x_2030))
+(assert (< x_2030 x_2031))
+(assert (< x_2031 x_2032))
+(assert (< x_2032 x_2033))
+(assert (< x_2033 x_2034))
+(assert (< x_2034 x_2035))
+(assert (< x_2035 x_2036))
+(assert (< x_2036 x_2037))
+(assert (< x_2037 x_2038))
+(assert (< x_2038 x_2039))
+(assert (< x_2039 x_2040))
+(assert (< x_2040 x_2041))
+(assert (< x_2041 x_2042))
+(assert (< x_2042 x_2043))
+(assert (< x_2043 x_2044))
+(assert (< x_2044 x_2045))
+(assert (< x_2045 x_2046))
+(assert (< x_2046 x_2047))
+(assert (< x_2047 x_2048))
+(assert (< x_2048 x_2049))
+(assert (< x_2049 x_2050))
+(assert (< x_2050 x_2051))
+(assert (< x_2051 x_2052))
+(assert (< x_2052 x_2053))
+(assert (< x_2053 x_2054))
+(assert (< x_2054 x_2055))
+(assert (< x_2055 x_2056))
+(assert (< x_2056 x_2057))
+(assert (< x_2057 x_2058))
+(assert (< x_2058 x_2059))
+(assert (< x_2059 x_2060))
+(assert (< x_2060 x_2061))
+(assert (< x_2061 x_2062))
+(assert (< x_2062 x_2063))
+(assert (< x_2063 x_2064))
+(assert (< x_2064 x_2065))
+(assert (< x_2065 x_2066))
+(assert (< x_2066 x_2067))
+(assert (< x_2067 x_2068))
+(assert (< x_2068 x_2069))
+(assert (< x_2069 x_2070))
+(assert (< x_2070 x_2071))
+(assert (< x_2071 x_2072))
+(assert (< x_2072 x_2073))
+(assert (< x_2073 x_2074))
+(assert (< x_2074 x_2075))
+(assert (< x_2075 x_2076))
+(assert (< x_2076 x_2077))
+(assert (< x_2077 x_2078))
+(assert (< x_2078 x_2079))
+(assert (< x_2079 x_2080))
+(assert (< x_2080 x_2081))
+(assert (< x_2081 x_2082))
+(assert (< x_2082 x_2083))
+(assert (< x_2083 x_2084))
+(assert (< x_2084 x_2085))
+(assert (< x_2085 x_2086))
+(assert (< x_2086 x_2087))
+(assert (< x_2087 x_2088))
+(assert (< x_2088 x_2089))
+(assert (< x_2089 x_2090))
+(assert (< x_2090 x_2091))
+(assert (< x_2091 x_2092))
+(assert (< x_2092 x_2093))
+(assert (< x_2093 x_2094))
+(assert (< x_2094 x_2095))
+(assert (< x_2095 x_2096))
+(assert (< x_2096 x_2097))
+(assert (< x_2097 x_2098))
+(assert (< x_2098 x_2099))
+(assert (< x_2099 x_2100))
+(assert (< x_2100 x_2101))
+(assert (< x_2101 x_2102))
+(assert (< x_2102 x_2103))
+(assert (< x_2103 x_2104))
+(assert (< x_2104 x_2105))
+(assert (< x_2105 x_2106))
+(assert (< x_2106 x_2107))
+(assert (< x_2107 x_2108))
+(assert (< x_2108 x_2109))
+(assert (< x_2109 x_2110))
+(assert (< x_2110 x_2111))
+(assert (< x_2111 x_2112))
+(assert (< x_2112 x_2113))
+(assert (< x_2113 x_2114))
+(assert (< x_2114 x_2115))
+(assert (< x_2115 x_2116))
+(assert (< x_2116 x_2117))
+(assert (< x_2117 x_2118))
+(assert (< x_2118 x_2119))
+(assert (< x_2119 x_2120))
+(assert (< x_2120 x_2121))
+(assert (< x_2121 x_2122))
+(assert (< x_2122 x_2123))
+(assert (< x_2123 x_2124))
+(assert (< x_2124 x_2125))
+(assert (< x_2125 x_2126))
+(assert (< x_2126 x_2127))
+(assert (< x_2127 x_2128))
+(assert (< x_2128 x_2129))
+(assert (< x_2129 x_2130))
+(assert (< x_2130 x_2131))
+(assert (< x_2131 x_2132))
+(assert (< x_2132 x_2133))
+(assert (< x_2133 x_2134))
+(assert (< x_2134 x_2135))
+(assert (< x_2135 x_2136))
+(assert (< x_2136 x_2137))
+(assert (< x_2137 x_2138))
+(assert (< x_2138 x_2139))
+(assert (< x_2139 x_2140))
+(assert (< x_2140 x_2141))
+(assert (< x_2141 x_2142))
+(assert (< x_2142 x_2143))
+(assert (< x_2143 x_2144))
+(assert (< x_2144 x_2145))
+(assert (< x_2145 x_2146))
+(assert (< x_2146 x_2147))
+(assert (< x_2147 x_2148))
+(assert (< x_2148 x_2149))
+(assert (< x_2149 x_2150))
+(assert (< x_2150 x_2151))
+(assert (< x_2151 x_2152))
+(assert (< x_2152 x_2153))
+(assert (< x_2153 x_2154))
+(assert (< x_2154 x_2155))
+(assert (< x_2155 x_2156))
+(assert (< x_2156 x_2157))
+(assert (< x_2157 x_2158))
+(assert (< x_2158 x_2159))
+(assert (< x_2159 x_2160))
+(assert (< x_2160 x_2161))
+(assert (< x_2161 x_2162))
+(assert (< x_2162 x_2163))
+(assert (< x_2163 x_2164))
+(assert (< x_2164 x_2165))
+(assert (< x_2165 x_2166))
+(assert (< x_2166 x_2167))
+(assert (< x_2167 x_2168))
+(assert (< x_2168 x_2169))
+(assert (< x_2169 x_2170))
+(assert (< x_2170 x_2171))
+(assert (< x_2171 x_2172))
+(assert (< x_2172 x_2173))
+(assert (< x_2173 x_2174))
+(assert (< x_2174 x_2175))
+(assert (< x_2175 x_2176))
+(assert (< x_2176 x_2177))
+(assert (< x_2177 x_2178))
+(assert (< x_2178 x_2179))
+(assert (< x_2179 x_2180))
+(assert (< x_2180 x_2181))
+(assert (< x_2181 x_2182))
+(assert (< x_2182 x_2183))
+(assert (< x_2183 x_2184))
+(assert (< x_2184 x_2185))
+(assert (< x_2185 x_2186))
+(assert (< x_2186 x_2187))
+(assert (< x_2187 x_2188))
+(assert (< x_2188 x_2189))
+(assert (< x_2189 x_2190))
+(assert (< x_2190 x_2191))
+(assert (< x_2191 x_2192))
+(assert (< x_2192 x_2193))
+(assert (< x_2193 x_2194))
+(assert (< x_2194 x_2195))
+(assert (< x_2195 x_2196))
+(assert (< x_2196 x_2197))
+(assert (< x_2197 x_2198))
+(assert (< x_2198 x_2199))
+(assert (< x_2199 x_2200))
+(assert (< x_2200 x_2201))
+(assert (< x_2201 x_2202))
+(assert (< x_2202 x_2203))
+(assert (< x_2203 x_2204))
+(assert (< x_2204 x_2205))
+(assert (< x_2205 x_2206))
+(assert (< x_2206 x_2207))
+(assert (< x_2207 x_2208))
+(assert (< x_2208 x_2209))
+(assert (< x_2209 x_2210))
+(assert (< x_2210 x_2211))
+(assert (< x_2211 x_2212))
+(assert (< x_2212 x_2213))
+(assert (< x_2213 x_2214))
+(assert (< x_2214 x_2215))
+(assert (< x_2215 x_2216))
+(assert (< x_2216 x_2217))
+(assert (< x_2217 x_2218))
+(assert (< x_2218 x_2219))
+(assert (< x_2219 x_2220))
+(assert (< x_2220 x_2221))
+(assert (< x_2221 x_2222))
+(assert (< x_2222 x_2223))
+(assert (< x_2223 x_2224))
+(assert (< x_2224 x_2225))
+(assert (< x_2225 x_2226))
+(assert (< x_2226 x_2227))
+(assert (< x_2227 x_2228))
+(assert (< x_2228 x_2229))
+(assert (< x_2229 x_2230))
+(assert (< x_2230 x_2231))
+(assert (< x_2231 x_2232))
+(assert (< x_2232 x_2233))
+(assert (< x_2233 x_2234))
+(assert (< x_2234 x_2235))
+(assert (< x_2235 x_2236))
+(assert (< x_2236 x_2237))
+(assert (< x_2237 x_2238))
+(assert (< x_2238 x_2239))
+(assert (< x_2239 x_2240))
+(assert (< x_2240 x_2241))
+(assert (< x_2241 x_2242))
+(assert (< x_2242 x_2243))
+(assert (< x_2243 x_2244))
+(assert (< x_2244 x_2245))
+(assert (< x_2245 x_2246))
+(assert (< x_2246 x_2247))
+(assert (< x_2247 x_2248))
+(assert (< x_2248 x_2249))
+(assert (< x_2249 x_2250))
+(assert (< x_2250 x_2251))
+(assert (< x_2251 x_2252))
+(assert (< x_2252 x_2253))
+(assert (< x_2253 x_2254))
+(assert (< x_2254 x_2255))
+(assert (< x_2255 x_2256))
+(assert (< x_2256 x_2257))
+(assert (< x_2257 x_2258))
+(assert (< x_2258 x_2259))
+(assert (< x_2259 x_2260))
+(assert (< x_2260 x_2261))
+(assert (< x_2261 x_2262))
+(assert (< x_2262 x_2263))
+(assert (< x_2263 x_2264))
+(assert (< x_2264 x_2265))
+(assert (< x_2265 x_2266))
+(assert (< x_2266 x_2267))
+(assert (< x_2267 x_2268))
+(assert (< x_2268 x_2269))
+(assert (< x_2269 x_2270))
+(assert (< x_2270 x_2271))
+(assert (< x_2271 x_2272))
+(assert (< x_2272 x_2273))
+(assert (< x_2273 x_2274))
+(assert (< x_2274 x_2275))
+(assert (< x_2275 x_2276))
+(assert (< x_2276 x_2277))
+(assert (< x_2277 x_2278))
+(assert (< x_2278 x_2279))
+(assert (< x_2279 x_2280))
+(assert (< x_2280 x_2281))
+(assert (< x_2281 x_2282))
+(assert (< x_2282 x_2283))
+(assert (< x_2283 x_2284))
+(assert (< x_2284 x_2285))
+(assert (< x_2285 x_2286))
+(assert (< x_2286 x_2287))
+(assert (< x_2287 x_2288))
+(assert (< x_2288 x_2289))
+(assert (< x_2289 x_2290))
+(assert (< x_2290 x_2291))
+(assert (< x_2291 x_2292))
+(assert (< x_2292 x_2293))
+(assert (< x_2293 x_2294))
+(assert (< x_2294 x_2295))
+(assert (< x_2295 x_2296))
+(assert (< x_2296 x_2297))
+(assert (< x_2297 x_2298))
+(assert (< x_2298 x_2299))
+(assert (< x_2299 x_2300))
+(assert (< x_2300 x_2301))
+(assert (< x_2301 x_2302))
+(assert (< x_2302 x_2303))
+(assert (< x_2303 x_2304))
+(assert (< x_2304 x_2305))
+(assert (< x_2305 x_2306))
+(assert (< x_2306 x_2307))
+(assert (< x_2307 x_2308))
+(assert (< x_2308 x_2309))
+(assert (< x_2309 x_2310))
+(assert (< x_2310 x_2311))
+(assert (< x_2311 x_2312))
+(assert (< x_2312 x_2313))
+(assert (< x_2313 x_2314))
+(assert (< x_2314 x_2315))
+(assert (< x_2315 x_2316))
+(assert (< x_2316 x_2317))
+(assert (< x_2317 x_2318))
+(assert (< x_2318 x_2319))
+(assert (< x_2319 x_2320))
+(assert (< x_2320 x_2321))
+(assert (< x_2321 x_2322))
+(assert (< x_2322 x_2323))
+(assert (< x_2323 x_2324))
+(assert (< x_2324 x_2325))
+(assert (< x_2325 x_2326))
+(assert (< x_2326 x_2327))
+(assert (< x_2327 x_2328))
+(assert (< x_2328 x_2329))
+(assert (< x_2329 x_2330))
+(assert (< x_2330 x_2331))
+(assert (< x_2331 x_2332))
+(assert (< x_2332 x_2333))
+(assert (< x_2333 x_2334))
+(assert (< x_2334 x_2335))
+(assert (< x_2335 x_2336))
+(assert (< x_2336 x_2337))
+(assert (< x_2337 x_2338))
+(assert (< x_2338 x_2339))
+(assert (< x_2339 x_2340))
+(assert (< x_2340 x_2341))
+(assert (< x_2341 x_2342))
+(assert (< x_2342 x_2343))
+(assert (< x_2343 x_2344))
+(assert (< x_2344 x_2345))
+(assert (< x_2345 x_2346))
+(assert (< x_2346 x_2347))
+(assert (< x_2347 x_2348))
+(assert (< x_2348 x_2349))
+(assert (< x_2349 x_2350))
+(assert (< x_2350 x_2351))
+(assert (< x_2351 x_2352))
+(assert (< x_2352 x_2353))
+(assert (< x_2353 x_2354))
+(assert (< x_2354 x_2355))
+(assert (< x_2355 x_2356))
+(assert (< x_2356 x_2357))
+(assert (< x_2357 x_2358))
+(assert (< x_2358 x_2359))
+(assert (< x_2359 x_2360))
+(assert (< x_2360 x_2361))
+(assert (< x_2361 x_2362))
+(assert (< x_2362 x_2363))
+(assert (< x_2363 x_2364))
+(assert (< x_2364 x_2365))
+(assert (< x_2365 x_2366))
+(assert (< x_2366 x_2367))
+(assert (< x_2367 x_2368))
+(assert (< x_2368 x_2369))
+(assert (< x_2369 x_2370))
+(assert (< x_2370 x_2371))
+(assert (< x_2371 x_2372))
+(assert (< x_2372 x_2373))
+(assert (< x_2373 x_2374))
+(assert (< x_2374 x_2375))
+(assert (< x_2375 x_2376))
+(assert (< x_2376 x_2377))
+(assert (< x_2377 x_2378))
+(assert (< x_2378 x_2379))
+(assert (< x_2379 x_2380))
+(assert (< x_2380 x_2381))
+(assert (< x_2381 x_2382))
+(assert (< x_2382 x_2383))
+(assert (< x_2383 x_2384))
+(assert (< x_2384 x_2385))
+(assert (< x_2385 x_2386))
+(assert (< x_2386 x_2387))
+(assert (< x_2387 x_2388))
+(assert (< x_2388 x_2389))
+(assert (< x_2389 x_2390))
+(assert (< x_2390 x_2391))
+(assert (< x_2391 x_2392))
+(assert (< x_2392 x_2393))
+(assert (< x_2393 x_2394))
+(assert (< x_2394 x_2395))
+(assert (< x_2395 x_2396))
+(assert (< x_2396 x_2397))
+(assert (< x_2397 x_2398))
+(assert (< x_2398 x_2399))
+(assert (< x_2399 x_2400))
+(assert (< x_2400 x_2401))
+(assert (< x_2401 x_2402))
+(assert (< x_2402 x_2403))
+(assert (< x_2403 x_2404))
+(assert (< x_2404 x_2405))
+(assert (< x_2405 x_2406))
+(assert (< x_2406 x_2407))
+(assert (< x_2407 x_2408))
+(assert (< x_2408 x_2409))
+(assert (< x_2409 x_2410))
+(assert (< x_2410 x_2411))
+(assert (< x_2411 x_2412))
+(assert (< x_2412 x_2413))
+(assert (< x_2413 x_2414))
+(assert (< x_2414 x_2415))
+(assert (< x_2415 x_2416))
+(assert (< x_2416 x_2417))
+(assert (< x_2417 x_2418))
+(assert (< x_2418 x_2419))
+(assert (< x_2419 x_2420))
+(assert (< x_2420 x_2421))
+(assert (< x_2421 x_2422))
+(assert (< x_2422 x_2423))
+(assert (< x_2423 x_2424))
+(assert (< x_2424 x_2425))
+(assert (< x_2425 x_2426))
+(assert (< x_2426 x_2427))
+(assert (< x_2427 x_2428))
+(assert (< x_2428 x_2429))
+(assert (< x_2429 x_2430))
+(assert (< x_2430 x_2431))
+(assert (< x_2431 x_2432))
+(assert (< x_2432 x_2433))
+(assert (< x_2433 x_2434))
+(assert (< x_2434 x_2435))
+(assert (< x_2435 x_2436))
+(assert (< x_2436 x_2437))
+(assert (< x_2437 x_2438))
+(assert (< x_2438 x_2439))
+(assert (< x_2439 x_2440))
+(assert (< x_2440 x_2441))
+(assert (< x_2441 x_2442))
+(assert (< x_2442 x_2443))
+(assert (< x_2443 x_2444))
+(assert (< x_2444 x_2445))
+(assert (< x_2445 x_2446))
+(assert (< x_2446 x_2447))
+(assert (< x_2447 x_2448))
+(assert (< x_2448 x_2449))
+(assert (< x_2449 x_2450))
+(assert (< x_2450 x_2451))
+(assert (< x_2451 x_2452))
+(assert (< x_2452 x_2453))
+(assert (< x_2453 x_2454))
+(assert (< x_2454 x_2455))
+(assert (< x_2455 x_2456))
+(assert (< x_2456 x_2457))
+(assert (< x_2457 x_2458))
+(assert (< x_2458 x_2459))
+(assert (< x_2459 x_2460))
+(assert (< x_2460 x_2461))
+(assert (< x_2461 x_2462))
+(assert (< x_2462 x_2463))
+(assert (< x_2463 x_2464))
+(assert (< x_2464 x_2465))
+(assert (< x_2465 x_2466))
+(assert (< x_2466 x_2467))
+(assert (< x_2467 x_2468))
+(assert (< x_2468 x_2469))
+(assert (< x_2469 x_2470))
+(assert (< x_2470 x_2471))
+(assert (< x_2471 x_2472))
+(assert (< x_2472 x_2473))
+(assert (< x_2473 x_2474))
+(assert (< x_2474 x_2475))
+(assert (< x_2475 x_2476))
+(assert (< x_2476 x_2477))
+(assert (< x_2477 x_2478))
+(assert (< x_2478 x_2479))
+(assert (< x_2479 x_2480))
+(assert (< x_2480 x_2481))
+(assert (< x_2481 x_2482))
+(assert (< x_2482 x_2483))
+(assert (< x_2483 x_2484))
+(assert (< x_2484 x_2485))
+(assert (< x_2485 x_2486))
+(assert (< x_2486 x_2487))
+(assert (< x_2487 x_2488))
+(assert (< x_2488 x_2489))
+(assert (< x_2489 x_2490))
+(assert (< x_2490 x_2491))
+(assert (< x_2491 x_2492))
+(assert (< x_2492 x_2493))
+(assert (< x_2493 x_2494))
+(assert (< x_2494 x_2495))
+(assert (< x_2495 x_2496))
+(assert (< x_2496 x_2497))
+(assert (< x_2497 x_2498))
+(assert (< x_2498 x_2499))
+(assert (< x_2499 x_2500))
+(assert (< x_2500 x_2501))
+(assert (< x_2501 x_2502))
+(assert (< x_2502 x_2503))
+(assert (< x_2503 x_2504))
+(assert (< x_2504 x_2505))
+(assert (< x_2505 x_2506))
+(assert (< x_2506 x_2507))
+(assert (< x_2507 x_2508))
+(assert (< x_2508 x_2509))
+(assert (< x_2509 x_2510))
+(assert (< x_2510 x_2511))
+(assert (< x_2511 x_2512))
+(assert (< x_2512 x_2513))
+(assert (< x_2513 x_2514))
+(assert (< x_2514 x_2515))
+(assert (< x_2515 x_2516))
+(assert (< x_2516 x_2517))
+(assert (< x_2517 x_2518))
+(assert (< x_2518 x_2519))
+(assert (< x_2519 x_2520))
+(assert (< x_2520 x_2521))
+(assert (< x_2521 x_2522))
+(assert (< x_2522 x_2523))
+(assert (< x_2523 x_2524))
+(assert (< x_2524 x_2525))
+(assert (< x_2525 x_2526))
+(assert (< x_2526 x_2527))
+(assert (< x_2527 x_2528))
+(assert (< x_2528 x_2529))
+(assert (< x_2529 x_2530))
+(assert (< x_2530 x_2531))
+(assert (< x_2531 x_2532))
+(assert (< x_2532 x_2533))
+(assert (< x_2533 x_2534))
+(assert (< x_2534 x_2535))
+(assert (< x_2535 x_2536))
+(assert (< x_2536 x_2537))
+(assert (< x_2537 x_2538))
+(assert (< x_2538 x_2539))
+(assert (< x_2539 x_2540))
+(assert (< x_2540 x_2541))
+(assert (< x_2541 x_2542))
+(assert (< x_2542 x_2543))
+(assert (< x_2543 x_2544))
+(assert (< x_2544 x_2545))
+(assert (< x_2545 x_2546))
+(assert (< x_2546 x_2547))
+(assert (< x_2547 x_2548))
+(assert (< x_2548 x_2549))
+(assert (< x_2549 x_2550))
+(assert (< x_2550 x_2551))
+(assert (< x_2551 x_2552))
+(assert (< x_2552 x_2553))
+(assert (< x_2553 x_2554))
+(assert (< x_2554 x_2555))
+(assert (< x_2555 x_2556))
+(assert (< x_2556 x_2557))
+(assert (< x_2557 x_2558))
+(assert (< x_2558 x_2559))
+(assert (< x_2559 x_2560))
+(assert (< x_2560 x_2561))
+(assert (< x_2561 x_2562))
+(assert (< x_2562 x_2563))
+(assert (< x_2563 x_2564))
+(assert (< x_2564 x_2565))
+(assert (< x_2565 x_2566))
+(assert (< x_2566 x_2567))
+(assert (< x_2567 x_2568))
+(assert (< x_2568 x_2569))
+(assert (< x_2569 x_2570))
+(assert (< x_2570 x_2571))
+(assert (< x_2571 x_2572))
+(assert (< x_2572 x_2573))
+(assert (< x_2573 x_2574))
+(assert (< x_2574 x_2575))
+(assert (< x_2575 x_2576))
+(assert (< x_2576 x_2577))
+(assert (< x_2577 x_2578))
+(assert (< x_2578 x_2579))
+(assert (< x_2579 x_2580))
+(assert (< x_2580 x_2581))
+(assert (< x_2581 x_2582))
+(assert (< x_2582 x_2583))
+(assert (< x_2583 x_2584))
+(assert (< x_2584 x_2585))
+(assert (< x_2585 x_2586))
+(assert (< x_2586 x_2587))
+(assert (< x_2587 x_2588))
+(assert (< x_2588 x_2589))
+(assert (< x_2589 x_2590))
+(assert (< x_2590 x_2591))
+(assert (< x_2591 x_2592))
+(assert (< x_2592 x_2593))
+(assert (< x_2593 x_2594))
+(assert (< x_2594 x_2595))
+(assert (< x_2595 x_2596))
+(assert (< x_2596 x_2597))
+(assert (< x_2597 x_2598))
+(assert (< x_2598 x_2599))
+(assert (< x_2599 x_2600))
+(assert (< x_2600 x_2601))
+(assert (< x_2601 x_2602))
+(assert (< x_2602 x_2603))
+(assert (< x_2603 x_2604))
+(assert (< x_2604 x_2605))
+(assert (< x_2605 x_2606))
+(assert (< x_2606 x_2607))
+(assert (< x_2607 x_2608))
+(assert (< x_2608 x_2609))
+(assert (< x_2609 x_2610))
+(assert (< x_2610 x_2611))
+(assert (< x_2611 x_2612))
+(assert (< x_2612 x_2613))
+(assert (< x_2613 x_2614))
+(assert (< x_2614 x_2615))
+(assert (< x_2615 x_2616))
+(assert (< x_2616 x_2617))
+(assert (< x_2617 x_2618))
+(assert (< x_2618 x_2619))
+(assert (< x_2619 x_2620))
+(assert (< x_2620 x_2621))
+(assert (< x_2621 x_2622))
+(assert (< x_2622 x_2623))
+(assert (< x_2623 x_2624))
+(assert (< x_2624 x_2625))
+(assert (< x_2625 x_2626))
+(assert (< x_2626 x_2627))
+(assert (< x_2627 x_2628))
+(assert (< x_2628 x_2629))
+(assert (< x_2629 x_2630))
+(assert (< x_2630 x_2631))
+(assert (< x_2631 x_2632))
+(assert (< x_2632 x_2633))
+(assert (< x_2633 x_2634))
+(assert (< x_2634 x_2635))
+(assert (< x_2635 x_2636))
+(assert (< x_2636 x_2637))
+(assert (< x_2637 x_2638))
+(assert (< x_2638 x_2639))
+(assert (< x_2639 x_2640))
+(assert (< x_2640 x_2641))
+(assert (< x_2641 x_2642))
+(assert (< x_2642 x_2643))
+(assert (< x_2643 x_2644))
+(assert (< x_2644 x_2645))
+(assert (< x_2645 x_2646))
+(assert (< x_2646 x_2647))
+(assert (< x_2647 x_2648))
+(assert (< x_2648 x_2649))
+(assert (< x_2649 x_2650))
+(assert (< x_2650 x_2651))
+(assert (< x_2651 x_2652))
+(assert (< x_2652 x_2653))
+(assert (< x_2653 x_2654))
+(assert (< x_2654 x_2655))
+(assert (< x_2655 x_2656))
+(assert (< x_2656 x_2657))
+(assert (< x_2657 x_2658))
+(assert (< x_2658 x_2659))
+(assert (< x_2659 x_2660))
+(assert (< x_2660 x_2661))
+(assert (< x_2661 x_2662))
+(assert (< x_2662 x_2663))
+(assert (< x_2663 x_2664))
+(assert (< x_2664 x_2665))
+(assert (< x_2665 x_2666))
+(assert (< x_2666 x_2667))
+(assert (< x_2667 x_2668))
+(assert (< x_2668 x_2669))
+(assert (< x_2669 x_2670))
+(assert (< x_2670 x_2671))
+(assert (< x_2671 x_2672))
+(assert (< x_2672 x_2673))
+(assert (< x_2673 x_2674))
+(assert (< x_2674 x_2675))
+(assert (< x_2675 x_2676))
+(assert (< x_2676 x_2677))
+(assert (< x_2677 x_2678))
+(assert (< x_2678 x_2679))
+(assert (< x_2679 x_2680))
+(assert (< x_2680 x_2681))
+(assert (< x_2681 x_2682))
+(assert (< x_2682 x_2683))
+(assert (< x_2683 x_2684))
+(assert (< x_2684 x_2685))
+(assert (< x_2685 x_2686))
+(assert (< x_2686 x_2687))
+(assert (< x_2687 x_2688))
+(assert (< x_2688 x_2689))
+(assert (< x_2689 x_2690))
+(assert (< x_2690 x_2691))
+(assert (< x_2691 x_2692))
+(assert (< x_2692 x_2693))
+(assert (< x_2693 x_2694))
+(assert (< x_2694 x_2695))
+(assert (< x_2695 x_2696))
+(assert (< x_2696 x_2697))
+(assert (< x_2697 x_2698))
+(assert (< x_2698 x_2699))
+(assert (< x_2699 x_2700))
+(assert (< x_2700 x_2701))
+(assert (< x_2701 x_2702))
+(assert (< x_2702 x_2703))
+(assert (< x_2703 x_2704))
+(assert (< x_2704 x_2705))
+(assert (< x_2705 x_2706))
+(assert (< x_2706 x_2707))
+(assert (< x_2707 x_2708))
+(assert (< x_2708 x_2709))
+(assert (< x_2709 x_2710))
+(assert (< x_2710 x_2711))
+(assert (< x_2711 x_2712))
+(assert (< x_2712 x_2713))
+(assert (< x_2713 x_2714))
+(assert (< x_2714 x_2715))
+(assert (< x_2715 x_2716))
+(assert (< x_2716 x_2717))
+(assert (< x_2717 x_2718))
+(assert (< x_2718 x_2719))
+(assert (< x_2719 x_2720))
+(assert (< x_2720 x_2721))
+(assert (< x_2721 x_2722))
+(assert (< x_2722 x_2723))
+(assert (< x_2723 x_2724))
+(assert (< x_2724 x_2725))
+(assert (< x_2725 x_2726))
+(assert (< x_2726 x_2727))
+(assert (< x_2727 x_2728))
+(assert (< x_2728 x_2729))
+(assert (< x_2729 x_2730))
+(assert (< x_2730 x_2731))
+(assert (< x_2731 x_2732))
+(assert (< x_2732 x_2733))
+(assert (< x_2733 x_2734))
+(assert (< x_2734 x_2735))
+(assert (< x_2735 x_2736))
+(assert (< x_2736 x_2737))
+(assert (< x_2737 x_2738))
+(assert (< x_2738 x_2739))
+(assert (< x_2739 x_2740))
+(assert (< x_2740 x_2741))
+(assert (< x_2741 x_2742))
+(assert (< x_2742 x_2743))
+(assert (< x_2743 x_2744))
+(assert (< x_2744 x_2745))
+(assert (< x_2745 x_2746))
+(assert (< x_2746 x_2747))
+(assert (< x_2747 x_2748))
+(assert (< x_2748 x_2749))
+(assert (< x_2749 x_2750))
+(assert (< x_2750 x_2751))
+(assert (< x_2751 x_2752))
+(assert (< x_2752 x_2753))
+(assert (< x_2753 x_2754))
+(assert (< x_2754 x_2755))
+(assert (< x_2755 x_2756))
+(assert (< x_2756 x_2757))
+(assert (< x_2757 x_2758))
+(assert (< x_2758 x_2759))
+(assert (< x_2759 x_2760))
+(assert (< x_2760 x_2761))
+(assert (< x_2761 x_2762))
+(assert (< x_2762 x_2763))
+(assert (< x_2763 x_2764))
+(assert (< x_2764 x_2765))
+(assert (< x_2765 x_2766))
+(assert (< x_2766 x_2767))
+(assert (< x_2767 x_2768))
+(assert (< x_2768 x_2769))
+(assert (< x_2769 x_2770))
+(assert (< x_2770 x_2771))
+(assert (< x_2771 x_2772))
+(assert (< x_2772 x_2773))
+(assert (< x_2773 x_2774))
+(assert (< x_2774 x_2775))
+(assert (< x_2775 x_2776))
+(assert (< x_2776 x_2777))
+(assert (< x_2777 x_2778))
+(assert (< x_2778 x_2779))
+(assert (< x_2779 x_2780))
+(assert (< x_2780 x_2781))
+(assert (< x_2781 x_2782))
+(assert (< x_2782 x_2783))
+(assert (< x_2783 x_2784))
+(assert (< x_2784 x_2785))
+(assert (< x_2785 x_2786))
+(assert (< x_2786 x_2787))
+(assert (< x_2787 x_2788))
+(assert (< x_2788 x_2789))
+(assert (< x_2789 x_2790))
+(assert (< x_2790 x_2791))
+(assert (< x_2791 x_2792))
+(assert (< x_2792 x_2793))
+(assert (< x_2793 x_2794))
+(assert (< x_2794 x_2795))
+(assert (< x_2795 x_2796))
+(assert (< x_2796 x_2797))
+(assert (< x_2797 x_2798))
+(assert (< x_2798 x_2799))
+(assert (< x_2799 x_2800))
+(assert (< x_2800 x_2801))
+(assert (< x_2801 x_2802))
+(assert (< x_2802 x_2803))
+(assert (< x_2803 x_2804))
+(assert (< x_2804 x_2805))
+(assert (< x_2805 x_2806))
+(assert (< x_2806 x_2807))
+(assert (< x_2807 x_2808))
+(assert (< x_2808 x_2809))
+(assert (< x_2809 x_2810))
+(assert (< x_2810 x_2811))
+(assert (< x_2811 x_2812))
+(assert (< x_2812 x_2813))
+(assert (< x_2813 x_2814))
+(assert (< x_2814 x_2815))
+(assert (< x_2815 x_2816))
+(assert (< x_2816 x_2817))
+(assert (< x_2817 x_2818))
+(assert (< x_2818 x_2819))
+(assert (< x_2819 x_2820))
+(assert (< x_2820 x_2821))
+(assert (< x_2821 x_2822))
+(assert (< x_2822 x_2823))
+(assert (< x_2823 x_2824))
+(assert (< x_2824 x_2825))
+(assert (< x_2825 x_2826))
+(assert (< x_2826 x_2827))
+(assert (< x_2827 x_2828))
+(assert (< x_2828 x_2829))
+(assert (< x_2829 x_2830))
+(assert (< x_2830 x_2831))
+(assert (< x_2831 x_2832))
+(assert (< x_2832 x_2833))
+(assert (< x_2833 x_2834))
+(assert (< x_2834 x_2835))
+(assert (< x_2835 x_2836))
+(assert (< x_2836 x_2837))
+(assert (< x_2837 x_2838))
+(assert (< x_2838 x_2839))
+(assert (< x_2839 x_2840))
+(assert (< x_2840 x_2841))
+(assert (< x_2841 x_2842))
+(assert (< x_2842 x_2843))
+(assert (< x_2843 x_2844))
+(assert (< x_2844 x_2845))
+(assert (< x_2845 x_2846))
+(assert (< x_2846 x_2847))
+(assert (< x_2847 x_2848))
+(assert (< x_2848 x_2849))
+(assert (< x_2849 x_2850))
+(assert (< x_2850 x_2851))
+(assert (< x_2851 x_2852))
+(assert (< x_2852 x_2853))
+(assert (< x_2853 x_2854))
+(assert (< x_2854 x_2855))
+(assert (< x_2855 x_2856))
+(assert (< x_2856 x_2857))
+(assert (< x_2857 x_2858))
+(assert (< x_2858 x_2859))
+(assert (< x_2859 x_2860))
+(assert (< x_2860 x_2861))
+(assert (< x_2861 x_2862))
+(assert (< x_2862 x_2863))
+(assert (< x_2863 x_2864))
+(assert (< x_2864 x_2865))
+(assert (< x_2865 x_2866))
+(assert (< x_2866 x_2867))
+(assert (< x_2867 x_2868))
+(assert (< x_2868 x_2869))
+(assert (< x_2869 x_2870))
+(assert (< x_2870 x_2871))
+(assert (< x_2871 x_2872))
+(assert (< x_2872 x_2873))
+(assert (< x_2873 x_2874))
+(assert (< x_2874 x_2875))
+(assert (< x_2875 x_2876))
+(assert (< x_2876 x_2877))
+(assert (< x_2877 x_2878))
+(assert (< x_2878 x_2879))
+(assert (< x_2879 x_2880))
+(assert (< x_2880 x_2881))
+(assert (< x_2881 x_2882))
+(assert (< x_2882 x_2883))
+(assert (< x_2883 x_2884))
+(assert (< x_2884 x_2885))
+(assert (< x_2885 x_2886))
+(assert (< x_2886 x_2887))
+(assert (< x_2887 x_2888))
+(assert (< x_2888 x_2889))
+(assert (< x_2889 x_2890))
+(assert (< x_2890 x_2891))
+(assert (< x_2891 x_2892))
+(assert (< x_2892 x_2893))
+(assert (< x_2893 x_2894))
+(assert (< x_2894 x_2895))
+(assert (< x_2895 x_2896))
+(assert (< x_2896 x_2897))
+(assert (< x_2897 x_2898))
+(assert (< x_2898 x_2899))
+(assert (< x_2899 x_2900))
+(assert (< x_2900 x_2901))
+(assert (< x_2901 x_2902))
+(assert (< x_2902 x_2903))
+(assert (< x_2903 x_2904))
+(assert (< x_2904 x_2905))
+(assert (< x_2905 x_2906))
+(assert (< x_2906 x_2907))
+(assert (< x_2907 x_2908))
+(assert (< x_2908 x_2909))
+(assert (< x_2909 x_2910))
+(assert (< x_2910 x_2911))
+(assert (< x_2911 x_2912))
+(assert (< x_2912 x_2913))
+(assert (< x_2913 x_2914))
+(assert (< x_2914 x_2915))
+(assert (< x_2915 x_2916))
+(assert (< x_2916 x_2917))
+(assert (< x_2917 x_2918))
+(assert (< x_2918 x_2919))
+(assert (< x_2919 x_2920))
+(assert (< x_2920 x_2921))
+(assert (< x_2921 x_2922))
+(assert (< x_2922 x_2923))
+(assert (< x_2923 x_2924))
+(assert (< x_2924 x_2925))
+(assert (< x_2925 x_2926))
+(assert (< x_2926 x_2927))
+(assert (< x_2927 x_2928))
+(assert (< x_2928 x_2929))
+(assert (< x_2929 x_2930))
+(assert (< x_2930 x_2931))
+(assert (< x_2931 x_2932))
+(assert (< x_2932 x_2933))
+(assert (< x_2933 x_2934))
+(assert (< x_2934 x_2935))
+(assert (< x_2935 x_2936))
+(assert (< x_2936 x_2937))
+(assert (< x_2937 x_2938))
+(assert (< x_2938 x_2939))
+(assert (< x_2939 x_2940))
+(assert (< x_2940 x_2941))
+(assert (< x_2941 x_2942))
+(assert (< x_2942 x_2943))
+(assert (< x_2943 x_2944))
+(assert (< x_2944 x_2945))
+(assert (< x_2945 x_2946))
+(assert (< x_2946 x_2947))
+(assert (< x_2947 x_2948))
+(assert (< x_2948 x_2949))
+(assert (< x_2949 x_2950))
+(assert (< x_2950 x_2951))
+(assert (< x_2951 x_2952))
+(assert (< x_2952 x_2953))
+(assert (< x_2953 x_2954))
+(assert (< x_2954 x_2955))
+(assert (< x_2955 x_2956))
+(assert (< x_2956 x_2957))
+(assert (< x_2957 x_2958))
+(assert (< x_2958 x_2959))
+(assert (< x_2959 x_2960))
+(assert (< x_2960 x_2961))
+(assert (< x_2961 x_2962))
+(assert (< x_2962 x_2963))
+(assert (< x_2963 x_2964))
+(assert (< x_2964 x_2965))
+(assert (< x_2965 x_2966))
+(assert (< x_2966 x_2967))
+(assert (< x_2967 x_2968))
+(assert (< x_2968 x_2969))
+(assert (< x_2969 x_2970))
+(assert (< x_2970 x_2971))
+(assert (< x_2971 x_2972))
+(assert (< x_2972 x_2973))
+(assert (< x_2973 x_2974))
+(assert (< x_2974 x_2975))
+(assert (< x_2975 x_2976))
+(assert (< x_2976 x_2977))
+(assert (< x_2977 x_2978))
+(assert (< x_2978 x_2979))
+(assert (< x_2979 x_2980))
+(assert (< x_2980 x_2981))
+(assert (< x_2981 x_2982))
+(assert (< x_2982 x_2983))
+(assert (< x_2983 x_2984))
+(assert (< x_2984 x_2985))
+(assert (< x_2985 x_2986))
+(assert (< x_2986 x_2987))
+(assert (< x_2987 x_2988))
+(assert (< x_2988 x_2989))
+(assert (< x_2989 x_2990))
+(assert (< x_2990 x_2991))
+(assert (< x_2991 x_2992))
+(assert (< x_2992 x_2993))
+(assert (< x_2993 x_2994))
+(assert (< x_2994 x_2995))
+(assert (< x_2995 x_2996))
+(assert (< x_2996 x_2997))
+(assert (< x_2997 x_2998))
+(assert (< x_2998 x_2999))
+(check-sat)
+(push 1)
+(assert (< x_2999 x_0000))
+(check-sat)
+(pop 1)
+(assert (= x_0000 0))
+(assert (= x_2999 1))
+(check-sat)
+(get-value (x_0000 x_2999))
+(exit)
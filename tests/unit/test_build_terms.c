@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "yices.h"
+
+#define NUM_ELEMS(a) (sizeof(a)/sizeof((a)[0]))
+
+static void check_term(const char *name, term_t t, term_t expected) {
+  printf("%s: ", name);
+  if (t == NULL_TERM) {
+    printf("error\n");
+    yices_print_error(stdout);
+  } else {
+    yices_pp_term(stdout, t, 100, 10, 0);
+  }
+  fflush(stdout);
+  if (t != expected) {
+    printf("BUG: expected ");
+    yices_pp_term(stdout, expected, 100, 10, 0);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+/*
+ * badval is the index of the bad instruction in code for INVALID_BATCH_CODE,
+ * and the index of the node that failed for the other errors
+ */
+static void check_error(const char *name, term_t t, error_code_t code, int64_t badval) {
+  printf("%s: ", name);
+  yices_print_error(stdout);
+  fflush(stdout);
+  if (t != NULL_TERM || yices_error_code() != code || yices_error_report()->badval != badval) {
+    printf("BUG: unexpected result\n");
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+int main(void) {
+  term_vector_t v;
+  term_t x, y, a, b, t;
+  uint32_t i;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+  yices_init_term_vector(&v);
+
+  x = yices_new_uninterpreted_term(yices_int_type());
+  yices_set_term_name(x, "x");
+  y = yices_new_uninterpreted_term(yices_int_type());
+  yices_set_term_name(y, "y");
+  a = yices_new_uninterpreted_term(yices_bv_type(8));
+  yices_set_term_name(a, "a");
+  b = yices_new_uninterpreted_term(yices_bv_type(8));
+  yices_set_term_name(b, "b");
+
+  // (and (< (+ x y 3) 10) (not (= x y)))
+  int32_t arith[] = {
+    YICES_BATCH_TERM, 1, x,             // 0
+    YICES_BATCH_TERM, 1, y,             // 1
+    YICES_BATCH_INT32, 1, 3,            // 2
+    YICES_BATCH_ADD, 3, 0, 1, 2,        // 3
+    YICES_BATCH_INT32, 1, 10,           // 4
+    YICES_BATCH_ARITH_LT, 2, 3, 4,      // 5
+    YICES_BATCH_EQ, 2, 0, 1,            // 6
+    YICES_BATCH_NOT, 1, 6,              // 7
+    YICES_BATCH_AND, 2, 5, 7,           // 8
+  };
+  t = yices_and2(yices_arith_lt_atom(yices_add(yices_add(x, y), yices_int32(3)), yices_int32(10)),
+                 yices_not(yices_eq(x, y)));
+  check_term("arith", yices_build_terms(NUM_ELEMS(arith), arith, NULL), t);
+
+  // all nodes
+  check_term("arith with nodes", yices_build_terms(NUM_ELEMS(arith), arith, &v), t);
+  if (v.size != 9 || v.data[0] != x || v.data[1] != y || v.data[8] != t) {
+    printf("BUG: wrong node vector\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  // (bvult (bvadd (bvmul a b) (extract 7 0 (concat a b))) 0b00000101)
+  int32_t bv[] = {
+    YICES_BATCH_TERM, 1, a,             // 0
+    YICES_BATCH_TERM, 1, b,             // 1
+    YICES_BATCH_BVMUL, 2, 0, 1,         // 2
+    YICES_BATCH_BVCONCAT, 2, 0, 1,      // 3
+    YICES_BATCH_BVEXTRACT, 3, 3, 0, 7,  // 4
+    YICES_BATCH_BVADD, 2, 2, 4,         // 5
+    YICES_BATCH_BVCONST32, 2, 8, 5,     // 6
+    YICES_BATCH_BVLT, 2, 5, 6,          // 7
+  };
+  t = yices_bvlt_atom(yices_bvadd(yices_bvmul(a, b), yices_bvextract(yices_bvconcat2(a, b), 0, 7)),
+                      yices_bvconst_uint32(8, 5));
+  check_term("bv", yices_build_terms(NUM_ELEMS(bv), bv, NULL), t);
+
+  // ite + distinct
+  int32_t ite[] = {
+    YICES_BATCH_TERM, 1, x,             // 0
+    YICES_BATCH_TERM, 1, y,             // 1
+    YICES_BATCH_ARITH_GEQ, 2, 0, 1,     // 2
+    YICES_BATCH_ITE, 3, 2, 0, 1,        // 3
+    YICES_BATCH_INT32, 1, 0,            // 4
+    YICES_BATCH_DISTINCT, 3, 0, 3, 4,   // 5
+  };
+  t = yices_ite(yices_arith_geq_atom(x, y), x, y);
+  t = yices_distinct(3, (term_t []) { x, t, yices_zero() });
+  check_term("ite", yices_build_terms(NUM_ELEMS(ite), ite, NULL), t);
+
+  // malformed code
+  int32_t empty[] = { 0 };
+  check_error("empty", yices_build_terms(0, empty, NULL), INVALID_BATCH_CODE, 0);
+
+  int32_t bad_op[] = { YICES_BATCH_TERM, 1, x, 1000, 1, 0 };
+  check_error("bad opcode", yices_build_terms(NUM_ELEMS(bad_op), bad_op, NULL), INVALID_BATCH_CODE, 3);
+
+  int32_t bad_arity[] = { YICES_BATCH_TERM, 1, x, YICES_BATCH_NOT, 2, 0, 0 };
+  check_error("bad arity", yices_build_terms(NUM_ELEMS(bad_arity), bad_arity, NULL), INVALID_BATCH_CODE, 3);
+
+  int32_t forward[] = { YICES_BATCH_TERM, 1, x, YICES_BATCH_NEG, 1, 1 };
+  check_error("forward reference", yices_build_terms(NUM_ELEMS(forward), forward, NULL), INVALID_BATCH_CODE, 3);
+
+  int32_t truncated[] = { YICES_BATCH_TERM, 1, x, YICES_BATCH_ADD, 3, 0, 0 };
+  check_error("truncated", yices_build_terms(NUM_ELEMS(truncated), truncated, NULL), INVALID_BATCH_CODE, 3);
+
+  // type errors are reported by the term constructors
+  int32_t bad_leaf[] = { YICES_BATCH_TERM, 1, -2 };
+  check_error("bad leaf", yices_build_terms(NUM_ELEMS(bad_leaf), bad_leaf, &v), INVALID_TERM, 0);
+
+  int32_t bad_type[] = { YICES_BATCH_TERM, 1, x, YICES_BATCH_TERM, 1, a, YICES_BATCH_BVADD, 2, 0, 1 };
+  check_error("bad type", yices_build_terms(NUM_ELEMS(bad_type), bad_type, &v), BITVECTOR_REQUIRED, 2);
+  if (v.size != 0) {
+    printf("BUG: node vector not empty after an error\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  // the failing node is after some good nodes
+  int32_t late[] = {
+    YICES_BATCH_TERM, 1, x,             // 0
+    YICES_BATCH_TERM, 1, y,             // 1
+    YICES_BATCH_ADD, 2, 0, 1,           // 2
+    YICES_BATCH_TERM, 1, a,             // 3
+    YICES_BATCH_INT32, 1, 1,            // 4
+    YICES_BATCH_ARITH_LT, 2, 2, 4,      // 5
+    YICES_BATCH_ARITH_EQ, 2, 2, 3,      // 6: a is not arithmetic
+    YICES_BATCH_AND, 2, 5, 6,           // 7
+  };
+  check_error("late error", yices_build_terms(NUM_ELEMS(late), late, &v), ARITHTERM_REQUIRED, 6);
+  if (v.size != 0) {
+    printf("BUG: node vector not empty after an error\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  // a long chain: x + 0 + 1 + ... + 999
+  int32_t *chain = (int32_t *) malloc((3 + 7*1000) * sizeof(int32_t));
+  if (chain == NULL) {
+    printf("out of memory\n");
+    exit(1);
+  }
+  chain[0] = YICES_BATCH_TERM;
+  chain[1] = 1;
+  chain[2] = x;
+  t = x;
+  for (i=0; i<1000; i++) {
+    chain[3 + 7*i] = YICES_BATCH_INT32;
+    chain[4 + 7*i] = 1;
+    chain[5 + 7*i] = i;
+    chain[6 + 7*i] = YICES_BATCH_ADD;
+    chain[7 + 7*i] = 2;
+    chain[8 + 7*i] = 2*i;
+    chain[9 + 7*i] = 2*i + 1;
+    t = yices_add(t, yices_int32(i));
+  }
+  check_term("chain", yices_build_terms(3 + 7*1000, chain, &v), t);
+  printf("chain: %"PRIu32" nodes\n", v.size);
+  free(chain);
+
+  yices_delete_term_vector(&v);
+  yices_exit();
+
+  return 0;
+}
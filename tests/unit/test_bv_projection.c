@@ -0,0 +1,246 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "api/yices_globals.h"
+#include "model/bv_projection.h"
+#include "yices.h"
+
+#ifdef MINGW
+static inline long int random(void) {
+  return rand();
+}
+#endif
+
+
+/*
+ * All tests use 4-bit variables x, y, z and eliminate y.
+ * We check that the result R(x, z) is true in the model
+ * and that R(x, z) implies (EXISTS y: A(x, y, z)) by enumeration.
+ */
+#define NBITS 4
+#define NVALS 16
+
+static term_t x, y, z;
+static term_t cst[NVALS];
+
+static void init_terms(void) {
+  uint32_t i;
+
+  x = yices_new_uninterpreted_term(yices_bv_type(NBITS));
+  yices_set_term_name(x, "x");
+  y = yices_new_uninterpreted_term(yices_bv_type(NBITS));
+  yices_set_term_name(y, "y");
+  z = yices_new_uninterpreted_term(yices_bv_type(NBITS));
+  yices_set_term_name(z, "z");
+  for (i=0; i<NVALS; i++) {
+    cst[i] = yices_bvconst_uint32(NBITS, i);
+  }
+}
+
+static model_t *make_model(uint32_t vx, uint32_t vy, uint32_t vz) {
+  term_t var[3], val[3];
+
+  var[0] = x; val[0] = cst[vx];
+  var[1] = y; val[1] = cst[vy];
+  var[2] = z; val[2] = cst[vz];
+  return yices_model_from_map(3, var, val);
+}
+
+static bool holds(term_t f, uint32_t vx, uint32_t vy, uint32_t vz) {
+  model_t *mdl;
+  int32_t code;
+
+  mdl = make_model(vx, vy, vz);
+  code = yices_formula_true_in_model(mdl, f);
+  yices_free_model(mdl);
+  assert(code >= 0);
+
+  return code;
+}
+
+
+/*
+ * Random bound on y: a comparison between y and x, z, or a constant
+ */
+static term_t random_other(void) {
+  switch (random() % 3) {
+  case 0: return x;
+  case 1: return z;
+  default: return cst[random() % NVALS];
+  }
+}
+
+static term_t random_bound(bool is_signed) {
+  term_t t;
+
+  t = random_other();
+  switch (random() % 6) {
+  case 0: return is_signed ? yices_bvsge_atom(y, t) : yices_bvge_atom(y, t);
+  case 1: return is_signed ? yices_bvsgt_atom(y, t) : yices_bvgt_atom(y, t);
+  case 2: return is_signed ? yices_bvsle_atom(y, t) : yices_bvle_atom(y, t);
+  case 3: return is_signed ? yices_bvslt_atom(y, t) : yices_bvlt_atom(y, t);
+  case 4: return yices_bveq_atom(y, t);
+  default: return yices_bvneq_atom(y, t);
+  }
+}
+
+
+/*
+ * Build n random bounds that are true for some values of x, y, z
+ * then project y and check the result.
+ */
+static void test_random(uint32_t n, bool is_signed) {
+  bv_projector_t proj;
+  model_t *mdl;
+  ivector_t v;
+  term_t a[10], b[10], f, r;
+  uint32_t i, vx, vy, vz, tries;
+
+  assert(n <= 10);
+
+  // search for a satisfiable set of bounds
+  tries = 0;
+  for (;;) {
+    for (i=0; i<n; i++) {
+      a[i] = random_bound(is_signed);
+      b[i] = a[i];
+    }
+    f = yices_and(n, b); // this modifies b
+    vx = random() % NVALS;
+    vy = random() % NVALS;
+    vz = random() % NVALS;
+    if (holds(f, vx, vy, vz)) break;
+    tries ++;
+    if (tries > 1000) return;
+  }
+
+  printf("test: ");
+  yices_pp_term(stdout, f, 120, 10, 6);
+  printf("model: x = %"PRIu32", y = %"PRIu32", z = %"PRIu32"\n", vx, vy, vz);
+
+  mdl = make_model(vx, vy, vz);
+  init_bv_projector(&proj, mdl, __yices_globals.manager);
+  bvproj_add_var(&proj, y);
+  for (i=0; i<n; i++) {
+    bvproj_add_literal(&proj, a[i]);
+  }
+  if (bvproj_eliminate(&proj) < 0) {
+    printf("BUG: evaluation error\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  init_ivector(&v, 10);
+  bvproj_get_residual_vars(&proj, &v);
+  if (v.size > 0) {
+    printf("BUG: y not eliminated\n");
+    fflush(stdout);
+    exit(1);
+  }
+  bvproj_get_formula_vector(&proj, &v);
+  r = yices_and(v.size, v.data);
+  printf("result: ");
+  yices_pp_term(stdout, r, 120, 10, 8);
+  fflush(stdout);
+
+  if (!holds(r, vx, vy, vz)) {
+    printf("BUG: result is false in the model\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  // r(x, z) must imply EXISTS y: f(x, y, z)
+  for (vx=0; vx<NVALS; vx++) {
+    for (vz=0; vz<NVALS; vz++) {
+      if (holds(r, vx, 0, vz)) {
+        for (vy=0; vy<NVALS; vy++) {
+          if (holds(f, vx, vy, vz)) break;
+        }
+        if (vy == NVALS) {
+          printf("BUG: result does not imply the projection (x = %"PRIu32", z = %"PRIu32")\n", vx, vz);
+          fflush(stdout);
+          exit(1);
+        }
+      }
+    }
+  }
+
+  delete_ivector(&v);
+  delete_bv_projector(&proj);
+  yices_free_model(mdl);
+}
+
+
+/*
+ * y occurs in a non-bound literal: it can't be eliminated
+ */
+static void test_residue(void) {
+  bv_projector_t proj;
+  model_t *mdl;
+  ivector_t v;
+
+  mdl = make_model(1, 2, 3);
+  init_bv_projector(&proj, mdl, __yices_globals.manager);
+  bvproj_add_var(&proj, y);
+  bvproj_add_literal(&proj, yices_bvlt_atom(yices_bvadd(y, x), z));
+  bvproj_add_literal(&proj, yices_bvge_atom(y, x));
+  (void) bvproj_eliminate(&proj);
+
+  init_ivector(&v, 10);
+  bvproj_get_residual_vars(&proj, &v);
+  if (v.size != 1 || v.data[0] != y) {
+    printf("BUG: expected y as residual variable\n");
+    fflush(stdout);
+    exit(1);
+  }
+  ivector_reset(&v);
+  bvproj_get_formula_vector(&proj, &v);
+  if (v.size != 2) {
+    printf("BUG: literals should not change\n");
+    fflush(stdout);
+    exit(1);
+  }
+  printf("residue: ok\n\n");
+
+  delete_ivector(&v);
+  delete_bv_projector(&proj);
+  yices_free_model(mdl);
+}
+
+
+int main(void) {
+  uint32_t i;
+
+  yices_init();
+  init_terms();
+
+  test_residue();
+  for (i=0; i<100; i++) {
+    test_random(1 + (i % 5), (i & 1) != 0);
+  }
+
+  yices_exit();
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "yices.h"
+
+static term_t new_var(type_t tau, const char *name) {
+  term_t t = yices_new_uninterpreted_term(tau);
+  yices_set_term_name(t, name);
+  return t;
+}
+
+static const char *status2string(smt_status_t status) {
+  switch (status) {
+  case STATUS_IDLE: return "idle";
+  case STATUS_SEARCHING: return "searching";
+  case STATUS_UNKNOWN: return "unknown";
+  case STATUS_SAT: return "sat";
+  case STATUS_UNSAT: return "unsat";
+  case STATUS_INTERRUPTED: return "interrupted";
+  default: return "error";
+  }
+}
+
+static void check(context_t *ctx, const char *name, smt_status_t expected) {
+  smt_status_t status;
+
+  status = yices_check_context(ctx, NULL);
+  printf("check %s: %s\n", name, status2string(status));
+  fflush(stdout);
+  if (status != expected) {
+    printf("BUG: expected %s\n", status2string(expected));
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static void assert_formula(context_t *ctx, term_t f) {
+  if (yices_assert_formula(ctx, f) < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+int main(void) {
+  context_t *ctx, *clone, *clone2;
+  term_t x, y, f;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  x = new_var(yices_int_type(), "x");
+  y = new_var(yices_int_type(), "y");
+  f = new_var(yices_function_type1(yices_int_type(), yices_int_type()), "f");
+
+  // cloning requires the assertion log
+  ctx = yices_new_context(NULL);
+  assert_formula(ctx, yices_arith_gt_atom(x, yices_zero()));
+  clone = yices_clone_context(ctx);
+  if (clone != NULL || yices_error_code() != CTX_OPERATION_NOT_SUPPORTED) {
+    printf("BUG: clone without assertion log\n");
+    fflush(stdout);
+    exit(1);
+  }
+  yices_free_context(ctx);
+
+  ctx = yices_new_context(NULL);
+  yices_context_enable_option(ctx, "log-assertions");
+  assert_formula(ctx, yices_arith_gt_atom(x, yices_zero()));
+  assert_formula(ctx, yices_eq(yices_application1(f, x), y));
+  yices_push(ctx);
+  assert_formula(ctx, yices_arith_lt_atom(x, yices_int32(5)));
+  check(ctx, "ctx", STATUS_SAT);
+
+  // the clone has the same assertions and push level
+  clone = yices_clone_context(ctx);
+  if (clone == NULL) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+  printf("clone status: %s\n", status2string(yices_context_status(clone)));
+  check(clone, "clone", STATUS_SAT);
+
+  // x < 5 is still in the clone after pop in ctx
+  yices_pop(ctx);
+  assert_formula(ctx, yices_arith_gt_atom(x, yices_int32(10)));
+  check(ctx, "ctx after pop", STATUS_SAT);
+  assert_formula(clone, yices_arith_gt_atom(x, yices_int32(10)));
+  check(clone, "clone with x > 10", STATUS_UNSAT);
+
+  // pop in the clone removes x < 5
+  yices_pop(clone);
+  assert_formula(clone, yices_arith_gt_atom(x, yices_int32(10)));
+  check(clone, "clone after pop", STATUS_SAT);
+
+  // clone of an unsat context
+  assert_formula(ctx, yices_arith_lt_atom(x, yices_int32(3)));
+  check(ctx, "ctx with x < 3", STATUS_UNSAT);
+  clone2 = yices_clone_context(ctx);
+  check(clone2, "clone2", STATUS_UNSAT);
+
+  yices_free_context(clone2);
+  yices_free_context(clone);
+  yices_free_context(ctx);
+  yices_exit();
+
+  return 0;
+}
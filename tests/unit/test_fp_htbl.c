@@ -0,0 +1,302 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Test of the fingerprint hash tables against a reference set
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "utils/fingerprint_hash_tables.h"
+
+
+/*
+ * Objects are integers in [0, MAX_OBJ)
+ * - key[v] = hash code of object v
+ * - present[v] = true if v is in the table (reference set)
+ */
+#define MAX_OBJ 4000
+
+static uint32_t key[MAX_OBJ];
+static bool present[MAX_OBJ];
+static uint32_t num_present;
+
+typedef struct test_obj_s {
+  int_hobj_t m;
+  int32_t val;
+} test_obj_t;
+
+static uint32_t hash_obj(test_obj_t *o) {
+  return key[o->val];
+}
+
+static bool eq_obj(test_obj_t *o, int32_t v) {
+  return o->val == v;
+}
+
+static int32_t build_obj(test_obj_t *o) {
+  return o->val;
+}
+
+static test_obj_t obj = {
+  { (hobj_hash_t) hash_obj, (hobj_eq_t) eq_obj, (hobj_build_t) build_obj },
+  0,
+};
+
+
+static void fail(const char *msg) {
+  printf("BUG: %s\n", msg);
+  fflush(stdout);
+  exit(1);
+}
+
+
+/*
+ * Operations checked against the reference set
+ */
+static void add(fp_htbl_t *table, int32_t v) {
+  obj.val = v;
+  if (fp_htbl_find_obj(table, &obj.m) != (present[v] ? v : NULL_VALUE)) {
+    fail("find before add");
+  }
+  if (fp_htbl_get_obj(table, &obj.m) != v) {
+    fail("get_obj");
+  }
+  if (! present[v]) {
+    present[v] = true;
+    num_present ++;
+  }
+}
+
+static void erase(fp_htbl_t *table, int32_t v) {
+  fp_htbl_erase_record(table, key[v], v);
+  if (present[v]) {
+    present[v] = false;
+    num_present --;
+  }
+  obj.val = v;
+  if (fp_htbl_find_obj(table, &obj.m) != NULL_VALUE) {
+    fail("find after erase");
+  }
+}
+
+static void clear_reference(void) {
+  uint32_t i;
+
+  for (i=0; i<MAX_OBJ; i++) {
+    present[i] = false;
+  }
+  num_present = 0;
+}
+
+
+/*
+ * Full check: the table content must match the reference set
+ * and the counters must match the control bytes.
+ */
+static void check_table(fp_htbl_t *table) {
+  uint32_t i, nelems, ndeleted;
+  int32_t v;
+
+  nelems = 0;
+  ndeleted = 0;
+  for (i=0; i<table->size; i++) {
+    if (table->ctrl[i] == FP_DELETED) {
+      ndeleted ++;
+    } else if (table->ctrl[i] != FP_EMPTY) {
+      if (table->ctrl[i] & 0x80) fail("bad control byte");
+      v = table->records[i].value;
+      if (v < 0 || v >= MAX_OBJ || !present[v] || table->records[i].key != key[v] ||
+          table->ctrl[i] != (uint8_t) (key[v] >> 25)) {
+        fail("bad record");
+      }
+      nelems ++;
+    }
+  }
+  if (nelems != table->nelems || nelems != num_present || ndeleted != table->ndeleted) {
+    fail("bad counters");
+  }
+  if (nelems + ndeleted > table->resize_threshold) {
+    fail("above the resize threshold");
+  }
+
+  for (i=0; i<MAX_OBJ; i++) {
+    obj.val = i;
+    if (fp_htbl_find_obj(table, &obj.m) != (present[i] ? (int32_t) i : NULL_VALUE)) {
+      fail("find_obj doesn't match the reference set");
+    }
+  }
+}
+
+
+/*
+ * Keys with home group g (for a table of size 64 = 4 groups).
+ * Bit 25 and above vary with j so that some fingerprints are equal
+ * and some aren't.
+ */
+static uint32_t group_key(uint32_t g, uint32_t j) {
+  return ((j % 3) << 25) | (j << 8) | g;
+}
+
+
+/*
+ * Tombstones and resizing in a table of size 64 (threshold = 56)
+ */
+static void test_thresholds(void) {
+  fp_htbl_t table;
+  uint32_t i;
+
+  printf("thresholds\n");
+  clear_reference();
+  init_fp_htbl(&table, 64);
+  if (table.size != 64 || table.resize_threshold != 56) fail("initial size");
+
+  // fill groups 0, 1, 2 and half of group 3: 56 elements
+  for (i=0; i<56; i++) {
+    key[i] = group_key(i/16, i);
+    add(&table, i);
+  }
+  check_table(&table);
+  if (table.size != 64) fail("resized too early");
+
+  // erase 14 elements in each full group: they become tombstones
+  for (i=0; i<48; i++) {
+    if (i % 16 >= 2) erase(&table, i);
+  }
+  check_table(&table);
+  if (table.nelems != 14 || table.ndeleted != 42) fail("tombstones");
+
+  // one more element: rebuild in place (more tombstones than elements)
+  key[100] = group_key(3, 100);
+  add(&table, 100);
+  check_table(&table);
+  if (table.size != 64 || table.ndeleted != 0 || table.nelems != 15) fail("rebuild in place");
+
+  // erasing from a group with an empty slot doesn't leave a tombstone
+  erase(&table, 0);
+  check_table(&table);
+  if (table.ndeleted != 0) fail("unexpected tombstone");
+
+  // back to exactly 56 elements then one more: the table grows
+  for (i=200; num_present < 56; i++) {
+    key[i] = group_key(i % 4, i);
+    add(&table, i);
+  }
+  check_table(&table);
+  if (table.size != 64) fail("resized too early");
+  key[300] = group_key(0, 300);
+  add(&table, 300);
+  check_table(&table);
+  if (table.size != 128 || table.resize_threshold != 112) fail("growth");
+
+  // erase to empty
+  for (i=0; i<MAX_OBJ; i++) {
+    if (present[i]) erase(&table, i);
+  }
+  check_table(&table);
+  if (table.nelems != 0) fail("not empty");
+
+  delete_fp_htbl(&table);
+}
+
+
+/*
+ * Overflow: more elements with the same home group than a group can hold,
+ * some with the same key.
+ */
+static void test_overflow(void) {
+  fp_htbl_t table;
+  uint32_t i;
+
+  printf("overflow\n");
+  clear_reference();
+  init_fp_htbl(&table, 64);
+  for (i=0; i<40; i++) {
+    key[i] = group_key(1, i % 20);
+    add(&table, i);
+  }
+  check_table(&table);
+
+  // erase the first elements: the others are still found past the tombstones
+  for (i=0; i<16; i++) {
+    erase(&table, i);
+    check_table(&table);
+  }
+  for (i=0; i<16; i++) {
+    add(&table, i);
+  }
+  check_table(&table);
+
+  reset_fp_htbl(&table);
+  clear_reference();
+  check_table(&table);
+
+  delete_fp_htbl(&table);
+}
+
+
+/*
+ * Random operations
+ * - if collisions is true, keys are drawn from a small set
+ */
+static void test_random(uint32_t n, bool collisions) {
+  fp_htbl_t table;
+  uint32_t i, max_size;
+  int32_t v;
+
+  printf("random: %"PRIu32" operations%s\n", n, collisions ? ", many collisions" : "");
+  clear_reference();
+  for (i=0; i<MAX_OBJ; i++) {
+    key[i] = collisions ? ((uint32_t) random() % 64) * 0x9E3779B1u : (uint32_t) random() ^ ((uint32_t) random() << 16);
+  }
+
+  init_fp_htbl(&table, 0);
+  max_size = 0;
+  for (i=0; i<n; i++) {
+    v = (int32_t) (random() % MAX_OBJ);
+    if (random() % 3 == 0) {
+      erase(&table, v);
+    } else {
+      add(&table, v);
+    }
+    if (table.size > max_size) max_size = table.size;
+    if (i % 1000 == 0) check_table(&table);
+  }
+  check_table(&table);
+  printf("  %"PRIu32" elements, size = %"PRIu32", max size = %"PRIu32"\n", table.nelems, table.size, max_size);
+
+  for (i=0; i<MAX_OBJ; i++) {
+    if (present[i]) erase(&table, i);
+  }
+  check_table(&table);
+
+  delete_fp_htbl(&table);
+}
+
+
+int main(void) {
+  test_thresholds();
+  test_overflow();
+  test_random(50000, false);
+  test_random(50000, true);
+  printf("all tests passed\n");
+  return 0;
+}
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "yices.h"
+
+#define N 200
+
+static void check(bool cond, const char *msg) {
+  if (!cond) {
+    printf("BUG: %s\n", msg);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static int32_t int_value(model_t *mdl, const yval_t *v) {
+  int32_t x;
+
+  check(v->node_tag == YVAL_RATIONAL, "rational value expected");
+  check(yices_val_get_int32(mdl, v, &x) == 0, "yices_val_get_int32");
+  return x;
+}
+
+int main(void) {
+  context_t *ctx;
+  model_t *mdl;
+  term_t x, y, s, a[N], b[N];
+  yval_t val[N], v;
+  int32_t i, k;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  x = yices_new_uninterpreted_term(yices_int_type());
+  y = yices_new_uninterpreted_term(yices_int_type());
+  ctx = yices_new_context(NULL);
+  yices_assert_formula(ctx, yices_arith_eq_atom(x, yices_int32(3)));
+  yices_assert_formula(ctx, yices_arith_eq_atom(y, yices_int32(5)));
+  check(yices_check_context(ctx, NULL) == STATUS_SAT, "context should be sat");
+  mdl = yices_get_model(ctx, true);
+  check(mdl != NULL, "no model");
+
+  // a[i] = s + i where s = x * y is shared by all terms
+  s = yices_mul(x, y);
+  for (i=0; i<N; i++) {
+    a[i] = yices_add(s, yices_int32(i));
+  }
+
+  check(yices_get_values(mdl, N, a, val) == 0, "yices_get_values failed");
+  for (i=0; i<N; i++) {
+    check(int_value(mdl, val + i) == 15 + i, "wrong value");
+  }
+
+  // the cached values agree with single queries
+  for (i=0; i<N; i++) {
+    check(yices_get_value(mdl, a[i], &v) == 0, "yices_get_value failed");
+    check(v.node_id == val[i].node_id, "different node for the same term");
+    check(yices_get_int32_value(mdl, a[i], &k) == 0 && k == 15 + i, "wrong int32 value");
+  }
+  check(yices_term_array_value(mdl, N, a, b) == 0, "yices_term_array_value failed");
+  for (i=0; i<N; i++) {
+    check(b[i] == yices_int32(15 + i), "wrong constant term");
+  }
+  printf("values: ok\n");
+
+  // empty array
+  check(yices_get_values(mdl, 0, a, val) == 0, "empty array");
+
+  // bad term
+  a[3] = -10;
+  check(yices_get_values(mdl, N, a, val) < 0 && yices_error_code() == INVALID_TERM, "invalid term not detected");
+  printf("invalid term: ");
+  yices_print_error(stdout);
+
+  // free variable
+  a[3] = yices_add(s, yices_new_variable(yices_int_type()));
+  check(yices_get_values(mdl, N, a, val) < 0 && yices_error_code() == EVAL_FREEVAR_IN_TERM, "free variable not detected");
+  printf("free variable: ");
+  yices_print_error(stdout);
+
+  // the cache does not survive garbage collection
+  a[3] = yices_add(s, yices_int32(3));
+  yices_garbage_collect(a, N, NULL, 0, true);
+  check(yices_get_values(mdl, N, a, val) == 0, "yices_get_values failed after gc");
+  for (i=0; i<N; i++) {
+    check(int_value(mdl, val + i) == 15 + i, "wrong value after gc");
+  }
+  printf("after gc: ok\n");
+  fflush(stdout);
+
+  yices_free_model(mdl);
+  yices_free_context(ctx);
+  yices_exit();
+
+  return 0;
+}
@@ -0,0 +1,214 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "yices.h"
+
+/*
+ * Symmetry breaking in a push/pop context: pigeon-hole formulas
+ * with N holes and N+1 pigeons of an uninterpreted sort.
+ */
+#define N 8
+
+static term_t hole[N];
+static term_t pigeon[N+1];
+
+static const char *status2string(smt_status_t status) {
+  switch (status) {
+  case STATUS_IDLE: return "idle";
+  case STATUS_SEARCHING: return "searching";
+  case STATUS_UNKNOWN: return "unknown";
+  case STATUS_SAT: return "sat";
+  case STATUS_UNSAT: return "unsat";
+  case STATUS_INTERRUPTED: return "interrupted";
+  default: return "error";
+  }
+}
+
+static void check(context_t *ctx, const char *name, smt_status_t expected) {
+  smt_status_t status;
+
+  status = yices_check_context(ctx, NULL);
+  printf("check %s: %s\n", name, status2string(status));
+  fflush(stdout);
+  if (status != expected) {
+    printf("BUG: expected %s\n", status2string(expected));
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static void assert_formula(context_t *ctx, term_t f) {
+  if (yices_assert_formula(ctx, f) < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+// check that f is true in the current model of ctx
+static void check_model(context_t *ctx, term_t f) {
+  model_t *mdl;
+
+  mdl = yices_get_model(ctx, true);
+  if (mdl == NULL || yices_formula_true_in_model(mdl, f) != 1) {
+    printf("BUG: formula false in the model\n");
+    fflush(stdout);
+    exit(1);
+  }
+  yices_free_model(mdl);
+}
+
+/*
+ * Assert the holes are distinct and every pigeon is in a hole
+ * - if all_distinct is true, also assert that the pigeons are distinct
+ * - all assertions are added in one call
+ */
+static void assert_pigeon_hole(context_t *ctx, bool all_distinct) {
+  term_t a[N+3];
+  term_t eq[N];
+  uint32_t i, j, n;
+
+  n = 0;
+  a[n++] = yices_distinct(N, hole);
+  for (i=0; i<=N; i++) {
+    for (j=0; j<N; j++) {
+      eq[j] = yices_eq(pigeon[i], hole[j]);
+    }
+    a[n++] = yices_or(N, eq);
+  }
+  if (all_distinct) {
+    a[n++] = yices_distinct(N+1, pigeon);
+  }
+
+  if (yices_assert_formulas(ctx, n, a) < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static context_t *new_context(void) {
+  ctx_config_t *config;
+  context_t *ctx;
+
+  config = yices_new_config();
+  yices_default_config_for_logic(config, "QF_UF");
+  yices_set_config(config, "mode", "push-pop");
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+  if (ctx == NULL || yices_context_enable_option(ctx, "break-symmetries") < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+
+  return ctx;
+}
+
+int main(void) {
+  context_t *ctx;
+  term_vector_t core;
+  type_t tau;
+  term_t f;
+  uint32_t i;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  tau = yices_new_uninterpreted_type();
+  for (i=0; i<N; i++) {
+    hole[i] = yices_new_uninterpreted_term(tau);
+  }
+  for (i=0; i<=N; i++) {
+    pigeon[i] = yices_new_uninterpreted_term(tau);
+  }
+
+  ctx = new_context();
+
+  yices_push(ctx);
+  assert_pigeon_hole(ctx, true);
+  check(ctx, "pigeon-hole", STATUS_UNSAT);
+
+  // no assumptions: the core must be empty
+  yices_init_term_vector(&core);
+  if (yices_get_unsat_core(ctx, &core) < 0 || core.size != 0) {
+    printf("BUG: expected an empty unsat core\n");
+    fflush(stdout);
+    exit(1);
+  }
+  yices_delete_term_vector(&core);
+
+  yices_pop(ctx);
+  check(ctx, "empty", STATUS_SAT);
+
+  assert_pigeon_hole(ctx, false);
+  check(ctx, "no distinct", STATUS_SAT);
+
+  // this is not invariant by permutation of the holes
+  yices_push(ctx);
+  f = yices_and2(yices_eq(pigeon[0], hole[N-1]), yices_eq(pigeon[1], hole[N-1]));
+  assert_formula(ctx, f);
+  check(ctx, "two pigeons in the last hole", STATUS_SAT);
+  check_model(ctx, f);
+  yices_pop(ctx);
+
+  // this is invariant
+  yices_push(ctx);
+  assert_formula(ctx, yices_distinct(N+1, pigeon));
+  check(ctx, "distinct pigeons", STATUS_UNSAT);
+  yices_pop(ctx);
+
+  f = yices_eq(pigeon[2], hole[N-1]);
+  assert_formula(ctx, f);
+  check(ctx, "third pigeon in the last hole", STATUS_SAT);
+  check_model(ctx, f);
+
+  f = yices_eq(pigeon[3], hole[N-2]);
+  assert_formula(ctx, f);
+  check(ctx, "fourth pigeon in the next to last hole", STATUS_SAT);
+  check_model(ctx, f);
+
+  yices_free_context(ctx);
+
+  // the guards must be retired after the option is disabled
+  ctx = new_context();
+  assert_pigeon_hole(ctx, false);
+  check(ctx, "no distinct", STATUS_SAT);
+  yices_context_disable_option(ctx, "break-symmetries");
+  f = yices_and2(yices_eq(pigeon[0], hole[N-1]), yices_eq(pigeon[1], hole[N-1]));
+  assert_formula(ctx, f);
+  check(ctx, "two pigeons in the last hole, no symmetry breaking", STATUS_SAT);
+  check_model(ctx, f);
+
+  yices_free_context(ctx);
+
+  // guards created or retired in a popped scope
+  ctx = new_context();
+  yices_push(ctx);
+  assert_pigeon_hole(ctx, false);
+  check(ctx, "no distinct in a scope", STATUS_SAT);
+  yices_pop(ctx);
+
+  assert_pigeon_hole(ctx, false);
+  check(ctx, "no distinct", STATUS_SAT);
+  yices_push(ctx);
+  yices_context_disable_option(ctx, "break-symmetries");
+  f = yices_and2(yices_eq(pigeon[0], hole[N-1]), yices_eq(pigeon[1], hole[N-1]));
+  assert_formula(ctx, f);
+  check(ctx, "two pigeons in the last hole in a scope", STATUS_SAT);
+  check_model(ctx, f);
+  yices_pop(ctx);
+
+  // the pop restores the guard: it must be retired again
+  check(ctx, "after pop", STATUS_SAT);
+  assert_formula(ctx, f);
+  check(ctx, "two pigeons in the last hole after pop", STATUS_SAT);
+  check_model(ctx, f);
+
+  yices_free_context(ctx);
+  yices_exit();
+
+  return 0;
+}
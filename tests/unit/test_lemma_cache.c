@@ -0,0 +1,313 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "yices.h"
+
+/*
+ * Lemma cache shared between contexts: pigeon-hole formulas
+ * with N holes and N+1 pigeons over the integers.
+ */
+#define N 6
+
+static const char *status2string(smt_status_t status) {
+  switch (status) {
+  case STATUS_IDLE: return "idle";
+  case STATUS_SEARCHING: return "searching";
+  case STATUS_UNKNOWN: return "unknown";
+  case STATUS_SAT: return "sat";
+  case STATUS_UNSAT: return "unsat";
+  case STATUS_INTERRUPTED: return "interrupted";
+  default: return "error";
+  }
+}
+
+static void check(context_t *ctx, const char *name, smt_status_t expected) {
+  smt_status_t status;
+
+  status = yices_check_context(ctx, NULL);
+  printf("check %s: %s (cache size = %"PRIu32")\n", name, status2string(status), yices_lemma_cache_size());
+  fflush(stdout);
+  if (status != expected) {
+    printf("BUG: expected %s\n", status2string(expected));
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static void assert_formulas(context_t *ctx, uint32_t n, term_t *a) {
+  if (yices_assert_formulas(ctx, n, a) < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static context_t *new_logic_context(const char *logic, const char *mode) {
+  ctx_config_t *config;
+  context_t *ctx;
+
+  config = yices_new_config();
+  yices_default_config_for_logic(config, logic);
+  yices_set_config(config, "mode", mode);
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+  if (ctx == NULL || yices_context_enable_option(ctx, "lemma-cache") < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+
+  return ctx;
+}
+
+static context_t *new_context(const char *mode) {
+  return new_logic_context("QF_LIA", mode);
+}
+
+/*
+ * Variables x[0 ... n-1] are in the range [1, hi] and distinct
+ * - the disequalities are written as (x[i] < x[j] or x[i] > x[j])
+ *   so that the atoms used in the lemmas are terms
+ */
+static void assert_pigeon_hole(context_t *ctx, term_t *x, uint32_t n, int32_t hi) {
+  term_t a[2*(N+1)];
+  term_t f;
+  uint32_t i, j, k;
+
+  k = 0;
+  for (i=0; i<n; i++) {
+    a[k++] = yices_arith_geq_atom(x[i], yices_int32(1));
+    a[k++] = yices_arith_leq_atom(x[i], yices_int32(hi));
+  }
+  assert_formulas(ctx, k, a);
+
+  for (i=0; i<n; i++) {
+    for (j=i+1; j<n; j++) {
+      f = yices_or2(yices_arith_lt_atom(x[i], x[j]), yices_arith_gt_atom(x[i], x[j]));
+      assert_formulas(ctx, 1, &f);
+    }
+  }
+}
+
+// check that f is true in the current model of ctx
+static void check_model(context_t *ctx, term_t f) {
+  model_t *mdl;
+
+  mdl = yices_get_model(ctx, true);
+  if (mdl == NULL || yices_formula_true_in_model(mdl, f) != 1) {
+    printf("BUG: formula false in the model\n");
+    fflush(stdout);
+    exit(1);
+  }
+  yices_free_model(mdl);
+}
+
+static void save_and_reset(const char *filename) {
+  if (yices_save_lemma_cache(filename) < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+  yices_reset_lemma_cache();
+  if (yices_lemma_cache_size() != 0) {
+    printf("BUG: reset failed\n");
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static int32_t load(const char *filename) {
+  int32_t code;
+
+  code = yices_load_lemma_cache(filename);
+  remove(filename);
+  if (code < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+  // the loaded clauses are not in the cache until they are checked
+  if (yices_lemma_cache_size() != 0) {
+    printf("BUG: loaded clauses were not checked\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  return code;
+}
+
+int main(void) {
+  char filename[64];
+  context_t *ctx;
+  term_t x[N+1];
+  term_t y[N+1];
+  term_t a[2];
+  term_t f;
+  type_t tau;
+  uint32_t i, n;
+  int32_t code;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  for (i=0; i<=N; i++) {
+    x[i] = yices_new_uninterpreted_term(yices_int_type());
+  }
+
+  // the option is not supported by MCSAT
+  {
+    ctx_config_t *config;
+
+    config = yices_new_config();
+    yices_set_config(config, "solver-type", "mcsat");
+    ctx = yices_new_context(config);
+    yices_free_config(config);
+    if (ctx != NULL) {
+      if (yices_context_enable_option(ctx, "lemma-cache") >= 0 ||
+          yices_error_code() != CTX_OPERATION_NOT_SUPPORTED) {
+        printf("BUG: lemma-cache accepted by MCSAT\n");
+        fflush(stdout);
+        exit(1);
+      }
+      yices_free_context(ctx);
+    }
+  }
+
+  // first context: fills the cache
+  ctx = new_context("one-shot");
+  assert_pigeon_hole(ctx, x, N+1, N);
+  check(ctx, "pigeon-hole", STATUS_UNSAT);
+  yices_free_context(ctx);
+
+  n = yices_lemma_cache_size();
+  if (n == 0) {
+    printf("BUG: empty lemma cache\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  // second context: same formula, uses the cached lemmas
+  ctx = new_context("one-shot");
+  assert_pigeon_hole(ctx, x, N+1, N);
+  check(ctx, "pigeon-hole again", STATUS_UNSAT);
+  yices_free_context(ctx);
+
+  // the cached lemmas must not make satisfiable problems unsat
+  ctx = new_context("push-pop");
+  assert_pigeon_hole(ctx, x, N, N);
+  check(ctx, "holes", STATUS_SAT);
+  yices_push(ctx);
+  f = yices_arith_eq_atom(x[0], yices_int32(N));
+  assert_formulas(ctx, 1, &f);
+  check(ctx, "first pigeon in the last hole", STATUS_SAT);
+  check_model(ctx, f);
+  yices_pop(ctx);
+  yices_push(ctx);
+  f = yices_arith_eq_atom(x[1], x[0]);
+  assert_formulas(ctx, 1, &f);
+  check(ctx, "two pigeons in the same hole", STATUS_UNSAT);
+  yices_pop(ctx);
+  check(ctx, "holes after pop", STATUS_SAT);
+  yices_free_context(ctx);
+
+  // garbage collection must keep the cached terms
+  yices_garbage_collect(x, N+1, NULL, 0, false);
+
+  // save, reset, and reload
+  snprintf(filename, sizeof(filename), "/tmp/test_lemma_cache_%d.ys", (int) getpid());
+  n = yices_lemma_cache_size();
+  save_and_reset(filename);
+  code = load(filename);
+  printf("reloaded %"PRId32" lemmas (saved %"PRIu32")\n", code, n);
+  if (code != (int32_t) n) {
+    printf("BUG: wrong number of clauses after reload\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  ctx = new_context("one-shot");
+  assert_pigeon_hole(ctx, x, N+1, N);
+  check(ctx, "pigeon-hole after reload", STATUS_UNSAT);
+  yices_free_context(ctx);
+  if (yices_lemma_cache_size() == 0) {
+    printf("BUG: reloaded clauses not added\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  // a clause that's not valid must not be imported
+  // (the archive format is a sequence of clauses terminated by true)
+  a[0] = yices_arith_geq_atom(x[0], yices_int32(5));
+  a[1] = yices_true();
+  if (yices_save_terms(filename, 2, a) < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+  yices_reset_lemma_cache();
+  code = load(filename);
+  if (code != 1) {
+    printf("BUG: the forged clause was not loaded\n");
+    fflush(stdout);
+    exit(1);
+  }
+  ctx = new_context("one-shot");
+  f = yices_arith_eq_atom(x[0], yices_int32(1));
+  assert_formulas(ctx, 1, &f);
+  check(ctx, "after loading an invalid clause", STATUS_SAT);
+  check_model(ctx, f);
+  yices_free_context(ctx);
+
+  // same thing with the egraph: pigeons are (g y[i])
+  yices_reset_lemma_cache();
+  tau = yices_function_type1(yices_int_type(), yices_int_type());
+  f = yices_new_uninterpreted_term(tau);
+  for (i=0; i<=N; i++) {
+    y[i] = yices_application1(f, x[i]);
+  }
+  ctx = new_logic_context("QF_UFLIA", "one-shot");
+  assert_pigeon_hole(ctx, y, N+1, N);
+  check(ctx, "pigeon-hole with UF", STATUS_UNSAT);
+  yices_free_context(ctx);
+
+  ctx = new_logic_context("QF_UFLIA", "push-pop");
+  assert_pigeon_hole(ctx, y, N, N);
+  check(ctx, "holes with UF", STATUS_SAT);
+  yices_push(ctx);
+  f = yices_arith_eq_atom(x[1], x[0]);
+  assert_formulas(ctx, 1, &f);
+  check(ctx, "two equal arguments", STATUS_UNSAT);
+  yices_pop(ctx);
+  yices_push(ctx);
+  f = yices_arith_eq_atom(y[0], yices_int32(N));
+  assert_formulas(ctx, 1, &f);
+  check(ctx, "first UF pigeon in the last hole", STATUS_SAT);
+  check_model(ctx, f);
+  yices_pop(ctx);
+  yices_free_context(ctx);
+
+  ctx = new_logic_context("QF_UFLIA", "one-shot");
+  assert_pigeon_hole(ctx, y, N+1, N);
+  check(ctx, "pigeon-hole with UF again", STATUS_UNSAT);
+  yices_free_context(ctx);
+
+  // with a zero memory limit, nothing is added
+  yices_reset_lemma_cache();
+  yices_set_lemma_cache_limit(0);
+  ctx = new_context("one-shot");
+  assert_pigeon_hole(ctx, x, N+1, N);
+  check(ctx, "pigeon-hole without memory", STATUS_UNSAT);
+  yices_free_context(ctx);
+  if (yices_lemma_cache_size() != 0) {
+    printf("BUG: memory limit ignored\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  yices_exit();
+
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "yices.h"
+
+#define NVARS 100000
+
+static const char *status2string(smt_status_t status) {
+  switch (status) {
+  case STATUS_IDLE: return "idle";
+  case STATUS_SEARCHING: return "searching";
+  case STATUS_UNKNOWN: return "unknown";
+  case STATUS_SAT: return "sat";
+  case STATUS_UNSAT: return "unsat";
+  case STATUS_INTERRUPTED: return "interrupted";
+  default: return "error";
+  }
+}
+
+static void check(context_t *ctx, param_t *params, smt_status_t expected, int32_t memout) {
+  smt_status_t status;
+
+  status = yices_check_context(ctx, params);
+  printf("check: %s (memout = %"PRId32")\n", status2string(status), yices_context_memout(ctx));
+  fflush(stdout);
+  if (status != expected) {
+    printf("BUG: expected %s\n", status2string(expected));
+    fflush(stdout);
+    exit(1);
+  }
+  if (yices_context_memout(ctx) != memout) {
+    printf("BUG: expected memout = %"PRId32"\n", memout);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static void set_param(param_t *params, const char *name, const char *value) {
+  if (yices_set_param(params, name, value) < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+int main(void) {
+  ctx_config_t *config;
+  context_t *ctx;
+  param_t *params;
+  term_t *x;
+  uint32_t i;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  // interactive mode so that the context is cleaned up after an interruption
+  config = yices_new_config();
+  yices_set_config(config, "mode", "interactive");
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+
+  // a large chain of binary clauses: the core needs more than 1MB for the variables
+  x = (term_t *) malloc(NVARS * sizeof(term_t));
+  if (x == NULL) {
+    printf("out of memory\n");
+    exit(1);
+  }
+  for (i=0; i<NVARS; i++) {
+    x[i] = yices_new_uninterpreted_term(yices_bool_type());
+  }
+  for (i=0; i+1<NVARS; i++) {
+    yices_assert_formula(ctx, yices_or2(x[i], yices_not(x[i+1])));
+  }
+
+  params = yices_new_param_record();
+  yices_default_params_for_context(ctx, params);
+
+  // deleting learned clauses can't help: the search must stop
+  set_param(params, "memory-limit", "1");
+  check(ctx, params, STATUS_INTERRUPTED, 1);
+  printf("status after cleanup: %s\n", status2string(yices_context_status(ctx)));
+
+  // bad values
+  if (yices_set_param(params, "memory-limit", "-1") >= 0) {
+    printf("BUG: negative memory-limit accepted\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  // no limit: the search completes and the flag is cleared
+  set_param(params, "memory-limit", "0");
+  check(ctx, params, STATUS_SAT, 0);
+
+  // a large enough budget
+  yices_reset_context(ctx);
+  yices_assert_formula(ctx, yices_or2(x[0], x[1]));
+  set_param(params, "memory-limit", "1000");
+  check(ctx, params, STATUS_SAT, 0);
+
+  yices_free_param_record(params);
+  yices_free_context(ctx);
+  free(x);
+  yices_exit();
+
+  return 0;
+}
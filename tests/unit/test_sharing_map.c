@@ -0,0 +1,223 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST: the parallel sharing analysis must give the same map as
+ * the sequential one.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "api/yices_globals.h"
+#include "context/internalization_table.h"
+#include "context/shared_terms.h"
+#include "utils/int_vectors.h"
+
+#include "yices.h"
+
+#ifdef MINGW
+static inline long int random(void) {
+  return rand();
+}
+#endif
+
+
+#define NVARS 40
+#define NBOOLS 20
+#define NPOOL 200
+
+static term_t x[NVARS];
+static term_t b[NBOOLS];
+static term_t pool[NPOOL];
+
+static term_t random_var(void) {
+  return x[random() % NVARS];
+}
+
+static term_t random_bool(void) {
+  term_t t;
+
+  t = b[random() % NBOOLS];
+  return (random() % 2) ? t : yices_not(t);
+}
+
+
+/*
+ * Pool of arithmetic subterms shared by many assertions:
+ * if-then-elses and sums
+ */
+static void build_pool(void) {
+  uint32_t i;
+  term_t t;
+
+  for (i=0; i<NPOOL; i++) {
+    switch (i % 3) {
+    case 0:
+      t = yices_ite(random_bool(), random_var(), yices_add(random_var(), yices_int32(i)));
+      break;
+    case 1:
+      t = yices_add(random_var(), random_var());
+      break;
+    default:
+      t = yices_ite(yices_arith_lt_atom(random_var(), random_var()), random_var(), yices_int32(i));
+      break;
+    }
+    pool[i] = t;
+  }
+}
+
+static term_t random_arith(void) {
+  switch (random() % 3) {
+  case 0:
+    return random_var();
+  case 1:
+    return pool[random() % NPOOL];
+  default:
+    return yices_add(pool[random() % NPOOL], random_var());
+  }
+}
+
+static term_t random_assertion(void) {
+  term_t a[3];
+
+  a[0] = yices_arith_leq_atom(random_arith(), random_arith());
+  a[1] = random_bool();
+  a[2] = yices_ite(random_bool(), yices_arith_eq_atom(random_arith(), random_arith()), random_bool());
+  switch (random() % 4) {
+  case 0:
+    return a[0];
+  case 1:
+    return yices_or(3, a);
+  case 2:
+    return yices_and(2, a);
+  default:
+    return yices_ite(a[1], a[0], a[2]);
+  }
+}
+
+
+/*
+ * Check that map1 and map2 are equal
+ */
+static void compare_maps(sharing_map_t *map1, sharing_map_t *map2) {
+  int_hmap_pair_t *r, *s;
+
+  if (map1->hmap.nelems != map2->hmap.nelems) {
+    printf("BUG: the maps have different sizes (%"PRIu32" and %"PRIu32")\n",
+           map1->hmap.nelems, map2->hmap.nelems);
+    exit(1);
+  }
+  for (r = int_hmap_first_record(&map1->hmap); r != NULL; r = int_hmap_next_record(&map1->hmap, r)) {
+    s = int_hmap_find(&map2->hmap, r->key);
+    if (s == NULL || s->val != r->val) {
+      printf("BUG: different parents for term %"PRId32"\n", r->key);
+      exit(1);
+    }
+  }
+}
+
+
+/*
+ * Compute the map of a[0 ... n-1] sequentially and with num_threads threads
+ */
+static void test_sharing(intern_tbl_t *intern, term_t *a, uint32_t n, uint32_t num_threads) {
+  sharing_map_t seq, par;
+  uint32_t nshared;
+  int_hmap_pair_t *r;
+
+  printf("test: %"PRIu32" assertions, %"PRIu32" threads: ", n, num_threads);
+  fflush(stdout);
+
+  init_sharing_map(&seq, intern);
+  init_sharing_map(&par, intern);
+  sharing_map_add_terms(&seq, a, n);
+  sharing_map_add_terms_mt(&par, a, n, num_threads);
+  compare_maps(&seq, &par);
+
+  nshared = 0;
+  for (r = int_hmap_first_record(&seq.hmap); r != NULL; r = int_hmap_next_record(&seq.hmap, r)) {
+    if (r->val == bool_const) nshared ++;
+  }
+  printf("%"PRIu32" terms, %"PRIu32" shared\n", seq.hmap.nelems, nshared);
+
+  delete_sharing_map(&seq);
+  delete_sharing_map(&par);
+}
+
+
+int main(void) {
+  intern_tbl_t intern;
+  ivector_t v;
+  term_t r, t;
+  uint32_t i;
+
+  yices_init();
+
+  for (i=0; i<NVARS; i++) {
+    x[i] = yices_new_uninterpreted_term(yices_int_type());
+  }
+  for (i=0; i<NBOOLS; i++) {
+    b[i] = yices_new_uninterpreted_term(yices_bool_type());
+  }
+
+  init_intern_tbl(&intern, 0, __yices_globals.terms);
+
+  /*
+   * Substitutions: x[0], x[2], and x[4] are replaced by (x[1] + 1).
+   * The sequential analysis compresses the paths to the root, the
+   * parallel one doesn't. x[3] is mapped: it's not explored.
+   */
+  intern_tbl_merge_classes(&intern, x[0], x[2]);
+  intern_tbl_merge_classes(&intern, intern_tbl_get_root(&intern, x[2]), x[4]);
+  r = intern_tbl_get_root(&intern, x[0]);
+  t = yices_add(x[1], yices_int32(1));
+  intern_tbl_add_subst(&intern, r, t);
+  intern_tbl_map_root(&intern, x[3], 0);
+
+  build_pool();
+  init_ivector(&v, 0);
+  for (i=0; i<6000; i++) {
+    ivector_push(&v, random_assertion());
+  }
+  // some assertions occur twice and some are subterms of others
+  for (i=0; i<500; i++) {
+    ivector_push(&v, v.data[random() % v.size]);
+  }
+  for (i=0; i<NBOOLS; i += 2) {
+    ivector_push(&v, b[i]);
+  }
+  for (i=0; i<100; i++) {
+    ivector_push(&v, yices_arith_geq0_atom(pool[i]));
+  }
+
+  test_sharing(&intern, v.data, 500, 4);
+  test_sharing(&intern, v.data, 2000, 2);
+  test_sharing(&intern, v.data, v.size, 3);
+  test_sharing(&intern, v.data, v.size, 4);
+  test_sharing(&intern, v.data, v.size, 16);
+
+  delete_ivector(&v);
+  delete_intern_tbl(&intern);
+  yices_exit();
+
+  printf("all tests passed\n");
+
+  return 0;
+}
@@ -0,0 +1,222 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "yices.h"
+
+#define NUM_TERMS 6
+
+static term_t term[NUM_TERMS];
+
+static term_t new_var(type_t tau, const char *name) {
+  term_t t = yices_new_uninterpreted_term(tau);
+  yices_set_term_name(t, name);
+  return t;
+}
+
+static void build_terms(void) {
+  type_t u = yices_new_uninterpreted_type();
+  yices_set_type_name(u, "U");
+  type_t fun = yices_function_type1(u, yices_int_type());
+  type_t bv = yices_bv_type(20);
+  type_t bv100 = yices_bv_type(100);
+
+  term_t x = new_var(yices_int_type(), "x");
+  term_t y = new_var(yices_real_type(), "y");
+  term_t f = new_var(fun, "f");
+  term_t a = new_var(bv, "a");
+  term_t b = new_var(bv100, "b");
+  term_t z = yices_new_variable(yices_int_type());
+
+  term[0] = yices_arith_geq_atom(yices_add(yices_mul(x, yices_square(y)), yices_parse_rational("123456789012345678901234567890/7")), x);
+  term[1] = yices_neq(yices_application1(f, yices_constant(u, 0)), x);
+  term[2] = yices_bvge_atom(yices_bvshl(a, yices_bvconst_uint32(20, 5)), yices_bvmul(a, a));
+  term[3] = yices_bveq_atom(yices_bvadd(yices_bvsquare(b), yices_bvconst_uint32(100, 3)), b);
+  term[4] = yices_forall(1, &z, yices_arith_geq_atom(z, x));
+  term[5] = yices_ite(term[0], x, yices_floor(y));
+}
+
+/*
+ * Check whether u is equal to t, up to renaming of the bound variables
+ * - the archive doesn't keep the identity of variables so a quantified
+ *   term is rebuilt with fresh variables
+ */
+static bool same_term(term_t t, term_t u) {
+  term_t x[8], y[8];
+  int32_t i, n;
+
+  if (t == u) return true;
+  if (yices_term_constructor(t) != YICES_FORALL_TERM ||
+      yices_term_constructor(u) != YICES_FORALL_TERM) {
+    return false;
+  }
+  n = yices_term_num_children(t);
+  if (n != yices_term_num_children(u) || n > 8) {
+    return false;
+  }
+  n --; // the last child is the body
+  for (i=0; i<n; i++) {
+    x[i] = yices_term_child(t, i);
+    y[i] = yices_term_child(u, i);
+  }
+  return yices_subst_term(n, y, x, yices_term_child(u, n)) == yices_term_child(t, n);
+}
+
+static void test_save(const char *filename, uint32_t n, const term_t t[]) {
+  int32_t code;
+
+  code = yices_save_terms(filename, n, t);
+  printf("Save %"PRIu32" terms to '%s': got code %"PRId32"\n", n, filename, code);
+  if (code < 0) {
+    yices_print_error(stdout);
+  }
+  fflush(stdout);
+}
+
+static void test_load(const char *filename, uint32_t n, const term_t t[]) {
+  term_vector_t v;
+  int32_t code;
+  uint32_t i;
+
+  yices_init_term_vector(&v);
+  code = yices_load_terms(filename, &v);
+  printf("Load '%s': got code %"PRId32"\n", filename, code);
+  if (code < 0) {
+    yices_print_error(stdout);
+    if (v.size != 0) {
+      printf("BUG: vector not empty\n");
+      fflush(stdout);
+      exit(1);
+    }
+  } else {
+    // loading in the same term table must give back the same terms
+    if (v.size != n) {
+      printf("BUG: expected %"PRIu32" terms, got %"PRIu32"\n", n, v.size);
+      fflush(stdout);
+      exit(1);
+    }
+    for (i=0; i<n; i++) {
+      if (! same_term(t[i], v.data[i])) {
+        printf("BUG: loaded term %"PRIu32" differs from the original\n", i);
+        yices_pp_term(stdout, t[i], 100, 10, 2);
+        yices_pp_term(stdout, v.data[i], 100, 10, 2);
+        fflush(stdout);
+        exit(1);
+      }
+    }
+    printf("  %"PRIu32" terms loaded\n", n);
+  }
+  fflush(stdout);
+  yices_delete_term_vector(&v);
+}
+
+/*
+ * Corrupted archives with a valid checksum
+ * - the header is 24 bytes: magic number then five 32bit words
+ *   (little endian), the last one is the checksum of the records
+ * - we change each byte of the records, fix the checksum, and load
+ *   the result: this must not crash
+ */
+#define HEADER_SIZE 24
+
+static uint32_t checksum(const uint8_t *data, size_t n) {
+  uint32_t h;
+  size_t i;
+
+  h = 2166136261u;
+  for (i=0; i<n; i++) {
+    h ^= data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static void write_file(const char *filename, const uint8_t *data, size_t n) {
+  FILE *f;
+
+  f = fopen(filename, "w");
+  if (f == NULL || fwrite(data, 1, n, f) != n) {
+    printf("BUG: failed to write '%s'\n", filename);
+    fflush(stdout);
+    exit(1);
+  }
+  fclose(f);
+}
+
+static void test_corrupted(const char *filename) {
+  static const uint8_t delta[3] = { 1, 0x80, 0xff };
+  uint8_t data[4096];
+  uint8_t *p;
+  term_vector_t v;
+  FILE *f;
+  size_t n, i;
+  uint32_t j, c, ok, errors;
+
+  f = fopen(filename, "r");
+  if (f == NULL) {
+    printf("BUG: can't open '%s'\n", filename);
+    fflush(stdout);
+    exit(1);
+  }
+  n = fread(data, 1, sizeof(data), f);
+  fclose(f);
+  if (n <= HEADER_SIZE || n == sizeof(data)) {
+    printf("BUG: unexpected archive size\n");
+    fflush(stdout);
+    exit(1);
+  }
+
+  ok = 0;
+  errors = 0;
+  yices_init_term_vector(&v);
+  for (i=HEADER_SIZE; i<n; i++) {
+    for (j=0; j<3; j++) {
+      data[i] ^= delta[j];
+      c = checksum(data + HEADER_SIZE, n - HEADER_SIZE);
+      p = data + HEADER_SIZE - 4;
+      p[0] = (uint8_t) c;
+      p[1] = (uint8_t) (c >> 8);
+      p[2] = (uint8_t) (c >> 16);
+      p[3] = (uint8_t) (c >> 24);
+      write_file("corrupted.ytar", data, n);
+      if (yices_load_terms("corrupted.ytar", &v) < 0) {
+        if (yices_error_code() != ARCHIVE_FORMAT_ERROR) {
+          printf("BUG: unexpected error code\n");
+          yices_print_error(stdout);
+          fflush(stdout);
+          exit(1);
+        }
+        errors ++;
+      } else {
+        ok ++;
+      }
+      data[i] ^= delta[j];
+    }
+  }
+  yices_delete_term_vector(&v);
+  remove("corrupted.ytar");
+
+  printf("Corrupted archives: %"PRIu32" rejected, %"PRIu32" loaded\n", errors, ok);
+  fflush(stdout);
+}
+
+int main(void) {
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+  build_terms();
+
+  test_save("empty.ytar", 0, term);
+  test_load("empty.ytar", 0, term);
+
+  test_save("terms.ytar", NUM_TERMS, term);
+  test_load("terms.ytar", NUM_TERMS, term);
+  test_corrupted("terms.ytar");
+
+  test_save("/usr", NUM_TERMS, term);
+  test_load("/usr", 0, term);
+  test_load("no-such-file.ytar", 0, term);
+
+  yices_exit();
+  return 0;
+}
@@ -0,0 +1,185 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "yices.h"
+
+/*
+ * Symmetry breaking for arithmetic and bitvector variables:
+ * pigeon-hole formulas with N holes and N+1 pigeons.
+ */
+#define N 8
+
+static const char *status2string(smt_status_t status) {
+  switch (status) {
+  case STATUS_IDLE: return "idle";
+  case STATUS_SEARCHING: return "searching";
+  case STATUS_UNKNOWN: return "unknown";
+  case STATUS_SAT: return "sat";
+  case STATUS_UNSAT: return "unsat";
+  case STATUS_INTERRUPTED: return "interrupted";
+  default: return "error";
+  }
+}
+
+static void check(context_t *ctx, const char *name, smt_status_t expected) {
+  smt_status_t status;
+
+  status = yices_check_context(ctx, NULL);
+  printf("check %s: %s\n", name, status2string(status));
+  fflush(stdout);
+  if (status != expected) {
+    printf("BUG: expected %s\n", status2string(expected));
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static void assert_formulas(context_t *ctx, uint32_t n, term_t *a) {
+  if (yices_assert_formulas(ctx, n, a) < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+// check that f is true in the current model of ctx
+static void check_model(context_t *ctx, term_t f) {
+  model_t *mdl;
+
+  mdl = yices_get_model(ctx, true);
+  if (mdl == NULL || yices_formula_true_in_model(mdl, f) != 1) {
+    printf("BUG: formula false in the model\n");
+    fflush(stdout);
+    exit(1);
+  }
+  yices_free_model(mdl);
+}
+
+static context_t *new_context(const char *logic, const char *mode) {
+  ctx_config_t *config;
+  context_t *ctx;
+
+  config = yices_new_config();
+  yices_default_config_for_logic(config, logic);
+  yices_set_config(config, "mode", mode);
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+  if (ctx == NULL || yices_context_enable_option(ctx, "break-symmetries") < 0) {
+    yices_print_error(stdout);
+    fflush(stdout);
+    exit(1);
+  }
+
+  return ctx;
+}
+
+/*
+ * Variables x[0 ... n-1] are in the range [lo, hi] and distinct
+ * - if bv is true, they are bitvectors (unsigned comparisons)
+ */
+static void assert_pigeon_hole(context_t *ctx, term_t *x, uint32_t n, int32_t lo, int32_t hi, bool bv) {
+  term_t a[2*(N+1)+1];
+  uint32_t i, k;
+
+  k = 0;
+  for (i=0; i<n; i++) {
+    if (bv) {
+      a[k++] = yices_bvge_atom(x[i], yices_bvconst_int32(4, lo));
+      a[k++] = yices_bvle_atom(x[i], yices_bvconst_int32(4, hi));
+    } else {
+      a[k++] = yices_arith_geq_atom(x[i], yices_int32(lo));
+      a[k++] = yices_arith_leq_atom(x[i], yices_int32(hi));
+    }
+  }
+  a[k++] = yices_distinct(n, x);
+  assert_formulas(ctx, k, a);
+}
+
+// check that x[0] < ... < x[n-1] in the model (for integer variables)
+static void check_sorted(context_t *ctx, term_t *x, uint32_t n) {
+  model_t *mdl;
+  int32_t v, prev;
+  uint32_t i;
+
+  mdl = yices_get_model(ctx, true);
+  prev = INT32_MIN;
+  for (i=0; i<n; i++) {
+    if (yices_get_int32_value(mdl, x[i], &v) < 0 || v <= prev) {
+      printf("BUG: symmetries were not broken\n");
+      fflush(stdout);
+      exit(1);
+    }
+    prev = v;
+  }
+  yices_free_model(mdl);
+}
+
+int main(void) {
+  context_t *ctx;
+  term_t x[N+1];
+  term_t f;
+  uint32_t i;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  for (i=0; i<=N; i++) {
+    x[i] = yices_new_uninterpreted_term(yices_int_type());
+  }
+
+  // one-shot: N+1 pigeons
+  ctx = new_context("QF_LIA", "one-shot");
+  assert_pigeon_hole(ctx, x, N+1, 1, N, false);
+  check(ctx, "integer pigeon-hole", STATUS_UNSAT);
+  yices_free_context(ctx);
+
+  // one-shot: N pigeons, the ordering constraints are x[0] <= ... <= x[N-1]
+  ctx = new_context("QF_LIA", "one-shot");
+  assert_pigeon_hole(ctx, x, N, 1, N, false);
+  check(ctx, "integer holes", STATUS_SAT);
+  check_sorted(ctx, x, N);
+  yices_free_context(ctx);
+
+  // push-pop: the ordering constraints are guarded
+  ctx = new_context("QF_LIA", "push-pop");
+  assert_pigeon_hole(ctx, x, N, 1, N, false);
+  check(ctx, "integer holes", STATUS_SAT);
+
+  // this is not invariant by permutation of x
+  f = yices_arith_eq_atom(x[0], yices_int32(N));
+  assert_formulas(ctx, 1, &f);
+  check(ctx, "first pigeon in the last hole", STATUS_SAT);
+  check_model(ctx, f);
+
+  yices_push(ctx);
+  f = yices_arith_eq_atom(x[1], yices_int32(1));
+  assert_formulas(ctx, 1, &f);
+  check(ctx, "second pigeon in the first hole", STATUS_SAT);
+  check_model(ctx, f);
+  yices_pop(ctx);
+  yices_free_context(ctx);
+
+  // bitvectors
+  for (i=0; i<=N; i++) {
+    x[i] = yices_new_uninterpreted_term(yices_bv_type(4));
+  }
+  ctx = new_context("QF_BV", "one-shot");
+  assert_pigeon_hole(ctx, x, N+1, 1, N, true);
+  check(ctx, "bitvector pigeon-hole", STATUS_UNSAT);
+  yices_free_context(ctx);
+
+  ctx = new_context("QF_BV", "push-pop");
+  assert_pigeon_hole(ctx, x, N, 1, N, true);
+  check(ctx, "bitvector holes", STATUS_SAT);
+  f = yices_bveq_atom(x[0], yices_bvconst_int32(4, N));
+  assert_formulas(ctx, 1, &f);
+  check(ctx, "first pigeon in the last hole", STATUS_SAT);
+  check_model(ctx, f);
+  yices_free_context(ctx);
+
+  yices_exit();
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "yices.h"
+
+static void check(bool cond, const char *msg) {
+  if (!cond) {
+    printf("BUG: %s\n", msg);
+    fflush(stdout);
+    exit(1);
+  }
+}
+
+static void show_stats(void) {
+  yices_gc_stats_t stats;
+
+  yices_get_gc_stats(&stats);
+  printf("gc stats: full = %"PRIu32", young = %"PRIu32", terms = %"PRIu64", types = %"PRIu64", bytes = %"PRIu64"\n",
+         stats.full_collections, stats.young_collections, stats.terms_reclaimed,
+         stats.types_reclaimed, stats.bytes_reclaimed);
+  printf("terms: %"PRIu32" (young: %"PRIu32")\n", yices_num_terms(), yices_num_young_terms());
+  fflush(stdout);
+}
+
+int main(void) {
+  yices_gc_stats_t stats;
+  context_t *ctx;
+  term_t x, y, old, asserted, kept, tmp;
+  uint32_t i, n;
+
+  printf("Testing Yices %s (%s, %s)\n", yices_version, yices_build_arch, yices_build_mode);
+  yices_init();
+
+  x = yices_new_uninterpreted_term(yices_int_type());
+  yices_set_term_name(x, "x");
+  y = yices_new_uninterpreted_term(yices_int_type());
+  yices_set_term_name(y, "y");
+  old = yices_arith_gt_atom(yices_mul(x, y), yices_zero());
+  yices_incref_term(old);
+
+  // everything that survives this collection becomes old
+  yices_garbage_collect(NULL, 0, NULL, 0, true);
+  check(yices_num_young_terms() == 0, "young terms after full collection");
+  show_stats();
+
+  ctx = yices_new_context(NULL);
+  asserted = yices_arith_lt_atom(x, yices_int32(100));
+  yices_assert_formula(ctx, asserted);
+  kept = yices_or2(old, yices_arith_eq_atom(x, yices_int32(-1)));
+
+  // garbage
+  for (i=0; i<100; i++) {
+    tmp = yices_arith_geq_atom(yices_add(x, yices_int32(i)), y);
+    check(tmp >= 0, "term construction");
+  }
+  n = yices_num_terms();
+  check(yices_num_young_terms() > 100, "young terms");
+  show_stats();
+
+  // young collection: roots = context + kept + refcounts + names
+  yices_decref_term(old);
+  yices_garbage_collect_young(&kept, 1, true);
+  show_stats();
+  check(yices_num_terms() < n, "young garbage not collected");
+  check(yices_num_young_terms() == 0, "young terms after young collection");
+  check(yices_term_is_bool(old), "old term deleted");
+  check(yices_term_is_bool(asserted), "asserted term deleted");
+  check(yices_term_is_bool(kept), "root term deleted");
+  check(yices_get_term_by_name("x") == x, "named term deleted");
+
+  yices_get_gc_stats(&stats);
+  check(stats.young_collections == 1 && stats.full_collections == 1, "collection counts");
+  check(stats.terms_reclaimed >= 100, "reclaimed terms");
+
+  // a full collection can now delete old
+  yices_garbage_collect(NULL, 0, NULL, 0, true);
+  show_stats();
+
+  yices_free_context(ctx);
+  yices_exit();
+
+  return 0;
+}